@@ -452,6 +452,7 @@
   //#define DIRECT_MIXING_IN_G1    // Allow ABCDHI mix factors in G1 movement commands
   //#define GRADIENT_MIX           // Support for gradient mixing with M166 and LCD
   //#define MIXING_PRESETS         // Assign 8 default V-tool presets for 2 or 3 MIXING_STEPPERS
+  //#define MIXER_STEP_PATTERN 100 // Build a table of this many E steps when the mix changes, so each E step is one lookup
   #if ENABLED(GRADIENT_MIX)
     //#define GRADIENT_VTOOL       // Add M166 T to use a V-tool index as a Gradient alias
   #endif
@@ -807,12 +808,13 @@
  *
  * Use a physical model of the hotend to control temperature. When configured correctly this gives
  * better responsiveness and stability than PID and removes the need for PID_EXTRUSION_SCALING
- * and PID_FAN_SCALING. Use M306 T to autotune the model.
+ * and PID_FAN_SCALING. Use M306 T to autotune the model (requires MPC_AUTOTUNE).
  * @section mpctemp
  */
 #if ENABLED(MPCTEMP)
   //#define MPC_EDIT_MENU                             // Add MPC editing to the "Advanced Settings" menu. (~1.3K bytes of flash)
   //#define MPC_AUTOTUNE_MENU                         // Add MPC auto-tuning to the "Advanced Settings" menu. (~350 bytes of flash)
+  #define MPC_AUTOTUNE                                // Include M306 T auto-tuning. Disable to save flash and set the model with M306 instead.
 
   #define MPC_MAX 255                                 // (0..255) Current to nozzle while MPC is active.
   #define MPC_HEATER_POWER { 40.0f }                  // (W) Heat cartridge powers.
@@ -1049,6 +1051,14 @@
   // and processor overload (too many expensive sqrt calls).
   #define DEFAULT_SEGMENTS_PER_SECOND 200
 
+  // Reduce the sqrt calls by computing the kinematics only at the ends and middle of
+  // each span of segments, and fitting a parabola for the tower positions in between.
+  //#define DELTA_IK_INTERPOLATION
+  #if ENABLED(DELTA_IK_INTERPOLATION)
+    #define DELTA_IK_SPAN_SEGMENTS 8      // Segments per fitted span
+    #define DELTA_IK_MAX_DEVIATION 0.02   // (mm) Use full kinematics in spans where a tower strays this far from a straight line
+  #endif
+
   // After homing move down to a height where XY movement is unconstrained
   //#define DELTA_HOME_TO_SAFE_ZONE
 
@@ -1063,6 +1073,9 @@
   #if ENABLED(DELTA_AUTO_CALIBRATION)
     // Default number of probe points : n*n (1 -> 7)
     #define DELTA_CALIBRATION_DEFAULT_POINTS 4
+
+    // Reuse the convergence factors while the radius and tower angles stay within 0.5mm / 0.5°
+    //#define DELTA_CALIBRATION_REUSE_FACTORS
   #endif
 
   #if EITHER(DELTA_AUTO_CALIBRATION, DELTA_CALIBRATION_MENU)
@@ -1330,6 +1343,8 @@
 
 // Enable this feature if all enabled endstop pins are interrupt-capable.
 // This will remove the need to poll the interrupt pins, saving many CPU cycles.
+// Not for the i3 Mega: Y (D42) and Z2 (D43) are on port L, which has no interrupts.
+// Without it the pins are only read at 1kHz while homing or probing enables them.
 //#define ENDSTOP_INTERRUPTS_FEATURE
 
 /**
@@ -1595,6 +1610,9 @@
 
   #define JD_HANDLE_SMALL_SEGMENTS    // Use curvature estimation instead of just the junction angle
                                       // for small segments (< 1mm) with large junction angles (> 135°).
+  #if ENABLED(JD_HANDLE_SMALL_SEGMENTS)
+    //#define JD_CURVE_WINDOW 4         // Estimate the curvature over this many small segments for smoother speed on curves
+  #endif
 #endif
 
 /**
@@ -2228,6 +2246,12 @@
 
 //#define Z_AFTER_HOMING  10      // (mm) Height to move to after homing Z
 
+//#define Z_HOMING_FAST_DESCENT   // Drop quickly to just above the last known Z position before homing Z
+#if ENABLED(Z_HOMING_FAST_DESCENT)
+  #define Z_HOMING_FAST_FEEDRATE (10*60) // (mm/min) Feedrate for the drop, with endstops on
+  #define Z_HOMING_FAST_MARGIN       5   // (mm) Start the normal homing approach this far above the last known Z home
+#endif
+
 // Direction of endstops when homing; 1=MAX, -1=MIN
 // :[-1,1]
 #define X_HOME_DIR -1
@@ -2435,6 +2459,12 @@
     // as the filament moves. (Be sure to set FILAMENT_RUNOUT_DISTANCE_MM
     // large enough to avoid false positives.)
     //#define FILAMENT_MOTION_SENSOR
+
+    // Count the E steps taken since the last check instead of adding up
+    // each finished block. Runout and motion-sensor jams are caught within
+    // a few mm, even during long extrusions, and the stepper ISR does no
+    // float math for the sensor.
+    //#define FILAMENT_RUNOUT_STEP_TRACKING
   #endif
 #endif
 
@@ -2818,6 +2848,21 @@
 #if ENABLED(EEPROM_SETTINGS)
   #define EEPROM_AUTO_INIT    // Init EEPROM automatically on any errors.
   //#define EEPROM_INIT_NOW   // Init EEPROM on first boot after a new build.
+  //#define EEPROM_DIFF_SAVE  // Compare before saving. Skip the write when nothing changed.
+  //#define EEPROM_FAST_VALIDATE // Validate with one raw CRC read instead of a full dry-run load
+  //#define EEPROM_WEAR_LEVELING // Rotate saves over several copies of the settings. The newest valid copy is loaded.
+  #if ENABLED(EEPROM_WEAR_LEVELING)
+    #define EEPROM_WEAR_SLOTS 2 // Number of settings copies. Each takes EEPROM space from the mesh slots.
+  #endif
+  //#define EEPROM_PAGE_WRITE // External I2C/SPI EEPROM: Write changed bytes in page bursts and poll for write completion
+  #if ENABLED(EEPROM_PAGE_WRITE)
+    #define EEPROM_PAGE_SIZE 16 // Bytes per burst. A power of 2 no larger than the chip's page size.
+  #endif
+  //#define SDCARD_EEPROM_EXTENSION // AVR: Extend the EEPROM with a file on the SD card. Settings stay in the EEPROM, meshes go to the card.
+  #if ENABLED(SDCARD_EEPROM_EXTENSION)
+    #define SDCARD_EEPROM_EXTENSION_BLOCKS 32 // Size of the file in 512-byte blocks
+  #endif
+  //#define EEPROM_IMAGE      // M505 prints the stored settings and meshes as M505 lines that write them back when sent to a printer with the same firmware
 #endif
 
 // @section host
@@ -3791,6 +3836,7 @@
 
 #if ENABLED(TFT_COLOR_UI)
   //#define TFT_SHARED_IO    // SPI is shared between TFT display and other devices. Disable async data transfer
+  //#define TFT_CANVAS_CACHE // Skip redrawing screen areas whose content hasn't changed since they were last sent
 #endif
 
 #if ENABLED(TFT_LVGL_UI)
@@ -4022,3 +4068,7 @@
 
 // Disable servo with M282 to reduce power consumption, noise, and heat when not in use
 // #define SERVO_DETACH_GCODE
+
+// AVR: Pulse servos from a compare match on the millis() timer (Timer 0) instead of
+// taking a 16-bit timer. Frees Timer 4 for PWM. Pulse widths have 4us resolution.
+//#define SERVO_SHARED_TIMER
@@ -394,6 +394,29 @@
   //#define THERMAL_PROTECTION_VARIANCE_MONITOR   // Detect a sensor malfunction preventing temperature updates
 #endif
 
+#if ENABLED(THERMAL_PROTECTION_HOTENDS)
+  /**
+   * Thermal Protection Model - EXPERIMENTAL.
+   * Predict each hotend temperature from the heater power and part fan duty with
+   * a simple heat balance, and halt when the measured temperature keeps leaving
+   * the prediction. The fan is part of the model, so a fan going to 100% doesn't
+   * trigger it, while a dead heater, a loose thermistor, or a heater stuck on is
+   * caught within a few windows, even with no target set.
+   * With MPCTEMP the MPC constants (M306) are used instead of these.
+   */
+  //#define THERMAL_PROTECTION_MODEL
+  #if ENABLED(THERMAL_PROTECTION_MODEL)
+    #define TP_MODEL_HEATER_POWER  { 40.0f }  // (W) Heat cartridge powers
+    #define TP_MODEL_HEAT_CAPACITY { 16.7f }  // (J/K) Heat block heat capacities
+    #define TP_MODEL_XFER_FAN0     { 0.068f } // (W/K) Heat loss to room air with the fan off
+    #define TP_MODEL_XFER_FAN255   { 0.097f } // (W/K) Heat loss to room air with the fan on full
+    #define TP_MODEL_AMBIENT       25         // (°C) Room temperature
+    #define TP_MODEL_WINDOW         5         // (seconds) Length of each prediction
+    #define TP_MODEL_RESIDUAL      10         // (°C) Allowed error at the end of a window
+    #define TP_MODEL_STRIKES        3         // Consecutive bad windows before halting
+  #endif
+#endif
+
 #if ENABLED(PIDTEMP)
   // Add an additional term to the heater power, proportional to the extrusion speed.
   // A well-chosen Kc value should add just enough power to melt the increased material volume.
@@ -403,6 +426,20 @@
     #define LPQ_MAX_LEN 50
   #endif
 
+  /**
+   * Add heater power ahead of the flow the queued moves will demand.
+   * The moves in the planner buffer are averaged into a volumetric rate,
+   * so power rises as a high-flow section is planned, not after it starts.
+   * Kv is the power needed per mm³/s, roughly the energy to heat 1mm³ of
+   * filament to printing temperature (about 0.45 J/mm³ for PLA at 210°C).
+   * Set it per hotend with M301 E<hotend> V<Kv>.
+   */
+  //#define PID_FLOW_FEEDFORWARD
+  #if ENABLED(PID_FLOW_FEEDFORWARD)
+    #define DEFAULT_Kv 0.0                // (W per mm³/s) Heater power per unit of flow
+    #define PID_FLOW_HEATER_WATTS 40      // (W) Heater power at full PWM, to convert watts to PID output
+  #endif
+
   /**
    * Add an additional term to the heater power, proportional to the fan speed.
    * A well-chosen Kf value should add just enough power to compensate for power-loss from the cooling fan.
@@ -454,6 +491,17 @@
   #endif
 #endif
 
+/**
+ * Fixed-point PID
+ * Run the hotend, bed and chamber PID loops in integer math, which is much
+ * lighter than float math on 8-bit MCUs. Anti-windup and PID_FUNCTIONAL_RANGE
+ * behave as before, and the output tracks the float loop to within a fraction
+ * of a power step. Gains are still stored and reported as floats.
+ */
+#if ANY(PIDTEMP, PIDTEMPBED, PIDTEMPCHAMBER)
+  //#define PID_FIXED_POINT
+#endif
+
 /**
  * Automatic Temperature Mode
  *
@@ -552,6 +600,101 @@
 #define TEMP_SENSOR_AD8495_OFFSET 0.0
 #define TEMP_SENSOR_AD8495_GAIN   1.0
 
+/**
+ * Direct-indexed thermistor tables
+ * Resample each thermistor table at compile time onto a uniform grid over the
+ * raw ADC range, stored in PROGMEM as 1/16 °C integers. Conversions then skip the
+ * table bisect and float divide. Each table takes 2 * (2^BITS + 1) bytes of flash.
+ * The worst error below 275°C with the EPCOS (1) and 5 tables is about 1°C
+ * at 8 bits and 0.5°C at 9 bits. Custom (1000) thermistors are not affected.
+ */
+//#define THERMISTOR_DIRECT_TABLES
+#if ENABLED(THERMISTOR_DIRECT_TABLES)
+  #define THERMISTOR_DIRECT_TABLE_BITS 8  // (6-10) Grid of 2^BITS steps
+#endif
+
+/**
+ * ADC sample filter
+ * Pass each raw ADC sample through a short sliding median before it is summed,
+ * so single-sample spikes from a noisy board never reach the reading. With the
+ * spikes gone fewer samples are needed, so each reading can sum a fraction of
+ * the usual 16 samples and temperatures update DECIMATE times more often.
+ * Readings keep the same scale, so tables and raw limits are unaffected.
+ */
+//#define TEMP_ADC_FILTER
+#if ENABLED(TEMP_ADC_FILTER)
+  #define TEMP_ADC_MEDIAN_HOTEND 3  // Median taps for hotend sensors: 1 (off), 3, or 5
+  #define TEMP_ADC_MEDIAN_BED    3  // Median taps for the bed sensor: 1 (off), 3, or 5
+  #define TEMP_ADC_MEDIAN_OTHER  1  // Median taps for chamber, probe, cooler, board, and redundant sensors
+  #define TEMP_ADC_DECIMATE      2  // Readings per 16 samples: 1, 2, or 4
+#endif
+
+/**
+ * ADC auto sequence (AVR only)
+ * Let Timer 0 trigger the ADC and sample each temperature sensor in turn from
+ * the ADC interrupt, instead of stepping through the sensors from the
+ * temperature ISR. A full set of readings arrives every 16ms per sensor (about
+ * 33ms for hotend + bed) instead of every 164ms. PID and MPC run at this rate.
+ * Not for use with other ADC inputs, such as joysticks or ADC keypads.
+ */
+//#define ADC_AUTO_SEQUENCE
+
+/**
+ * Interleave bed and hotend PWM
+ * Normally every heater turns on at the start of each soft PWM cycle. With this
+ * option the bed on-phase is moved to the end of the cycle instead, so the bed
+ * and hotends only overlap when their duty cycles add up to more than 100%.
+ * This lowers the peak current drawn from the PSU, and so the voltage dips
+ * that can make the steppers skip. Has no effect with SLOW_PWM_HEATERS.
+ */
+//#define HEATER_PWM_INTERLEAVE
+
+/**
+ * Hardware PWM for heaters (AVR)
+ * Drive a heater from a timer output instead of the soft PWM in the temperature
+ * ISR. The duty cycle then keeps its full 127 steps at any SOFT_PWM_SCALE and
+ * doesn't jitter with ISR load. Heaters not enabled here keep using soft PWM.
+ * On the i3 Mega the hotend (D10) is on Timer 2, which SPEAKER also needs, and
+ * the bed (D8) is on Timer 4, which servos (BLTouch) also need.
+ * Keep the frequency low. The MOSFETs have no gate driver and run warm when
+ * switched fast, and a bed SSR may not follow at all. Timer 2 can't go below 30Hz.
+ */
+//#define HEATER_HW_PWM
+#if ENABLED(HEATER_HW_PWM)
+  #define HW_PWM_HOTEND                 // Hotend 0 on its timer output
+  //#define HW_PWM_BED                  // Bed on its timer output
+  #define HEATER_HW_PWM_FREQUENCY 30    // (Hz) Timer frequency for the heater pins
+#endif
+
+/**
+ * Heater power budget
+ * Limit the combined power of the hotends and bed. When both heat up together,
+ * the hotends get the power they ask for and the bed gets whatever is left.
+ * The hotends reach temperature in a fraction of the bed's time, then the full
+ * budget goes to the bed. Use this for a PSU that can't run all heaters at once.
+ */
+//#define HEATER_POWER_BUDGET
+#if ENABLED(HEATER_POWER_BUDGET)
+  #define HEATER_BUDGET_WATTS        180      // (W) Total allowed heater power
+  #define HEATER_BUDGET_HOTEND_WATTS { 40 }   // (W) Hotend heater powers
+  #define HEATER_BUDGET_BED_WATTS    160      // (W) Bed heater power
+#endif
+
+/**
+ * Parallel preheat with M194 S<hotend> B<bed>
+ * Heat the hotend and bed together so both reach their targets at the same
+ * time. The heater that needs longer starts first and the other one waits until
+ * its predicted time-to-target matches, then M194 waits like M109 and M190.
+ * Each prediction starts from the rate below and then follows the measured
+ * heating rate. With MPCTEMP the hotend uses the MPC model instead.
+ * The ETA of each heater goes to the host once per second.
+ */
+//#define PARALLEL_PREHEAT
+#if ENABLED(PARALLEL_PREHEAT)
+  #define PREHEAT_HOTEND_RATE 2.0   // (°C/s) Initial hotend heating rate
+  #define PREHEAT_BED_RATE    0.5   // (°C/s) Initial bed heating rate
+#endif
+
 // @section fans
 
 /**
@@ -593,6 +736,13 @@
 // Some coolers may require a non-zero "off" state.
 //#define FAN_OFF_PWM  1
 
+/**
+ * Apply each move's M106/M107 fan speeds in the stepper ISR as the move starts,
+ * without the sync blocks of LASER_SYNCHRONOUS_M106_M107. A fan kickstart ends
+ * at the first move that starts after FAN_KICKSTART_TIME.
+ */
+//#define FAN_SPEED_AT_BLOCK_START
+
 /**
  * PWM Fan Scaling
  *
@@ -925,6 +1075,7 @@
 // #define XY_COUNTERPART_BACKOFF_MM 0         // (mm) Backoff X after homing Y, and vice-versa
 
 //#define QUICK_HOME                          // If G28 contains XY do a diagonal move first
+//#define PARALLEL_XY_HOMING                  // If G28 contains XY home them together, each stopping at its own endstop
 //#define HOME_Y_BEFORE_X                     // If G28 contains XY home Y before X
 //#define HOME_Z_FIRST                        // Home Z first. Requires a real endstop (not a probe).
 //#define CODEPENDENT_XY_HOMING               // If X/Y can't home without homing Y/X first
@@ -998,6 +1149,13 @@
    */
   #define BLTOUCH_HS_MODE false
 
+  /**
+   * In HIGH SPEED mode, send the RESET after each probe point without waiting,
+   * so the reset delay runs during the travel to the next point. The probe waits
+   * for it to finish before the next descent. Not used with PROBE_TRAVEL_OVERLAP.
+   */
+  //#define BLTOUCH_ASYNC_RESET
+
 
 #endif // BLTOUCH
 
@@ -1054,6 +1212,11 @@
     // Amplification factor. Used to scale the correction step up or down in case
     // the stepper (spindle) position is farther out than the test point.
     #define Z_STEPPER_ALIGN_AMP 1.0       // Use a value > 1.0 NOTE: This may cause instability!
+
+    // Fit the bed's response to each correction and use it for the next one.
+    // The fitted factor is kept for the next G34 until reboot. Replaces the
+    // second iteration's per-stepper guess.
+    //#define Z_STEPPER_ALIGN_LEARN_AMP
   #endif
 
   // On a 300mm bed a 5% grade would give a misalignment of ~1.5cm
@@ -1134,6 +1297,8 @@
   #endif
   //#define SHAPING_MIN_FREQ  20        // By default the minimum of the shaping frequencies. Override to affect SRAM usage.
   //#define SHAPING_MAX_STEPRATE 10000  // By default the maximum total step rate of the shaped axes. Override to affect SRAM usage.
+  //#define SHAPING_QUEUE_DEPTH 200    // Override the step buffer size (entries shared by X and Y). Steps are echoed early when it fills.
+  //#define SHAPING_COMPACT_QUEUE       // Store 8-bit delta times and packed echoes, half the SRAM per entry. For 8-bit MCUs.
   //#define SHAPING_MENU                // Add a menu to the LCD to set shaping parameters.
 #endif
 
@@ -1221,6 +1386,10 @@
   // to reduce print artifacts. (Enabling this is costly in memory and computation!)
   //#define BACKLASH_SMOOTHING_MM 3 // (mm)
 
+  // Take up backlash with a short move of its own ahead of each reversing move,
+  // instead of adding the steps to the move. The move keeps its speed profile.
+  //#define BACKLASH_TAKEUP_MOVE
+
   // Add runtime configuration and tuning of backlash values (M425)
   //#define BACKLASH_GCODE
 
@@ -1316,6 +1485,40 @@
  */
 //#define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Step Rate Table
+ * Have the planner sample the S-curve speed of each acceleration and deceleration ramp into a table
+ * of step rates, one for each equal slice of the ramp time. The Stepper ISR then steps through the
+ * table instead of evaluating the Bézier curve, and only converts a rate into a timer interval when
+ * the slice changes. This frees ISR cycles and raises the maximum step frequency. Each ramp becomes
+ * a staircase of small speed changes, so use enough entries to keep each change below the jerk limit.
+ * Requires S_CURVE_ACCELERATION. Uses 4 bytes of SRAM per entry per planner block, plus 8 bytes.
+ */
+//#define STEP_RATE_TABLE
+#if ENABLED(STEP_RATE_TABLE)
+  #define STEP_RATE_TABLE_SIZE 8  // Entries per acceleration and deceleration ramp
+#endif
+
+/**
+ * Adaptive Multistepping
+ * Multistepping (2x, 4x, ... steps per ISR) begins at step rates estimated at compile time.
+ * Adjust those limits from the Stepper ISR load measured during each block: lower them if the
+ * ISR is too busy, raise them if a block used multistepping with time to spare. A higher factor
+ * is kept until the rate drops 1/8 below its limit, so the factor doesn't toggle between steps.
+ * Use 'M579' to report step events done at each factor and 'M579 R' to reset.
+ */
+//#define ADAPTIVE_MULTISTEPPING
+
+/**
+ * Fused Step Ports
+ * On AVR, pulse all the step pins that share a port with one write to the
+ * port's PIN register, instead of a separate read-modify-write per stepper.
+ * On the i3 Mega X and Y step share PORTF, and Z/Z2 step pins on PORTL need no
+ * read-modify-write. Use ISR_PROFILER (M578) to compare the pulse phase timing.
+ * Needs a plain XYZ(E) machine with a single extruder.
+ */
+//#define FUSED_STEP_PORTS
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1534,6 +1737,13 @@
   #endif
 #endif
 
+/**
+ * Estimate the time left in an SD print from the print itself: the time spent moving
+ * per file byte so far, applied to the bytes remaining, plus the moves in the planner.
+ * Reported by M27 and M73, and shown in place of the progress-based estimate until M73 R is given.
+ */
+//#define ESTIMATE_REMAINING_TIME
+
 // LCD Print Progress options. Multiple times may be displayed in turn.
 #if HAS_DISPLAY && EITHER(SDSUPPORT, SET_PROGRESS_MANUALLY)
   #define SHOW_PROGRESS_PERCENT           // Show print progress percentage (doesn't affect progress bar)
@@ -1568,14 +1778,50 @@
    */
   //#define SD_SPI_SPEED SPI_HALF_SPEED
 
+  /**
+   * At mount, read block 0 repeatedly at each SPI rate from SD_SPI_SPEED down
+   * and keep the fastest rate whose reads all match a slow reference read.
+   * Helps cheap cards and long cables that fail at full speed.
+   */
+  //#define SD_SPI_AUTOTUNE
+  #if ENABLED(SD_SPI_AUTOTUNE)
+    #define SD_SPI_AUTOTUNE_READS 8   // Reads that must match at each rate
+  #endif
+
   // The standard SD detect circuit reads LOW when media is inserted and HIGH when empty.
   // Enable this option and set to HIGH if your SD cards are incorrectly detected.
   //#define SD_DETECT_STATE HIGH
 
   //#define SD_IGNORE_AT_STARTUP            // Don't mount the SD card when starting up
+  //#define SD_STREAMING_READ               // Read sequential blocks with one multi-block command (CMD18) for faster SD printing
+  //#define SD_STREAMING_WRITE              // Write sequential blocks with one multi-block command (CMD25) and pre-erase for faster uploads
+  //#define SD_READ_AHEAD                   // Read the next block of the print file during idle(). Report stalls with M27. Uses 1K of SRAM.
+  //#define SD_EXTENT_CACHE                 // Remember the cluster runs of the open file so seeks and cluster changes skip FAT walks
+  #if ENABLED(SD_EXTENT_CACHE)
+    #define SD_EXTENT_CACHE_SIZE 16       // Number of runs (6 bytes each). A defragmented file needs only one.
+    //#define SD_EXTENT_PREFETCH            // At job start list the runs of the whole file in idle time (e.g., during heat-up). Requires BACKGROUND_TASKS.
+  #endif
+  //#define SD_DIR_INDEX                    // Remember where each item of the current folder starts for fast file list paging
+  #if ENABLED(SD_DIR_INDEX)
+    #define SD_DIR_INDEX_SIZE 64          // Number of items indexed (2 bytes each). Later items are found by scanning.
+  #endif
+  //#define SD_NAME_CACHE                   // Keep the names of recently listed items so paging through folders doesn't read the card
+  #if ENABLED(SD_NAME_CACHE)
+    #define SD_NAME_CACHE_SIZE 4          // Number of items kept (about 90 bytes each)
+  #endif
+  //#define SD_QUIET_WRITES                 // Hold periodic power-loss saves until the planner is full and the print is read ahead. Report with M27.
+  #if ENABLED(SD_QUIET_WRITES)
+    #define SD_QUIET_MAX_WAIT 5000        // (ms) Longest time a write may be held
+  #endif
   //#define SDCARD_READONLY                 // Read-only SD card (to save over 2K of flash)
 
   #define GCODE_REPEAT_MARKERS              // Enable G-code M808 to set repeat markers and do looping
+  #if ENABLED(GCODE_REPEAT_MARKERS)
+    //#define GCODE_REPEAT_CACHE              // Keep a short M808 loop body in RAM so repeats don't re-read the card
+    #if ENABLED(GCODE_REPEAT_CACHE)
+      #define GCODE_REPEAT_CACHE_SIZE 256     // (bytes) Longest loop body to keep, with a null per line
+    #endif
+  #endif
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
@@ -1625,6 +1871,15 @@
     // especially with "vase mode" printing. Set too high and vases cannot be continued.
     #define POWER_LOSS_MIN_Z_CHANGE 0.05 // (mm) Minimum Z change before saving power-loss data
 
+    // Save to a ring of raw blocks in a pre-allocated file instead of rewriting the file.
+    // Each save is a single block write with no FAT update. The newest good record is resumed.
+    // With a POWER_LOSS_PIN the state stays in RAM and the journal is opened when the print
+    // starts, so the only write during printing is one block at the moment of the outage.
+    //#define POWER_LOSS_JOURNAL
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      #define POWER_LOSS_JOURNAL_SLOTS 8  // Records in the ring (512 bytes each)
+    #endif
+
     // Enable if Z homing is needed for proper recovery. 99.9% of the time this should be disabled!
     //#define POWER_LOSS_RECOVER_ZHOME
     #if ENABLED(POWER_LOSS_RECOVER_ZHOME)
@@ -1668,6 +1923,10 @@
     #define SDSORT_DYNAMIC_RAM false  // Use dynamic allocation (within SD menus). Least expensive option. Set SDSORT_LIMIT before use!
     #define SDSORT_CACHE_VFATS 2      // Maximum number of 13-byte VFAT entries to use for sorting.
                                       // Note: Only affects SCROLL_LONG_FILENAMES with SDSORT_CACHE_NAMES but not SDSORT_DYNAMIC_RAM.
+    //#define SDSORT_ON_MEDIA           // Sort folders over SDSORT_LIMIT items in batches and save the order in SORTIDX.DAT on the media
+    #if ENABLED(SDSORT_ON_MEDIA)
+      #define SDSORT_MEDIA_BATCH 8    // Names held per pass over the folder (on the stack). Larger is faster.
+    #endif
   #endif
 
   // Allow international symbols in long filenames. To display correctly, the
@@ -1736,6 +1995,10 @@
       #define USB_CS_PIN    SDSS
       #define USB_INTR_PIN  SD_DETECT_PIN
     #endif
+
+    // Read this many blocks in one USB transfer when a file is read in order,
+    // and serve the rest from RAM. Uses 512 bytes of SRAM per block.
+    //#define USB_READ_AHEAD_BLOCKS 8
   #endif
 
   /**
@@ -1804,6 +2067,20 @@
  */
 //#define NO_SD_HOST_DRIVE   // Disable SD Card access over USB (for security).
 
+/**
+ * SPI Flash Job Storage
+ * Store a job uploaded over serial or network in the onboard SPI flash and
+ * print it from there, with sequential page reads and no file system.
+ * Each new job starts after the previous one, so erases move across the region.
+ *  M590 stores the following lines until M591. M592 prints the stored job. M592 S0 stops.
+ * Requires SPI_FLASH. Keep the region clear of any UI assets in the same chip.
+ */
+//#define FLASH_JOB_STORAGE
+#if ENABLED(FLASH_JOB_STORAGE)
+  #define FLASH_JOB_START 0xC00000    // Flash address of the region. A multiple of 4096.
+  #define FLASH_JOB_SIZE  0x400000    // Bytes in the region. A multiple of 4096.
+#endif
+
 /**
  * Additional options for Graphical Displays
  *
@@ -1882,6 +2159,14 @@
   //#define STATUS_FAN_FRAMES 3       // :[0,1,2,3,4] Number of fan animation frames
   //#define STATUS_HEAT_PERCENT       // Show heating in a progress bar
   //#define BOOT_MARLIN_LOGO_ANIMATED // Animated Marlin logo. Costs ~3260 (or ~940) bytes of flash.
+  //#define STATUS_DIRTY_PAGES        // Only send Status Screen pages that changed since the last refresh
+
+  /**
+   * The display is drawn one page per update, so a frame spans several idle() calls.
+   * Enable to hold the remaining pages of a frame while the planner has moves queued,
+   * but fewer than this many blocks, and more commands are waiting to be planned.
+   */
+  //#define LCD_PAGE_DEFER_BLOCKS 4
 
   // Frivolous Game Options
   //#define MARLIN_BRICKOUT
@@ -1896,6 +2181,23 @@
   //#define OVERLAY_GFX_REVERSE       // Swap the CW/CCW indicators in the graphics overlay
 #endif
 
+//
+// Pace the updates of serial touch screens (see src/lcd/extui)
+//
+#if ENABLED(EXTENSIBLE_UI)
+  /**
+   * Skip UI updates while the planner is running dry or after the UI has
+   * used its time for the current second. The UI still runs at least every
+   * EXTUI_IDLE_MAX_INTERVAL ms to keep reading commands from the screen.
+   */
+  //#define EXTUI_IDLE_THROTTLE
+  #if ENABLED(EXTUI_IDLE_THROTTLE)
+    #define EXTUI_IDLE_MIN_MOVES      4   // Hold off the UI while moving with fewer moves planned than this
+    #define EXTUI_IDLE_BUDGET_MS    100   // (ms) UI time allowed per second before it's held off
+    #define EXTUI_IDLE_MAX_INTERVAL  50   // (ms) Longest the UI is ever held off
+  #endif
+#endif
+
 //
 // Additional options for DGUS / DWIN displays
 //
@@ -1908,6 +2210,17 @@
 
   #define DGUS_UPDATE_INTERVAL_MS  500    // (ms) Interval between automatic screen updates
 
+  /**
+   * Batch the periodic screen updates (DGUS_LCD_UI_ORIGIN, FYSETC, HIPRECY, MKS).
+   * Values bound for consecutive VPs go out as one write frame, and values
+   * the display was already sent since the last screen change are skipped.
+   */
+  //#define DGUS_WRITE_BATCHING
+  #if ENABLED(DGUS_WRITE_BATCHING)
+    #define DGUS_BATCH_BYTES      32      // Largest merged payload, and the largest write that can be skipped
+    #define DGUS_SENT_CACHE_SIZE  16      // VPs whose last value is remembered (7 bytes each)
+  #endif
+
   #if ANY(DGUS_LCD_UI_FYSETC, DGUS_LCD_UI_MKS, DGUS_LCD_UI_HIPRECY)
     #define DGUS_PRINT_FILENAME           // Display the filename during printing
     #define DGUS_PREHEAT_UI               // Display a preheat screen during heatup
@@ -2093,6 +2406,17 @@
   //#define WATCHDOG_RESET_MANUAL
 #endif
 
+/**
+ * Cooperative Yield
+ * Long blocking routines (EEPROM save, SD directory scans and sorting) give a
+ * short housekeeping slice to the heaters, watchdog, serial input and host
+ * keepalive at a bounded rate, instead of calling idle() from deep inside.
+ */
+//#define COOPERATIVE_YIELD
+#if ENABLED(COOPERATIVE_YIELD)
+  #define COOPERATIVE_YIELD_INTERVAL 20 // (ms) Minimum time between housekeeping slices
+#endif
+
 // @section lcd
 
 /**
@@ -2113,6 +2437,11 @@
   #define BABYSTEP_MULTIPLICATOR_Z  1       // (steps or mm) Steps or millimeter distance for each Z babystep
   #define BABYSTEP_MULTIPLICATOR_XY 1       // (steps or mm) Steps or millimeter distance for each XY babystep
 
+  //#define BABYSTEP_SMOOTHING              // Ramp the babystep rate up and down instead of stepping at full rate
+  #if ENABLED(BABYSTEP_SMOOTHING)
+    #define BABYSTEP_RAMP_TICKS 32          // Babystep ticks (about 1ms each) to reach the full babystep rate
+  #endif
+
   //#define DOUBLECLICK_FOR_Z_BABYSTEPPING  // Double-click on the Status Screen for Z Babystepping.
   #if ENABLED(DOUBLECLICK_FOR_Z_BABYSTEPPING)
     #define DOUBLECLICK_MAX_INTERVAL 1250   // Maximum interval between clicks, in milliseconds.
@@ -2235,6 +2564,48 @@
   //#define OPTIMIZED_MESH_STORAGE  // Store mesh with less precision to save EEPROM space
 #endif
 
+#if ENABLED(AUTO_BED_LEVELING_UBL)
+  //#define UBL_MESH_GRADIENTS      // Keep per-point X/Y slope tables for faster leveled moves. Uses 8 bytes of RAM per mesh point.
+#endif
+
+/**
+ * Print mesh statistics with the bilinear grid (after G29 and with M420 V):
+ * range, RMS, deviation from the best-fit plane, and the steepest step between
+ * neighboring points. The range also goes to the status line.
+ */
+#if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+  //#define MESH_STATISTICS
+#endif
+
+/**
+ * Partial probing for bilinear leveling.
+ * 'G29 U L<x> R<x> F<y> B<y>' probes only the points around the given job area
+ * and keeps the rest of the stored mesh, shifted by a plane fit to the change
+ * measured inside the area. Start G-code can pass the part's bounding box.
+ */
+#if BOTH(AUTO_BED_LEVELING_BILINEAR, HAS_BED_PROBE)
+  //#define ABL_PARTIAL_PROBING
+  #define ABL_PARTIAL_MARGIN 5   // (mm) Extra area probed around the job box
+#endif
+
+/**
+ * Keep extra bilinear meshes (e.g., per bed sheet or temperature) at the end of EEPROM.
+ * Each one is stored in µm from its own midpoint, about a third the size of floats.
+ * Save the current mesh with 'M420 W<slot>' and switch to one with 'M420 L<slot>'.
+ */
+#if BOTH(AUTO_BED_LEVELING_BILINEAR, EEPROM_SETTINGS)
+  //#define BILINEAR_MESH_SLOTS 4   // Number of slots, if they fit
+  #ifdef BILINEAR_MESH_SLOTS
+    /**
+     * Each slot notes the bed temperature when it was saved. With 'M420 B1' the active
+     * mesh follows the bed temperature, blended from the slots saved just below and above it.
+     * G29 and 'M420 L' turn the blending off again.
+     */
+    //#define BILINEAR_MESH_TEMP_BLEND
+    #define MESH_BLEND_TEMP_STEP 1    // (°C) Bed temperature change that updates the blend
+  #endif
+#endif
+
 /**
  * Repeatedly attempt G29 leveling until it succeeds.
  * Stop after G29_MAX_RETRIES attempts.
@@ -2255,6 +2626,27 @@
 
 // @section probes
 
+/**
+ * Adaptive Probing
+ * G29 (bilinear) tries to take each point with one fast tap. A slow tap
+ * is added only when the fast result is off from the height predicted
+ * by the points already probed around it. The slow taps also measure
+ * how far the fast taps overshoot, and that is corrected for.
+ * Requires single probing (MULTIPLE_PROBING disabled).
+ */
+//#define ADAPTIVE_PROBING
+#if ENABLED(ADAPTIVE_PROBING)
+  #define ADAPTIVE_PROBING_TOLERANCE 0.05 // (mm) Largest miss from the prediction taken without a slow tap
+  #define ADAPTIVE_PROBING_RETAP     1.0  // (mm) Raise after the fast tap before the slow tap
+#endif
+
+/**
+ * Keep the raise after each probe point queued, so the travel to the next
+ * point follows on without a full stop in between. A BLTouch in HIGH SPEED
+ * mode is reset once the travel is done.
+ */
+//#define PROBE_TRAVEL_OVERLAP
+
 /**
  * Thermal Probe Compensation
  *
@@ -2337,6 +2729,8 @@
   #define MAX_ARC_SEGMENT_MM      1.0 // (mm) Maximum length of each arc segment
   #define MIN_CIRCLE_SEGMENTS    72   // Minimum number of segments in a complete circle
   //#define ARC_SEGMENTS_PER_SEC 50   // Use the feedrate to choose the segment length
+  //#define ARC_CHORD_TOLERANCE 0.01  // (mm) Use the radius to choose the segment length. Raise MAX_ARC_SEGMENT_MM so large arcs use fewer blocks.
+                                    // Also uses an exact rotation and corrects only as often as the tolerance requires.
   #define N_ARC_CORRECTION       25   // Number of interpolated segments between corrections
   #define ARC_P_CIRCLES               // Enable the 'P' parameter to specify complete circles
   //#define SF_ARC_FIX                // Enable only if using SkeinForge with "Arc Point" fillet procedure
@@ -2344,6 +2738,9 @@
 
 // G5 Bézier Curve Support with XYZE destination and IJPQ offsets
 //#define BEZIER_CURVE_SUPPORT        // Requires ~2666 bytes
+#if ENABLED(BEZIER_CURVE_SUPPORT)
+  //#define BEZIER_CHORD_TOLERANCE 0.1 // (mm) Farthest a G5 segment may stray from the curve (Default 0.1)
+#endif
 
 #if EITHER(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
   //#define CNC_WORKSPACE_PLANES      // Allow G2/G3/G5 to operate in XY, ZX, or YZ planes
@@ -2358,6 +2755,15 @@
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
  */
 //#define DIRECT_STEPPING
+#if ENABLED(DIRECT_STEPPING)
+  /**
+   * Page buffers for G6 moves, sent by the host ahead of time.
+   * Formats: SP_4x4D_128, SP_4x2_256, SP_4x1_512 (256 bytes per page)
+   *          SP_4x2_64 (2 bits per axis, 64 bytes per page for AVR)
+   */
+  #define STEPPER_PAGES         4   // A multiple of 4
+  #define STEPPER_PAGE_FORMAT SP_4x2_64
+#endif
 
 /**
  * G38 Probe Target
@@ -2377,6 +2783,31 @@
 // Moves (or segments) with fewer steps than this will be joined with the next move
 #define MIN_STEPS_PER_SEGMENT 6
 
+/**
+ * Fixed-Point Planner
+ * Use integer math for the planner trapezoid generator. Entry and exit factors are
+ * carried as Q16.16 and divisions by the acceleration become multiplies by a
+ * reciprocal stored in each block, removing most float divides and SQRT calls
+ * from recalculate() on 8-bit boards. Uses 8 bytes of SRAM per planner block.
+ * Enable MARLIN_TEST_BUILD to compare the results against the float math at boot.
+ */
+//#define PLANNER_FIXED_POINT
+
+/**
+ * Segment Coalescing
+ * Merge runs of short, nearly collinear G0/G1 moves into one move before they
+ * reach the planner. Curves and text sliced into hundreds of tiny segments then
+ * use fewer planner blocks, so the lookahead buffer doesn't run dry.
+ * Moves are merged only when they share the feedrate and E-to-XY ratio and every
+ * merged endpoint lies within the chord tolerance of the resulting line.
+ */
+//#define SEGMENT_COALESCING
+#if ENABLED(SEGMENT_COALESCING)
+  #define COALESCE_CHORD_TOLERANCE    0.01  // (mm) Max. deviation of a merged endpoint from the line
+  #define COALESCE_E_RATIO_TOLERANCE  0.02  // Max. relative change in E per XY mm between merged moves
+  #define COALESCE_MAX_LENGTH         10    // (mm) Max. length of a merged move
+#endif
+
 /**
  * Minimum delay before and after setting the stepper DIR (in ns)
  *     0 : No delay (Expect at least 10µS since one Stepper ISR must transpire)
@@ -2464,6 +2895,32 @@
 #define MAX_CMD_SIZE 128
 #define BUFSIZE 8
 
+/**
+ * Parsed Moves
+ * Parse plain G0/G1 lines as they are queued and keep them as records of
+ * about 25 bytes instead of MAX_CMD_SIZE strings. More moves fit in the
+ * same RAM, and the main loop doesn't parse them again. Other commands
+ * still use the BUFSIZE slots, so BUFSIZE can be lowered to pay for this.
+ */
+//#define PREPARSED_MOVES
+#if ENABLED(PREPARSED_MOVES)
+  #define PREPARSED_MOVES_SIZE 16   // Number of parsed moves that can be queued (2-255)
+
+  /**
+   * Binary Motion Frames
+   * After "M580 S1" the host sends moves as CRC-checked binary frames of
+   * fixed-point deltas, about a third the size of the text lines. Frames are
+   * confirmed by a sliding-window "ack:<seq>" instead of an "ok" per line.
+   * See feature/binary_motion.h for the frame format.
+   */
+  //#define BINARY_MOTION
+  #if ENABLED(BINARY_MOTION)
+    #define BINARY_MOTION_WINDOW     192  // (bytes) The host can send this much past the last ack (at most RX_BUFFER_SIZE)
+    #define BINARY_MOTION_ACK_FRAMES   8  // Send an ack at least this often during a burst of frames
+    #define BINARY_MOTION_TIMEOUT     30  // (s) Return to text commands if nothing arrives. 0 to disable.
+  #endif
+#endif
+
 // Transmission to Host Buffer Size
 // To save 386 bytes of flash (and TX_BUFFER_SIZE+3 bytes of RAM) set to 0.
 // To buffer a simple "ok" you need 4 bytes.
@@ -2471,7 +2928,7 @@
 // For debug-echo: 128 bytes for the optimal speed.
 // Other output doesn't need to be that speedy.
 // :[0, 2, 4, 8, 16, 32, 64, 128, 256]
-#define TX_BUFFER_SIZE 0
+#define TX_BUFFER_SIZE 32
 
 // Host Receive Buffer Size
 // Without XON/XOFF flow control (see SERIAL_XON_XOFF below) 32 bytes should be enough.
@@ -2502,6 +2959,64 @@
 // Not supported on all platforms.
 //#define RX_BUFFER_MONITOR
 
+/**
+ * Serial DMA (STM32F1 / STM32F4 only)
+ * Receive hardware serial ports with circular DMA instead of an interrupt
+ * per byte, for high baud rates. The Emergency Parser scans the new bytes
+ * from idle(). Use a large SERIAL_RX_BUFFER_SIZE build flag, since a full
+ * buffer overwrites the oldest bytes.
+ */
+//#define SERIAL_DMA
+
+/**
+ * Touchscreen TX Buffer
+ * Replies to the Anycubic TFT are copied into an interrupt-drained ring so
+ * the main loop doesn't wait for the 115200 baud link. When the ring is
+ * nearly full the periodic status replies (A0-A7) are skipped and the TFT
+ * gets fresh values on its next poll.
+ */
+//#define LCD_SERIAL_TX_BUFFER_SIZE 256 // (bytes) Power of 2, at most 256. Default 128.
+#ifdef LCD_SERIAL_TX_BUFFER_SIZE
+  #define LCD_SERIAL_TX_LOW_WATER    48 // (bytes) Skip status replies with less room than this
+#endif
+
+/**
+ * Serial Link Statistics
+ * Per-port counters to tell whether the host link or the firmware is the bottleneck:
+ *  - Bytes per second in and out, and the RX buffer high-water mark (AVR serial only)
+ *  - Time from the first to the last character of each line
+ *  - Time from queueing each line to running it
+ *  - Time the command queue was empty while moving with room in the planner
+ * Use 'M581' to report and start a new interval, 'M581 S<seconds>' to auto-report.
+ */
+//#define SERIAL_LINK_STATS
+
+/**
+ * Buffer Occupancy Report
+ * Sample the planner and command queue once per ms for a host to graph:
+ *  - Min/avg/max blocks in the planner, and avg/max commands in the queue
+ *  - Time both were empty while printing, with the stepper idle
+ * Use 'M589' to report and start a new interval, 'M589 S<seconds>' to auto-report.
+ */
+//#define BUFFER_OCCUPANCY_REPORT
+
+/**
+ * Fleet Telemetry
+ * Auto-report one binary frame with temperatures, targets, heater powers, position,
+ * progress, planner and queue occupancy, and status flags, in place of polling with
+ * M105, M114, M27 and M73. See feature/fleet_telemetry.h for the frame layout.
+ * Use 'M594' to send a frame, 'M594 S<seconds>' to auto-report.
+ */
+//#define FLEET_TELEMETRY
+
+/**
+ * Receive serial commands in place.
+ * Build each incoming line directly in the next free slot of the command
+ * queue instead of a separate line buffer, then queue it without a copy.
+ * Saves MAX_CMD_SIZE bytes of RAM. Requires a single serial port.
+ */
+//#define SERIAL_ZERO_COPY
+
 /**
  * Emergency Command Parser
  *
@@ -2532,6 +3047,28 @@
   //#define FULL_REPORT_TO_HOST_FEATURE   // Auto-report the machine status like Grbl CNC
 #endif
 
+/**
+ * Realtime Overrides (requires EMERGENCY_PARSER)
+ *
+ * Single-byte feedrate and flow overrides (like Grbl), acted on as soon
+ * as they arrive instead of waiting behind the command queue. The bytes
+ * may be sent at any time, even in the middle of a line, and are removed
+ * from the G-code stream. Moves already in the planner keep their speed.
+ *
+ *  0x90 : Feedrate 100%    0x99 : Flow 100% (active extruder)
+ *  0x91 : Feedrate +10%    0x9A : Flow +10%
+ *  0x92 : Feedrate -10%    0x9B : Flow -10%
+ *  0x93 : Feedrate +1%     0x9C : Flow +1%
+ *  0x94 : Feedrate -1%     0x9D : Flow -1%
+ *
+ * Overrides are ignored while MeatPack packing is enabled.
+ */
+//#define REALTIME_OVERRIDES
+#if ENABLED(REALTIME_OVERRIDES)
+  #define REALTIME_OVERRIDE_MIN  10 // (%) Lowest feedrate or flow an override can set
+  #define REALTIME_OVERRIDE_MAX 200 // (%) Highest feedrate or flow an override can set
+#endif
+
 /**
  * Bad Serial-connections can miss a received command by sending an 'ok'
  * Therefore some clients abort after 30 seconds in a timeout.
@@ -2542,6 +3079,29 @@
 
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
+#if ENABLED(ADVANCED_OK)
+  //#define ADVANCED_OK_CREDITS   // Add lines read (S) and lines the queue can take (C) so the host can send ahead
+#endif
+
+/**
+ * Resend Window
+ * After a checksum error keep reading, and hold the good lines that follow
+ * the bad one until the host sends it again. The stream isn't dropped and
+ * resent in full, so motion doesn't stall on a noisy line. Counts are in M576.
+ */
+//#define RESEND_WINDOW
+#if ENABLED(RESEND_WINDOW)
+  #define RESEND_WINDOW_SIZE 2  // Lines to hold (1-8), each taking MAX_CMD_SIZE bytes of SRAM
+#endif
+
+/**
+ * Output not sent in reply to a command (host actions, file and fan notices,
+ * busy and buffer reports) goes to every serial port. With a host on one port
+ * and a display on another, send each kind only to the ports that use it.
+ * Each is a mask of ports, with bit 0 for SERIAL_PORT and bit 1 for SERIAL_PORT_2.
+ */
+//#define HOST_ACTION_PORTS  0b01 // Host action commands, like "//action:pause"
+//#define NOTICE_PORTS       0b01 // Notices and auto-reports
 
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
@@ -2601,6 +3161,7 @@
   #define RETRACT_RECOVER_LENGTH_SWAP   0   // (mm) Default additional swap recover length (added to retract length on recover from toolchange)
   #define RETRACT_RECOVER_FEEDRATE      8   // (mm/s) Default feedrate for recovering from retraction
   #define RETRACT_RECOVER_FEEDRATE_SWAP 8   // (mm/s) Default feedrate for recovering from swap retraction
+  //#define FWRETRACT_COMBINED_HOP          // Retract and Z-hop in one move, and recover while lowering Z
   #if ENABLED(MIXING_EXTRUDER)
     //#define RETRACT_SYNC_MIXING           // Retract and restore all mixing steppers simultaneously
   #endif
@@ -2621,6 +3182,13 @@
     //#define EVENT_GCODE_AFTER_TOOLCHANGE "G12X"   // Extra G-code to run after tool-change
   #endif
 
+  /**
+   * Plan the raise, retract, park, prime, and return moves of a tool change
+   * back to back, with a single wait at the end, instead of stopping after
+   * each one. Only for extruders that change without a mechanism.
+   */
+  //#define TOOLCHANGE_PIPELINE
+
   /**
    * Extra G-code to run while executing tool-change commands. Can be used to use an additional
    * stepper motor (e.g., I axis in Configuration.h) to drive the tool-changer.
@@ -2794,6 +3362,8 @@
 
   #define PARK_HEAD_ON_PAUSE                      // Park the nozzle during pause and filament change.
   //#define HOME_BEFORE_FILAMENT_CHANGE           // If needed, home before parking for filament change
+  //#define ADVANCED_PAUSE_NONBLOCKING            // Wait for the user and reload from the main loop, instead of within M600.
+                                                  // Heaters, displays, and serial stay live. Later commands wait in the queue.
 
   //#define FILAMENT_LOAD_UNLOAD_GCODES           // Add M701/M702 Load/Unload G-codes, plus Load/Unload in the LCD Prepare menu.
   //#define FILAMENT_UNLOAD_ALL_EXTRUDERS         // Allow M702 to unload all extruders above a minimum target temp (as set by M302)
@@ -3123,6 +3693,19 @@
   #define E6_SLAVE_ADDRESS 0
   #define E7_SLAVE_ADDRESS 0
 
+  /**
+   * Timer-driven software serial (AVR)
+   * Software UART drivers use a bit-bang UART run from a spare 16-bit timer
+   * instead of SoftwareSerial. SoftwareSerial keeps interrupts off for a whole
+   * byte, which stalls the stepper ISR. This ISR takes a few microseconds per
+   * tick, preempts the stepper ISR, and only runs during transfers.
+   * The default TMC_BAUD_RATE becomes 19200. Up to 38400 works.
+   */
+  //#define TMC_TIMER_SERIAL
+  #if ENABLED(TMC_TIMER_SERIAL)
+    #define TMC_TIMER_SERIAL_TIMER 3  // Timer 3 or 5. Not the ISR_PROFILER_TIMER or STEP_CAPTURE_TIMER.
+  #endif
+
   // @section tmc/smart
 
   /**
@@ -3210,6 +3793,7 @@
     #define CURRENT_STEP_DOWN     50  // [mA]
     #define REPORT_CURRENT_CHANGE
     #define STOP_ON_ERROR
+    //#define TMC_MONITOR_ROUND_ROBIN   // Poll one driver per check, spread over the interval, instead of all at once
   #endif
 
   // @section tmc/hybrid
@@ -3246,6 +3830,20 @@
   #define E6_HYBRID_THRESHOLD     30
   #define E7_HYBRID_THRESHOLD     30
 
+  /**
+   * Tune the hybrid thresholds while printing (TMC2208/TMC2209)
+   * The driver runs out of voltage in stealthChop when PWM_SCALE_SUM nears 255,
+   * and steps may be lost. When a monitored driver reports that while moving in
+   * stealthChop, its threshold is lowered to just below the speed it was at.
+   * Set optimistic thresholds above, then check M913 and save with M500.
+   * Requires MONITOR_DRIVER_STATUS.
+   */
+  //#define HYBRID_THRESHOLD_AUTO
+  #if ENABLED(HYBRID_THRESHOLD_AUTO)
+    #define HYBRID_AUTO_PWM_SCALE 248   // PWM_SCALE_SUM (0-255) that counts as out of headroom
+    #define HYBRID_AUTO_MARGIN     10   // (%) Switch this much below the speed where it happened
+  #endif
+
   /**
    * Use StallGuard to home / probe X, Y, Z.
    *
@@ -3567,6 +4165,13 @@
      */
     //#define LASER_POWER_SYNC
 
+    /**
+     * Alternatively, apply M3/M4 S power in inline mode to the moves that follow,
+     * like G1 S, without a planner synchronization or sync block. Lookahead goes
+     * on across power changes, but the power only changes when the next move starts.
+     */
+    //#define LASER_POWER_INLINE_M3
+
     /**
      * Scale the laser's power in proportion to the movement rate.
      *
@@ -3682,6 +4287,7 @@
   #define POWER_MONITOR_VOLTS_PER_AMP    0.05000  // Input voltage to the MCU analog pin per amp  - DO NOT apply more than ADC_VREF!
   #define POWER_MONITOR_CURRENT_OFFSET   0        // Offset (in amps) applied to the calculated current
   #define POWER_MONITOR_FIXED_VOLTAGE   13.6      // Voltage for a current sensor with no voltage sensor (for power display)
+  //#define POWER_MONITOR_ENERGY                  // Integrate the power into Wh. Report with 'M430', reset with 'M430 R'.
 #endif
 
 #if ENABLED(POWER_MONITOR_VOLTAGE)
@@ -3726,6 +4332,19 @@
   //#define AUTO_REPORT_REDUNDANT // Include the "R" sensor in the auto-report
 #endif
 
+/**
+ * Skip temperature auto-reports that would repeat the last one.
+ * A report is only sent when a temperature or target has moved by
+ * D°C or more (set with M155 D<degrees>), or when the last report
+ * is older than AUTO_REPORT_TEMP_MAX_INTERVAL. Use D0 for the usual
+ * fixed-interval reports. Frees serial bandwidth for G-code.
+ */
+//#define AUTO_REPORT_TEMP_CHANGES
+#if ALL(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_TEMP_CHANGES)
+  #define AUTO_REPORT_TEMP_DELTA         1.0  // (°C) Default change threshold
+  #define AUTO_REPORT_TEMP_MAX_INTERVAL  10   // (s) Longest time between reports
+#endif
+
 /**
  * Auto-report position with M154 S<seconds>
  */
@@ -3787,6 +4406,131 @@
 
 //#define REPORT_FAN_CHANGE   // Report the new fan speed when changed by M106 (and others)
 
+/**
+ * Planner Telemetry
+ * Record the timing of the last BLOCK_BUFFER_SIZE planner blocks: when each was queued,
+ * how long it waited for the Stepper ISR, the time spent in recalculate(), and how full
+ * the planner and command queue were at that moment. Also count planner underruns.
+ * Use 'M577' to report and 'M577 R' to reset. Helps to tune BLOCK_BUFFER_SIZE and
+ * MIN_STEPS_PER_SEGMENT. Uses 13 bytes of SRAM per planner block.
+ */
+//#define PLANNER_TELEMETRY
+
+/**
+ * ISR Profiler
+ * Count the CPU cycles spent in the Stepper ISR (and its pulse, block, advance and
+ * babystep phases) and in the Temperature ISR. Keep min/max/average and a histogram.
+ * Time spent in a preempting ISR is not charged to the section it interrupted.
+ * Use 'M578' to report and 'M578 R' to reset. AVR only.
+ */
+//#define ISR_PROFILER
+#if ENABLED(ISR_PROFILER)
+  #define ISR_PROFILER_TIMER 3  // A free 16-bit timer (1, 3, 4, 5) to run at F_CPU
+#endif
+
+/**
+ * Idle Profiler
+ * Time the tasks of idle() and loop(): heaters, UI, media, host keepalive, auto-reports,
+ * command processing, etc. Keep the total and longest µs and the call count of each.
+ * Time spent in a task nested inside another one is not charged to the outer task.
+ * Use 'M583' to report and start a new interval, 'M583 S<seconds>' to auto-report.
+ */
+//#define IDLE_PROFILER
+
+/**
+ * Idle Scheduler
+ * Call the periodic tasks of idle() (host keepalive, position encoders, auto-reports,
+ * print job timer) from a table, each only when its period has passed, in priority
+ * order. With IDLE_PROFILER, 'M583' also reports each task's longest run in µs and
+ * how many runs went over the task's budget.
+ */
+//#define IDLE_SCHEDULER
+
+/**
+ * Command Latency
+ * Time each command from the queue and keep a histogram in powers of 2 from <64µs
+ * to 64ms+ for G0/G1, arcs, other G-codes, M-codes and tool changes, along with the
+ * slowest command of each. Use 'M588' to report and 'M588 R' to reset.
+ */
+//#define COMMAND_LATENCY
+
+/**
+ * Stack Monitor
+ * Paint the free RAM at boot and track the lowest stack address ever written, the
+ * least free stack at Stepper / Temperature ISR entry, the deepest idle() recursion,
+ * and how often and how deeply those ISRs nest. Use 'M584' to report and 'M584 R'
+ * to reset the counts. Check the headroom before growing BLOCK_BUFFER_SIZE or BUFSIZE.
+ * AVR only. Not compatible with M100_FREE_MEMORY_WATCHER.
+ */
+//#define STACK_MONITOR
+
+/**
+ * SRAM Report
+ * After the build, list the static RAM (.data + .bss) used by each subsystem: planner
+ * and stepper, command queue, serial buffers, MeatPack, touchscreen, bed mesh, SD card,
+ * temperature, and the rest. Fail the build if the total exceeds SRAM_BUDGET, leaving
+ * room for the stack. PlatformIO only.
+ */
+//#define SRAM_REPORT
+#if ENABLED(SRAM_REPORT)
+  #define SRAM_BUDGET 7168  // (bytes) Static RAM limit. Comment out to report only.
+#endif
+
+/**
+ * Serial link benchmark
+ * 'M585 S1' starts discarding planned moves so a host can stream G0/G1 lines at
+ * full speed with nothing moving. 'M585 S0' restores the position and reports
+ * lines/s, bytes/s, parse time per line and G0/G1 planning time per move.
+ */
+//#define LINK_BENCHMARK
+
+/**
+ * Virtual stepping
+ * 'M586 S1' hands planned blocks to a virtual stepper that times them instead
+ * of moving, so a print runs at full CPU speed for a firmware-side estimate.
+ * 'M586 S0' restores the position and reports the print time, block count and
+ * predicted buffer underruns. Heating, homing and probing are skipped.
+ */
+//#define VIRTUAL_STEPPING
+
+/**
+ * Crash trace
+ * Keep the last commands, planner indexes and heater states in RAM that
+ * survives a reset, along with the kill() reason. After a watchdog or soft
+ * reset the trace is printed at boot. kill() prints it right away. AVR only.
+ */
+//#define CRASH_TRACE
+#if ENABLED(CRASH_TRACE)
+  #define CRASH_TRACE_SIZE 16   // Entries of 6 bytes. A power of 2.
+#endif
+
+/**
+ * Step timing capture
+ * Timestamp the STEP edges of one axis with the input capture of a spare 16-bit timer,
+ * with no logic analyzer. Wire the STEP pin to ICP4 (D49) or ICP5 (D48) on a Mega 2560.
+ * 'M587 X10 F3000' moves +10mm and compares the cruise intervals to the planned step rate.
+ * The PWM pins of the timer can't be used while the capture runs. AVR only.
+ */
+//#define STEP_CAPTURE
+#if ENABLED(STEP_CAPTURE)
+  #define STEP_CAPTURE_TIMER 5    // Timer 4 or 5. Servos use Timer 4.
+  #define STEP_CAPTURE_SIZE 256   // Edges to keep, 2 bytes each
+#endif
+
+/**
+ * Temperature History
+ * Keep a ring of downsampled readings for each hotend and the bed in SRAM: the
+ * average temperature and heater power over each interval, plus the target and
+ * fan speed. Use 'M582' to dump it as CSV, 'M582 B' for compact hex, and 'M582 R'
+ * to clear it. Tune PID / MPC or look back at a thermal error without streaming
+ * M155 during the print. Uses 6 bytes of SRAM per heater per sample.
+ */
+//#define TEMP_HISTORY
+#if ENABLED(TEMP_HISTORY)
+  #define TEMP_HISTORY_SIZE       64  // (1-255) Samples kept
+  #define TEMP_HISTORY_INTERVAL 2000  // (ms) Time covered by each sample
+#endif
+
 // @section gcode
 
 /**
@@ -3804,6 +4548,17 @@
 #define MEATPACK_ON_SERIAL_PORT_1
 #define MEATPACK_ON_SERIAL_PORT_2
 
+/**
+ * MeatPack dictionary packing
+ * Let the host upload up to 64 tokens like "G1 X" or " E" that each pack
+ * into a single byte. The dictionary is checked with a CRC before use.
+ * Each MeatPack serial port has its own dictionary in SRAM.
+ */
+//#define MEATPACK_DICTIONARY
+#if ENABLED(MEATPACK_DICTIONARY)
+  #define MEATPACK_DICT_BYTES 192   // Total characters for all tokens (64-255)
+#endif
+
 //#define GCODE_CASE_INSENSITIVE  // Accept G-code sent to the firmware in lowercase
 
 //#define REPETIER_GCODE_M360     // Add commands originally from Repetier FW
@@ -3851,6 +4606,20 @@
   #define GCODE_MACROS_SLOT_SIZE  50  // Maximum length of a single macro
 #endif
 
+/**
+ * Settings Profiles
+ *
+ * Add M824 to keep sets of acceleration, jerk, Linear Advance K, hotend PID
+ * and probe Z offset (e.g., one per filament) and switch between them in one
+ * command. Store the current settings with M824 W<index>, apply them with
+ * M824 S<index>, and save with M500. The Anycubic TFT Special Menu can apply
+ * the first two profiles.
+ */
+//#define SETTINGS_PROFILES
+#if ENABLED(SETTINGS_PROFILES)
+  #define SETTINGS_PROFILE_COUNT 2    // Number of profiles, up to 8
+#endif
+
 /**
  * User-defined menu items to run custom G-code.
  * Up to 25 may be defined, but the actual number is LCD-dependent.
@@ -3990,6 +4759,30 @@
 //#define CANCEL_OBJECTS
 #if ENABLED(CANCEL_OBJECTS)
   #define CANCEL_OBJECTS_REPORTING // Emit the current object as a status message
+
+  /**
+   * Read ahead in the printing SD file to find where each "M486 S" section ends,
+   * so the sections of canceled objects are skipped with one seek instead of
+   * being read line by line. Only sections made of plain G0-G3 moves are skipped.
+   * Canceling the object being printed also skips the rest of its section.
+   */
+  //#define CANCEL_OBJECTS_PRESCAN
+  #if ENABLED(CANCEL_OBJECTS_PRESCAN)
+    #define CANCEL_OBJECTS_PRESCAN_SIZE 8 // Upcoming sections to remember (18 bytes each)
+  #endif
+#endif
+
+/**
+ * Background Tasks
+ * Run long jobs queued by the UI a slice at a time from idle(), such as
+ * reading ahead in the SD file list. Tasks wait while the planner is
+ * running low so they never hold up motion.
+ */
+//#define BACKGROUND_TASKS
+#if ENABLED(BACKGROUND_TASKS)
+  #define BACKGROUND_TASKS_MAX        4   // Tasks that can be queued at once
+  #define BACKGROUND_TASKS_SLICE_US 2000  // (µs) Time given to tasks per idle() call
+  #define BACKGROUND_TASKS_MIN_MOVES  4   // Wait while moving with fewer moves planned than this
 #endif
 
 /**
@@ -4067,6 +4860,8 @@
    * error rolling average when attempting to correct only for skips and not for vibration.
    */
   #define I2CPE_MIN_UPD_TIME_MS     4                       // (ms) Minimum time between encoder checks.
+  //#define I2CPE_UPDATE_ONE          // Check one encoder per update, in turn, so each idle() waits on only
+                                                            // one I2C read. With N encoders, each is checked every N updates.
 
   // Use a rolling average to identify persistent errors that indicate skips, as opposed to vibration and noise.
   #define I2CPE_ERR_ROLLING_AVERAGE
@@ -4183,6 +4978,14 @@
  */
 #if HAS_ETHERNET
   #define MAC_ADDRESS { 0xDE, 0xAD, 0xBE, 0xEF, 0xF0, 0x0D }  // A MAC address unique to your network
+
+  /**
+   * Pull telnet data from the TCP stack in bulk instead of one byte per call,
+   * so streamed G-code isn't limited by per-byte socket overhead.
+   * Combine with ADVANCED_OK_CREDITS so the host can keep several lines in flight
+   * instead of waiting a TCP round trip for every "ok".
+   */
+  //#define ETHERNET_RX_BUFFER_SIZE 1024  // (bytes) 64..4096
 #endif
 
 /**
@@ -4270,6 +5073,10 @@
     { -10.0,  400 }, \
     { -50.0, 2000 }
 
+  // Plan all the steps of a sequence before waiting, so they join at speed
+  // instead of stopping between steps. Check the filament tip after enabling.
+  //#define MMU2_SEQUENCE_LOOKAHEAD
+
   /**
    * Using a sensor like the MMU2S
    * This mode requires a MK3S extruder with a sensor at the extruder idler, like the MMU2S.
@@ -4349,6 +5156,19 @@
 
 // Enable Tests that will run at startup and produce a report
 //#define MARLIN_TEST_BUILD
+#if ENABLED(MARLIN_TEST_BUILD)
+  /**
+   * Planner Benchmark
+   * Send generated perimeters, small text and dense infill through the G-code queue and planner.
+   * A simulated stepper takes the blocks instead of the Stepper ISR, so nothing moves.
+   * Reports planning time per block, buffer occupancy, underruns and speed discontinuities.
+   * Enable PLANNER_TELEMETRY to also report recalculate() time.
+   */
+  //#define PLANNER_BENCHMARK
+  #if ENABLED(PLANNER_BENCHMARK)
+    #define PLANNER_BENCHMARK_TIME_SCALE 4  // Simulated stepper speed relative to real time. Use a large value to never wait for the buffer.
+  #endif
+#endif
 
 // Enable Marlin dev mode which adds some special commands
 //#define MARLIN_DEV_MODE
@@ -4361,6 +5181,13 @@
   //#define BUFFER_MONITORING
 #endif
 
+/**
+ * Report the time taken by startup and its slowest stage once setup() is done.
+ * With BACKGROUND_TASKS the TMC connection test runs after setup() instead,
+ * so the host can connect sooner.
+ */
+//#define BOOT_TIMING
+
 /**
  * Postmortem Debugging captures misbehavior and outputs the CPU status and backtrace to serial.
  * When running in the debugger it will break for debugging. This is useful to help understand
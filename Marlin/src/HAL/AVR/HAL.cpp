@@ -146,6 +146,64 @@ void MarlinHAL::reboot() {
 
 #endif // USE_WATCHDOG
 
+// ------------------------
+// ADC Sequencer
+// ------------------------
+
+#if ENABLED(ADC_AUTO_SEQUENCE)
+
+  static uint8_t adc_seq_ch[ADC_SEQUENCE_LENGTH], adc_seq_len, adc_seq_idx, adc_seq_rounds, adc_seq_round;
+  static uint16_t adc_seq_acc[ADC_SEQUENCE_LENGTH];
+  static volatile uint16_t adc_seq_out[ADC_SEQUENCE_LENGTH];
+  static volatile bool adc_seq_done;
+
+  // Set the channel for the next triggered conversion. ADMUX is latched when it starts.
+  static void adc_seq_select(const uint8_t ch) {
+    #ifdef MUX5
+      ADCSRB = _BV(ADTS2) | (ch > 7 ? _BV(MUX5) : 0);
+    #else
+      ADCSRB = _BV(ADTS2);
+    #endif
+    ADMUX = _BV(REFS0) | (ch & 0x07);
+  }
+
+  void MarlinHAL::adc_sequence_add(const uint8_t ch) {
+    if (adc_seq_len < ADC_SEQUENCE_LENGTH) adc_seq_ch[adc_seq_len++] = ch;
+  }
+
+  // Timer 0 overflow starts each conversion, so one channel is sampled every 1.024ms
+  void MarlinHAL::adc_sequence_start(const uint8_t rounds) {
+    if (!adc_seq_len) return;
+    adc_seq_rounds = rounds;
+    adc_seq_select(adc_seq_ch[0]);
+    ADCSRA |= _BV(ADIF) | _BV(ADATE) | _BV(ADIE);
+  }
+
+  bool MarlinHAL::adc_sequence_ready() { return adc_seq_done; }
+  uint16_t MarlinHAL::adc_sequence_sum(const uint8_t i) { return adc_seq_out[i]; }
+  void MarlinHAL::adc_sequence_next() { adc_seq_done = false; }
+
+  // Add each result to its channel and select the next. A finished round is published
+  // if the last one was taken, otherwise it is dropped.
+  ISR(ADC_vect) {
+    adc_seq_acc[adc_seq_idx] += ADC;
+    if (++adc_seq_idx >= adc_seq_len) {
+      adc_seq_idx = 0;
+      if (++adc_seq_round >= adc_seq_rounds) {
+        adc_seq_round = 0;
+        const bool publish = !adc_seq_done;
+        for (uint8_t i = 0; i < adc_seq_len; ++i) {
+          if (publish) adc_seq_out[i] = adc_seq_acc[i];
+          adc_seq_acc[i] = 0;
+        }
+        if (publish) adc_seq_done = true;
+      }
+    }
+    adc_seq_select(adc_seq_ch[adc_seq_idx]);
+  }
+
+#endif // ADC_AUTO_SEQUENCE
+
 // ------------------------
 // Free Memory Accessor
 // ------------------------
@@ -255,6 +255,17 @@ public:
   // The current value of the ADC register
   static __typeof__(ADC) adc_value() { return ADC; }
 
+  #if ENABLED(ADC_AUTO_SEQUENCE)
+    // Add a channel to the auto-triggered sequence. Sums come back in this order.
+    static void adc_sequence_add(const uint8_t ch);
+    // Start sampling, summing 'rounds' samples of each channel
+    static void adc_sequence_start(const uint8_t rounds);
+    // Is a full set of sums ready? Read them, then call adc_sequence_next().
+    static bool adc_sequence_ready();
+    static uint16_t adc_sequence_sum(const uint8_t i);
+    static void adc_sequence_next();
+  #endif
+
   /**
    * init_pwm_timers
    * Set the default frequency for timers 2-5 to 1000HZ
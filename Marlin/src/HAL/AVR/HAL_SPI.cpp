@@ -88,17 +88,33 @@ void spiBegin() {
     return SPDR;
   }
 
-  /** SPI read data  */
+  /**
+   * SPI read data
+   * Start the next transfer before storing the last byte, so the store
+   * and loop overhead overlap the transfer instead of idling the bus.
+   */
   void spiRead(uint8_t *buf, uint16_t nbyte) {
     if (nbyte-- == 0) return;
     SPDR = 0xFF;
-    for (uint16_t i = 0; i < nbyte; i++) {
+    while (nbyte > 1) {
       while (!TEST(SPSR, SPIF)) { /* Intentionally left empty */ }
-      buf[i] = SPDR;
+      uint8_t b = SPDR;
       SPDR = 0xFF;
+      *buf++ = b;
+      while (!TEST(SPSR, SPIF)) { /* Intentionally left empty */ }
+      b = SPDR;
+      SPDR = 0xFF;
+      *buf++ = b;
+      nbyte -= 2;
+    }
+    if (nbyte) {
+      while (!TEST(SPSR, SPIF)) { /* Intentionally left empty */ }
+      const uint8_t b = SPDR;
+      SPDR = 0xFF;
+      *buf++ = b;
     }
     while (!TEST(SPSR, SPIF)) { /* Intentionally left empty */ }
-    buf[nbyte] = SPDR;
+    *buf = SPDR;
   }
 
   /** SPI send a byte */
@@ -107,14 +123,19 @@ void spiBegin() {
     while (!TEST(SPSR, SPIF)) { /* Intentionally left empty */ }
   }
 
-  /** SPI send block  */
+  /**
+   * SPI send block
+   * Fetch each byte while the previous one is shifting out.
+   */
   void spiSendBlock(uint8_t token, const uint8_t *buf) {
     SPDR = token;
-    for (uint16_t i = 0; i < 512; i += 2) {
+    for (const uint8_t * const end = buf + 512; buf < end;) {
+      uint8_t b = *buf++;
       while (!TEST(SPSR, SPIF)) { /* Intentionally left empty */ }
-      SPDR = buf[i];
+      SPDR = b;
+      b = *buf++;
       while (!TEST(SPSR, SPIF)) { /* Intentionally left empty */ }
-      SPDR = buf[i + 1];
+      SPDR = b;
     }
     while (!TEST(SPSR, SPIF)) { /* Intentionally left empty */ }
   }
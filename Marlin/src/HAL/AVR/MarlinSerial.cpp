@@ -55,6 +55,8 @@ template<typename Cfg> uint8_t  MarlinSerial<Cfg>::rx_dropped_bytes = 0;
 template<typename Cfg> uint8_t  MarlinSerial<Cfg>::rx_buffer_overruns = 0;
 template<typename Cfg> uint8_t  MarlinSerial<Cfg>::rx_framing_errors = 0;
 template<typename Cfg> typename MarlinSerial<Cfg>::ring_buffer_pos_t MarlinSerial<Cfg>::rx_max_enqueued = 0;
+template<typename Cfg> uint32_t MarlinSerial<Cfg>::rx_bytes = 0;
+template<typename Cfg> uint32_t MarlinSerial<Cfg>::tx_bytes = 0;
 
 // A SW memory barrier, to ensure GCC does not overoptimize loops
 #define sw_barrier() asm volatile("": : :"memory");
@@ -143,6 +145,8 @@ FORCE_INLINE void MarlinSerial<Cfg>::store_rxd_char() {
   // Read the character from the USART
   uint8_t c = R_UDR;
 
+  if (Cfg::LINK_STATS) ++rx_bytes;
+
   #if ENABLED(DIRECT_STEPPING)
     if (page_manager.maybe_store_rxd_char(c)) return;
   #endif
@@ -455,6 +459,8 @@ void MarlinSerial<Cfg>::flush() {
 
 template<typename Cfg>
 void MarlinSerial<Cfg>::write(const uint8_t c) {
+  if (Cfg::LINK_STATS) ++tx_bytes;
+
   if (Cfg::TX_SIZE == 0) {
 
     _written = true;
@@ -512,6 +518,56 @@ void MarlinSerial<Cfg>::write(const uint8_t c) {
   }
 }
 
+/**
+ * Copy a block of bytes into the TX ring, publishing the head
+ * once per chunk instead of once per byte.
+ * Return false to have the caller write byte by byte instead.
+ */
+template<typename Cfg>
+bool MarlinSerial<Cfg>::writeBlock(const uint8_t *buffer, size_t size) {
+  // Without the TX ISR write() has to poll anyway
+  if (Cfg::TX_SIZE == 0 || !hal.isr_state()) return false;
+
+  if (Cfg::LINK_STATS) tx_bytes += size;
+  _written = true;
+  while (size) {
+    uint8_t h = tx_buffer.head;
+    uint8_t room = (tx_buffer.tail - h - 1) & (Cfg::TX_SIZE - 1);
+    if (!room) { sw_barrier(); continue; }  // Wait for the TX ISR to make room
+
+    NOMORE(room, size);
+    size -= room;
+    while (room--) {
+      tx_buffer.buffer[h] = *buffer++;
+      h = (h + 1) & (Cfg::TX_SIZE - 1);
+    }
+    tx_buffer.head = h;
+
+    // Enable TX ISR - Non atomic, but it will eventually enable TX ISR
+    B_UDRIE = 1;
+  }
+  return true;
+}
+
+// Bytes that can be queued without waiting for the TX ISR
+template<typename Cfg>
+typename MarlinSerial<Cfg>::ring_buffer_pos_t MarlinSerial<Cfg>::get_tx_buffer_free() {
+  if (Cfg::TX_SIZE == 0) return 0;
+  const uint8_t t = tx_buffer.tail,  // next byte to send.
+                h = tx_buffer.head;  // next pos for queue.
+  return (t - h - 1) & (Cfg::TX_SIZE - 1);
+}
+
+// The RX ISR updates the count, so read it with interrupts off
+template<typename Cfg>
+uint32_t MarlinSerial<Cfg>::rxBytes() {
+  if (!Cfg::LINK_STATS) return 0;
+  CRITICAL_SECTION_START();
+  const uint32_t n = rx_bytes;
+  CRITICAL_SECTION_END();
+  return n;
+}
+
 template<typename Cfg>
 void MarlinSerial<Cfg>::flushTX() {
 
@@ -629,17 +685,6 @@ MSerialT1 customizedSerial1(MSerialT1::HasEmergencyParser);
   template class MarlinSerial< LCDSerialCfg<LCD_SERIAL_PORT> >;
   MSerialLCD lcdSerial(MSerialLCD::HasEmergencyParser);
 
-  #if HAS_DGUS_LCD
-    template<typename Cfg>
-    typename MarlinSerial<Cfg>::ring_buffer_pos_t MarlinSerial<Cfg>::get_tx_buffer_free() {
-      const ring_buffer_pos_t t = tx_buffer.tail,  // next byte to send.
-                              h = tx_buffer.head;  // next pos for queue.
-      int ret = t - h - 1;
-      if (ret < 0) ret += Cfg::TX_SIZE + 1;
-      return ret;
-    }
-  #endif
-
 #endif // LCD_SERIAL_PORT
 
 #endif // !USBCON && (UBRRH || UBRR0H || UBRR1H || UBRR2H || UBRR3H)
@@ -183,6 +183,7 @@
                    rx_buffer_overruns,
                    rx_framing_errors;
     static ring_buffer_pos_t rx_max_enqueued;
+    static uint32_t rx_bytes, tx_bytes;
 
     FORCE_INLINE static ring_buffer_pos_t atomic_read_rx_head();
 
@@ -204,10 +205,9 @@
     static void flush();
     static ring_buffer_pos_t available();
     static void write(const uint8_t c);
+    static bool writeBlock(const uint8_t *buffer, size_t size);
     static void flushTX();
-    #if HAS_DGUS_LCD
-      static ring_buffer_pos_t get_tx_buffer_free();
-    #endif
+    static ring_buffer_pos_t get_tx_buffer_free();
 
     enum { HasEmergencyParser = Cfg::EMERGENCYPARSER };
     static bool emergency_parser_enabled() { return Cfg::EMERGENCYPARSER; }
@@ -216,6 +216,11 @@
     FORCE_INLINE static uint8_t buffer_overruns() { return Cfg::RX_OVERRUNS ? rx_buffer_overruns : 0; }
     FORCE_INLINE static uint8_t framing_errors() { return Cfg::RX_FRAMING_ERRORS ? rx_framing_errors : 0; }
     FORCE_INLINE static ring_buffer_pos_t rxMaxEnqueued() { return Cfg::MAX_RX_QUEUED ? rx_max_enqueued : 0; }
+
+    // Byte counters and RX high-water mark for SERIAL_LINK_STATS
+    static uint32_t rxBytes();
+    FORCE_INLINE static uint32_t txBytes() { return Cfg::LINK_STATS ? tx_bytes : 0; }
+    FORCE_INLINE static void resetRxMaxEnqueued() { rx_max_enqueued = 0; }
   };
 
   template <uint8_t serial>
@@ -228,7 +233,8 @@
     static constexpr bool DROPPED_RX        = ENABLED(SERIAL_STATS_DROPPED_RX);
     static constexpr bool RX_OVERRUNS       = ENABLED(SERIAL_STATS_RX_BUFFER_OVERRUNS);
     static constexpr bool RX_FRAMING_ERRORS = ENABLED(SERIAL_STATS_RX_FRAMING_ERRORS);
-    static constexpr bool MAX_RX_QUEUED     = ENABLED(SERIAL_STATS_MAX_RX_QUEUED);
+    static constexpr bool MAX_RX_QUEUED     = ANY(SERIAL_STATS_MAX_RX_QUEUED, SERIAL_LINK_STATS);
+    static constexpr bool LINK_STATS        = ENABLED(SERIAL_LINK_STATS);
   };
 
   typedef Serial1Class< MarlinSerial< MarlinSerialCfg<SERIAL_PORT> > > MSerialT1;
@@ -258,6 +264,7 @@
     static constexpr bool RX_FRAMING_ERRORS = false;
     static constexpr bool MAX_RX_QUEUED     = false;
     static constexpr bool RX_OVERRUNS       = false;
+    static constexpr bool LINK_STATS        = false;
   };
 
   typedef Serial1Class< MarlinSerial< MMU2SerialCfg<MMU2_SERIAL_PORT> > > MSerialMMU2;
@@ -266,17 +273,22 @@
 
 #ifdef LCD_SERIAL_PORT
 
+  #ifndef LCD_SERIAL_TX_BUFFER_SIZE
+    #define LCD_SERIAL_TX_BUFFER_SIZE 128
+  #endif
+
   template <uint8_t serial>
   struct LCDSerialCfg {
     static constexpr int PORT               = serial;
     static constexpr unsigned int RX_SIZE   = TERN(HAS_DGUS_LCD, DGUS_RX_BUFFER_SIZE,  64);
-    static constexpr unsigned int TX_SIZE   = TERN(HAS_DGUS_LCD, DGUS_TX_BUFFER_SIZE, 128);
+    static constexpr unsigned int TX_SIZE   = TERN(HAS_DGUS_LCD, DGUS_TX_BUFFER_SIZE, LCD_SERIAL_TX_BUFFER_SIZE);
     static constexpr bool XONOFF            = false;
     static constexpr bool EMERGENCYPARSER   = ENABLED(EMERGENCY_PARSER);
     static constexpr bool DROPPED_RX        = false;
     static constexpr bool RX_FRAMING_ERRORS = false;
     static constexpr bool MAX_RX_QUEUED     = false;
     static constexpr bool RX_OVERRUNS       = ALL(HAS_DGUS_LCD, SERIAL_STATS_RX_BUFFER_OVERRUNS);
+    static constexpr bool LINK_STATS        = false;
   };
 
   typedef Serial1Class< MarlinSerial< LCDSerialCfg<LCD_SERIAL_PORT> > > MSerialLCD;
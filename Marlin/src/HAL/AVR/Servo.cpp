@@ -61,6 +61,75 @@
 #include "../shared/servo.h"
 #include "../shared/servo_private.h"
 
+#if ENABLED(SERVO_SHARED_TIMER)
+
+/**
+ * Servo pulses from Timer 0 Compare B
+ *
+ * Timer 0 runs the millis() clock in fast PWM mode at 4us per count, so there is
+ * exactly one compare match in each 1.024ms cycle. OCR0B is double-buffered and
+ * a new value takes effect in the next cycle. So each pulse starts at a fixed
+ * count and ends in a later cycle at (start + width). Servos are pulsed one at a
+ * time, and the frame restarts after REFRESH_INTERVAL.
+ */
+#define SERVO_START_COUNT   192                                 // Clear of millis() at 0 and the temperature ISR at 128
+#define SERVO_FRAME_CYCLES  ((REFRESH_INTERVAL) / 1024 + 1)     // Timer 0 cycles per servo frame
+
+static uint8_t pulse_chan;                                      // The servo being pulsed, or waited for
+static bool pulse_high;                                         // Its pin is high
+
+ISR(TIMER0_COMPB_vect) {
+  static uint8_t skip, cycles;
+
+  if (cycles < 255) ++cycles;
+  if (skip) { --skip; return; }
+
+  if (pulse_high) {                                             // The pulse is done
+    extDigitalWrite(servo_info[pulse_chan].Pin.nbr, LOW);
+    pulse_high = false;
+    ++pulse_chan;
+    OCR0B = SERVO_START_COUNT;                                  // Next match at the start count
+    return;
+  }
+
+  if (pulse_chan >= ServoCount) {                               // All servos done. Wait for the next frame.
+    if (cycles < SERVO_FRAME_CYCLES) return;
+    pulse_chan = 0;
+  }
+  if (pulse_chan == 0) cycles = 0;
+
+  const ServoInfo_t &info = servo_info[pulse_chan];
+  if (!info.Pin.isActive) { ++pulse_chan; return; }             // Try the next servo in the next cycle
+
+  // Start the pulse now, at the start count. Ticks of 0.5us are rounded to 4us counts.
+  const uint16_t end = _MAX(256U, SERVO_START_COUNT + ((info.ticks + 4U) >> 3));
+  extDigitalWrite(info.Pin.nbr, HIGH);
+  pulse_high = true;
+  OCR0B = end & 0xFF;                                           // Match in a later cycle...
+  skip = (end >> 8) - 1;                                        // ...after skipping any cycles in between
+}
+
+void initISR(const timer16_Sequence_t) {
+  CRITICAL_SECTION_START();
+  OCR0B = SERVO_START_COUNT;
+  TIFR0 = _BV(OCF0B);                                           // Clear any pending interrupt
+  SBI(TIMSK0, OCIE0B);
+  CRITICAL_SECTION_END();
+}
+
+void finISR(const timer16_Sequence_t) {
+  CRITICAL_SECTION_START();
+  CBI(TIMSK0, OCIE0B);
+  if (pulse_high) {                                             // Don't leave a pulse hanging
+    extDigitalWrite(servo_info[pulse_chan].Pin.nbr, LOW);
+    pulse_high = false;
+    OCR0B = SERVO_START_COUNT;
+  }
+  CRITICAL_SECTION_END();
+}
+
+#else // !SERVO_SHARED_TIMER
+
 static volatile int8_t Channel[_Nbr_16timers];              // counter for the servo being pulsed for each timer (or -1 if refresh interval)
 
 /************ static functions common to all instances ***********************/
@@ -220,6 +289,8 @@ void finISR(const timer16_Sequence_t timer_index) {
   #endif
 }
 
+#endif // !SERVO_SHARED_TIMER
+
 #endif // HAS_SERVOS
 
 #endif // __AVR__
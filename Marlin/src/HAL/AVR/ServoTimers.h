@@ -57,7 +57,9 @@
 #define SERVO_TIMER_PRESCALER   8   // timer prescaler
 
 // Say which 16 bit timers can be used and in what order
-#if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+#if ENABLED(SERVO_SHARED_TIMER)
+  // Pulses come from Timer 0 Compare B, so no 16 bit timer is taken
+#elif defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
   //#define _useTimer1
   #define _useTimer4
   #if NUM_SERVOS > SERVOS_PER_TIMER
@@ -77,6 +79,9 @@
 #endif
 
 typedef enum {
+  #if ENABLED(SERVO_SHARED_TIMER)
+    _timer0,
+  #endif
   #ifdef _useTimer1
     _timer1,
   #endif
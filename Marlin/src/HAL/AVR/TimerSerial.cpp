@@ -0,0 +1,183 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __AVR__
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(TMC_TIMER_SERIAL)
+
+#include "TimerSerial.h"
+
+#define _TIMER_SERIAL_DEF(A) TERN_(A##_HAS_TIMER_SERIAL, TimerSerial tmcTimerSerial##A(A##_SERIAL_RX_PIN, A##_SERIAL_TX_PIN);)
+MAP(_TIMER_SERIAL_DEF, X, X2, Y, Y2, Z, Z2, Z3, Z4, I, J, K, U, V, W, E0, E1, E2, E3, E4, E5, E6, E7)
+#undef _TIMER_SERIAL_DEF
+
+#define TS_REG_(R,S)  CAT(CAT(R, TMC_TIMER_SERIAL_TIMER), S)
+
+#define TX_SIZE    4        // Queued bytes to send. A power of 2.
+#define RX_SIZE   16        // Received bytes. A power of 2.
+#define IDLE_TICKS (3 * 64) // Stop the timer after 64 quiet bit times
+
+TimerSerial *TimerSerial::active; // = nullptr
+
+// The line of the active port
+static volatile uint8_t *tx_out, *tx_ddr, *rx_in;
+static uint8_t tx_mask, rx_mask;
+static bool one_wire;               // RX and TX on the same pin
+
+// Transfer state shared with the ISR
+static volatile uint8_t tx_buf[TX_SIZE], tx_head, tx_tail, tx_bits;
+static volatile uint16_t tx_shift;
+static volatile uint8_t rx_buf[RX_SIZE], rx_head, rx_tail, rx_bits, rx_byte;
+static volatile uint8_t ticks, idle;
+
+ISR(TS_REG_(TIMER, _COMPA_vect)) { TimerSerial::tick(); }
+
+// Drive a shared pin for sending, or release it to its pull-up for the reply
+static void line_out() { *tx_out |= tx_mask; *tx_ddr |= tx_mask; }
+static void line_in()  { *tx_ddr &= ~tx_mask; *tx_out |= tx_mask; }
+
+// Low start bit, 8 data bits LSB first, high stop bit
+static void load(const uint8_t c) { tx_shift = (uint16_t(c) << 1) | 0x200; tx_bits = 10; }
+
+void TimerSerial::tick() {
+  if (tx_bits) {
+    if (--ticks) return;
+    ticks = 3;
+    if (tx_shift & 1) *tx_out |= tx_mask; else *tx_out &= ~tx_mask;
+    tx_shift >>= 1;
+    if (--tx_bits) return;
+
+    // The stop bit is out. Send the next byte or listen for the reply.
+    if (tx_head != tx_tail) {
+      load(tx_buf[tx_tail]);
+      tx_tail = (tx_tail + 1) & (TX_SIZE - 1);
+    }
+    else {
+      if (one_wire) line_in();
+      rx_bits = 0;
+      idle = IDLE_TICKS;
+    }
+    return;
+  }
+
+  if (rx_bits) {
+    if (--ticks) return;
+    ticks = 3;
+    const bool bit = *rx_in & rx_mask;
+    if (--rx_bits) {
+      rx_byte = (rx_byte >> 1) | (bit ? 0x80 : 0);
+      return;
+    }
+    // Keep the byte only with a valid stop bit
+    if (bit) {
+      const uint8_t h = (rx_head + 1) & (RX_SIZE - 1);
+      if (h != rx_tail) { rx_buf[rx_head] = rx_byte; rx_head = h; }
+    }
+    idle = IDLE_TICKS;
+    return;
+  }
+
+  // A start bit began within the last tick. The center of data bit 0 is 4 ticks away.
+  if (!(*rx_in & rx_mask)) { rx_bits = 9; ticks = 4; return; }
+
+  if (!--idle) TS_REG_(TIMSK, ) &= ~_BV(TS_REG_(OCIE, A));
+}
+
+void TimerSerial::begin(const long baud) {
+  if (rx_pin == tx_pin)
+    pinMode(tx_pin, INPUT_PULLUP);
+  else {
+    pinMode(tx_pin, OUTPUT);
+    digitalWrite(tx_pin, HIGH);
+    pinMode(rx_pin, INPUT_PULLUP);
+  }
+
+  // CTC mode at clock / 1, three ticks per bit. The interrupt is only on during transfers.
+  TS_REG_(TIMSK, ) &= ~_BV(TS_REG_(OCIE, A));
+  TS_REG_(TCCR, A) = 0;
+  TS_REG_(TCCR, B) = _BV(TS_REG_(WGM, 2)) | _BV(TS_REG_(CS, 0));
+  TS_REG_(OCR, A) = (F_CPU) / (3 * baud) - 1;
+}
+
+void TimerSerial::select() {
+  flush();
+  const bool was_on = hal.isr_state();
+  hal.isr_off();
+  tx_out = portOutputRegister(digitalPinToPort(tx_pin));
+  tx_ddr = portModeRegister(digitalPinToPort(tx_pin));
+  tx_mask = digitalPinToBitMask(tx_pin);
+  rx_in = portInputRegister(digitalPinToPort(rx_pin));
+  rx_mask = digitalPinToBitMask(rx_pin);
+  one_wire = rx_pin == tx_pin;
+  rx_bits = rx_head = rx_tail = 0;
+  active = this;
+  if (was_on) hal.isr_on();
+}
+
+size_t TimerSerial::write(const uint8_t c) {
+  if (active != this) select();
+
+  // A slot frees up within one byte time
+  const uint8_t next = (tx_head + 1) & (TX_SIZE - 1);
+  while (next == tx_tail) { /* nada */ }
+
+  const bool was_on = hal.isr_state();
+  hal.isr_off();
+  if (tx_bits) {
+    tx_buf[tx_head] = c;
+    tx_head = next;
+  }
+  else {
+    // Start sending on the next tick
+    rx_bits = 0;
+    if (one_wire) line_out();
+    load(c);
+    ticks = 1;
+    TS_REG_(TIFR, ) = _BV(TS_REG_(OCF, A));
+    TS_REG_(TIMSK, ) |= _BV(TS_REG_(OCIE, A));
+  }
+  if (was_on) hal.isr_on();
+  return 1;
+}
+
+int TimerSerial::available() {
+  return active == this ? (rx_head - rx_tail) & (RX_SIZE - 1) : 0;
+}
+
+int TimerSerial::peek() {
+  return available() ? rx_buf[rx_tail] : -1;
+}
+
+int TimerSerial::read() {
+  if (!available()) return -1;
+  const uint8_t c = rx_buf[rx_tail];
+  rx_tail = (rx_tail + 1) & (RX_SIZE - 1);
+  return c;
+}
+
+void TimerSerial::flush() {
+  while (tx_bits) { /* nada */ }
+}
+
+#endif // TMC_TIMER_SERIAL
+#endif // __AVR__
@@ -0,0 +1,65 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * Timer Serial
+ *
+ * A half-duplex software UART for TMC2208/2209 drivers, run from the compare
+ * interrupt of a spare 16-bit timer at three ticks per bit. SoftwareSerial
+ * keeps interrupts off for a whole byte. This ISR takes a few microseconds per
+ * tick and can preempt the stepper ISR, so stepping goes on during a transfer.
+ *
+ * The timer runs only from the first byte written until the line has been idle
+ * for a while after the reply. Writes are queued and return at once, unless the
+ * queue is full. Replies are buffered for available() / read(). One port uses
+ * the line at a time, so drivers can share pins.
+ */
+
+#include <Stream.h>
+
+class TimerSerial : public Stream {
+  public:
+    TimerSerial(const pin_t rx, const pin_t tx) : rx_pin(rx), tx_pin(tx) {}
+
+    void begin(const long baud);
+    void end() { flush(); }
+
+    size_t write(const uint8_t c) override;
+    using Print::write;
+    int available() override;
+    int read() override;
+    int peek() override;
+    void flush() override;
+
+    static void tick();   // Timer compare interrupt
+
+  private:
+    const pin_t rx_pin, tx_pin;
+
+    static TimerSerial *active;   // The port that has the line
+    void select();
+};
+
+#define _TIMER_SERIAL_DECL(A) TERN_(A##_HAS_TIMER_SERIAL, extern TimerSerial tmcTimerSerial##A;)
+MAP(_TIMER_SERIAL_DECL, X, X2, Y, Y2, Z, Z2, Z3, Z4, I, J, K, U, V, W, E0, E1, E2, E3, E4, E5, E6, E7)
+#undef _TIMER_SERIAL_DECL
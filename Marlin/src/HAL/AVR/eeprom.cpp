@@ -32,21 +32,103 @@
 
 #include "../shared/eeprom_api.h"
 
+#if ENABLED(COOPERATIVE_YIELD)
+  #include "../../MarlinCore.h"
+#endif
+
 #ifndef MARLIN_EEPROM_SIZE
   #define MARLIN_EEPROM_SIZE size_t(E2END + 1)
 #endif
-size_t PersistentStore::capacity()    { return MARLIN_EEPROM_SIZE; }
-bool PersistentStore::access_start()  { return true; }
-bool PersistentStore::access_finish() { return true; }
+
+#if ENABLED(SDCARD_EEPROM_EXTENSION)
+
+  /**
+   * Addresses past the end of the EEPROM go to a contiguous file on the SD
+   * card, accessed as raw blocks. The settings stay in the EEPROM and load
+   * without media. The meshes, stored at the top, go to the card.
+   *
+   * The file is found on the first access past the EEPROM. The block being
+   * accessed is kept in the borrowed volume cache and written back when
+   * another block is needed or the access is finished.
+   */
+
+  #include "../../sd/cardreader.h"
+
+  #define EEPROM_EXT_FILENAME "EEPROMX.DAT"
+
+  static uint32_t ext_first_block;    // First block of the file, 0 if not found yet
+  static uint8_t *ext_cache;          // The cached block
+  static uint16_t ext_cached = 0xFFFF; // Index of the cached block in the file
+  static bool ext_dirty;
+
+  static bool ext_flush() {
+    if (!ext_dirty) return true;
+    ext_dirty = false;
+    return card.rawWrite(ext_first_block + ext_cached, ext_cache);
+  }
+
+  // Get the cached byte at an offset into the file, or nullptr on failure
+  static uint8_t* ext_byte(const uint16_t ofs) {
+    const uint16_t b = ofs >> 9;
+    if (b != ext_cached) {
+      if (!ext_first_block)
+        ext_first_block = card.openContiguous(EEPROM_EXT_FILENAME, SDCARD_EEPROM_EXTENSION_BLOCKS, 0xFF);
+      if (!ext_first_block || !ext_flush()) return nullptr;
+      ext_cache = card.rawRead(ext_first_block + b);
+      ext_cached = ext_cache ? b : 0xFFFF;
+      if (!ext_cache) return nullptr;
+    }
+    return &ext_cache[ofs & 0x1FF];
+  }
+
+  size_t PersistentStore::capacity() { return MARLIN_EEPROM_SIZE + (SDCARD_EEPROM_EXTENSION_BLOCKS) * 512U; }
+
+  bool PersistentStore::access_start() {
+    ext_first_block = 0;              // The media may have been swapped
+    ext_cached = 0xFFFF;
+    ext_dirty = false;
+    return true;
+  }
+
+  bool PersistentStore::access_finish() {
+    const bool ok = ext_flush();
+    ext_cached = 0xFFFF;              // Release the volume cache
+    return ok;
+  }
+
+#else
+
+  size_t PersistentStore::capacity()    { return MARLIN_EEPROM_SIZE; }
+  bool PersistentStore::access_start()  { return true; }
+  bool PersistentStore::access_finish() { return true; }
+
+#endif
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
-  uint16_t written = 0;
+  #if DISABLED(COOPERATIVE_YIELD)
+    uint16_t written = 0;
+  #endif
   while (size--) {
     uint8_t * const p = (uint8_t * const)pos;
     uint8_t v = *value;
+    #if ENABLED(SDCARD_EEPROM_EXTENSION)
+      if (pos >= int(MARLIN_EEPROM_SIZE)) {
+        uint8_t * const e = ext_byte(pos - MARLIN_EEPROM_SIZE);
+        if (!e) {
+          SERIAL_ECHO_MSG(STR_ERR_EEPROM_WRITE);
+          return true;
+        }
+        if (*e != v) { *e = v; ext_dirty = true; }
+      }
+      else
+    #endif
     if (v != eeprom_read_byte(p)) { // EEPROM has only ~100,000 write cycles, so only write bytes that have changed!
       eeprom_write_byte(p, v);
-      if (++written & 0x7F) delay(2); else safe_delay(2); // Avoid triggering watchdog during long EEPROM writes
+      #if ENABLED(COOPERATIVE_YIELD)
+        delay(2); idle_yield();                             // Keep heaters and serial going during long EEPROM writes
+      #else
+        if (++written & 0x7F) delay(2); else safe_delay(2); // Avoid triggering watchdog during long EEPROM writes
+      #endif
       if (eeprom_read_byte(p) != v) {
         SERIAL_ECHO_MSG(STR_ERR_EEPROM_WRITE);
         return true;
@@ -61,7 +143,18 @@ bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, ui
 
 bool PersistentStore::read_data(int &pos, uint8_t *value, size_t size, uint16_t *crc, const bool writing/*=true*/) {
   do {
-    uint8_t c = eeprom_read_byte((uint8_t*)pos);
+    #if ENABLED(SDCARD_EEPROM_EXTENSION)
+      uint8_t c;
+      if (pos >= int(MARLIN_EEPROM_SIZE)) {
+        const uint8_t * const e = ext_byte(pos - MARLIN_EEPROM_SIZE);
+        if (!e) return true;
+        c = *e;
+      }
+      else
+        c = eeprom_read_byte((uint8_t*)pos);
+    #else
+      uint8_t c = eeprom_read_byte((uint8_t*)pos);
+    #endif
     if (writing) *value = c;
     crc16(crc, &c, 1);
     pos++;
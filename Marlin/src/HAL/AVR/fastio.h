@@ -83,6 +83,11 @@
 
 #define _TOGGLE(IO)           (DIO ## IO ## _RPORT = _BV(DIO ## IO ## _PIN))
 
+// Input register and bit mask of a pin. Several pins on one port can be
+// toggled together by writing their combined mask to the input register.
+#define _IO_RPORT(IO)         DIO ## IO ## _RPORT
+#define _IO_MASK(IO)          _BV(DIO ## IO ## _PIN)
+
 #define _SET_INPUT(IO)        CBI(DIO ## IO ## _DDR, DIO ## IO ## _PIN)
 #define _SET_OUTPUT(IO)       SBI(DIO ## IO ## _DDR, DIO ## IO ## _PIN)
 
@@ -101,6 +106,8 @@
 #define READ(IO)              _READ(IO)
 #define WRITE(IO,V)           _WRITE(IO,V)
 #define TOGGLE(IO)            _TOGGLE(IO)
+#define IO_RPORT(IO)          _IO_RPORT(IO)
+#define IO_MASK(IO)           _IO_MASK(IO)
 
 #define SET_INPUT(IO)         _SET_INPUT(IO)
 #define SET_INPUT_PULLUP(IO)  do{ _SET_INPUT(IO); _WRITE(IO, HIGH); }while(0)
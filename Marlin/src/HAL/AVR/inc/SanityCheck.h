@@ -78,6 +78,75 @@
   #error "Disable SPEAKER or enable FAN_SOFT_PWM."
 #endif
 
+/**
+ * Checks for heater hardware PWM
+ */
+#if ENABLED(HEATER_HW_PWM)
+  #include "../ServoTimers.h"   // Needed to check timer availability (_useTimer3/4/5)
+  #if !AVR_ATmega2560_FAMILY
+    #error "HEATER_HW_PWM is only supported on ATmega1280/2560."
+  #elif ENABLED(HW_PWM_HOTEND) && !PWM_PIN(HEATER_0_PIN)
+    #error "HW_PWM_HOTEND requires HEATER_0_PIN to be a hardware PWM pin."
+  #elif ENABLED(HW_PWM_BED) && !PWM_PIN(HEATER_BED_PIN)
+    #error "HW_PWM_BED requires HEATER_BED_PIN to be a hardware PWM pin."
+  #endif
+  // Timer of a PWM_PIN on the ATmega1280/2560
+  #define _HW_PWM_TIMER(P) (WITHIN(P, 9, 10) ? 2 : (P == 2 || P == 3 || P == 5) ? 3 : WITHIN(P, 6, 8) ? 4 : WITHIN(P, 44, 46) ? 5 : 0)
+  #define _HW_PWM_USES(T) ((ENABLED(HW_PWM_HOTEND) && _HW_PWM_TIMER(HEATER_0_PIN) == T) || (ENABLED(HW_PWM_BED) && _HW_PWM_TIMER(HEATER_BED_PIN) == T))
+  #if _HW_PWM_USES(0)
+    #error "HEATER_HW_PWM can't use Timer 0, which runs millis() and the temperature ISR."
+  #elif _HW_PWM_USES(2) && ENABLED(SPEAKER)
+    #error "HEATER_HW_PWM uses Timer 2, which SPEAKER needs for tones. Disable SPEAKER or HW_PWM_HOTEND."
+  #elif NUM_SERVOS > 0 && ((_HW_PWM_USES(3) && defined(_useTimer3)) || (_HW_PWM_USES(4) && defined(_useTimer4)) || (_HW_PWM_USES(5) && defined(_useTimer5)))
+    #error "HEATER_HW_PWM uses a timer that is used by the servo system."
+  #elif _HW_PWM_USES(5) && HAS_MOTOR_CURRENT_PWM
+    #error "HEATER_HW_PWM uses Timer 5, which is used for motor current PWM."
+  #elif ENABLED(ISR_PROFILER) && _HW_PWM_USES(ISR_PROFILER_TIMER)
+    #error "HEATER_HW_PWM uses the ISR_PROFILER_TIMER."
+  #elif ENABLED(STEP_CAPTURE) && _HW_PWM_USES(STEP_CAPTURE_TIMER)
+    #error "HEATER_HW_PWM uses the STEP_CAPTURE_TIMER."
+  #elif ENABLED(TMC_TIMER_SERIAL) && _HW_PWM_USES(TMC_TIMER_SERIAL_TIMER)
+    #error "HEATER_HW_PWM uses the TMC_TIMER_SERIAL_TIMER."
+  #endif
+  #undef _HW_PWM_TIMER
+  #undef _HW_PWM_USES
+#endif
+
+/**
+ * Checks for the TMC timer-driven serial
+ */
+#if ENABLED(TMC_TIMER_SERIAL)
+  #include "../ServoTimers.h"   // Needed to check timer availability (_useTimer3)
+  #if TMC_TIMER_SERIAL_TIMER != 3 && TMC_TIMER_SERIAL_TIMER != 5
+    #error "TMC_TIMER_SERIAL_TIMER must be 3 or 5."
+  #elif !defined(TIMSK5) && TMC_TIMER_SERIAL_TIMER == 5
+    #error "TMC_TIMER_SERIAL_TIMER 5 is not available on this MCU."
+  #elif TMC_TIMER_SERIAL_TIMER == 3 && NUM_SERVOS > 0 && defined(_useTimer3)
+    #error "TMC_TIMER_SERIAL_TIMER 3 is used by the servo system."
+  #elif TMC_TIMER_SERIAL_TIMER == 5 && HAS_MOTOR_CURRENT_PWM
+    #error "TMC_TIMER_SERIAL_TIMER 5 is used for motor current PWM."
+  #elif ENABLED(ISR_PROFILER) && TMC_TIMER_SERIAL_TIMER == ISR_PROFILER_TIMER
+    #error "TMC_TIMER_SERIAL_TIMER and ISR_PROFILER_TIMER must be different timers."
+  #elif ENABLED(STEP_CAPTURE) && TMC_TIMER_SERIAL_TIMER == STEP_CAPTURE_TIMER
+    #error "TMC_TIMER_SERIAL_TIMER and STEP_CAPTURE_TIMER must be different timers."
+  #elif defined(TMC_BAUD_RATE) && TMC_BAUD_RATE > 38400
+    #error "TMC_TIMER_SERIAL supports a TMC_BAUD_RATE of 38400 at most."
+  #endif
+#endif
+
+/**
+ * SERVO_SHARED_TIMER uses OCR0B, so pin D4 (OC0B) can't have hardware PWM
+ */
+#if ENABLED(SERVO_SHARED_TIMER)
+  #if !HAS_SERVOS
+    #error "SERVO_SHARED_TIMER requires NUM_SERVOS > 0."
+  #elif DISABLED(FAN_SOFT_PWM) && (FAN0_PIN == 4 || FAN1_PIN == 4 || FAN2_PIN == 4 || TERN0(USE_CONTROLLER_FAN, CONTROLLER_FAN_PIN == 4) || E0_AUTO_FAN_PIN == 4)
+    #error "SERVO_SHARED_TIMER needs Timer 0 Compare B, used for PWM on pin D4. Enable FAN_SOFT_PWM or move the fan."
+  #elif ENABLED(HEATER_HW_PWM) && (TERN0(HW_PWM_HOTEND, HEATER_0_PIN == 4) || TERN0(HW_PWM_BED, HEATER_BED_PIN == 4))
+    #error "SERVO_SHARED_TIMER needs Timer 0 Compare B, used by HEATER_HW_PWM on pin D4."
+  #endif
+#endif
+
 /**
  * Sanity checks for Spindle / Laser PWM
  */
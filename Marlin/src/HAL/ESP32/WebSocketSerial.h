@@ -40,9 +40,12 @@
 
 typedef uint16_t ring_buffer_pos_t;
 
+// Single producer, single consumer. For RX the producer is the AsyncTCP task,
+// which may run on the other core, so each side only writes its own index.
 class RingBuffer {
   uint8_t *data;
-  ring_buffer_pos_t size, read_index, write_index;
+  ring_buffer_pos_t size;
+  volatile ring_buffer_pos_t read_index, write_index;
 
 public:
   RingBuffer(ring_buffer_pos_t size);
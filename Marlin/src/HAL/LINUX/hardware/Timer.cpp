@@ -24,6 +24,11 @@
 #include "Timer.h"
 #include <stdio.h>
 
+#ifdef LINUX_RT_TIMERS
+  #include <pthread.h>
+  #include <sched.h>
+#endif
+
 Timer::Timer() {
   active = false;
   compare = 0;
@@ -34,8 +39,83 @@ Timer::Timer() {
   period = 0;
   start_time = 0;
   avg_error = 0;
+  max_late = 0;
+}
+
+#ifdef LINUX_RT_TIMERS
+
+Timer::~Timer() {}
+
+void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
+  frequency = sim_freq;
+  cbfn = fn;
+  priority = sig_id; // Timer 0 (stepper) gets the highest priority
+  std::thread(&Timer::run, this).detach();
+}
+
+void Timer::run() {
+  #ifdef LINUX_RT_TIMERS_CPU
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(LINUX_RT_TIMERS_CPU, &cpus);
+    pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+  #endif
+  sched_param param;
+  param.sched_priority = sched_get_priority_max(SCHED_FIFO) - priority;
+  if (pthread_setschedparam(pthread_self(), SCHED_FIFO, &param))
+    printf("timer(%d) not real-time\n", int(priority));
+
+  auto now_ns = []{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return uint64_t(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+  };
+  auto sleep_until = [](const uint64_t ns) {
+    timespec ts;
+    ts.tv_sec = ns / 1000000000ULL;
+    ts.tv_nsec = ns % 1000000000ULL;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr)) { /* interrupted */ }
+  };
+
+  uint64_t deadline = now_ns();
+  for (;;) {
+    const uint64_t ns = period;
+    if (!active || !ns) {
+      // Poll until enabled, then count the first period from now
+      deadline = now_ns() + 50000;
+      sleep_until(deadline);
+      continue;
+    }
+
+    // Each period follows the last deadline, not the wakeup, so lateness doesn't accumulate
+    deadline += ns;
+    sleep_until(deadline);
+
+    const uint64_t late = now_ns() - deadline;
+    avg_error = (avg_error + late) / 2;
+    if (late > max_late) max_late = late;
+    if (late > ns) { ++overruns; deadline += late; } // Drop missed periods instead of catching up in a burst
+
+    start_time = Clock::nanos();
+    if (active) cbfn(); // The callback may set the next period with setCompare
+  }
 }
 
+void Timer::start(uint32_t frequency) {
+  setCompare(this->frequency / frequency);
+}
+
+void Timer::enable() { active = true; }
+
+void Timer::disable() { active = false; }
+
+void Timer::setCompare(uint32_t compare) {
+  this->compare = compare;
+  period = Clock::ticksToNanos(compare, frequency);
+}
+
+#else // !LINUX_RT_TIMERS
+
 Timer::~Timer() {
   timer_delete(timerid);
 }
@@ -110,6 +190,8 @@ void Timer::setCompare(uint32_t compare) {
   this->start_time = Clock::nanos();
 }
 
+#endif // !LINUX_RT_TIMERS
+
 uint32_t Timer::getCount() {
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
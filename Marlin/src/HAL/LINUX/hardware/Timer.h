@@ -30,6 +30,17 @@
 
 #include "Clock.h"
 
+/**
+ * Build with -DLINUX_RT_TIMERS to run each timer in its own SCHED_FIFO thread,
+ * sleeping to absolute deadlines with clock_nanosleep, instead of POSIX signal
+ * timers. Add -DLINUX_RT_TIMERS_CPU=<n> to pin the threads to an isolated core.
+ * Real-time scheduling needs CAP_SYS_NICE, otherwise the threads run normally.
+ */
+#ifdef LINUX_RT_TIMERS
+  #include <atomic>
+  #include <thread>
+#endif
+
 class Timer {
 public:
   Timer();
@@ -47,11 +58,16 @@ public:
   uint32_t getCompare() {return compare;}
   uint32_t getOverruns() {return overruns;}
   uint32_t getAvgError() {return avg_error;}
+  uint64_t getMaxLate() {return max_late;}
 
   intptr_t getID() {
     return (*(intptr_t*)timerid);
   }
 
+  #ifdef LINUX_RT_TIMERS
+    void run();
+  #endif
+
   static void handler(int sig, siginfo_t *si, void *uc) {
     Timer* _this = (Timer*)si->si_value.sival_ptr;
     _this->avg_error += (Clock::nanos() - _this->start_time) - _this->period; //high_resolution_clock is also limited in precision, but best we have
@@ -63,14 +79,21 @@ public:
   }
 
 private:
-  bool active;
+  #ifdef LINUX_RT_TIMERS
+    std::atomic<bool> active;
+    std::atomic<uint64_t> period;
+    uint32_t priority;
+  #else
+    bool active;
+    uint64_t period;
+  #endif
   uint32_t compare;
   uint32_t frequency;
   uint32_t overruns;
   timer_t timerid;
   sigset_t mask;
   callback_fn* cbfn;
-  uint64_t period;
   uint64_t avg_error;
+  uint64_t max_late;
   uint64_t start_time;
 };
@@ -42,6 +42,15 @@ bool PersistentStore::access_start()  { eeprom_init(); return true; }
 bool PersistentStore::access_finish() { return true; }
 
 bool PersistentStore::write_data(int &pos, const uint8_t *value, size_t size, uint16_t *crc) {
+  #if ENABLED(EEPROM_PAGE_WRITE)
+    if (eeprom_update_block((uint8_t*)pos, value, size)) {
+      SERIAL_ECHO_MSG(STR_ERR_EEPROM_WRITE);
+      return true;
+    }
+    crc16(crc, value, size);
+    pos += size;
+    return false;
+  #endif
   uint16_t written = 0;
   while (size--) {
     uint8_t v = *value;
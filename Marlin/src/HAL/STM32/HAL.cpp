@@ -104,6 +104,9 @@ void MarlinHAL::init() {
 
 // HAL idle task
 void MarlinHAL::idletask() {
+  // Catch emergency commands in serial DMA buffers
+  TERN_(SERIAL_DMA, MarlinSerial::update_rx_all());
+
   #if HAS_SHARED_MEDIA
     // Stm32duino currently doesn't have a "loop/idle" method
     CDC_resume_receive();
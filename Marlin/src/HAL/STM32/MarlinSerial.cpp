@@ -86,12 +86,104 @@
   DECLARE_SERIAL_PORT(LP1)
 #endif
 
+#if ENABLED(SERIAL_DMA)
+
+  // Ports receiving with DMA, polled by update_rx_all()
+  static MarlinSerial *dma_ports[4];
+  static uint8_t dma_port_count; // = 0
+
+  // Select the RX DMA stream (F4) or channel (F1) of the port
+  bool MarlinSerial::rx_dma_init() {
+    USART_TypeDef * const uart = (USART_TypeDef*)_serial.uart;
+    #ifdef STM32F4xx
+      if (uart == USART1)       { __HAL_RCC_DMA2_CLK_ENABLE(); dma_rx.Instance = DMA2_Stream2; dma_rx.Init.Channel = DMA_CHANNEL_4; }
+      else if (uart == USART2)  { __HAL_RCC_DMA1_CLK_ENABLE(); dma_rx.Instance = DMA1_Stream5; dma_rx.Init.Channel = DMA_CHANNEL_4; }
+      else if (uart == USART3)  { __HAL_RCC_DMA1_CLK_ENABLE(); dma_rx.Instance = DMA1_Stream1; dma_rx.Init.Channel = DMA_CHANNEL_4; }
+      #ifdef UART4
+        else if (uart == UART4) { __HAL_RCC_DMA1_CLK_ENABLE(); dma_rx.Instance = DMA1_Stream2; dma_rx.Init.Channel = DMA_CHANNEL_4; }
+      #endif
+      #ifdef UART5
+        else if (uart == UART5) { __HAL_RCC_DMA1_CLK_ENABLE(); dma_rx.Instance = DMA1_Stream0; dma_rx.Init.Channel = DMA_CHANNEL_4; }
+      #endif
+      #ifdef USART6
+        else if (uart == USART6) { __HAL_RCC_DMA2_CLK_ENABLE(); dma_rx.Instance = DMA2_Stream1; dma_rx.Init.Channel = DMA_CHANNEL_5; }
+      #endif
+      else return false;
+      dma_rx.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+    #else
+      if (uart == USART1)       { __HAL_RCC_DMA1_CLK_ENABLE(); dma_rx.Instance = DMA1_Channel5; }
+      else if (uart == USART2)  { __HAL_RCC_DMA1_CLK_ENABLE(); dma_rx.Instance = DMA1_Channel6; }
+      else if (uart == USART3)  { __HAL_RCC_DMA1_CLK_ENABLE(); dma_rx.Instance = DMA1_Channel3; }
+      #if defined(UART4) && defined(DMA2)
+        else if (uart == UART4) { __HAL_RCC_DMA2_CLK_ENABLE(); dma_rx.Instance = DMA2_Channel3; }
+      #endif
+      else return false;
+    #endif
+
+    dma_rx.Init.Direction = DMA_PERIPH_TO_MEMORY;
+    dma_rx.Init.PeriphInc = DMA_PINC_DISABLE;
+    dma_rx.Init.MemInc = DMA_MINC_ENABLE;
+    dma_rx.Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    dma_rx.Init.MemDataAlignment = DMA_MDATAALIGN_BYTE;
+    dma_rx.Init.Mode = DMA_CIRCULAR;
+    dma_rx.Init.Priority = DMA_PRIORITY_MEDIUM;
+    return HAL_DMA_Init(&dma_rx) == HAL_OK;
+  }
+
+#endif
+
 void MarlinSerial::begin(unsigned long baud, uint8_t config) {
   HardwareSerial::begin(baud, config);
   // Replace the IRQ callback with the one we have defined
   TERN_(EMERGENCY_PARSER, _serial.rx_callback = _rx_callback);
+
+  #if ENABLED(SERIAL_DMA)
+    // Stop the per-byte interrupt and let DMA fill rx_buff in a circle.
+    // The DMA interrupts stay off in the NVIC, so nothing interrupts per byte or per buffer.
+    if (!rx_dma_init()) return;               // No DMA for this port. Keep the interrupt.
+    UART_HandleTypeDef * const huart = &_serial.handle;
+    HAL_UART_AbortReceive(huart);
+    __HAL_LINKDMA(huart, hdmarx, dma_rx);
+    _serial.rx_head = _serial.rx_tail = 0;
+    TERN_(EMERGENCY_PARSER, rx_parsed = 0);
+    if (HAL_UART_Receive_DMA(huart, _serial.rx_buff, SERIAL_RX_BUFFER_SIZE) != HAL_OK) {
+      huart->hdmarx = nullptr;
+      HAL_UART_Receive_IT(huart, &_serial.recv, 1);
+      return;
+    }
+    // Line errors would make the HAL abort the DMA. Leave them to the G-code checksum.
+    CLEAR_BIT(huart->Instance->CR1, USART_CR1_PEIE);
+    CLEAR_BIT(huart->Instance->CR3, USART_CR3_EIE);
+    for (uint8_t i = 0; i < dma_port_count; ++i) if (dma_ports[i] == this) return;
+    if (dma_port_count < COUNT(dma_ports)) dma_ports[dma_port_count++] = this;
+  #endif
 }
 
+#if ENABLED(SERIAL_DMA)
+
+  void MarlinSerial::update_rx() {
+    if (_serial.handle.hdmarx != &dma_rx) return;
+    const uint16_t head = SERIAL_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(&dma_rx);
+    _serial.rx_head = head < SERIAL_RX_BUFFER_SIZE ? head : 0;
+
+    #if ENABLED(EMERGENCY_PARSER)
+      while (rx_parsed != _serial.rx_head) {
+        emergency_parser.update(static_cast<MSerialT*>(this)->emergency_state, _serial.rx_buff[rx_parsed]);
+        rx_parsed = (rx_parsed + 1) % SERIAL_RX_BUFFER_SIZE;
+      }
+    #endif
+  }
+
+  void MarlinSerial::update_rx_all() {
+    for (uint8_t i = 0; i < dma_port_count; ++i) dma_ports[i]->update_rx();
+  }
+
+  int MarlinSerial::available() { update_rx(); return HardwareSerial::available(); }
+  int MarlinSerial::peek()      { update_rx(); return HardwareSerial::peek(); }
+  int MarlinSerial::read()      { update_rx(); return HardwareSerial::read(); }
+
+#endif
+
 // This function is Copyright (c) 2006 Nicholas Zambetti.
 void MarlinSerial::_rx_complete_irq(serial_t *obj) {
   // No Parity error, read byte and store it in the buffer if there is room
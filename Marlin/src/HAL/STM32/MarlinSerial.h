@@ -41,8 +41,24 @@ struct MarlinSerial : public HardwareSerial {
 
   void _rx_complete_irq(serial_t *obj);
 
+  #if ENABLED(SERIAL_DMA)
+    int available();
+    int peek();
+    int read();
+    void update_rx();         // Take the bytes DMA has received and pass them to the Emergency Parser
+    static void update_rx_all();
+  #endif
+
 protected:
   usart_rx_callback_t _rx_callback;
+
+  #if ENABLED(SERIAL_DMA)
+    DMA_HandleTypeDef dma_rx;
+    bool rx_dma_init();
+    #if ENABLED(EMERGENCY_PARSER)
+      uint16_t rx_parsed;     // The next byte for the Emergency Parser
+    #endif
+  #endif
 };
 
 typedef Serial1Class<MarlinSerial> MSerialT;
@@ -27,3 +27,8 @@
 void eeprom_init();
 void eeprom_write_byte(uint8_t *pos, uint8_t value);
 uint8_t eeprom_read_byte(uint8_t *pos);
+
+#if ENABLED(EEPROM_PAGE_WRITE)
+  // Write only the changed bytes of each page in one burst. Return true on error.
+  bool eeprom_update_block(uint8_t *pos, const uint8_t *value, size_t size);
+#endif
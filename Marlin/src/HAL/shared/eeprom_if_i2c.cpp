@@ -82,14 +82,33 @@ static void _eeprom_begin(uint8_t * const pos) {
   eWire.write(uint8_t(eeprom_address & 0xFF));           // Address Low
 }
 
+#if ENABLED(EEPROM_PAGE_WRITE)
+
+  // The chip doesn't acknowledge its address until the write cycle is done.
+  // Return true if it's still busy after a generous timeout.
+  static bool _eeprom_ack_poll(uint8_t * const pos) {
+    const millis_t timeout_ms = millis() + 4 * (EEPROM_WRITE_DELAY);
+    do {
+      eWire.beginTransmission(_eeprom_calc_device_address(pos));
+      if (eWire.endTransmission() == 0) return false;
+    } while (PENDING(millis(), timeout_ms));
+    return true;
+  }
+
+#endif
+
 void eeprom_write_byte(uint8_t *pos, uint8_t value) {
   _eeprom_begin(pos);
   eWire.write(value);
   eWire.endTransmission();
 
   // wait for write cycle to complete
-  // this could be done more efficiently with "acknowledge polling"
-  delay(EEPROM_WRITE_DELAY);
+  #if ENABLED(EEPROM_PAGE_WRITE)
+    _eeprom_ack_poll(pos);
+  #else
+    // this could be done more efficiently with "acknowledge polling"
+    delay(EEPROM_WRITE_DELAY);
+  #endif
 }
 
 uint8_t eeprom_read_byte(uint8_t *pos) {
@@ -99,5 +118,48 @@ uint8_t eeprom_read_byte(uint8_t *pos) {
   return eWire.available() ? eWire.read() : 0xFF;
 }
 
+#if ENABLED(EEPROM_PAGE_WRITE)
+
+  // Read up to one page. Pages never cross a device address boundary.
+  static void _eeprom_read_page(uint8_t * const pos, uint8_t * const buf, const uint8_t n) {
+    _eeprom_begin(pos);
+    eWire.endTransmission();
+    eWire.requestFrom(_eeprom_calc_device_address(pos), n);
+    for (uint8_t i = 0; i < n; ++i) buf[i] = eWire.available() ? eWire.read() : 0xFF;
+  }
+
+  bool eeprom_update_block(uint8_t *pos, const uint8_t *value, size_t size) {
+    uint8_t stored[EEPROM_PAGE_SIZE];
+    while (size) {
+      // Stop each burst at the page boundary, where the chip would wrap around
+      const uint8_t room = EEPROM_PAGE_SIZE - (unsigned(pos) & (EEPROM_PAGE_SIZE - 1)),
+                    n = _MIN(size, size_t(room));
+
+      // Only the span from the first to the last changed byte is written
+      _eeprom_read_page(pos, stored, n);
+      uint8_t first = 0, last = n;
+      while (first < last && stored[first] == value[first]) ++first;
+      while (last > first && stored[last - 1] == value[last - 1]) --last;
+
+      if (first < last) {
+        _eeprom_begin(pos + first);
+        eWire.write(value + first, last - first);
+        eWire.endTransmission();
+        if (_eeprom_ack_poll(pos)) return true;
+        hal.watchdog_refresh();             // Avoid triggering watchdog during long EEPROM writes
+
+        _eeprom_read_page(pos, stored, n);
+        if (memcmp(stored, value, n)) return true;
+      }
+
+      pos += n;
+      value += n;
+      size -= n;
+    }
+    return false;
+  }
+
+#endif // EEPROM_PAGE_WRITE
+
 #endif // USE_SHARED_EEPROM
 #endif // I2C_EEPROM
@@ -36,6 +36,7 @@ void eeprom_init() {}
 #if ENABLED(USE_SHARED_EEPROM)
 
 #define CMD_WREN  6   // WREN
+#define CMD_RDSR  5   // RDSR
 #define CMD_READ  2   // WRITE
 #define CMD_WRITE 2   // WRITE
 
@@ -65,20 +66,89 @@ uint8_t eeprom_read_byte(uint8_t *pos) {
   return v;
 }
 
-void eeprom_write_byte(uint8_t *pos, uint8_t value) {
+#if ENABLED(EEPROM_PAGE_WRITE)
+
+  // Poll the Write-In-Progress bit of the status register.
+  // Return true if it's still busy after a generous timeout.
+  static bool _eeprom_wait_ready() {
+    const uint8_t eeprom_temp = CMD_RDSR;
+    const millis_t timeout_ms = millis() + 4 * (EEPROM_WRITE_DELAY);
+    do {
+      WRITE(SPI_EEPROM1_CS_PIN, LOW);
+      spiSend(SPI_CHAN_EEPROM1, &eeprom_temp, 1);
+      const uint8_t status = spiRec(SPI_CHAN_EEPROM1);
+      WRITE(SPI_EEPROM1_CS_PIN, HIGH);
+      if (!TEST(status, 0)) return false;
+    } while (PENDING(millis(), timeout_ms));
+    return true;
+  }
+
+#endif
+
+static void _eeprom_write_enable() {
   const uint8_t eeprom_temp = CMD_WREN;
   WRITE(SPI_EEPROM1_CS_PIN, LOW);
   spiSend(SPI_CHAN_EEPROM1, &eeprom_temp, 1); // Write Enable
 
   WRITE(SPI_EEPROM1_CS_PIN, HIGH);      // Done with the Bus
   delay(1);                         // For a small amount of time
+}
+
+void eeprom_write_byte(uint8_t *pos, uint8_t value) {
+  _eeprom_write_enable();
 
   _eeprom_begin(pos, CMD_WRITE);    // Set write address and begin transmission
 
   spiSend(SPI_CHAN_EEPROM1, value); // Send the value to be written
   WRITE(SPI_EEPROM1_CS_PIN, HIGH);      // Done with the Bus
-  delay(EEPROM_WRITE_DELAY);        // Give page write time to complete
+  #if ENABLED(EEPROM_PAGE_WRITE)
+    _eeprom_wait_ready();           // Wait for the write cycle to complete
+  #else
+    delay(EEPROM_WRITE_DELAY);      // Give page write time to complete
+  #endif
 }
 
+#if ENABLED(EEPROM_PAGE_WRITE)
+
+  static void _eeprom_read_page(uint8_t * const pos, uint8_t * const buf, const uint8_t n) {
+    _eeprom_begin(pos, CMD_READ);   // Sequential read from this location
+    for (uint8_t i = 0; i < n; ++i) buf[i] = spiRec(SPI_CHAN_EEPROM1);
+    WRITE(SPI_EEPROM1_CS_PIN, HIGH);
+  }
+
+  bool eeprom_update_block(uint8_t *pos, const uint8_t *value, size_t size) {
+    uint8_t stored[EEPROM_PAGE_SIZE];
+    while (size) {
+      // Stop each burst at the page boundary, where the chip would wrap around
+      const uint8_t room = EEPROM_PAGE_SIZE - (unsigned(pos) & (EEPROM_PAGE_SIZE - 1)),
+                    n = _MIN(size, size_t(room));
+
+      // Only the span from the first to the last changed byte is written
+      _eeprom_read_page(pos, stored, n);
+      uint8_t first = 0, last = n;
+      while (first < last && stored[first] == value[first]) ++first;
+      while (last > first && stored[last - 1] == value[last - 1]) --last;
+
+      if (first < last) {
+        _eeprom_write_enable();
+        _eeprom_begin(pos + first, CMD_WRITE);
+        spiSend(SPI_CHAN_EEPROM1, value + first, last - first);
+        WRITE(SPI_EEPROM1_CS_PIN, HIGH);  // Raising CS starts the write cycle
+        if (_eeprom_wait_ready()) return true;
+        hal.watchdog_refresh();             // Avoid triggering watchdog during long EEPROM writes
+
+        _eeprom_read_page(pos, stored, n);
+        if (memcmp(stored, value, n)) return true;
+      }
+
+      pos += n;
+      value += n;
+      size -= n;
+    }
+    return false;
+  }
+
+#endif // EEPROM_PAGE_WRITE
+
 #endif // USE_SHARED_EEPROM
 #endif // I2C_EEPROM
@@ -190,6 +190,60 @@
   #include "feature/cancel_object.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS_PRESCAN)
+  #include "feature/cancel_prescan.h"
+#endif
+
+#if ENABLED(ESTIMATE_REMAINING_TIME)
+  #include "feature/print_estimator.h"
+#endif
+
+#if ENABLED(BACKGROUND_TASKS)
+  #include "feature/bg_tasks.h"
+#endif
+
+#if ENABLED(SEGMENT_COALESCING)
+  #include "feature/coalesce.h"
+#endif
+
+#if ENABLED(PLANNER_BENCHMARK)
+  #include "tests/planner_benchmark.h"
+#endif
+
+#if ENABLED(LINK_BENCHMARK)
+  #include "feature/link_benchmark.h"
+#endif
+
+#if ENABLED(VIRTUAL_STEPPING)
+  #include "feature/virtual_stepper.h"
+#endif
+
+#if ENABLED(ISR_PROFILER)
+  #include "feature/isr_profiler.h"
+#endif
+
+#if ENABLED(STACK_MONITOR)
+  #include "feature/stack_monitor.h"
+#endif
+
+#if ENABLED(CRASH_TRACE)
+  #include "feature/crash_trace.h"
+#endif
+
+#if ENABLED(IDLE_PROFILER)
+  #include "feature/idle_profiler.h"
+#else
+  #define PROFILE_IDLE_TASK(T, V...) do{ V; }while(0)
+#endif
+
+#if ENABLED(FLEET_TELEMETRY)
+  #include "feature/fleet_telemetry.h"
+#endif
+
+#if ENABLED(IDLE_SCHEDULER)
+  #include "feature/idle_scheduler.h"
+#endif
+
 #if HAS_FILAMENT_SENSOR
   #include "feature/runout.h"
 #endif
@@ -352,6 +406,7 @@ void startOrResumeJob() {
     TERN_(CANCEL_OBJECTS, cancelable.reset());
     TERN_(LCD_SHOW_E_TOTAL, e_move_accumulator = 0);
     TERN_(SET_REMAINING_TIME, ui.reset_remaining_time());
+    TERN_(SD_EXTENT_PREFETCH, if (IS_SD_PRINTING()) card.prefetchExtents());
   }
   print_job_timer.start();
 }
@@ -785,14 +840,16 @@ void idle(const bool no_stepper_sleep/*=false*/) {
     if (++idle_depth > 5) SERIAL_ECHOLNPGM("idle() call depth: ", idle_depth);
   #endif
 
+  TERN_(STACK_MONITOR, stack_monitor.enter_idle());
+
   // Bed Distance Sensor task
   TERN_(BD_SENSOR, bdl.process());
 
   // Core Marlin activities
-  manage_inactivity(no_stepper_sleep);
+  PROFILE_IDLE_TASK(INACTIVITY, manage_inactivity(no_stepper_sleep));
 
   // Manage Heaters (and Watchdog)
-  thermalManager.task();
+  PROFILE_IDLE_TASK(THERMAL, thermalManager.task());
 
   // Max7219 heartbeat, animation, etc
   TERN_(MAX7219_DEBUG, max7219.idle_tasks());
@@ -806,11 +863,23 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Handle filament runout sensors
   #if HAS_FILAMENT_SENSOR
     if (TERN1(HAS_PRUSA_MMU2, !mmu2.enabled()))
-      runout.run();
+      PROFILE_IDLE_TASK(RUNOUT, runout.run());
   #endif
 
+  // Plan held G0/G1 moves before the planner runs dry
+  TERN_(SEGMENT_COALESCING, coalescer.idle());
+
+  // Let the simulated stepper take planned blocks
+  TERN_(PLANNER_BENCHMARK, planner_benchmark.idle());
+
+  // Release planned blocks while the link benchmark runs
+  TERN_(LINK_BENCHMARK, link_benchmark.idle());
+
+  // Let the virtual stepper take planned blocks
+  TERN_(VIRTUAL_STEPPING, virtual_stepper.idle());
+
   // Run HAL idle tasks
-  hal.idletask();
+  PROFILE_IDLE_TASK(HAL, hal.idletask());
 
   // Check network connection
   TERN_(HAS_ETHERNET, ethernet.check());
@@ -827,25 +896,39 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   #endif
 
   // Handle SD Card insert / remove
-  TERN_(HAS_MEDIA, card.manage_media());
+  {
+    TERN_(IDLE_PROFILER, IdleProfile media_profile(IDLE_TASK_MEDIA));
+    TERN_(HAS_MEDIA, card.manage_media());
+    TERN_(SD_READ_AHEAD, card.read_ahead());
+    TERN_(ESTIMATE_REMAINING_TIME, print_estimator.update());
+    TERN_(SD_QUIET_WRITES, card.run_deferred());
+  }
+  TERN_(CANCEL_OBJECTS_PRESCAN, cancel_prescan.idle());
+  TERN_(BACKGROUND_TASKS, bg_tasks.idle());
+  TERN_(BILINEAR_MESH_TEMP_BLEND, bedlevel.temp_blend_idle());
 
   // Handle USB Flash Drive insert / remove
   TERN_(USB_FLASH_DRIVE_SUPPORT, card.diskIODriver()->idle());
 
-  // Announce Host Keepalive state (if any)
-  TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
+  #if ENABLED(IDLE_SCHEDULER)
+    // Host Keepalive, Encoders, Auto-reports, and Print Job Timer when due
+    idle_scheduler.run();
+  #else
+    // Announce Host Keepalive state (if any)
+    TERN_(HOST_KEEPALIVE_FEATURE, PROFILE_IDLE_TASK(KEEPALIVE, gcode.host_keepalive()));
 
-  // Update the Print Job Timer state
-  TERN_(PRINTCOUNTER, print_job_timer.tick());
+    // Update the Print Job Timer state
+    TERN_(PRINTCOUNTER, print_job_timer.tick());
+  #endif
 
   // Update the Beeper queue
   TERN_(HAS_BEEPER, buzzer.tick());
 
   // Handle UI input / draw events
-  TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update());
+  PROFILE_IDLE_TASK(UI, TERN(DWIN_CREALITY_LCD, DWIN_Update(), ui.update()));
 
   // Run i2c Position Encoders
-  #if ENABLED(I2C_POSITION_ENCODERS)
+  #if ENABLED(I2C_POSITION_ENCODERS) && DISABLED(IDLE_SCHEDULER)
   {
     static millis_t i2cpem_next_update_ms;
     if (planner.has_blocks_queued()) {
@@ -861,11 +944,18 @@ void idle(const bool no_stepper_sleep/*=false*/) {
   // Auto-report Temperatures / SD Status
   #if HAS_AUTO_REPORTING
     if (!gcode.autoreport_paused) {
-      TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
-      TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
-      TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
-      TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+      TERN_(IDLE_PROFILER, IdleProfile autoreport_profile(IDLE_TASK_AUTOREPORT));
+      #if DISABLED(IDLE_SCHEDULER)
+        TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
+        TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
+        TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
+        TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+        TERN_(SERIAL_LINK_STATS, queue.link_auto_reporter.tick());
+        TERN_(IDLE_PROFILER, idle_profiler.auto_reporter.tick());
+        TERN_(FLEET_TELEMETRY, fleet_telemetry.auto_reporter.tick());
+      #endif
       TERN_(BUFFER_MONITORING, queue.auto_report_buffer_statistics());
+      TERN_(BUFFER_OCCUPANCY_REPORT, queue.auto_report_occupancy());
     }
   #endif
 
@@ -883,9 +973,33 @@ void idle(const bool no_stepper_sleep/*=false*/) {
 
   IDLE_DONE:
   TERN_(MARLIN_DEV_MODE, idle_depth--);
+  TERN_(STACK_MONITOR, stack_monitor.exit_idle());
   return;
 }
 
+#if ENABLED(COOPERATIVE_YIELD)
+
+  /**
+   * A bounded slice of housekeeping for routines that block for a long time.
+   * Only the heaters (with the watchdog), serial input and host keepalive are
+   * serviced. Moves, UI, and media tasks wait for the next idle(), so calling
+   * this from anywhere, even from inside idle(), keeps the stack shallow.
+   */
+  void idle_yield() {
+    static bool busy; // = false
+    static millis_t next_ms; // = 0
+    const millis_t ms = millis();
+    if (busy || PENDING(ms, next_ms)) return;
+    busy = true;
+    next_ms = ms + (COOPERATIVE_YIELD_INTERVAL);
+    thermalManager.task();
+    queue.get_available_commands();
+    TERN_(HOST_KEEPALIVE_FEATURE, gcode.host_keepalive());
+    busy = false;
+  }
+
+#endif
+
 /**
  * Kill all activity and lock the machine.
  * After this the machine will need to be reset.
@@ -909,6 +1023,8 @@ void kill(FSTR_P const lcd_error/*=nullptr*/, FSTR_P const lcd_component/*=nullp
   // "Error:Printer halted. kill() called!"
   SERIAL_ERROR_MSG(STR_ERR_KILLED);
 
+  TERN_(CRASH_TRACE, crash_trace.kill(lcd_error));
+
   #ifdef ACTION_ON_KILL
     hostui.kill();
   #endif
@@ -918,6 +1034,8 @@ void kill(FSTR_P const lcd_error/*=nullptr*/, FSTR_P const lcd_component/*=nullp
 
 void minkill(const bool steppers_off/*=false*/) {
 
+  TERN_(CRASH_TRACE, crash_trace.record(TRACE_MINKILL));
+
   // Wait a short time (allows messages to get out before shutting down.
   for (int i = 1000; i--;) DELAY_US(600);
 
@@ -1150,11 +1268,25 @@ void setup() {
   const byte mcu = hal.get_reset_source();
   hal.clear_reset_source();
 
-  #if ENABLED(MARLIN_DEV_MODE)
+  #if ENABLED(BOOT_TIMING)
+    PGM_P boot_stage = nullptr, boot_slowest = nullptr;
+    millis_t boot_stage_ms = millis(), boot_slowest_ms = 0;
+  #endif
+
+  #if ANY(MARLIN_DEV_MODE, BOOT_TIMING)
     auto log_current_ms = [&](PGM_P const msg) {
-      SERIAL_ECHO_START();
-      SERIAL_CHAR('['); SERIAL_ECHO(millis()); SERIAL_ECHOPGM("] ");
-      SERIAL_ECHOLNPGM_P(msg);
+      #if ENABLED(MARLIN_DEV_MODE)
+        SERIAL_ECHO_START();
+        SERIAL_CHAR('['); SERIAL_ECHO(millis()); SERIAL_ECHOPGM("] ");
+        SERIAL_ECHOLNPGM_P(msg);
+      #endif
+      #if ENABLED(BOOT_TIMING)
+        // Time the stage that just ended
+        const millis_t ms = millis(), took = ms - boot_stage_ms;
+        if (boot_stage && took > boot_slowest_ms) { boot_slowest_ms = took; boot_slowest = boot_stage; }
+        boot_stage = msg;
+        boot_stage_ms = ms;
+      #endif
     };
     #define SETUP_LOG(M) log_current_ms(PSTR(M))
   #else
@@ -1281,6 +1413,9 @@ void setup() {
   if (mcu & RST_WATCHDOG)  SERIAL_ECHOLNPGM(STR_WATCHDOG_RESET);
   if (mcu & RST_SOFTWARE)  SERIAL_ECHOLNPGM(STR_SOFTWARE_RESET);
 
+  // Print what was going on before a reset
+  TERN_(CRASH_TRACE, crash_trace.boot());
+
   // Identify myself as Marlin x.x.x
   SERIAL_ECHOLNPGM("Marlin " SHORT_BUILD_VERSION);
   #if defined(STRING_DISTRIBUTION_DATE) && defined(STRING_CONFIG_H_AUTHOR)
@@ -1329,7 +1464,7 @@ void setup() {
     #endif
   #endif
 
-  #if ALL(HAS_MEDIA, SDCARD_EEPROM_EMULATION)
+  #if HAS_MEDIA && ANY(SDCARD_EEPROM_EMULATION, SDCARD_EEPROM_EXTENSION)
     SETUP_RUN(card.mount());          // Mount media with settings before first_load
   #endif
 
@@ -1367,6 +1502,14 @@ void setup() {
     SETUP_RUN(refresh_delta_clip_start_height()); // Init safe delta height without soft endstops
   #endif
 
+  #if ENABLED(ISR_PROFILER)
+    SETUP_RUN(isr_profiler.init());   // Start the cycle counter before the ISRs run
+  #endif
+
+  #if ENABLED(STACK_MONITOR)
+    SETUP_RUN(stack_monitor.init());  // Find the stack used so far, before the ISRs run
+  #endif
+
   SETUP_RUN(stepper.init());          // Init stepper. This enables interrupts!
 
   #if HAS_SERVOS
@@ -1640,7 +1783,12 @@ void setup() {
   #endif
 
   #if HAS_TRINAMIC_CONFIG && DISABLED(PSU_DEFAULT_OFF)
-    SETUP_RUN(test_tmc_connection());
+    #if ALL(BOOT_TIMING, BACKGROUND_TASKS)
+      SETUP_LOG("test_tmc_connection() deferred");
+      bg_tasks.add([]{ test_tmc_connection(); return true; });
+    #else
+      SETUP_RUN(test_tmc_connection());
+    #endif
   #endif
 
   #if ENABLED(BD_SENSOR)
@@ -1651,6 +1799,16 @@ void setup() {
 
   SETUP_LOG("setup() completed.");
 
+  #if ENABLED(BOOT_TIMING)
+    SERIAL_ECHO_START();
+    SERIAL_ECHOPGM("Boot took ", boot_stage_ms, "ms");
+    if (boot_slowest) {
+      SERIAL_ECHOPGM(", slowest ", boot_slowest_ms, "ms in ");
+      SERIAL_ECHOPGM_P(boot_slowest);
+    }
+    SERIAL_EOL();
+  #endif
+
   TERN_(MARLIN_TEST_BUILD, runStartupTests());
 }
 
@@ -1676,13 +1834,15 @@ void loop() {
       if (marlin_state == MF_SD_COMPLETE) finishSDPrinting();
     #endif
 
-    queue.advance();
+    TERN_(ADVANCED_PAUSE_NONBLOCKING, filament_change.task());
+
+    PROFILE_IDLE_TASK(COMMANDS, queue.advance());
 
     #if ANY(POWER_OFF_TIMER, POWER_OFF_WAIT_FOR_COOLDOWN)
       powerManager.checkAutoPowerOff();
     #endif
 
-    endstops.event_handler();
+    PROFILE_IDLE_TASK(ENDSTOPS, endstops.event_handler());
 
     TERN_(HAS_TFT_LVGL_UI, printer_state_polling());
 
@@ -33,6 +33,11 @@ void stop();
 void idle(const bool no_stepper_sleep=false);
 inline void idle_no_sleep() { idle(true); }
 
+#if ENABLED(COOPERATIVE_YIELD)
+  // Brief housekeeping for long routines. Never re-enters idle().
+  void idle_yield();
+#endif
+
 #if ENABLED(G38_PROBE_TARGET)
   extern uint8_t G38_move;          // Flag to tell the ISR that G38 is in progress, and the type
   extern bool G38_did_trigger;      // Flag from the ISR to indicate the endstop changed
@@ -20,21 +20,15 @@
  *
  */
 
-#include "../../inc/MarlinConfig.h"
-
-#if HAS_GCODE_M876
-
-#include "../../feature/host_actions.h"
-#include "../gcode.h"
-#include "../../MarlinCore.h"
-
-/**
- * M876: Handle Prompt Response
- */
-void GcodeSuite::M876() {
-
-  if (parser.seenval('S')) hostui.handle_response((uint8_t)parser.value_int());
+#include "debug_section.h"
+#include "../module/motion.h"
 
+void SectionLog::echo_msg(FSTR_P const fpre, FSTR_P const fmsg) {
+  SERIAL_ECHOF(fpre);
+  if (fmsg) {
+    SERIAL_CHAR(' ');
+    SERIAL_ECHOF(fmsg);
+  }
+  SERIAL_CHAR(' ');
+  print_pos(current_position);
 }
-
-#endif // HAS_GCODE_M876
@@ -22,28 +22,23 @@
 #pragma once
 
 #include "serial.h"
-#include "../module/motion.h"
 
+/**
+ * Log entry to and exit from a section, with the current position.
+ * Only the flag test is inline. The output is done out of line, so each
+ * section costs one call in debug builds, and nothing when 'inbug' is 0.
+ */
 class SectionLog {
 public:
-  SectionLog(FSTR_P const fmsg=nullptr, bool inbug=true) {
-    the_msg = fmsg;
-    if ((debug = inbug)) echo_msg(F(">>>"));
+  SectionLog(FSTR_P const fmsg=nullptr, const bool inbug=true) : the_msg(fmsg), debug(inbug) {
+    if (debug) echo_msg(F(">>>"), the_msg);
   }
 
-  ~SectionLog() { if (debug) echo_msg(F("<<<")); }
+  ~SectionLog() { if (debug) echo_msg(F("<<<"), the_msg); }
 
 private:
-  FSTR_P the_msg;
-  bool debug;
+  FSTR_P const the_msg;
+  const bool debug;
 
-  void echo_msg(FSTR_P const fpre) {
-    SERIAL_ECHOF(fpre);
-    if (the_msg) {
-      SERIAL_CHAR(' ');
-      SERIAL_ECHOF(the_msg);
-    }
-    SERIAL_CHAR(' ');
-    print_pos(current_position);
-  }
+  static void echo_msg(FSTR_P const fpre, FSTR_P const fmsg);
 };
@@ -49,7 +49,8 @@ enum MarlinDebugFlags : uint8_t {
 };
 
 extern uint8_t marlin_debug_flags;
-#define DEBUGGING(F) (marlin_debug_flags & (MARLIN_DEBUG_## F))
+// A flag compiled out (= 0) makes the test a constant, so guarded code is dropped
+#define DEBUGGING(F) ((MARLIN_DEBUG_## F) && (marlin_debug_flags & (MARLIN_DEBUG_## F)))
 
 //
 // Serial redirection
@@ -129,6 +130,18 @@ extern uint8_t marlin_debug_flags;
 #define PORT_RESTORE()     _PORT_RESTORE(1)
 #define SERIAL_PORTMASK(P) SerialMask::from(P)
 
+// Ports for host actions and unsolicited notices
+#ifdef HOST_ACTION_PORTS
+  #define SERIAL_ACTION_PORTS SerialMask(HOST_ACTION_PORTS)
+#else
+  #define SERIAL_ACTION_PORTS SerialMask::All
+#endif
+#ifdef NOTICE_PORTS
+  #define SERIAL_NOTICE_PORTS SerialMask(NOTICE_PORTS)
+#else
+  #define SERIAL_NOTICE_PORTS SerialMask::All
+#endif
+
 //
 // SERIAL_CHAR - Print one or more individual chars
 //
@@ -71,6 +71,7 @@ ENUM_FLAGS(SerialFeature);
 CALL_IF_EXISTS_IMPL(void, flushTX);
 CALL_IF_EXISTS_IMPL(bool, connected, true);
 CALL_IF_EXISTS_IMPL(SerialFeature, features, SerialFeature::None);
+CALL_IF_EXISTS_IMPL(bool, writeBlock, false);
 
 // A simple forward struct to prevent the compiler from selecting print(double, int) as a default overload
 // for any type other than double/float. For double/float, a conversion exists so the call will be invisible.
@@ -138,8 +139,12 @@ struct SerialBase {
   void flushTX()                    { CALL_IF_EXISTS(void, SerialChild, flushTX); }
 
   // Glue code here
-  void write(const char *str)                    { while (*str) write(*str++); }
-  void write(const uint8_t *buffer, size_t size) { while (size--) write(*buffer++); }
+  void write(const char *str)                    { write((const uint8_t*)str, strlen(str)); }
+  // Children with a TX ring can take a whole block at once
+  void write(const uint8_t *buffer, size_t size) {
+    if (!CALL_IF_EXISTS(bool, SerialChild, writeBlock, buffer, size))
+      while (size--) write(*buffer++);
+  }
   void print(char *str)                          { write(str); }
   void print(const char *str)                    { write(str); }
   // No default argument to avoid ambiguity
@@ -42,13 +42,61 @@ volatile int16_t Babystep::steps[BS_AXIS_IND(Z_AXIS) + 1];
 #endif
 int16_t Babystep::accum;
 
-void Babystep::step_axis(const AxisEnum axis) {
-  const int16_t curTodo = steps[BS_AXIS_IND(axis)]; // get rid of volatile for performance
-  if (curTodo) {
-    stepper.do_babystep((AxisEnum)axis, curTodo > 0);
-    if (curTodo > 0) steps[BS_AXIS_IND(axis)]--; else steps[BS_AXIS_IND(axis)]++;
+#if ENABLED(BABYSTEP_SMOOTHING)
+
+  uint16_t Babystep::rate[BS_AXIS_IND(Z_AXIS) + 1],
+           Babystep::phase[BS_AXIS_IND(Z_AXIS) + 1];
+  uint8_t Babystep::moving_fwd;
+
+  /**
+   * Ramp the babystep rate up to one step per tick and back down ahead of the
+   * last step, instead of stepping at the full rate from the first tick. When
+   * the babystep direction reverses the axis first slows down to a stop.
+   */
+  void Babystep::step_axis(const AxisEnum axis) {
+    constexpr uint16_t full_rate = 256, ramp = _MAX(1, full_rate / (BABYSTEP_RAMP_TICKS));
+    const uint8_t i = BS_AXIS_IND(axis);
+    const int16_t curTodo = steps[i]; // get rid of volatile for performance
+    if (!curTodo) { rate[i] = 0; return; }
+
+    const bool fwd = curTodo > 0;
+    uint16_t r = rate[i];
+    if (!r) {                                               // Start from rest
+      SET_BIT_TO(moving_fwd, i, fwd);
+      phase[i] = 0;
+    }
+
+    // Steps left in the direction of motion. None when reversing, so as to slow down first.
+    const uint16_t left = fwd == TEST(moving_fwd, i) ? ABS(curTodo) : 0;
+
+    // Slow down once the distance to stop at this rate reaches the steps left
+    if (uint32_t(r) * r < uint32_t(2 * full_rate) * ramp * left)
+      r = _MIN(r + ramp, full_rate);
+    else
+      r = r > ramp ? r - ramp : 0;
+    rate[i] = r;
+
+    phase[i] += r;
+    if (phase[i] >= full_rate) {
+      phase[i] -= full_rate;
+      if (left) {
+        stepper.do_babystep((AxisEnum)axis, fwd);
+        if (fwd) steps[i]--; else steps[i]++;
+      }
+    }
   }
-}
+
+#else
+
+  void Babystep::step_axis(const AxisEnum axis) {
+    const int16_t curTodo = steps[BS_AXIS_IND(axis)]; // get rid of volatile for performance
+    if (curTodo) {
+      stepper.do_babystep((AxisEnum)axis, curTodo > 0);
+      if (curTodo > 0) steps[BS_AXIS_IND(axis)]--; else steps[BS_AXIS_IND(axis)]++;
+    }
+  }
+
+#endif
 
 void Babystep::add_mm(const AxisEnum axis, const_float_t mm) {
   add_steps(axis, mm * planner.settings.axis_steps_per_mm[axis]);
@@ -80,6 +80,11 @@ public:
   }
 
 private:
+  #if ENABLED(BABYSTEP_SMOOTHING)
+    static uint16_t rate[BS_AXIS_IND(Z_AXIS) + 1],          // Babystep rate in 1/256 steps per tick
+                    phase[BS_AXIS_IND(Z_AXIS) + 1];         // Step accumulator at that rate
+    static uint8_t moving_fwd;                              // Babystep direction bits while moving
+  #endif
   static void step_axis(const AxisEnum axis);
 };
 
@@ -144,6 +144,45 @@ void Backlash::add_correction_steps(const int32_t &da, const int32_t &db, const
   }
 }
 
+#if ENABLED(BACKLASH_TAKEUP_MOVE)
+
+  /**
+   * Get the steps that take up the backlash of the axes reversing on a move of 'dist' steps.
+   * The planner queues these as a short move of their own ahead of the move, so the move
+   * keeps its own length and speed profile. A take-up too short to be planned as a block
+   * goes into the residual error instead, for add_correction_steps() to fold into the move.
+   * Return true if there is a take-up move to queue.
+   */
+  bool Backlash::get_takeup_steps(const xyz_long_t &dist, xyz_long_t &takeup) {
+    axis_bits_t dm = 0;
+    LOOP_NUM_AXES(axis) if (dist[axis] < 0) SBI(dm, axis);
+
+    axis_bits_t changed_dir = last_direction_bits ^ dm;
+    // Ignore direction change unless steps are taken in that direction
+    LOOP_NUM_AXES(axis) if (!dist[axis]) CBI(changed_dir, axis);
+    last_direction_bits ^= changed_dir;
+
+    takeup.reset();
+    if (!correction || !changed_dir) return false;
+
+    const float f_corr = float(correction) / all_on;
+    int32_t longest = 0;
+    LOOP_NUM_AXES(axis) {
+      if (TEST(changed_dir, axis) && distance_mm[axis]) {
+        const int32_t steps = f_corr * distance_mm[axis] * planner.settings.axis_steps_per_mm[axis];
+        takeup[axis] = TEST(dm, axis) ? -steps : steps;
+        NOLESS(longest, steps);
+      }
+    }
+
+    if (longest >= MIN_STEPS_PER_SEGMENT) return true;
+
+    residual_error += takeup;
+    return false;
+  }
+
+#endif
+
 int32_t Backlash::get_applied_steps(const AxisEnum axis) {
   if (axis >= NUM_AXES) return 0;
 
@@ -35,6 +35,17 @@
   #include "../../../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(MESH_STATISTICS)
+  #include "../../../libs/least_squares_fit.h"
+  #include "../../../libs/numtostr.h"
+  #include "../../../lcd/marlinui.h"
+#endif
+
+#if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+  #include "../../../module/settings.h"
+  #include "../../../module/temperature.h"
+#endif
+
 LevelingBilinear bedlevel;
 
 xy_pos_t LevelingBilinear::grid_spacing,
@@ -44,6 +55,34 @@ bed_mesh_t LevelingBilinear::z_values;
 xy_pos_t LevelingBilinear::cached_rel;
 xy_int8_t LevelingBilinear::cached_g;
 
+#if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+
+  bool LevelingBilinear::temp_blend; // = false
+
+  /**
+   * Re-blend the mesh from the saved slots as the bed temperature moves
+   */
+  void LevelingBilinear::temp_blend_idle() {
+    static celsius_float_t blended_temp = -999;
+    static millis_t next_ms = 0;
+    if (!temp_blend) { blended_temp = -999; return; }
+
+    const millis_t ms = millis();
+    if (PENDING(ms, next_ms)) return;
+    next_ms = ms + 1000UL;
+
+    const celsius_float_t t = thermalManager.degBed();
+    if (ABS(t - blended_temp) < (MESH_BLEND_TEMP_STEP)) return;
+    blended_temp = t;
+
+    if (!settings.blend_meshes(t)) {
+      temp_blend = false;
+      SERIAL_ECHO_MSG("No mesh slots to blend.");
+    }
+  }
+
+#endif
+
 /**
  * Extrapolate a single point from its neighbors
  */
@@ -153,10 +192,67 @@ void LevelingBilinear::extrapolate_unprobed_bed_level() {
     }
 }
 
+#if ENABLED(MESH_STATISTICS)
+
+  /**
+   * Report the spread of the mesh, how far it is from a flat (tilted) plane,
+   * and the steepest step between neighboring points. A single bad probe
+   * shows up as a large plane residual and a large step at the same spot.
+   */
+  void LevelingBilinear::print_mesh_statistics(const bed_mesh_t &zv) {
+    float lo = 1e6, hi = -1e6, sum = 0, sum2 = 0, step = 0;
+    xy_uint8_t step_at { 0, 0 };
+    linear_fit_data lsf;
+    incremental_LSF_reset(&lsf);
+    GRID_LOOP(x, y) {
+      const float z = zv[x][y];
+      if (isnan(z)) continue;
+      NOMORE(lo, z); NOLESS(hi, z);
+      sum += z; sum2 += sq(z);
+      incremental_LSF(&lsf, get_mesh_x(x), get_mesh_y(y), z);
+      // Steepest slope to the next point on each axis
+      const float sx = x < GRID_MAX_POINTS_X - 1 ? ABS(zv[x + 1][y] - z) : 0,
+                  sy = y < GRID_MAX_POINTS_Y - 1 ? ABS(zv[x][y + 1] - z) : 0;
+      if (sx > step) { step = sx; step_at.set(x, y); }
+      if (sy > step) { step = sy; step_at.set(x, y); }
+    }
+    const float n = lsf.N;
+    if (!n) return;
+
+    const float mean = sum / n, rms = SQRT(_MAX(sum2 / n - sq(mean), 0));
+
+    float fit_rms = NAN, fit_max = NAN;
+    if (!finish_incremental_LSF(&lsf)) {
+      float r2 = 0;
+      fit_max = 0;
+      GRID_LOOP(x, y) {
+        const float z = zv[x][y];
+        if (isnan(z)) continue;
+        const float r = ABS(z + lsf.A * get_mesh_x(x) + lsf.B * get_mesh_y(y) + lsf.D);
+        r2 += sq(r);
+        NOLESS(fit_max, r);
+      }
+      fit_rms = SQRT(r2 / n);
+    }
+
+    auto stat = [](FSTR_P const label, const_float_t v) { SERIAL_ECHOF(label); SERIAL_PRINT(v, 3); };
+    stat(F("Mesh Range:"), hi - lo);
+    stat(F(" RMS:"), rms);
+    stat(F(" Plane RMS:"), fit_rms);
+    stat(F(" Max:"), fit_max);
+    stat(F(" Step:"), step);
+    SERIAL_ECHOLNPGM(" @ X", step_at.x, " Y", step_at.y);
+
+    ui.status_printf(0, F("Mesh range %smm"), ftostr53_63(hi - lo));
+  }
+
+#endif
+
 void LevelingBilinear::print_leveling_grid(const bed_mesh_t* _z_values/*=nullptr*/) {
   // print internal grid(s) or just the one passed as a parameter
   SERIAL_ECHOLNPGM("Bilinear Leveling Grid:");
   print_2d_array(GRID_MAX_POINTS_X, GRID_MAX_POINTS_Y, 3, _z_values ? *_z_values[0] : z_values[0]);
+  TERN_(MESH_STATISTICS, print_mesh_statistics(_z_values ? *_z_values : z_values));
 
   #if ENABLED(ABL_BILINEAR_SUBDIVISION)
     if (!_z_values) {
@@ -303,34 +399,41 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
 
   if (cached_rel.x != rel.x) {
     cached_rel.x = rel.x;
-    ratio.x = rel.x * ABL_BG_FACTOR(x);
-    const float gx = constrain(FLOOR(ratio.x), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
-    ratio.x -= gx;      // Subtract whole to get the ratio within the grid box
+    const float rx = rel.x * ABL_BG_FACTOR(x);
+    ratio.x = rx - thisg.x;
+    // Still inside the same grid box? Then the index and bounds are unchanged.
+    if (ratio.x < 0 || ratio.x >= 1) {
+      const float gx = constrain(FLOOR(rx), 0, ABL_BG_POINTS_X - (FAR_EDGE_OR_BOX));
+      ratio.x = rx - gx;        // Subtract whole to get the ratio within the grid box
 
-    #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
-      // Beyond the grid maintain height at grid edges
-      NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
-    #endif
+      #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+        // Beyond the grid maintain height at grid edges
+        NOLESS(ratio.x, 0); // Never <0 (>1 is ok when nextg.x==thisg.x)
+      #endif
 
-    thisg.x = gx;
-    nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
+      thisg.x = gx;
+      nextg.x = _MIN(thisg.x + 1, ABL_BG_POINTS_X - 1);
+    }
   }
 
   if (cached_rel.y != rel.y || cached_g.x != thisg.x) {
 
     if (cached_rel.y != rel.y) {
       cached_rel.y = rel.y;
-      ratio.y = rel.y * ABL_BG_FACTOR(y);
-      const float gy = constrain(FLOOR(ratio.y), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
-      ratio.y -= gy;
-
-      #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
-        // Beyond the grid maintain height at grid edges
-        NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
-      #endif
+      const float ry = rel.y * ABL_BG_FACTOR(y);
+      ratio.y = ry - thisg.y;
+      if (ratio.y < 0 || ratio.y >= 1) {
+        const float gy = constrain(FLOOR(ry), 0, ABL_BG_POINTS_Y - (FAR_EDGE_OR_BOX));
+        ratio.y = ry - gy;
+
+        #if DISABLED(EXTRAPOLATE_BEYOND_GRID)
+          // Beyond the grid maintain height at grid edges
+          NOLESS(ratio.y, 0); // Never < 0.0. (> 1.0 is ok when nextg.y==thisg.y.)
+        #endif
 
-      thisg.y = gy;
-      nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+        thisg.y = gy;
+        nextg.y = _MIN(thisg.y + 1, ABL_BG_POINTS_Y - 1);
+      }
     }
 
     if (cached_g != thisg) {
@@ -373,8 +476,12 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
   /**
    * Prepare a bilinear-leveled linear move on Cartesian,
    * splitting the move where it crosses grid borders.
+   *
+   * The cells along the line are walked in order, stepping to the
+   * nearer of the next X and Y grid lines each time, so every
+   * crossing gets one segment end and nothing more.
    */
-  void LevelingBilinear::line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits, uint16_t y_splits) {
+  void LevelingBilinear::line_to_destination(const_feedRate_t scaled_fr_mm_s) {
     // Get current and destination cells for this line
     xy_int_t c1 { CELL_INDEX(x, current_position.x), CELL_INDEX(y, current_position.y) },
              c2 { CELL_INDEX(x, destination.x), CELL_INDEX(y, destination.y) };
@@ -384,54 +491,51 @@ float LevelingBilinear::get_z_correction(const xy_pos_t &raw) {
     LIMIT(c2.y, 0, ABL_BG_POINTS_Y - 2);
 
     // Start and end in the same cell? No split needed.
-    if (c1 == c2) {
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
-      return;
-    }
-
-    #define LINE_SEGMENT_END(A) (current_position.A + (destination.A - current_position.A) * normalized_dist)
-
-    float normalized_dist;
-    xyze_pos_t end;
-    const xy_int8_t gc { _MAX(c1.x, c2.x), _MAX(c1.y, c2.y) };
-
-    // Crosses on the X and not already split on this X?
-    // The x_splits flags are insurance against rounding errors.
-    if (c2.x != c1.x && TEST(x_splits, gc.x)) {
-      // Split on the X grid line
-      CBI(x_splits, gc.x);
-      end = destination;
-      destination.x = grid_start.x + ABL_BG_SPACING(x) * gc.x;
-      normalized_dist = (destination.x - current_position.x) / (end.x - current_position.x);
-      destination.y = LINE_SEGMENT_END(y);
-    }
-    // Crosses on the Y and not already split on this Y?
-    else if (c2.y != c1.y && TEST(y_splits, gc.y)) {
-      // Split on the Y grid line
-      CBI(y_splits, gc.y);
-      end = destination;
-      destination.y = grid_start.y + ABL_BG_SPACING(y) * gc.y;
-      normalized_dist = (destination.y - current_position.y) / (end.y - current_position.y);
-      destination.x = LINE_SEGMENT_END(x);
-    }
-    else {
-      // Must already have been split on these border(s)
-      // This should be a rare case.
-      current_position = destination;
-      line_to_current_position(scaled_fr_mm_s);
-      return;
-    }
+    if (c1 != c2) {
+      const xyze_pos_t start = current_position, end = destination;
+      const xyze_float_t diff = end - start;
+      const xy_int8_t dir { int8_t(c2.x > c1.x ? 1 : -1), int8_t(c2.y > c1.y ? 1 : -1) };
+
+      // Fraction of the move to the first grid line on each axis, and from one line to the next
+      xy_float_t next { 2, 2 }, step { 2, 2 };
+      if (c1.x != c2.x) {
+        const float inv = 1.0f / diff.x;
+        next.x = (grid_start.x + ABL_BG_SPACING(x) * (c1.x + (dir.x > 0)) - start.x) * inv;
+        step.x = ABL_BG_SPACING(x) * ABS(inv);
+      }
+      if (c1.y != c2.y) {
+        const float inv = 1.0f / diff.y;
+        next.y = (grid_start.y + ABL_BG_SPACING(y) * (c1.y + (dir.y > 0)) - start.y) * inv;
+        step.y = ABL_BG_SPACING(y) * ABS(inv);
+      }
 
-    destination.z = LINE_SEGMENT_END(z);
-    destination.e = LINE_SEGMENT_END(e);
+      float last = 0;
+      xy_int_t c = c1;
+      while (c != c2) {
+        const float t = _MIN(next.x, next.y);
+        if (t >= 1) break;  // Rounding left the end cell short of the last line
+
+        // Step into the next cell. Through a corner steps on both axes.
+        if (next.x <= t) { c.x += dir.x; next.x = c.x == c2.x ? 2 : next.x + step.x; }
+        if (next.y <= t) { c.y += dir.y; next.y = c.y == c2.y ? 2 : next.y + step.y; }
+
+        if (t <= last) continue;  // Started on this line
+        last = t;
+
+        destination = end;
+        destination.x = start.x + diff.x * t;
+        destination.y = start.y + diff.y * t;
+        destination.z = start.z + diff.z * t;
+        destination.e = start.e + diff.e * t;
+        current_position = destination;
+        line_to_current_position(scaled_fr_mm_s);
+      }
 
-    // Do the split and look for more borders
-    line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
+      destination = end;
+    }
 
-    // Restore destination from stack
-    destination = end;
-    line_to_destination(scaled_fr_mm_s, x_splits, y_splits);
+    current_position = destination;
+    line_to_current_position(scaled_fr_mm_s);
   }
 
 #endif // IS_CARTESIAN && !SEGMENT_LEVELED_MOVES
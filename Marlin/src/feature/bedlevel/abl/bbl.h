@@ -54,6 +54,9 @@ public:
   static void set_grid(const xy_pos_t& _grid_spacing, const xy_pos_t& _grid_start);
   static void extrapolate_unprobed_bed_level();
   static void print_leveling_grid(const bed_mesh_t *_z_values=nullptr);
+  #if ENABLED(MESH_STATISTICS)
+    static void print_mesh_statistics(const bed_mesh_t &zv);
+  #endif
   static void refresh_bed_level();
   static bool has_mesh() { return !!grid_spacing.x; }
   static bool mesh_is_valid() { return has_mesh(); }
@@ -62,8 +65,13 @@ public:
   static float get_z_correction(const xy_pos_t &raw);
   static constexpr float get_z_offset() { return 0.0f; }
 
+  #if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+    static bool temp_blend;   // Follow the bed temperature with a blend of the saved slots (M420 B)
+    static void temp_blend_idle();
+  #endif
+
   #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
-    static void line_to_destination(const_feedRate_t scaled_fr_mm_s, uint16_t x_splits=0xFFFF, uint16_t y_splits=0xFFFF);
+    static void line_to_destination(const_feedRate_t scaled_fr_mm_s);
   #endif
 };
 
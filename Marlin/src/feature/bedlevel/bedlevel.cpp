@@ -75,6 +75,10 @@ void set_bed_leveling_enabled(const bool enable/*=true*/) {
     _report_leveling();
     planner.synchronize();
 
+    #if ENABLED(UBL_MESH_GRADIENTS)
+      if (enable) bedlevel.refresh_gradients();         // Pick up any mesh edits made while off
+    #endif
+
     // Get the corrected leveled / unleveled position
     planner.apply_modifiers(current_position, true);    // Physical position with all modifiers
     planner.leveling_active ^= true;                    // Toggle leveling between apply and unapply
@@ -67,6 +67,31 @@ int8_t unified_bed_leveling::storage_slot;
 
 float unified_bed_leveling::z_values[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
 
+#if ENABLED(UBL_MESH_GRADIENTS)
+
+  bed_mesh_t unified_bed_leveling::z_dx, unified_bed_leveling::z_dy;
+
+  /**
+   * Rebuild the slope tables used by ubl_motion after z_values changes.
+   * The last column / row get zero slope, like the clamped lookups they replace.
+   * Segmented moves treat undefined points as zero, so the tables do the same.
+   */
+  void unified_bed_leveling::refresh_gradients() {
+    auto zv = [](const uint8_t x, const uint8_t y) {
+      const float z = z_values[x][y];
+      #if UBL_SEGMENTED
+        if (isnan(z)) return 0.0f;
+      #endif
+      return z;
+    };
+    GRID_LOOP(x, y) {
+      z_dx[x][y] = x < GRID_MAX_CELLS_X ? (zv(x + 1, y) - zv(x, y)) * RECIPROCAL(MESH_X_DIST) : 0;
+      z_dy[x][y] = y < GRID_MAX_CELLS_Y ? (zv(x, y + 1) - zv(x, y)) * RECIPROCAL(MESH_Y_DIST) : 0;
+    }
+  }
+
+#endif
+
 #define _GRIDPOS(A,N) (MESH_MIN_##A + N * (MESH_##A##_DIST))
 
 const float
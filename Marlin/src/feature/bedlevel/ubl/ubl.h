@@ -112,6 +112,10 @@ public:
   static int8_t storage_slot;
 
   static bed_mesh_t z_values;
+  #if ENABLED(UBL_MESH_GRADIENTS)
+    static bed_mesh_t z_dx, z_dy;                   // Z change per mm toward the next point in X / Y
+    static void refresh_gradients();
+  #endif
   #if ENABLED(OPTIMIZED_MESH_STORAGE)
     static void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
     static void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
@@ -214,12 +218,16 @@ public:
       return _UBL_OUTER_Z_RAISE;
     }
 
-    const float xratio = (rx0 - get_mesh_x(x1_i)) * RECIPROCAL(MESH_X_DIST),
-                z1 = z_values[x1_i][yi];
+    #if ENABLED(UBL_MESH_GRADIENTS)
+      return z_values[x1_i][yi] + (rx0 - get_mesh_x(x1_i)) * z_dx[x1_i][yi];        // Slope is zero at the last element
+    #else
+      const float xratio = (rx0 - get_mesh_x(x1_i)) * RECIPROCAL(MESH_X_DIST),
+                  z1 = z_values[x1_i][yi];
 
-    return z1 + xratio * (z_values[_MIN(x1_i, (GRID_MAX_POINTS_X) - 2) + 1][yi] - z1);  // Don't allow x1_i+1 to be past the end of the array
-                                                                                        // If it is, it is clamped to the last element of the
-                                                                                        // z_values[][] array and no correction is applied.
+      return z1 + xratio * (z_values[_MIN(x1_i, (GRID_MAX_POINTS_X) - 2) + 1][yi] - z1);  // Don't allow x1_i+1 to be past the end of the array
+                                                                                          // If it is, it is clamped to the last element of the
+                                                                                          // z_values[][] array and no correction is applied.
+    #endif
   }
 
   //
@@ -237,12 +245,16 @@ public:
       return _UBL_OUTER_Z_RAISE;
     }
 
-    const float yratio = (ry0 - get_mesh_y(y1_i)) * RECIPROCAL(MESH_Y_DIST),
-                z1 = z_values[xi][y1_i];
+    #if ENABLED(UBL_MESH_GRADIENTS)
+      return z_values[xi][y1_i] + (ry0 - get_mesh_y(y1_i)) * z_dy[xi][y1_i];        // Slope is zero at the last element
+    #else
+      const float yratio = (ry0 - get_mesh_y(y1_i)) * RECIPROCAL(MESH_Y_DIST),
+                  z1 = z_values[xi][y1_i];
 
-    return z1 + yratio * (z_values[xi][_MIN(y1_i, (GRID_MAX_POINTS_Y) - 2) + 1] - z1);  // Don't allow y1_i+1 to be past the end of the array
-                                                                                        // If it is, it is clamped to the last element of the
-                                                                                        // z_values[][] array and no correction is applied.
+      return z1 + yratio * (z_values[xi][_MIN(y1_i, (GRID_MAX_POINTS_Y) - 2) + 1] - z1);  // Don't allow y1_i+1 to be past the end of the array
+                                                                                          // If it is, it is clamped to the last element of the
+                                                                                          // z_values[][] array and no correction is applied.
+    #endif
   }
 
   /**
@@ -678,6 +678,8 @@ void unified_bed_leveling::G29() {
 
   LEAVE:
 
+  TERN_(UBL_MESH_GRADIENTS, refresh_gradients());
+
   #if HAS_MARLINUI_MENU
     ui.reset_alert_level();
     ui.quick_feedback();
@@ -85,10 +85,17 @@
       #endif
 
       // The distance is always MESH_X_DIST so multiply by the constant reciprocal.
-      const float xratio = (end.x - get_mesh_x(iend.x)) * RECIPROCAL(MESH_X_DIST),
-                  yratio = (end.y - get_mesh_y(iend.y)) * RECIPROCAL(MESH_Y_DIST),
-                  z1 = z_values[iend.x][iend.y    ] + xratio * (z_values[iend.x + 1][iend.y    ] - z_values[iend.x][iend.y    ]),
-                  z2 = z_values[iend.x][iend.y + 1] + xratio * (z_values[iend.x + 1][iend.y + 1] - z_values[iend.x][iend.y + 1]);
+      #if ENABLED(UBL_MESH_GRADIENTS)
+        const float cx = end.x - get_mesh_x(iend.x),
+                    yratio = (end.y - get_mesh_y(iend.y)) * RECIPROCAL(MESH_Y_DIST),
+                    z1 = z_values[iend.x][iend.y    ] + cx * z_dx[iend.x][iend.y    ],
+                    z2 = z_values[iend.x][iend.y + 1] + cx * z_dx[iend.x][iend.y + 1];
+      #else
+        const float xratio = (end.x - get_mesh_x(iend.x)) * RECIPROCAL(MESH_X_DIST),
+                    yratio = (end.y - get_mesh_y(iend.y)) * RECIPROCAL(MESH_Y_DIST),
+                    z1 = z_values[iend.x][iend.y    ] + xratio * (z_values[iend.x + 1][iend.y    ] - z_values[iend.x][iend.y    ]),
+                    z2 = z_values[iend.x][iend.y + 1] + xratio * (z_values[iend.x + 1][iend.y + 1] - z_values[iend.x][iend.y + 1]);
+      #endif
 
       // X cell-fraction done. Interpolate the two Z offsets with the Y fraction for the final Z offset.
       const float z0 = (z1 + (z2 - z1) * yratio) * planner.fade_scaling_factor_for_z(end.z);
@@ -421,30 +428,52 @@
       LIMIT(icell.x, 0, GRID_MAX_CELLS_X);
       LIMIT(icell.y, 0, GRID_MAX_CELLS_Y);
 
-      const int8_t ncellx = _MIN(icell.x+1, GRID_MAX_CELLS_X),
-                   ncelly = _MIN(icell.y+1, GRID_MAX_CELLS_Y);
-      float z_x0y0 = z_values[icell.x][icell.y],  // z at lower left corner
-            z_x1y0 = z_values[ncellx ][icell.y],  // z at upper left corner
-            z_x0y1 = z_values[icell.x][ncelly ],  // z at lower right corner
-            z_x1y1 = z_values[ncellx ][ncelly ];  // z at upper right corner
+      const int8_t ncelly = _MIN(icell.y+1, GRID_MAX_CELLS_Y);
+
+      #if ENABLED(UBL_MESH_GRADIENTS)
+
+        // Slopes come from the tables, which already guess zero for undefined points
+        float z_x0y0 = z_values[icell.x][icell.y];  // z at lower left corner
+        if (isnan(z_x0y0)) z_x0y0 = 0;
+
+        const xy_pos_t pos = { get_mesh_x(icell.x), get_mesh_y(icell.y) };
+        xy_pos_t cell = raw - pos;
+
+        const float z_xmy0 = z_dx[icell.x][icell.y],        // z slope per x along y0 (lower left to lower right)
+                    z_xmy1 = z_dx[icell.x][ncelly];         // z slope per x along y1 (upper left to upper right)
+
+              float z_cxy0 = z_x0y0 + z_xmy0 * cell.x;      // z height along y0 at cell.x (changes for each cell.x in cell)
 
-      if (isnan(z_x0y0)) z_x0y0 = 0;              // ideally activating planner.leveling_active (G29 A)
-      if (isnan(z_x1y0)) z_x1y0 = 0;              //   should refuse if any invalid mesh points
-      if (isnan(z_x0y1)) z_x0y1 = 0;              //   in order to avoid isnan tests per cell,
-      if (isnan(z_x1y1)) z_x1y1 = 0;              //   thus guessing zero for undefined points
+              float z_cxym = z_dy[icell.x][icell.y]         // z slope per y along cell.x from pos.y to y1 (changes for each cell.x in cell)
+                           + (z_xmy1 - z_xmy0) * RECIPROCAL(MESH_Y_DIST) * cell.x;
 
-      const xy_pos_t pos = { get_mesh_x(icell.x), get_mesh_y(icell.y) };
-      xy_pos_t cell = raw - pos;
+      #else
 
-      const float z_xmy0 = (z_x1y0 - z_x0y0) * RECIPROCAL(MESH_X_DIST),   // z slope per x along y0 (lower left to lower right)
-                  z_xmy1 = (z_x1y1 - z_x0y1) * RECIPROCAL(MESH_X_DIST);   // z slope per x along y1 (upper left to upper right)
+        const int8_t ncellx = _MIN(icell.x+1, GRID_MAX_CELLS_X);
+        float z_x0y0 = z_values[icell.x][icell.y],  // z at lower left corner
+              z_x1y0 = z_values[ncellx ][icell.y],  // z at upper left corner
+              z_x0y1 = z_values[icell.x][ncelly ],  // z at lower right corner
+              z_x1y1 = z_values[ncellx ][ncelly ];  // z at upper right corner
 
-            float z_cxy0 = z_x0y0 + z_xmy0 * cell.x;        // z height along y0 at cell.x (changes for each cell.x in cell)
+        if (isnan(z_x0y0)) z_x0y0 = 0;              // ideally activating planner.leveling_active (G29 A)
+        if (isnan(z_x1y0)) z_x1y0 = 0;              //   should refuse if any invalid mesh points
+        if (isnan(z_x0y1)) z_x0y1 = 0;              //   in order to avoid isnan tests per cell,
+        if (isnan(z_x1y1)) z_x1y1 = 0;              //   thus guessing zero for undefined points
 
-      const float z_cxy1 = z_x0y1 + z_xmy1 * cell.x,        // z height along y1 at cell.x
-                  z_cxyd = z_cxy1 - z_cxy0;                 // z height difference along cell.x from y0 to y1
+        const xy_pos_t pos = { get_mesh_x(icell.x), get_mesh_y(icell.y) };
+        xy_pos_t cell = raw - pos;
 
-            float z_cxym = z_cxyd * RECIPROCAL(MESH_Y_DIST); // z slope per y along cell.x from pos.y to y1 (changes for each cell.x in cell)
+        const float z_xmy0 = (z_x1y0 - z_x0y0) * RECIPROCAL(MESH_X_DIST),   // z slope per x along y0 (lower left to lower right)
+                    z_xmy1 = (z_x1y1 - z_x0y1) * RECIPROCAL(MESH_X_DIST);   // z slope per x along y1 (upper left to upper right)
+
+              float z_cxy0 = z_x0y0 + z_xmy0 * cell.x;        // z height along y0 at cell.x (changes for each cell.x in cell)
+
+        const float z_cxy1 = z_x0y1 + z_xmy1 * cell.x,        // z height along y1 at cell.x
+                    z_cxyd = z_cxy1 - z_cxy0;                 // z height difference along cell.x from y0 to y1
+
+              float z_cxym = z_cxyd * RECIPROCAL(MESH_Y_DIST); // z slope per y along cell.x from pos.y to y1 (changes for each cell.x in cell)
+
+      #endif
 
       //    float z_cxcy = z_cxy0 + z_cxym * cell.y;        // interpolated mesh z height along cell.x at cell.y (do inside the segment loop)
 
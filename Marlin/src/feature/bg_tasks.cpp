@@ -0,0 +1,73 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BACKGROUND_TASKS)
+
+#include "bg_tasks.h"
+#include "../module/planner.h"
+
+BackgroundTasks bg_tasks;
+
+bg_task_t BackgroundTasks::tasks[BACKGROUND_TASKS_MAX];
+uint8_t BackgroundTasks::next; // = 0
+bool BackgroundTasks::running; // = false
+
+bool BackgroundTasks::add(const bg_task_t task) {
+  if (queued(task)) return true;
+  for (auto &t : tasks) if (!t) { t = task; return true; }
+  return false;
+}
+
+void BackgroundTasks::remove(const bg_task_t task) {
+  for (auto &t : tasks) if (t == task) t = nullptr;
+}
+
+bool BackgroundTasks::queued(const bg_task_t task) {
+  for (auto &t : tasks) if (t == task) return true;
+  return false;
+}
+
+void BackgroundTasks::idle() {
+  // A task step may call idle() itself
+  if (running) return;
+
+  // Leave the time to the planner while it's running low
+  if (planner.has_blocks_queued() && planner.movesplanned() < (BACKGROUND_TASKS_MIN_MOVES)) return;
+
+  running = true;
+  const uint32_t start_us = micros();
+  for (uint8_t n = COUNT(tasks); n--;) {
+    const uint8_t i = next;
+    if (++next >= COUNT(tasks)) next = 0;
+    // Step the task until it's done or the slice is used up
+    while (tasks[i]) {
+      if (tasks[i]()) { tasks[i] = nullptr; break; }
+      if (micros() - start_us >= (BACKGROUND_TASKS_SLICE_US)) { running = false; return; }
+    }
+    if (micros() - start_us >= (BACKGROUND_TASKS_SLICE_US)) break;
+  }
+  running = false;
+}
+
+#endif // BACKGROUND_TASKS
@@ -0,0 +1,50 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * bg_tasks.h - Cooperative tasks run from idle()
+ *
+ * A task is a function that does one short step of its job and returns
+ * true once the job is finished. It keeps its own state between calls.
+ * idle() calls the queued tasks in turn until BACKGROUND_TASKS_SLICE_US
+ * has passed, and skips them while the planner is running low.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+typedef bool (*bg_task_t)();
+
+class BackgroundTasks {
+public:
+  static bool add(const bg_task_t task);    // Queue a task, if not already queued. False if full.
+  static void remove(const bg_task_t task);
+  static bool queued(const bg_task_t task);
+  static void idle();
+
+private:
+  static bg_task_t tasks[BACKGROUND_TASKS_MAX];
+  static uint8_t next;
+  static bool running;
+};
+
+extern BackgroundTasks bg_tasks;
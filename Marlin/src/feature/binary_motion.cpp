@@ -0,0 +1,239 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+/**
+ * binary_motion.cpp - Binary motion frames over the host serial port
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(BINARY_MOTION)
+
+#include "binary_motion.h"
+#include "../libs/crc16.h"
+
+#if ENABLED(EMERGENCY_PARSER)
+  #include "e_parser.h"
+#endif
+
+#define FRAME_TIMEOUT_MS 500  // Drop a frame whose bytes stop coming
+
+BinaryMotion binary_motion;
+
+bool BinaryMotion::active; // = false
+serial_index_t BinaryMotion::port;
+BinaryMotion::State BinaryMotion::state; // = STATE_SYNC
+uint8_t BinaryMotion::seq, BinaryMotion::type, BinaryMotion::len, BinaryMotion::count,
+        BinaryMotion::next_seq, BinaryMotion::unacked;
+bool BinaryMotion::resend_sent;
+uint16_t BinaryMotion::crc;
+millis_t BinaryMotion::last_rx_ms;
+int32_t BinaryMotion::last_value[NUM_AXES + 2];
+
+void BinaryMotion::start(const serial_index_t serial_ind) {
+  port = serial_ind;
+  state = STATE_SYNC;
+  next_seq = unacked = 0;
+  resend_sent = false;
+  ZERO(last_value);
+  last_rx_ms = millis();
+  TERN_(EMERGENCY_PARSER, emergency_parser.disable()); // Frame bytes could look like M112
+  active = true;
+}
+
+void BinaryMotion::stop() {
+  active = false;
+  TERN_(EMERGENCY_PARSER, emergency_parser.enable());
+}
+
+// The line buffer for the port isn't used while frames are coming in
+uint8_t* BinaryMotion::payload() { return (uint8_t*)GCodeQueue::serial_state[port.index].line_buffer; }
+
+void BinaryMotion::send_ack() {
+  PORT_REDIRECT(SERIAL_PORTMASK(port));
+  SERIAL_ECHOLNPGM("ack:", uint8_t(next_seq - 1));
+  unacked = 0;
+}
+
+void BinaryMotion::request_resend() {
+  if (unacked) send_ack();
+  PORT_REDIRECT(SERIAL_PORTMASK(port));
+  SERIAL_ECHOLNPGM("rs:", next_seq);
+  resend_sent = true;
+}
+
+// Read an unsigned LEB128 value of up to 32 bits
+static bool read_varint(const uint8_t *&p, const uint8_t * const end, uint32_t &v) {
+  v = 0;
+  for (uint8_t shift = 0; shift < 35; shift += 7) {
+    if (p >= end) return false;
+    const uint8_t b = *p++;
+    v |= uint32_t(b & 0x7F) << shift;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+/**
+ * Fill in a move record from a MOVE frame.
+ * The delta state is only updated for a good frame.
+ */
+bool BinaryMotion::decode_move(GCodeQueue::MoveRecord &move) {
+  const uint8_t *p = payload(), * const end = p + len;
+  uint32_t flags;
+  if (!read_varint(p, end, flags) || flags >= _BV32(G0_BIT + 1)) return false;
+  #if !HAS_EXTRUDERS
+    if (TEST(flags, move.E_BIT)) return false;
+  #endif
+
+  int32_t value[NUM_AXES + 2];
+  for (uint8_t i = 0; i < NUM_AXES + 2; ++i) {
+    value[i] = last_value[i];
+    if (!TEST(flags, i)) continue;
+    uint32_t z;
+    if (!read_varint(p, end, z)) return false;
+    value[i] += int32_t(z >> 1) ^ -int32_t(z & 1);
+    move.value[i] = value[i] * (i < NUM_AXES ? 0.001f : i == move.E_BIT ? 0.0001f : 0.1f);
+  }
+  if (p != end) return false;
+
+  move.codenum = TEST(flags, G0_BIT) ? 0 : 1;
+  move.seen = uint16_t(flags & (_BV32(G0_BIT) - 1));
+  COPY(last_value, value);
+  return true;
+}
+
+// True if the command is the given code and not a longer one, e.g., M28 but not M280
+static bool is_code(const char *cmd, PGM_P const code) {
+  while (*cmd == ' ') ++cmd;
+  const size_t n = strlen_P(code);
+  return !strncmp_P(cmd, code, n) && !NUMERIC(cmd[n]);
+}
+
+/**
+ * Handle a frame with a good CRC
+ */
+void BinaryMotion::process_frame() {
+  if (seq != next_seq) {
+    // An older frame is a copy sent before an ack arrived. A newer one means a frame was lost.
+    if (int8_t(seq - next_seq) > 0 && !resend_sent) request_resend();
+    return;
+  }
+
+  switch (type) {
+    case FRAME_MOVE: {
+      GCodeQueue::MoveRecord * const move = queue.ring_buffer.move_slot();
+      if (!move) return request_resend();   // Filled by another source since the frame began
+      if (decode_move(*move))
+        queue.ring_buffer.commit_move(true OPTARG(HAS_MULTI_SERIAL, port));
+      else
+        SERIAL_ERROR_MSG("Bad move frame ", seq);
+    } break;
+
+    case FRAME_GCODE: {
+      char * const cmd = (char*)payload();
+      cmd[len] = '\0';
+      if (is_code(cmd, PSTR("M28")) || is_code(cmd, PSTR("M928")))
+        SERIAL_ERROR_MSG("No M28/M928 with binary motion");
+      else if (queue.ring_buffer.full())
+        return request_resend();
+      else
+        queue.ring_buffer.enqueue(cmd, true OPTARG(HAS_MULTI_SERIAL, port));
+    } break;
+
+    case FRAME_NOP: break;
+    case FRAME_END: break;
+
+    default: SERIAL_ERROR_MSG("Bad frame type ", type); break;
+  }
+
+  ++next_seq;
+  ++unacked;
+  resend_sent = false;
+
+  if (type == FRAME_END) {
+    send_ack();
+    stop();
+  }
+}
+
+/**
+ * Read frames from the serial buffer for as long as the queue has room.
+ * Called by the command queue in place of reading text lines.
+ */
+void BinaryMotion::receive() {
+  const millis_t ms = millis();
+  const uint8_t p = port.index;
+
+  for (;;) {
+    // Only start a frame when a move record and a command slot are free
+    if (state == STATE_SYNC && !queue.ring_buffer.move_slot()) { last_rx_ms = ms; break; }
+
+    const int c = SERIAL_IMPL.read(p);
+    if (c < 0) break;
+    last_rx_ms = ms;
+
+    const uint8_t b = uint8_t(c);
+    switch (state) {
+      case STATE_SYNC:
+        if (b == SYNC_BYTE) { crc = 0xFFFF; state = STATE_SEQ; }
+        continue;
+      case STATE_SEQ:  seq = b;  state = STATE_TYPE; break;
+      case STATE_TYPE: type = b; state = STATE_LEN;  break;
+      case STATE_LEN:
+        if (b >= MAX_CMD_SIZE) { state = STATE_SYNC; request_resend(); continue; } // No room for the text terminator
+        len = b; count = 0;
+        state = len ? STATE_DATA : STATE_CRC0;
+        break;
+      case STATE_DATA:
+        payload()[count++] = b;
+        if (count == len) state = STATE_CRC0;
+        break;
+      case STATE_CRC0: count = b; state = STATE_CRC1; continue;
+      case STATE_CRC1:
+        state = STATE_SYNC;
+        if (crc == (uint16_t(b) << 8 | count)) process_frame(); else request_resend();
+        if (!active) return;
+        if (unacked >= BINARY_MOTION_ACK_FRAMES) send_ack();
+        continue;
+    }
+    crc16(&crc, &b, 1);
+  }
+
+  if (unacked) send_ack();
+
+  if (state != STATE_SYNC && ELAPSED(ms, last_rx_ms + FRAME_TIMEOUT_MS)) {
+    state = STATE_SYNC;
+    request_resend();
+  }
+
+  #if BINARY_MOTION_TIMEOUT
+    if (ELAPSED(ms, last_rx_ms + SEC_TO_MS(BINARY_MOTION_TIMEOUT))) {
+      PORT_REDIRECT(SERIAL_PORTMASK(port));
+      SERIAL_ECHO_MSG("Binary motion timed out");
+      stop();
+    }
+  #endif
+}
+
+#endif // BINARY_MOTION
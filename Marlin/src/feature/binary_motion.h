@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * binary_motion.h - Binary motion frames over the host serial port
+ *
+ * After "M580 S1" the host sends frames instead of text lines:
+ *
+ *   0xB1 | seq | type | len | payload[len] | crc16 (low byte first)
+ *
+ * The CRC-16/CCITT (seed 0xFFFF) covers seq, type, len, and payload.
+ *
+ *   MOVE  : varint flags, then a zigzag varint delta for each value in flags.
+ *           Flags use the MoveRecord seen bits, plus G0_BIT for G0.
+ *           Values are "as written", in 0.001 (axes), 0.0001 (E), and 0.1 (F)
+ *           units, each a delta from the last value sent for that letter.
+ *   GCODE : A command line as text, without line number or checksum.
+ *   NOP   : Keep the connection alive.
+ *   END   : Return to text commands after the ack for this frame.
+ *
+ * No "ok" is sent for frames. Instead "ack:<seq>" confirms all frames up to
+ * seq, sent after each read of the serial buffer or every few frames. A bad
+ * frame gets "rs:<seq>" and everything from seq on must be sent again. The
+ * host sends at most BINARY_MOTION_WINDOW bytes beyond the last ack.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../gcode/queue.h"
+
+class BinaryMotion {
+public:
+  enum FrameType : uint8_t { FRAME_NOP, FRAME_MOVE, FRAME_GCODE, FRAME_END };
+
+  static constexpr uint8_t SYNC_BYTE = 0xB1,
+                           G0_BIT = NUM_AXES + 2;
+
+  static bool active;
+
+  static void start(const serial_index_t serial_ind);
+  static void stop();
+  static void receive();
+
+private:
+  enum State : uint8_t { STATE_SYNC, STATE_SEQ, STATE_TYPE, STATE_LEN, STATE_DATA, STATE_CRC0, STATE_CRC1 };
+
+  static serial_index_t port;             // The port that sent M580 S1
+  static State state;
+  static uint8_t seq, type, len, count,
+                 next_seq,                 // Sequence number of the next frame to accept
+                 unacked;                  // Frames accepted since the last ack
+  static bool resend_sent;                 // Waiting for the host to send next_seq again
+  static uint16_t crc;
+  static millis_t last_rx_ms;
+  static int32_t last_value[NUM_AXES + 2]; // Last fixed-point value sent for each letter
+
+  static uint8_t* payload();
+  static void process_frame();
+  static bool decode_move(GCodeQueue::MoveRecord &move);
+  static void send_ack();
+  static void request_resend();
+};
+
+extern BinaryMotion binary_motion;
@@ -94,8 +94,22 @@ private:
         }
         return true;
       }
+
+      // Gather whole blocks so the card gets full, sequential block writes
+      for (size_t i = 0; i < length;) {
+        const size_t n = _MIN(length - i, sizeof(decode_buffer) - data_waiting);
+        memcpy(&decode_buffer[data_waiting], &buffer[i], n);
+        data_waiting += n;
+        i += n;
+        if (data_waiting == sizeof(decode_buffer)) {
+          if (!dummy_transfer && card.write(decode_buffer, data_waiting) < 0) return false;
+          data_waiting = 0;
+        }
+      }
+      return true;
+    #else
+      return (dummy_transfer || card.write(buffer, length) >= 0);
     #endif
-    return (dummy_transfer || card.write(buffer, length) >= 0);
   }
 
   static bool file_close() {
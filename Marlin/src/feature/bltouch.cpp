@@ -41,14 +41,32 @@ bool BLTouch::od_5v_mode;         // Initialized by settings.load, 0 = Open Drai
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../core/debug_out.h"
 
-bool BLTouch::command(const BLTCommand cmd, const millis_t &ms) {
+#if ENABLED(BLTOUCH_ASYNC_RESET)
+
+  millis_t BLTouch::ready_ms; // = 0
+
+  // Wait for the last command to settle
+  void BLTouch::wait_ready() {
+    const millis_t ms = millis();
+    if (PENDING(ms, ready_ms)) safe_delay(ready_ms - ms);
+  }
+
+#endif
+
+bool BLTouch::command(const BLTCommand cmd, const millis_t &ms OPTARG(BLTOUCH_ASYNC_RESET, const bool wait/*=true*/)) {
+  TERN_(BLTOUCH_ASYNC_RESET, wait_ready()); // The probe takes one command at a time
   const BLTCommand current = servo[Z_PROBE_SERVO_NR].read();
   if (DEBUGGING(LEVELING)) SERIAL_ECHOLNPGM("BLTouch from ", current, " to ", cmd);
   // If the new command is the same, skip it (and the delay).
   // The previous write should've already delayed to detect the alarm.
   if (cmd != current) {
     servo[Z_PROBE_SERVO_NR].move(cmd);
-    safe_delay(_MAX(ms, (uint32_t)BLTOUCH_DELAY)); // BLTOUCH_DELAY is also the *minimum* delay
+    #if ENABLED(BLTOUCH_ASYNC_RESET)
+      ready_ms = millis() + _MAX(ms, (uint32_t)BLTOUCH_DELAY);
+      if (wait) wait_ready();
+    #else
+      safe_delay(_MAX(ms, (uint32_t)BLTOUCH_DELAY)); // BLTOUCH_DELAY is also the *minimum* delay
+    #endif
   }
   return triggered();
 }
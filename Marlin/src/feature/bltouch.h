@@ -86,6 +86,12 @@ public:
   // Native BLTouch commands ("Underscore"...), used in lcd menus and internally
   static void _reset()              { command(BLTOUCH_RESET, BLTOUCH_RESET_DELAY); }
 
+  #if ENABLED(BLTOUCH_ASYNC_RESET)
+    // Send RESET and return. The next command or wait_ready() waits out the rest of the delay.
+    static void _reset_async()      { command(BLTOUCH_RESET, BLTOUCH_RESET_DELAY, false); }
+    static void wait_ready();
+  #endif
+
   static void _selftest()           { command(BLTOUCH_SELFTEST, BLTOUCH_DELAY); }
 
   static void _set_SW_mode()        { command(BLTOUCH_SW_MODE, BLTOUCH_DELAY); }
@@ -108,7 +114,10 @@ private:
   static bool _stow_query_alarm()   { return command(BLTOUCH_STOW, BLTOUCH_STOW_DELAY) == STOW_ALARM; }
 
   static void clear();
-  static bool command(const BLTCommand cmd, const millis_t &ms);
+  static bool command(const BLTCommand cmd, const millis_t &ms OPTARG(BLTOUCH_ASYNC_RESET, const bool wait=true));
+  #if ENABLED(BLTOUCH_ASYNC_RESET)
+    static millis_t ready_ms;       // When the last command has settled
+  #endif
   static bool deploy_proc();
   static bool stow_proc();
   static bool status_proc();
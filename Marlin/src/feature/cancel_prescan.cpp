@@ -0,0 +1,182 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(CANCEL_OBJECTS_PRESCAN)
+
+#include "cancel_prescan.h"
+#include "cancel_object.h"
+#include "../gcode/gcode.h"
+#include "../module/planner.h"
+
+CancelPrescan cancel_prescan;
+
+MediaFile CancelPrescan::scan;
+CancelPrescan::section_t CancelPrescan::ring[CANCEL_OBJECTS_PRESCAN_SIZE], CancelPrescan::cur, CancelPrescan::here;
+uint8_t CancelPrescan::head, CancelPrescan::count, CancelPrescan::len;
+char CancelPrescan::line[MAX_CMD_SIZE];
+uint32_t CancelPrescan::line_start;
+bool CancelPrescan::in_section, CancelPrescan::safe, CancelPrescan::rel_e, CancelPrescan::overflow, CancelPrescan::have_here;
+
+/**
+ * Begin scanning a newly opened file from the top, using a copy of
+ * the card's read handle so the print position is left alone.
+ */
+void CancelPrescan::start(const MediaFile &f) {
+  scan = f;
+  scan.seekSet(0);
+  head = count = len = 0;
+  line_start = 0;
+  in_section = overflow = have_here = false;
+  rel_e = gcode.axis_is_relative(E_AXIS);
+}
+
+void CancelPrescan::idle() {
+  if (count >= COUNT(ring) || !scan.isOpen() || !card.isPrinting()) return;
+
+  // Only read while moves are buffered so the scan never starves the planner
+  if (!planner.has_blocks_queued()) return;
+
+  // Parse to the end of the current block, which costs at most one card read
+  for (uint16_t n = 512 - (scan.curPosition() & 0x1FF); n--;) {
+    const int16_t c = scan.read();
+    if (c < 0) { scan.close(); break; } // End of file (or a read error)
+    const char ch = char(c);
+    if (ISEOL(ch)) {
+      const uint32_t next = scan.curPosition();
+      if (len || overflow) parse_line(next);
+      len = 0;
+      overflow = false;
+      line_start = next;
+      if (count >= COUNT(ring)) break;
+    }
+    else if (len < sizeof(line) - 1)
+      line[len++] = ch;
+    else
+      overflow = true;
+  }
+}
+
+// Close the open section, keeping it only if it can be skipped with a seek
+void CancelPrescan::end_section() {
+  if (!in_section) return;
+  in_section = false;
+  if (!safe) return;
+  cur.end = line_start;
+  ring[(head + count) % COUNT(ring)] = cur;
+  count++;
+}
+
+void CancelPrescan::parse_line(const uint32_t next) {
+  // A line too long to hold can't be checked
+  if (overflow) { safe = false; return; }
+
+  line[len] = '\0';
+  char *p = line, * const semi = strchr(line, ';');
+  if (semi) *semi = '\0';
+  while (*p == ' ') p++;
+  if (*p == 'N') { do p++; while (NUMERIC(*p)); while (*p == ' ') p++; }
+  if (!*p) return;  // Comments and blank lines change nothing
+
+  const char letter = *p;
+  if (letter != 'G' && letter != 'M') { safe = false; return; }
+  char *q;
+  const long code = strtol(p + 1, &q, 10);
+  if (q == p + 1 || *q == '.') { safe = false; return; }
+
+  if (letter == 'M' && code == 486) {
+    // Any M486 ends the section before it
+    end_section();
+    for (; *q; q++) if (*q == 'S') {
+      const long obj = strtol(q + 1, nullptr, 10);
+      if (WITHIN(obj, 0, 31)) {
+        cur.start = next;
+        cur.obj = int8_t(obj);
+        cur.e_seen = cur.f_seen = false;
+        in_section = safe = true;
+      }
+      break;
+    }
+    return;
+  }
+
+  if (!in_section) {
+    // Follow the E mode so the section knows whether E values are absolute
+    if (letter == 'M' && (code == 82 || code == 83)) rel_e = (code == 83);
+    else if (letter == 'G' && (code == 90 || code == 91)) rel_e = (code == 91);
+    return;
+  }
+
+  // Only plain moves may be left unread
+  if (letter != 'G' || !WITHIN(code, 0, 3)) { safe = false; return; }
+  while (*q) {
+    if (*q == 'E') {
+      const float v = strtof(q + 1, &q);
+      if (!rel_e) { cur.e = v; cur.e_seen = true; }
+    }
+    else if (*q == 'F') {
+      cur.f = strtof(q + 1, &q);
+      cur.f_seen = true;
+      cur.f_g0 = (code == 0);
+    }
+    else
+      q++;
+  }
+}
+
+/**
+ * Called with each command line from the card as it is queued. If it starts
+ * a scanned section for an object that has been canceled, pop the section
+ * so the queue can seek to its end. A line inside the section being printed
+ * also seeks to its end once that object is canceled, as with "M486 C".
+ */
+bool CancelPrescan::take_canceled(const char * const cmd, const uint32_t sdpos, section_t &sec) {
+  if (!cancelable.canceled) return false;
+
+  // Drop sections the print has already entered, keeping the latest one
+  while (count && ring[head].start < sdpos) {
+    here = ring[head];
+    have_here = true;
+    head = (head + 1) % COUNT(ring);
+    count--;
+  }
+
+  const bool is_m486 = cmd[0] == 'M' && cmd[1] == '4' && cmd[2] == '8' && cmd[3] == '6' && !NUMERIC(cmd[4]);
+  if (is_m486 && count && ring[head].start == sdpos && cancelable.is_canceled(ring[head].obj)) {
+    sec = ring[head];
+    head = (head + 1) % COUNT(ring);
+    count--;
+    return true;
+  }
+
+  if (have_here && sdpos >= here.end) have_here = false;
+  if (!is_m486 && have_here && cancelable.is_canceled(here.obj)) {
+    sec = here;
+    have_here = false;
+    return true;
+  }
+
+  return false;
+}
+
+#endif // CANCEL_OBJECTS_PRESCAN
@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * cancel_prescan.h - Find the extent of each M486 object section ahead of the print
+ *
+ * A second handle on the printing file is read from idle(), a block at a time,
+ * noting where each "M486 S<n>" section begins and ends. When the print reaches
+ * the start of a section whose object is already canceled, and the section holds
+ * only G0-G3 moves, the queue seeks straight to the end of it instead of reading
+ * and discarding every line. The section being printed is kept after the print
+ * enters it, so canceling the active object also seeks past the rest of it.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+#include "../sd/cardreader.h"
+
+class CancelPrescan {
+public:
+  typedef struct {
+    uint32_t start, end;  // File offsets just past the "M486 S" line, and of the next M486 line
+    float e, f;           // Last absolute E and last F given in the section
+    int8_t obj;           // Object index from M486 S
+    bool e_seen:1,        // An absolute E was given, so the queue needs a G92
+         f_seen:1,        // An F was given, so the feedrate must be restored
+         f_g0:1;          // The last F was on a G0 move
+  } section_t;
+
+  static void start(const MediaFile &f);
+  static void idle();
+  static bool take_canceled(const char * const cmd, const uint32_t sdpos, section_t &sec);
+
+private:
+  static MediaFile scan;
+  static section_t ring[CANCEL_OBJECTS_PRESCAN_SIZE], cur, here;
+  static uint8_t head, count, len;
+  static char line[MAX_CMD_SIZE];
+  static uint32_t line_start;
+  static bool in_section, safe, rel_e, overflow, have_here;
+  static void end_section();
+  static void parse_line(const uint32_t next);
+};
+
+extern CancelPrescan cancel_prescan;
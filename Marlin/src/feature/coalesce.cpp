@@ -0,0 +1,128 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * coalesce.cpp - Merge short collinear G0/G1 moves before planning
+ *
+ * Each new segment is merged into the held move if it continues in the same
+ * direction, at the same feedrate and extrusion ratio, and its endpoint stays
+ * within COALESCE_CHORD_TOLERANCE / 2 of the line through the held start.
+ * The held move is sent when a segment can't be merged, when any other command
+ * is processed, or when the command queue or planner is close to empty.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SEGMENT_COALESCING)
+
+#include "coalesce.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../gcode/queue.h"
+
+SegmentCoalescer coalescer;
+
+bool SegmentCoalescer::pending; // = false
+xyze_pos_t SegmentCoalescer::start, SegmentCoalescer::end;
+xy_float_t SegmentCoalescer::unit;
+float SegmentCoalescer::length, SegmentCoalescer::e_per_mm;
+feedRate_t SegmentCoalescer::feedrate;
+uint8_t SegmentCoalescer::extruder;
+
+// Only moves in XY, with or without E, may be held back
+bool SegmentCoalescer::is_candidate() {
+  if (planner.movesplanned() < 2) return false;   // Don't hold anything back from a hungry planner
+  LOOP_NUM_AXES(i) if (i > Y_AXIS && destination[i] != current_position[i]) return false;
+  return xy_pos_t(destination - current_position).magnitude() > 0;
+}
+
+bool SegmentCoalescer::can_merge() {
+  if (feedrate_mm_s != feedrate || active_extruder != extruder) return false;
+  if (!is_candidate()) return false;
+
+  const xy_pos_t seg = destination - end;
+  const float seg_len = seg.magnitude();
+  if (length + seg_len > float(COALESCE_MAX_LENGTH)) return false;
+
+  // Must keep moving forward along the initial direction
+  if (seg.x * unit.x + seg.y * unit.y <= 0) return false;
+
+  // Extrusion per mm must match the held move
+  const float e_ratio = (destination.e - end.e) / seg_len;
+  if (ABS(e_ratio - e_per_mm) > float(COALESCE_E_RATIO_TOLERANCE) * ABS(e_per_mm)) return false;
+
+  // The new endpoint must stay close to the line through the start
+  const xy_pos_t d = destination - start;
+  return ABS(d.x * unit.y - d.y * unit.x) <= float(COALESCE_CHORD_TOLERANCE) * 0.5f;
+}
+
+void SegmentCoalescer::prepare_line_to_destination() {
+  apply_motion_limits(destination);
+
+  if (pending) {
+    if (can_merge()) {
+      length += xy_pos_t(destination - end).magnitude();
+      end = destination;
+      current_position = destination;
+      return;
+    }
+    flush();
+  }
+
+  if (is_candidate()) {
+    start = current_position;
+    end = destination;
+    const xy_pos_t seg = end - start;
+    length = seg.magnitude();
+    unit = seg / length;
+    e_per_mm = (end.e - start.e) / length;
+    feedrate = feedrate_mm_s;
+    extruder = active_extruder;
+    pending = true;
+    current_position = destination;
+    return;
+  }
+
+  ::prepare_line_to_destination();
+}
+
+void SegmentCoalescer::flush() {
+  if (!pending) return;
+  pending = false;
+
+  // Plan the held move from its own start, then put the G-code state back
+  const xyze_pos_t old_current = current_position, old_destination = destination;
+  const feedRate_t old_feedrate = feedrate_mm_s;
+  current_position = start;
+  destination = end;
+  feedrate_mm_s = feedrate;
+  ::prepare_line_to_destination();
+  current_position = old_current;
+  destination = old_destination;
+  feedrate_mm_s = old_feedrate;
+}
+
+void SegmentCoalescer::idle() {
+  if (pending && (!queue.has_commands_queued() || planner.movesplanned() < 2)) flush();
+}
+
+#endif // SEGMENT_COALESCING
@@ -0,0 +1,50 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * coalesce.h - Merge short collinear G0/G1 moves before planning
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class SegmentCoalescer {
+public:
+  static bool pending;                          // A merged move is being held back
+
+  static void prepare_line_to_destination();    // Replaces ::prepare_line_to_destination for G0/G1
+  static void flush();                          // Send the held move to the planner
+  static void discard() { pending = false; }    // Drop the held move (e.g., on quick stop)
+  static void idle();                           // Flush if the queue or planner is running dry
+
+private:
+  static xyze_pos_t start, end;                 // Endpoints of the held move
+  static xy_float_t unit;                       // Direction of the first merged segment
+  static float length, e_per_mm;
+  static feedRate_t feedrate;
+  static uint8_t extruder;
+
+  static bool is_candidate();
+  static bool can_merge();
+};
+
+extern SegmentCoalescer coalescer;
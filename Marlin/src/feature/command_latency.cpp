@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * command_latency.cpp - Command dispatch latency histogram
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(COMMAND_LATENCY)
+
+#include "command_latency.h"
+
+CommandLatency command_latency;
+
+command_latency_t CommandLatency::stats[LATENCY_CLASSES];
+
+void CommandLatency::record(const char letter, const uint16_t codenum, const uint32_t us) {
+  LatencyClass c;
+  switch (letter) {
+    case 'G':
+      switch (codenum) {
+        case 0: case 1: c = LATENCY_MOVE; break;
+        case 2: case 3: case 5: c = LATENCY_ARC; break;
+        default: c = LATENCY_G; break;
+      }
+      break;
+    case 'M': c = LATENCY_M; break;
+    case 'T': c = LATENCY_T; break;
+    default: return;
+  }
+
+  command_latency_t &s = stats[c];
+  uint8_t bin = 0;
+  for (uint32_t t = us >> 6; t && bin < COMMAND_LATENCY_BINS - 1; t >>= 1) ++bin;
+  if (s.histogram[bin] < 0xFFFF) s.histogram[bin]++;
+  if (us >= s.max_us) {
+    s.max_us = us;
+    s.max_letter = letter;
+    s.max_codenum = codenum;
+  }
+}
+
+void CommandLatency::report() {
+  static PGMSTR(name_move, "G0/G1");
+  static PGMSTR(name_arc, "G2/G3/G5");
+  static PGMSTR(name_g, "G");
+  static PGMSTR(name_m, "M");
+  static PGMSTR(name_t, "T");
+  static PGM_P const names[LATENCY_CLASSES] PROGMEM = { name_move, name_arc, name_g, name_m, name_t };
+
+  SERIAL_ECHOLNPGM("Command us histogram bins <64 <128 <256 <512 <1K <2K <4K <8K <16K <32K <64K 64K+");
+  for (uint8_t i = 0; i < LATENCY_CLASSES; ++i) {
+    const command_latency_t &s = stats[i];
+    if (!s.max_letter) continue;
+    SERIAL_ECHOPGM_P((PGM_P)pgm_read_ptr(&names[i]));
+    SERIAL_ECHOPGM(" |");
+    for (uint8_t b = 0; b < COMMAND_LATENCY_BINS; ++b) SERIAL_ECHOPGM(" ", s.histogram[b]);
+    SERIAL_ECHOPGM(" | max:", s.max_us, "us ");
+    SERIAL_CHAR(s.max_letter);
+    SERIAL_ECHOLN(s.max_codenum);
+  }
+}
+
+#endif // COMMAND_LATENCY
@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * command_latency.h - Histogram of the time spent running each class of command
+ *
+ * Bins are powers of 2 from <64µs to 64ms+. The slowest command of each
+ * class is kept, so a slow M-code that stalls the stream can be found.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define COMMAND_LATENCY_BINS 12   // <64µs, <128µs, ... <64ms, 64ms+
+
+enum LatencyClass : uint8_t {
+  LATENCY_MOVE,                   // G0/G1
+  LATENCY_ARC,                    // G2/G3/G5
+  LATENCY_G,                      // Other G-codes
+  LATENCY_M,
+  LATENCY_T,
+  LATENCY_CLASSES
+};
+
+typedef struct {
+  uint16_t histogram[COMMAND_LATENCY_BINS];
+  uint32_t max_us;
+  char max_letter;                // The slowest command
+  uint16_t max_codenum;
+} command_latency_t;
+
+class CommandLatency {
+public:
+  static command_latency_t stats[LATENCY_CLASSES];
+
+  static void reset() { ZERO(stats); }
+  static void report();
+
+  static void record(const char letter, const uint16_t codenum, const uint32_t us);
+};
+
+extern CommandLatency command_latency;
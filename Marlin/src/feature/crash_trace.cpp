@@ -0,0 +1,97 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * crash_trace.cpp - Crash forensics trace in .noinit RAM
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(CRASH_TRACE)
+
+#include "crash_trace.h"
+
+#include "../module/planner.h"
+#include "../module/temperature.h"
+#include "../libs/hex_print.h"
+
+CrashTrace crash_trace;
+
+#define TRACE_MAGIC 0x7A3C
+
+// Not cleared by the C runtime, so it outlives a reset
+static struct {
+  uint16_t magic;
+  uint8_t index;                          // The next entry to write
+  char reason[20];                        // The start of the last kill() reason
+  trace_entry_t ring[CRASH_TRACE_SIZE];
+} trace __attribute__((section(".noinit")));
+
+void CrashTrace::record(const uint8_t type, const uint16_t value/*=0*/) {
+  uint8_t heaters = 0;
+  HOTEND_LOOP() if (thermalManager.degTargetHotend(e)) SBI(heaters, e);
+  #if HAS_HEATED_BED
+    if (thermalManager.degTargetBed()) SBI(heaters, 7);
+  #endif
+
+  const uint8_t i = trace.index & (CRASH_TRACE_SIZE - 1);
+  trace.ring[i] = { type, planner.block_buffer_head, planner.block_buffer_tail, heaters, value };
+  trace.index = i + 1;
+}
+
+void CrashTrace::kill(FSTR_P const reason) {
+  if (reason) {
+    strncpy_P(trace.reason, FTOP(reason), sizeof(trace.reason) - 1);
+    trace.reason[sizeof(trace.reason) - 1] = '\0';
+  }
+  else
+    trace.reason[0] = '\0';
+  report();
+}
+
+void CrashTrace::report() {
+  SERIAL_ECHO_MSG("Trace (oldest first)");
+  for (uint8_t n = 0; n < CRASH_TRACE_SIZE; ++n) {
+    const trace_entry_t &t = trace.ring[(trace.index + n) & (CRASH_TRACE_SIZE - 1)];
+    if (t.type == TRACE_NONE) continue;
+    SERIAL_ECHO_START();
+    switch (t.type) {
+      case TRACE_BOOT:    SERIAL_ECHOPGM("boot"); break;
+      case TRACE_MINKILL: SERIAL_ECHOPGM("minkill"); break;
+      default:            SERIAL_CHAR(t.type); SERIAL_ECHO(t.value);
+    }
+    SERIAL_ECHOLNPGM(" Q:", t.tail, "-", t.head, " H:", hex_byte(t.heaters));
+  }
+  if (trace.reason[0]) SERIAL_ECHO_MSG("Kill reason: ", trace.reason);
+}
+
+void CrashTrace::boot() {
+  if (trace.magic == TRACE_MAGIC) {
+    trace.reason[sizeof(trace.reason) - 1] = '\0';
+    report();
+  }
+  memset(&trace, 0, sizeof(trace));
+  trace.magic = TRACE_MAGIC;
+  record(TRACE_BOOT);
+}
+
+#endif // CRASH_TRACE
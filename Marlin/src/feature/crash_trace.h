@@ -0,0 +1,58 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * crash_trace.h - Recent commands and events, kept in RAM across a reset
+ *
+ * Each entry is a few bytes copied with no formatting, so recording costs
+ * next to nothing. After a watchdog or soft reset the trace is still valid
+ * and is printed at boot. kill() prints it right away, since a power cycle
+ * leaves no valid trace.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+enum TraceType : uint8_t {
+  TRACE_NONE,                             // Not written since the trace started
+  TRACE_BOOT,                             // Trace started
+  TRACE_MINKILL,                          // minkill(). The kill() reason is kept apart.
+  // Others are the command letter: 'G', 'M', 'T'...
+};
+
+typedef struct {
+  uint8_t type,                           // TraceType or command letter
+          head, tail,                     // Planner block indexes
+          heaters;                        // Heaters with a target. Bed is bit 7.
+  uint16_t value;                         // Command number
+} trace_entry_t;
+
+class CrashTrace {
+public:
+  static void boot();                     // Print the trace left before the reset, then start anew
+  static void report();
+
+  static void record(const uint8_t type, const uint16_t value=0);
+  static void kill(FSTR_P const reason);  // Keep the reason and print the trace
+};
+
+extern CrashTrace crash_trace;
@@ -131,6 +131,10 @@ namespace DirectStepping {
         return true;
       case State::SIZE:
         // Zero means full page size
+        if (Cfg::PAGE_SIZE < 256) {
+          if (c > Cfg::PAGE_SIZE) { fatal_error = true; state = State::MONITOR; return true; }
+          if (!c) c = Cfg::PAGE_SIZE;
+        }
         write_page_size = c;
         state = State::COLLECT;
         return true;
@@ -246,7 +250,7 @@ const uint8_t segment_table[DirectStepping::Config::NUM_SEGMENTS][DirectStepping
     { 1, 1, 1, 1, 1, 1, 1 }, // 14 =  7
     { 0 }
 
-  #elif STEPPER_PAGE_FORMAT == SP_4x2_256
+  #elif IS_SP_4x2
 
     { 0, 0, 0 }, // 0
     { 0, 1, 0 }, // 1
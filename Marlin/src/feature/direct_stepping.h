@@ -108,6 +108,9 @@ namespace DirectStepping {
   template <uint8_t num_pages>
   using SP_4x1_512  = config_t<num_pages, 4, 1, false, 512>;
 
+  template <uint8_t num_pages>
+  using SP_4x2_64   = config_t<num_pages, 4, 2, false, 64>;
+
   // configured types
   typedef STEPPER_PAGE_FORMAT<STEPPER_PAGES> Config;
 
@@ -120,6 +123,10 @@ namespace DirectStepping {
 //#define SP_4x2D_256 3
 #define SP_4x2_256 4
 #define SP_4x1_512 5
+#define SP_4x2_64 6
+
+// Formats that decode the same way, differing only in page size
+#define IS_SP_4x2 (STEPPER_PAGE_FORMAT == SP_4x2_256 || STEPPER_PAGE_FORMAT == SP_4x2_64)
 
 typedef typename DirectStepping::Config::page_idx_t page_idx_t;
 
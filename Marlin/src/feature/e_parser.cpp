@@ -30,6 +30,11 @@
 
 #include "e_parser.h"
 
+#if ENABLED(REALTIME_OVERRIDES)
+  #include "../module/motion.h"
+  #include "../module/planner.h"
+#endif
+
 // Static data members
 bool EmergencyParser::killed_by_M112, // = false
      EmergencyParser::quickstop_by_M410,
@@ -42,6 +47,43 @@ bool EmergencyParser::killed_by_M112, // = false
   uint8_t EmergencyParser::M876_reason; // = 0
 #endif
 
+#if ENABLED(REALTIME_OVERRIDES)
+
+  volatile bool EmergencyParser::override_pending, // = false
+                EmergencyParser::feed_reset,
+                EmergencyParser::flow_reset;
+  volatile int8_t EmergencyParser::feed_delta, // = 0
+                  EmergencyParser::flow_delta;
+
+  /**
+   * Apply overrides gathered by the RX ISR. Called from Temperature::task,
+   * so they take effect without waiting for the command queue.
+   */
+  void EmergencyParser::apply_overrides() {
+    hal.isr_off();
+    const bool fr_reset = feed_reset, fl_reset = flow_reset;
+    const int8_t fr_delta = feed_delta, fl_delta = flow_delta;
+    feed_reset = flow_reset = override_pending = false;
+    feed_delta = flow_delta = 0;
+    hal.isr_on();
+
+    if (fr_reset || fr_delta) {
+      const int16_t fr = (fr_reset ? 100 : feedrate_percentage) + fr_delta;
+      feedrate_percentage = constrain(fr, REALTIME_OVERRIDE_MIN, REALTIME_OVERRIDE_MAX);
+    }
+
+    #if HAS_EXTRUDERS
+      if (fl_reset || fl_delta) {
+        const int16_t fl = (fl_reset ? 100 : planner.flow_percentage[active_extruder]) + fl_delta;
+        planner.set_flow(active_extruder, constrain(fl, REALTIME_OVERRIDE_MIN, REALTIME_OVERRIDE_MAX));
+      }
+    #else
+      UNUSED(fl_reset); UNUSED(fl_delta);
+    #endif
+  }
+
+#endif
+
 // Global instance
 EmergencyParser emergency_parser;
 
@@ -49,7 +49,7 @@ class EmergencyParser {
 
 public:
 
-  // Currently looking for: M108, M112, M410, M524, M876 S[0-9], S000, P000, R000
+  // Currently looking for: M108, M112, M410, M524, M876 S[0-9], S000, P000, R000, 0x90-0x9D (overrides)
   enum State : uint8_t {
     EP_RESET,
     EP_N,
@@ -73,9 +73,23 @@ public:
       EP_ctrl,
       EP_K, EP_KI, EP_KIL, EP_KILL,
     #endif
-    EP_IGNORE // to '\n'
+    EP_IGNORE, // to '\n'
+    #if ALL(REALTIME_OVERRIDES, HAS_MEATPACK)
+      // Track MeatPack so packed bytes aren't taken for overrides
+      EP_MP_FF, EP_MP_CMD, EP_MP_LOAD,
+      EP_PACKED, EP_PACKED_FF, EP_PACKED_CMD,
+    #endif
   };
 
+  #if ENABLED(REALTIME_OVERRIDES)
+    // Grbl realtime override bytes
+    enum Override : uint8_t {
+      OVR_FEED_RESET = 0x90, OVR_FEED_UP_10, OVR_FEED_DOWN_10, OVR_FEED_UP_1, OVR_FEED_DOWN_1,
+      OVR_FLOW_RESET = 0x99, OVR_FLOW_UP_10, OVR_FLOW_DOWN_10, OVR_FLOW_UP_1, OVR_FLOW_DOWN_1
+    };
+    static constexpr bool is_override(const uint8_t c) { return c >= OVR_FEED_RESET && c <= OVR_FLOW_DOWN_1; }
+  #endif
+
   static bool killed_by_M112;
   static bool quickstop_by_M410;
 
@@ -87,12 +101,25 @@ public:
     static uint8_t M876_reason;
   #endif
 
+  #if ENABLED(REALTIME_OVERRIDES)
+    static volatile bool override_pending;
+    static void apply_overrides();
+  #endif
+
   EmergencyParser() { enable(); }
 
   FORCE_INLINE static void enable()  { enabled = true; }
   FORCE_INLINE static void disable() { enabled = false; }
 
   FORCE_INLINE static void update(State &state, const uint8_t c) {
+    #if ENABLED(REALTIME_OVERRIDES)
+      if (TERN1(HAS_MEATPACK, state < EP_MP_FF)) {
+        TERN_(HAS_MEATPACK, if (c == 0xFF) { state = EP_MP_FF; return; })
+        // Overrides may arrive mid-line, so leave the state untouched
+        if (is_override(c)) { if (enabled) take_override(c); return; }
+      }
+    #endif
+
     switch (state) {
       case EP_RESET:
         switch (c) {
@@ -209,6 +236,26 @@ public:
         if (ISEOL(c)) state = EP_RESET;
         break;
 
+      #if ALL(REALTIME_OVERRIDES, HAS_MEATPACK)
+        case EP_MP_FF: state = (c == 0xFF) ? EP_MP_CMD : EP_IGNORE; break;
+        case EP_MP_CMD:
+          switch (c) {
+            case 0xFB: state = EP_PACKED; break;  // MPCommand_EnablePacking
+            case 0xF5: state = EP_MP_LOAD; break; // MPCommand_LoadDictionary
+            default: state = EP_RESET;
+          }
+          break;
+        case EP_MP_LOAD: if (c == '\n') state = EP_RESET; break;
+        case EP_PACKED: if (c == 0xFF) state = EP_PACKED_FF; break;
+        case EP_PACKED_FF: state = (c == 0xFF) ? EP_PACKED_CMD : EP_PACKED; break;
+        case EP_PACKED_CMD:
+          switch (c) {
+            case 0xFA: case 0xF9: state = EP_RESET; break; // MPCommand_DisablePacking, MPCommand_ResetAll
+            default: state = EP_PACKED;
+          }
+          break;
+      #endif
+
       default:
         if (ISEOL(c)) {
           if (enabled) switch (state) {
@@ -238,6 +285,34 @@ public:
 
 private:
   static bool enabled;
+
+  #if ENABLED(REALTIME_OVERRIDES)
+    static volatile int8_t feed_delta, flow_delta;
+    static volatile bool feed_reset, flow_reset;
+
+    static inline void nudge(volatile int8_t &delta, const int8_t d) {
+      const int8_t v = delta + d;
+      delta = constrain(v, -100, 100);
+    }
+
+    // Called from the RX ISR. The main loop applies the result in apply_overrides().
+    static inline void take_override(const uint8_t c) {
+      switch (c) {
+        case OVR_FEED_RESET:   feed_reset = true; feed_delta = 0; break;
+        case OVR_FEED_UP_10:   nudge(feed_delta,  10); break;
+        case OVR_FEED_DOWN_10: nudge(feed_delta, -10); break;
+        case OVR_FEED_UP_1:    nudge(feed_delta,   1); break;
+        case OVR_FEED_DOWN_1:  nudge(feed_delta,  -1); break;
+        case OVR_FLOW_RESET:   flow_reset = true; flow_delta = 0; break;
+        case OVR_FLOW_UP_10:   nudge(flow_delta,  10); break;
+        case OVR_FLOW_DOWN_10: nudge(flow_delta, -10); break;
+        case OVR_FLOW_UP_1:    nudge(flow_delta,   1); break;
+        case OVR_FLOW_DOWN_1:  nudge(flow_delta,  -1); break;
+        default: return; // 0x95-0x98 (rapid overrides) are dropped
+      }
+      override_pending = true;
+    }
+  #endif
 };
 
 extern EmergencyParser emergency_parser;
@@ -219,8 +219,17 @@ class I2CPositionEncodersMgr {
 
     static void init();
 
-    // consider only updating one endoder per call / tick if encoders become too time intensive
-    static void update() { LOOP_PE(i) encoders[i].update(); }
+    #if ENABLED(I2CPE_UPDATE_ONE)
+      // Update one encoder per call so only one blocking read is done at a time
+      static void update() {
+        static uint8_t next; // = 0
+        encoders[next].update();
+        if (++next >= I2CPE_ENCODER_CNT) next = 0;
+      }
+    #else
+      // consider only updating one endoder per call / tick if encoders become too time intensive
+      static void update() { LOOP_PE(i) encoders[i].update(); }
+    #endif
 
     static void homed(const AxisEnum axis) {
       LOOP_PE(i)
@@ -38,7 +38,7 @@ IPAddress MarlinEthernet::ip,
           MarlinEthernet::gateway,
           MarlinEthernet::subnet;
 
-EthernetClient  MarlinEthernet::telnetClient;  // connected client
+TelnetClient    MarlinEthernet::telnetClient;  // connected client
 
 MarlinEthernet ethernet;
 
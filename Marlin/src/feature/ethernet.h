@@ -27,11 +27,56 @@
 
 // Teensy 4.1 uses internal MAC Address
 
+#ifdef ETHERNET_RX_BUFFER_SIZE
+
+  /**
+   * A telnet client that drains the socket in bulk reads.
+   * The G-code queue polls available()/read() once per byte,
+   * so serve those from a local buffer refilled with one socket read.
+   */
+  class BufferedEthernetClient : public EthernetClient {
+    public:
+      BufferedEthernetClient() : EthernetClient() {}
+      BufferedEthernetClient& operator=(const EthernetClient &c) {
+        EthernetClient::operator=(c);
+        index = count = 0;
+        return *this;
+      }
+
+      int available() {
+        if (index < count) return count - index;
+        index = count = 0;
+        const int n = EthernetClient::available();
+        if (n > 0) {
+          const int r = EthernetClient::read(buffer, _MIN(n, ETHERNET_RX_BUFFER_SIZE));
+          if (r > 0) count = r;
+        }
+        return count;
+      }
+
+      int peek() { return available() ? buffer[index] : -1; }
+      int read() { return available() ? buffer[index++] : -1; }
+
+      void stop() { index = count = 0; EthernetClient::stop(); }
+
+    private:
+      uint8_t buffer[ETHERNET_RX_BUFFER_SIZE];
+      uint16_t index = 0, count = 0;
+  };
+
+  typedef BufferedEthernetClient TelnetClient;
+
+#else
+
+  typedef EthernetClient TelnetClient;
+
+#endif
+
 class MarlinEthernet {
   public:
     static bool hardware_enabled, have_telnet_client;
     static IPAddress ip, myDns, gateway, subnet;
-    static EthernetClient telnetClient;
+    static TelnetClient telnetClient;
     static void init();
     static void check();
 };
@@ -0,0 +1,166 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(FLASH_JOB_STORAGE)
+
+#include "flash_job.h"
+#include "../module/printcounter.h"
+#include "../libs/hex_print.h"
+
+FlashJob flash_job;
+
+#define FLASH_JOB_MAGIC 0xA5F10B4AUL      // Not ASCII, so G-code text never matches it
+
+typedef struct {
+  uint32_t magic, seq, length;
+} flash_job_header_t;
+
+bool FlashJob::saving, FlashJob::printing;
+uint32_t FlashJob::start, FlashJob::length, FlashJob::seq, FlashJob::write_pos, FlashJob::read_pos;
+uint8_t FlashJob::page[SPI_FLASH_PageSize];
+uint16_t FlashJob::page_len;
+
+// The flash address of a G-code offset, after the header page and wrapped into the region
+uint32_t FlashJob::address(const uint32_t offset) {
+  return FLASH_JOB_START + (start - (FLASH_JOB_START) + SPI_FLASH_PageSize + offset) % (FLASH_JOB_SIZE);
+}
+
+// Find the newest job header in the region
+bool FlashJob::find_last() {
+  W25QXX.init(SPI_FULL_SPEED);
+  bool found = false;
+  for (uint32_t a = FLASH_JOB_START; a < (FLASH_JOB_START) + (FLASH_JOB_SIZE); a += SPI_FLASH_SectorSize) {
+    flash_job_header_t h;
+    W25QXX.SPI_FLASH_BufferRead((uint8_t*)&h, a, sizeof(h));
+    if (h.magic != FLASH_JOB_MAGIC) continue;
+    if (!found || int32_t(h.seq - seq) > 0) { found = true; start = a; seq = h.seq; length = h.length; }
+  }
+  return found;
+}
+
+/**
+ * Start a new job in the sector after the newest one.
+ * A job whose upload was cut short has no length, so skip only its header.
+ */
+void FlashJob::begin_write() {
+  if (printing) return;
+  if (find_last()) {
+    const uint32_t used = length == 0xFFFFFFFF ? SPI_FLASH_SectorSize : SPI_FLASH_PageSize + length,
+                   sectors = (used + SPI_FLASH_SectorSize - 1) / SPI_FLASH_SectorSize;
+    start = FLASH_JOB_START + (start - (FLASH_JOB_START) + sectors * SPI_FLASH_SectorSize) % (FLASH_JOB_SIZE);
+    ++seq;
+  }
+  else {
+    start = FLASH_JOB_START;
+    seq = 0;
+  }
+
+  W25QXX.SPI_FLASH_SectorErase(start);
+  flash_job_header_t h = { FLASH_JOB_MAGIC, seq, 0xFFFFFFFF };
+  W25QXX.SPI_FLASH_PageWrite((uint8_t*)&h, start, sizeof(h));
+
+  length = 0xFFFFFFFF;
+  write_pos = page_len = 0;
+  saving = true;
+  SERIAL_ECHOLNPGM("Writing to flash job");
+}
+
+// Program the page buffer, erasing each sector as the job enters it
+void FlashJob::write_page() {
+  const uint32_t addr = address(write_pos);
+  if (addr % SPI_FLASH_SectorSize == 0) W25QXX.SPI_FLASH_SectorErase(addr);
+  W25QXX.SPI_FLASH_PageWrite(page, addr, page_len);
+  write_pos += page_len;
+  page_len = 0;
+}
+
+void FlashJob::write_line(const char * const cmd) {
+  // Stop short of the sector holding this job's header
+  const size_t len = strlen(cmd) + 1;
+  if (SPI_FLASH_PageSize + write_pos + page_len + len > (FLASH_JOB_SIZE) - (SPI_FLASH_SectorSize)) {
+    saving = false;
+    SERIAL_ERROR_MSG("Flash job full");
+    return;
+  }
+  for (size_t i = 0; i < len; ++i) {
+    page[page_len++] = i < len - 1 ? cmd[i] : '\n';
+    if (page_len == SPI_FLASH_PageSize) write_page();
+  }
+}
+
+// Write the rest of the job, then its length to mark it complete
+void FlashJob::end_write() {
+  if (page_len) write_page();
+  length = write_pos;
+  W25QXX.SPI_FLASH_PageWrite((uint8_t*)&length, start + offsetof(flash_job_header_t, length), sizeof(length));
+  saving = false;
+  SERIAL_ECHOLNPGM("Flash job saved: ", length, " bytes");
+}
+
+bool FlashJob::start_print() {
+  if (saving || printing) return false;
+  if (!find_last() || length == 0xFFFFFFFF) {
+    length = read_pos = 0;
+    SERIAL_ECHOLNPGM("No flash job");
+    return false;
+  }
+  read_pos = 0;
+  printing = true;
+  print_job_timer.start();
+  return true;
+}
+
+void FlashJob::stop_print() {
+  if (!printing) return;
+  printing = false;
+  print_job_timer.stop();
+  SERIAL_ECHOLNPGM("Flash job stopped at ", read_pos, " of ", length, " bytes");
+}
+
+// Read the job a page at a time. Pages never cross the end of the region.
+int16_t FlashJob::get() {
+  if (eof()) return -1;
+  const uint16_t i = read_pos % SPI_FLASH_PageSize;
+  if (i == 0) W25QXX.SPI_FLASH_BufferRead(page, address(read_pos), _MIN(uint32_t(SPI_FLASH_PageSize), length - read_pos));
+  ++read_pos;
+  if (eof()) {
+    printing = false;
+    print_job_timer.stop();
+    SERIAL_ECHOLNPGM("Done printing flash job");
+  }
+  return page[i];
+}
+
+void FlashJob::report() {
+  if (saving)
+    SERIAL_ECHOLNPGM("Writing flash job: ", write_pos + page_len, " bytes");
+  else if (printing)
+    SERIAL_ECHOLNPGM("Printing flash job: ", read_pos, " of ", length, " bytes");
+  else if (find_last() && length != 0xFFFFFFFF)
+    SERIAL_ECHOLNPGM("Flash job ", seq, ": ", length, " bytes at 0x", hex_long(start));
+  else
+    SERIAL_ECHOLNPGM("No flash job");
+}
+
+#endif // FLASH_JOB_STORAGE
@@ -0,0 +1,65 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * flash_job.h - Store a print job in SPI flash and print it from there
+ *
+ * Jobs are laid out one after another in the FLASH_JOB region, wrapping at
+ * its end. Each job starts on a sector with a one-page header, followed by
+ * the G-code lines. The newest header (highest sequence) is the stored job.
+ * Its length stays erased until the job is finished, so an interrupted
+ * upload leaves no job to print.
+ */
+
+#include "../libs/W25Qxx.h"
+
+class FlashJob {
+public:
+  static bool saving,                     // Host lines go to flash (M590 .. M591)
+              printing;                   // Lines come from flash (M592)
+
+  static void begin_write();
+  static void write_line(const char * const cmd);
+  static void end_write();
+
+  static bool start_print();
+  static void stop_print();
+  static int16_t get();                   // The next byte of the job, or -1 at the end
+  static bool eof() { return read_pos >= length; }
+
+  static void report();
+
+private:
+  static uint32_t start,                  // Flash address of the job header
+                  length,                 // Bytes of G-code in the job
+                  seq,                    // Sequence number of the job
+                  write_pos, read_pos;    // Offsets into the G-code
+  static uint8_t page[SPI_FLASH_PageSize]; // The page being written, or the one being read
+  static uint16_t page_len;
+
+  static bool find_last();
+  static uint32_t address(const uint32_t offset);
+  static void write_page();
+};
+
+extern FlashJob flash_job;
@@ -0,0 +1,109 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * fleet_telemetry.cpp - Binary status frame for fleet managers
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(FLEET_TELEMETRY)
+
+#include "fleet_telemetry.h"
+#include "../MarlinCore.h"
+#include "../gcode/queue.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+#include "../lcd/marlinui.h"
+#include "../libs/crc16.h"
+
+#if HAS_FILAMENT_SENSOR
+  #include "runout.h"
+#endif
+
+FleetTelemetry fleet_telemetry;
+
+AutoReporter<FleetTelemetry::FleetTelemetryReport> FleetTelemetry::auto_reporter;
+
+#define HEATER_BYTES 5
+#define FRAME_PAYLOAD (4 + 4 + (HOTENDS + ENABLED(HAS_HEATED_BED)) * (HEATER_BYTES) + (LOGICAL_AXES) * 4 + 2 + 2)
+
+static uint8_t frame[FRAME_PAYLOAD], frame_len;
+
+static void put(uint32_t v, const uint8_t bytes) {
+  for (uint8_t i = 0; i < bytes; ++i, v >>= 8) frame[frame_len++] = uint8_t(v);
+}
+
+static void put_heater(const celsius_float_t temp, const celsius_t target, const int16_t power) {
+  put(uint16_t(int16_t(LROUND(temp * 10))), 2);
+  put(uint16_t(target), 2);
+  put(uint8_t(_MAX(power, 0)), 1);
+}
+
+/**
+ * Send one frame with the values the firmware already holds. No temperature
+ * is read and no position is recomputed to build it.
+ */
+void FleetTelemetry::report() {
+  const uint8_t flags = (printingIsActive() ? FLAG_PRINTING : 0)
+                      | (printingIsPaused() ? FLAG_PAUSED : 0)
+                      | (all_axes_homed() ? FLAG_HOMED : 0)
+                      | (planner.has_blocks_queued() ? FLAG_MOVING : 0)
+                      | (TERN0(HAS_FILAMENT_SENSOR, runout.filament_ran_out) ? FLAG_RUNOUT : 0)
+                      | (ENABLED(HAS_HEATED_BED) ? FLAG_BED : 0);
+  frame_len = 0;
+  put(VERSION, 1);
+  put(flags, 1);
+  put(HOTENDS, 1);
+  put(NUM_AXES, 1);
+  put(millis(), 4);
+
+  #if HAS_HOTEND
+    HOTEND_LOOP() put_heater(thermalManager.degHotend(e), thermalManager.degTargetHotend(e), thermalManager.getHeaterPower((heater_id_t)e));
+  #endif
+  #if HAS_HEATED_BED
+    put_heater(thermalManager.degBed(), thermalManager.degTargetBed(), thermalManager.getHeaterPower(H_BED));
+  #endif
+
+  LOOP_LOGICAL_AXES(i) put(uint32_t(int32_t(LROUND(current_position[i] * 1000))), 4);
+
+  #if HAS_PRINT_PROGRESS_PERMYRIAD
+    put(ui.get_progress_permyriad(), 2);
+  #elif HAS_PRINT_PROGRESS
+    put(ui.get_progress_percent() * 100U, 2);
+  #else
+    put(0xFFFF, 2);
+  #endif
+  put(planner.movesplanned(), 1);
+  put(queue.ring_buffer.length, 1);
+
+  uint16_t crc = 0xFFFF;
+  crc16(&crc, &frame_len, 1);
+  crc16(&crc, frame, frame_len);
+
+  SERIAL_CHAR(char(SYNC_BYTE), char(frame_len));
+  for (uint8_t i = 0; i < frame_len; ++i) SERIAL_CHAR(char(frame[i]));
+  SERIAL_CHAR(char(crc & 0xFF), char(crc >> 8), '\n');
+}
+
+#endif // FLEET_TELEMETRY
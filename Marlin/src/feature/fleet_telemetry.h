@@ -0,0 +1,63 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * fleet_telemetry.h - One binary status frame in place of M105, M114, M27 and M73
+ *
+ *   0xB2 | len | payload[len] | crc16 (low byte first) | '\n'
+ *
+ * The CRC-16/CCITT (seed 0xFFFF) covers len and payload. Values are little-endian:
+ *
+ *   u8  version, flags (FleetTelemetry::Flag), hotends, axes
+ *   u32 millis
+ *   per hotend, then the bed if FLAG_BED: i16 temp (0.1°C), i16 target (°C), u8 power
+ *   i32 position of each axis, then E if there is an extruder (µm)
+ *   u16 progress (0.01%, 0xFFFF if unknown)
+ *   u8  planner blocks, queued commands
+ *
+ * The frame always starts a line, so a host can read it in place of a text line.
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../libs/autoreport.h"
+
+class FleetTelemetry {
+public:
+  enum Flag : uint8_t {
+    FLAG_PRINTING = _BV(0),
+    FLAG_PAUSED   = _BV(1),
+    FLAG_HOMED    = _BV(2),
+    FLAG_MOVING   = _BV(3),
+    FLAG_RUNOUT   = _BV(4),
+    FLAG_BED      = _BV(5)
+  };
+
+  static constexpr uint8_t SYNC_BYTE = 0xB2, VERSION = 1;
+
+  static void report();
+
+  struct FleetTelemetryReport { static void report() { FleetTelemetry::report(); } };
+  static AutoReporter<FleetTelemetryReport> auto_reporter;
+};
+
+extern FleetTelemetry fleet_telemetry;
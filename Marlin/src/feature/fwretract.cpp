@@ -133,27 +133,53 @@ void FWRetract::retract(const bool retracting E_OPTARG(bool swapping/*=false*/))
   #endif
 
   const feedRate_t fr_max_z = planner.settings.max_feedrate_mm_s[Z_AXIS];
+
+  #if ENABLED(FWRETRACT_COMBINED_HOP)
+    // Feedrate for the hop and an E move done together. The move length is the hop,
+    // so scale it down for E to keep its own feedrate, and Z its maximum feedrate.
+    auto hop_feedrate = [&](const float hop, const float e_length, const_feedRate_t e_fr) -> feedRate_t {
+      return e_length > 0 ? _MIN(fr_max_z, hop * e_fr / e_length) : fr_max_z;
+    };
+  #endif
+
   if (retracting) {
     // Retract by moving from a faux E position back to the current E position
     current_retract[active_extruder] = base_retract;
-    prepare_internal_move_to_destination(                 // set current from destination
-      settings.retract_feedrate_mm_s * TERN1(RETRACT_SYNC_MIXING, (MIXING_STEPPERS))
-    );
+    const feedRate_t fr_retract = settings.retract_feedrate_mm_s * TERN1(RETRACT_SYNC_MIXING, (MIXING_STEPPERS));
 
-    // Is a Z hop set, and has the hop not yet been done?
-    if (!current_hop && settings.retract_zraise > 0.01f) {  // Apply hop only once
-      current_hop += settings.retract_zraise;               // Add to the hop total (again, only once)
-      // Raise up, set_current_to_destination. Maximum Z feedrate
-      prepare_internal_move_to_destination(fr_max_z);
-    }
+    #if ENABLED(FWRETRACT_COMBINED_HOP)
+
+      // Is a Z hop set, and has the hop not yet been done?
+      if (!current_hop && settings.retract_zraise > 0.01f) {  // Apply hop only once
+        current_hop += settings.retract_zraise;               // Add to the hop total (again, only once)
+        // Retract and raise together, set_current_to_destination
+        prepare_internal_move_to_destination(hop_feedrate(current_hop, base_retract, fr_retract));
+      }
+      else
+        prepare_internal_move_to_destination(fr_retract);     // set current from destination
+
+    #else
+
+      prepare_internal_move_to_destination(fr_retract);       // set current from destination
+
+      // Is a Z hop set, and has the hop not yet been done?
+      if (!current_hop && settings.retract_zraise > 0.01f) {  // Apply hop only once
+        current_hop += settings.retract_zraise;               // Add to the hop total (again, only once)
+        // Raise up, set_current_to_destination. Maximum Z feedrate
+        prepare_internal_move_to_destination(fr_max_z);
+      }
+
+    #endif
   }
   else {
-    // If a hop was done and Z hasn't changed, undo the Z hop
-    if (current_hop) {
-      current_hop = 0;
-      // Lower Z, set_current_to_destination. Maximum Z feedrate
-      prepare_internal_move_to_destination(fr_max_z);
-    }
+    #if DISABLED(FWRETRACT_COMBINED_HOP)
+      // If a hop was done and Z hasn't changed, undo the Z hop
+      if (current_hop) {
+        current_hop = 0;
+        // Lower Z, set_current_to_destination. Maximum Z feedrate
+        prepare_internal_move_to_destination(fr_max_z);
+      }
+    #endif
 
     const float extra_recover = swapping ? settings.swap_retract_recover_extra : settings.retract_recover_extra;
     if (extra_recover) {
@@ -161,13 +187,23 @@ void FWRetract::retract(const bool retracting E_OPTARG(bool swapping/*=false*/))
       sync_plan_position_e();                             // Sync the planner position so the extra amount is recovered
     }
 
+    TERN_(FWRETRACT_COMBINED_HOP, const float recover_length = current_retract[active_extruder] + extra_recover);
     current_retract[active_extruder] = 0;
 
-    // Recover E, set_current_to_destination
-    prepare_internal_move_to_destination(
-      (swapping ? settings.swap_retract_recover_feedrate_mm_s : settings.retract_recover_feedrate_mm_s)
-      * TERN1(RETRACT_SYNC_MIXING, (MIXING_STEPPERS))
-    );
+    const feedRate_t fr_recover = (swapping ? settings.swap_retract_recover_feedrate_mm_s : settings.retract_recover_feedrate_mm_s)
+                                  * TERN1(RETRACT_SYNC_MIXING, (MIXING_STEPPERS));
+
+    #if ENABLED(FWRETRACT_COMBINED_HOP)
+      // If a hop was done and Z hasn't changed, undo the Z hop while recovering
+      if (current_hop) {
+        const float hop = current_hop;
+        current_hop = 0;
+        // Lower Z and recover E together, set_current_to_destination
+        prepare_internal_move_to_destination(hop_feedrate(hop, recover_length, fr_recover));
+      }
+      else
+    #endif
+        prepare_internal_move_to_destination(fr_recover);   // Recover E, set_current_to_destination
   }
 
   TERN_(RETRACT_SYNC_MIXING, mixer.T(old_mixing_tool));   // Restore original mixing tool
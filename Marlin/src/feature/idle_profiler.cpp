@@ -0,0 +1,83 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * idle_profiler.cpp - Measure the time spent in each task of idle() and loop()
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(IDLE_PROFILER)
+
+#include "idle_profiler.h"
+
+#if ENABLED(IDLE_SCHEDULER)
+  #include "idle_scheduler.h"
+#endif
+
+IdleProfiler idle_profiler;
+
+idle_task_profile_t IdleProfiler::stats[IDLE_TASK_COUNT];
+uint32_t IdleProfiler::nested; // = 0
+millis_t IdleProfiler::mark_ms; // = 0
+AutoReporter<IdleProfiler::IdleProfileReport> IdleProfiler::auto_reporter;
+
+void IdleProfiler::reset() {
+  for (uint8_t i = 0; i < IDLE_TASK_COUNT; ++i) stats[i] = { 0, 0, 0 };
+  mark_ms = millis();
+}
+
+/**
+ * Report the time spent in each task and start a new interval
+ *
+ * Returns "IDLE <ms>" for the length of the interval, then for each task
+ * that ran "IDLE <task> SUM<µs> MAX<µs> N<calls>".
+ */
+void IdleProfiler::report() {
+  static PGMSTR(name_inactivity, "Inactivity");
+  static PGMSTR(name_thermal, "Thermal");
+  static PGMSTR(name_runout, "Runout");
+  static PGMSTR(name_hal, "HAL");
+  static PGMSTR(name_media, "Media");
+  static PGMSTR(name_keepalive, "Keepalive");
+  static PGMSTR(name_ui, "UI");
+  static PGMSTR(name_autoreport, "AutoReport");
+  static PGMSTR(name_commands, "Commands");
+  static PGMSTR(name_endstops, "Endstops");
+  static PGM_P const names[IDLE_TASK_COUNT] PROGMEM = {
+    name_inactivity, name_thermal, name_runout, name_hal, name_media,
+    name_keepalive, name_ui, name_autoreport, name_commands, name_endstops
+  };
+
+  SERIAL_ECHOLNPGM("IDLE ", millis() - mark_ms);
+  for (uint8_t i = 0; i < IDLE_TASK_COUNT; ++i) {
+    const idle_task_profile_t &s = stats[i];
+    if (!s.count) continue;
+    SERIAL_ECHOPGM("IDLE ");
+    SERIAL_ECHOPGM_P((PGM_P)pgm_read_ptr(&names[i]));
+    SERIAL_ECHOLNPGM(" SUM", s.total, " MAX", s.max, " N", s.count);
+  }
+  TERN_(IDLE_SCHEDULER, idle_scheduler.report());
+  reset();
+}
+
+#endif // IDLE_PROFILER
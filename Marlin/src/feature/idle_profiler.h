@@ -0,0 +1,91 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * idle_profiler.h - Measure the time spent in each task of idle() and loop()
+ *
+ * Each task is timed with micros(). Time spent in profiled tasks that run
+ * inside another one (e.g., idle() called while a command runs) is not
+ * charged to the outer task. Totals wrap after ~71 minutes, so report at
+ * least that often (M583 starts a new interval).
+ */
+
+#include "../inc/MarlinConfig.h"
+#include "../libs/autoreport.h"
+
+enum IdleTaskID : uint8_t {
+  IDLE_TASK_INACTIVITY,
+  IDLE_TASK_THERMAL,
+  IDLE_TASK_RUNOUT,
+  IDLE_TASK_HAL,
+  IDLE_TASK_MEDIA,
+  IDLE_TASK_KEEPALIVE,
+  IDLE_TASK_UI,
+  IDLE_TASK_AUTOREPORT,
+  IDLE_TASK_COMMANDS,
+  IDLE_TASK_ENDSTOPS,
+  IDLE_TASK_COUNT
+};
+
+typedef struct {
+  uint32_t total, max, count;
+} idle_task_profile_t;
+
+class IdleProfiler {
+public:
+  static idle_task_profile_t stats[IDLE_TASK_COUNT];
+  static uint32_t nested;               // Running total of µs spent in profiled tasks
+  static millis_t mark_ms;              // Start of the current interval
+
+  static void reset();
+  static void report();
+
+  static void record(const IdleTaskID id, const uint32_t us) {
+    idle_task_profile_t &s = stats[id];
+    s.total += us;
+    NOLESS(s.max, us);
+    s.count++;
+  }
+
+  struct IdleProfileReport { static void report() { IdleProfiler::report(); } };
+  static AutoReporter<IdleProfileReport> auto_reporter;
+};
+
+extern IdleProfiler idle_profiler;
+
+/**
+ * Profile a task for as long as this object is in scope
+ */
+class IdleProfile {
+  const IdleTaskID id;
+  uint32_t start, nested_start;
+public:
+  IdleProfile(const IdleTaskID i) : id(i), start(micros()), nested_start(IdleProfiler::nested) {}
+  ~IdleProfile() {
+    const uint32_t us = (micros() - start) - (IdleProfiler::nested - nested_start);
+    IdleProfiler::nested += us;
+    IdleProfiler::record(id, us);
+  }
+};
+
+#define PROFILE_IDLE_TASK(T, V...) do{ IdleProfile _task_profile(IDLE_TASK_##T); V; }while(0)
@@ -0,0 +1,169 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * idle_scheduler.cpp - Run the periodic tasks of idle() only when they are due
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(IDLE_SCHEDULER)
+
+#include "idle_scheduler.h"
+#include "../gcode/gcode.h"
+#include "../gcode/queue.h"
+#include "../module/motion.h"
+#include "../module/printcounter.h"
+
+#if ENABLED(IDLE_PROFILER)
+  #include "idle_profiler.h"
+#else
+  #define PROFILE_IDLE_TASK(T, V...) do{ V; }while(0)
+#endif
+
+#if ENABLED(I2C_POSITION_ENCODERS)
+  #include "encoder_i2c.h"
+  #include "../module/planner.h"
+#endif
+
+#if HAS_AUTO_REPORTING
+  #include "../module/temperature.h"
+  #if ENABLED(AUTO_REPORT_FANS)
+    #include "fancheck.h"
+  #endif
+  #if ENABLED(AUTO_REPORT_SD_STATUS)
+    #include "../sd/cardreader.h"
+  #endif
+  #if ENABLED(FLEET_TELEMETRY)
+    #include "fleet_telemetry.h"
+  #endif
+#endif
+
+IdleScheduler idle_scheduler;
+
+typedef struct {
+  void (*task)();
+  uint16_t period_ms, budget_us;
+  PGM_P name;
+} idle_sched_task_t;
+
+#if ENABLED(HOST_KEEPALIVE_FEATURE)
+  static PGMSTR(name_keepalive, "Keepalive");
+  static void task_keepalive() { PROFILE_IDLE_TASK(KEEPALIVE, gcode.host_keepalive()); }
+#endif
+
+#if ENABLED(I2C_POSITION_ENCODERS)
+  static PGMSTR(name_encoders, "Encoders");
+  static void task_encoders() { if (planner.has_blocks_queued()) I2CPEM.update(); }
+#endif
+
+#if HAS_AUTO_REPORTING
+  // Reporters with a period in seconds. The per-ms samplers stay in idle().
+  static PGMSTR(name_autoreport, "AutoReport");
+  static void task_autoreport() {
+    if (gcode.autoreport_paused) return;
+    TERN_(IDLE_PROFILER, IdleProfile autoreport_profile(IDLE_TASK_AUTOREPORT));
+    TERN_(AUTO_REPORT_TEMPERATURES, thermalManager.auto_reporter.tick());
+    TERN_(AUTO_REPORT_FANS, fan_check.auto_reporter.tick());
+    TERN_(AUTO_REPORT_SD_STATUS, card.auto_reporter.tick());
+    TERN_(AUTO_REPORT_POSITION, position_auto_reporter.tick());
+    TERN_(SERIAL_LINK_STATS, queue.link_auto_reporter.tick());
+    TERN_(IDLE_PROFILER, idle_profiler.auto_reporter.tick());
+    TERN_(FLEET_TELEMETRY, fleet_telemetry.auto_reporter.tick());
+  }
+#endif
+
+#if ENABLED(PRINTCOUNTER)
+  static PGMSTR(name_printcounter, "PrintCounter");
+  static void task_printcounter() { print_job_timer.tick(); }
+#endif
+
+// In order of priority
+static const idle_sched_task_t sched_tasks[] PROGMEM = {
+  #if ENABLED(HOST_KEEPALIVE_FEATURE)
+    { task_keepalive, 100, 2000, name_keepalive },
+  #endif
+  #if ENABLED(I2C_POSITION_ENCODERS)
+    { task_encoders, I2CPE_MIN_UPD_TIME_MS, 2000, name_encoders },
+  #endif
+  #if HAS_AUTO_REPORTING
+    { task_autoreport, 100, 5000, name_autoreport },
+  #endif
+  #if ENABLED(PRINTCOUNTER)
+    { task_printcounter, 1000, 1000, name_printcounter },
+  #endif
+};
+
+#define SCHED_TASKS COUNT(sched_tasks)
+
+static millis_t next_ms[SCHED_TASKS], next_due_ms; // = 0
+#if ENABLED(IDLE_PROFILER)
+  static uint16_t overruns[SCHED_TASKS];
+  static uint32_t max_us[SCHED_TASKS];
+#endif
+
+void IdleScheduler::run() {
+  const millis_t ms = millis();
+  if (PENDING(ms, next_due_ms)) return;
+
+  next_due_ms = ms + 0x7FFF;
+  for (uint8_t i = 0; i < SCHED_TASKS; ++i) {
+    idle_sched_task_t t;
+    memcpy_P(&t, &sched_tasks[i], sizeof(t));
+    if (ELAPSED(ms, next_ms[i])) {
+      next_ms[i] = ms + t.period_ms;
+      #if ENABLED(IDLE_PROFILER)
+        const uint32_t start = micros();
+        t.task();
+        const uint32_t us = micros() - start;
+        NOLESS(max_us[i], us);
+        if (us > t.budget_us) overruns[i]++;
+      #else
+        t.task();
+      #endif
+    }
+    if (int32_t(next_ms[i] - next_due_ms) < 0) next_due_ms = next_ms[i];
+  }
+}
+
+void IdleScheduler::reset() {
+  #if ENABLED(IDLE_PROFILER)
+    for (uint8_t i = 0; i < SCHED_TASKS; ++i) { overruns[i] = 0; max_us[i] = 0; }
+  #endif
+}
+
+/**
+ * Report "IDLE SCHED <task> MAX<µs> OVER<n>" for each task, where OVER
+ * counts the runs longer than the task's budget.
+ */
+void IdleScheduler::report() {
+  #if ENABLED(IDLE_PROFILER)
+    for (uint8_t i = 0; i < SCHED_TASKS; ++i) {
+      SERIAL_ECHOPGM("IDLE SCHED ");
+      SERIAL_ECHOPGM_P((PGM_P)pgm_read_ptr(&sched_tasks[i].name));
+      SERIAL_ECHOLNPGM(" MAX", max_us[i], " OVER", overruns[i]);
+    }
+  #endif
+  reset();
+}
+
+#endif // IDLE_SCHEDULER
@@ -0,0 +1,42 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * idle_scheduler.h - Run the periodic tasks of idle() only when they are due
+ *
+ * Each task in the table has a period and a budget in µs. idle() makes one
+ * time check until the earliest task is due, then runs every due task in
+ * table order (highest priority first). A task that runs past its budget
+ * counts as an overrun, reported by M583 when IDLE_PROFILER is enabled.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class IdleScheduler {
+public:
+  static void run();
+  static void report();
+  static void reset();
+};
+
+extern IdleScheduler idle_scheduler;
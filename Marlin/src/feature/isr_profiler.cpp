@@ -0,0 +1,93 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * isr_profiler.cpp - Measure the cycles spent in the Stepper and Temperature ISRs
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(ISR_PROFILER)
+
+#include "isr_profiler.h"
+
+ISRProfiler isr_profiler;
+
+isr_profile_t ISRProfiler::stats[PROFILE_COUNT];
+volatile uint16_t ISRProfiler::nested; // = 0
+
+void ISRProfiler::init() {
+  // Normal mode, no prescaler, no interrupts
+  CAT(CAT(TCCR, ISR_PROFILER_TIMER), A) = 0;
+  CAT(CAT(TCCR, ISR_PROFILER_TIMER), B) = _BV(CAT(CAT(CS, ISR_PROFILER_TIMER), 0));
+  CAT(TIMSK, ISR_PROFILER_TIMER) = 0;
+  reset();
+}
+
+void ISRProfiler::reset() {
+  const bool irqon = hal.isr_state();
+  hal.isr_off();
+  for (uint8_t i = 0; i < PROFILE_COUNT; ++i) {
+    stats[i] = { 0xFFFF, 0, 0, 0, { 0 } };
+  }
+  if (irqon) hal.isr_on();
+}
+
+void ISRProfiler::record(const ISRProfileID id, const uint16_t cycles) {
+  isr_profile_t &s = stats[id];
+  NOMORE(s.min, cycles);
+  NOLESS(s.max, cycles);
+  // Halve the totals before they overflow, keeping the average
+  if (s.total > 0xF0000000UL) { s.total >>= 1; s.count >>= 1; }
+  s.total += cycles;
+  s.count++;
+  uint8_t bin = 0;
+  for (uint16_t c = cycles >> 7; c && bin < ISR_PROFILER_BINS - 1; c >>= 1) ++bin;
+  if (s.histogram[bin] < 0xFFFF) s.histogram[bin]++;
+}
+
+void ISRProfiler::report() {
+  static PGMSTR(name_stepper, "Stepper");
+  static PGMSTR(name_pulse, "Pulse");
+  static PGMSTR(name_block, "Block");
+  static PGMSTR(name_advance, "Advance");
+  static PGMSTR(name_babystep, "Babystep");
+  static PGMSTR(name_temperature, "Temperature");
+  static PGM_P const names[PROFILE_COUNT] PROGMEM = {
+    name_stepper, name_pulse, name_block, name_advance, name_babystep, name_temperature
+  };
+
+  SERIAL_ECHOLNPGM("ISR cycles (F_CPU ", F_CPU, ") histogram bins <128 <256 <512 <1K <2K <4K <8K 8K+");
+  for (uint8_t i = 0; i < PROFILE_COUNT; ++i) {
+    // Copy the stats, since the ISRs keep running
+    hal.isr_off();
+    const isr_profile_t s = stats[i];
+    hal.isr_on();
+    if (!s.count) continue;
+    SERIAL_ECHOPGM_P((PGM_P)pgm_read_ptr(&names[i]));
+    SERIAL_ECHOPGM(" min:", s.min, " avg:", s.total / s.count, " max:", s.max, " n:", s.count, " |");
+    for (uint8_t b = 0; b < ISR_PROFILER_BINS; ++b) SERIAL_ECHOPGM(" ", s.histogram[b]);
+    SERIAL_EOL();
+  }
+}
+
+#endif // ISR_PROFILER
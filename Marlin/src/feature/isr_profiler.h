@@ -0,0 +1,91 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * isr_profiler.h - Measure the cycles spent in the Stepper and Temperature ISRs
+ *
+ * A free 16-bit timer runs at F_CPU without a prescaler, so each count is one
+ * CPU cycle. Sections that run longer than 65535 cycles (~4ms at 16MHz) wrap.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define ISR_PROFILER_COUNTER CAT(TCNT, ISR_PROFILER_TIMER)
+#define ISR_PROFILER_BINS 8   // Histogram bins: <128, <256, ... <8192, and 8192+ cycles
+
+enum ISRProfileID : uint8_t {
+  PROFILE_STEPPER_ISR,
+  PROFILE_PULSE_PHASE,
+  PROFILE_BLOCK_PHASE,
+  PROFILE_ADVANCE,
+  PROFILE_BABYSTEP,
+  PROFILE_TEMPERATURE_ISR,
+  PROFILE_COUNT
+};
+
+typedef struct {
+  uint16_t min, max;
+  uint32_t total, count;
+  uint16_t histogram[ISR_PROFILER_BINS];
+} isr_profile_t;
+
+class ISRProfiler {
+public:
+  static isr_profile_t stats[PROFILE_COUNT];
+  static volatile uint16_t nested;      // Running total of cycles spent in profiled ISRs
+
+  static void init();
+  static void reset();
+  static void report();
+
+  static uint16_t now() { return ISR_PROFILER_COUNTER; }
+  static void record(const ISRProfileID id, const uint16_t cycles);
+};
+
+extern ISRProfiler isr_profiler;
+
+/**
+ * Profile a code section for as long as this object is in scope.
+ * Cycles of profiled ISRs that preempt the section are not counted.
+ */
+class ISRProfile {
+  const ISRProfileID id;
+  uint16_t start, nested_start;
+public:
+  ISRProfile(const ISRProfileID i) : id(i) {
+    const bool irqon = hal.isr_state();
+    hal.isr_off();
+    start = ISRProfiler::now();
+    nested_start = ISRProfiler::nested;
+    if (irqon) hal.isr_on();
+  }
+  ~ISRProfile() {
+    const bool irqon = hal.isr_state();
+    hal.isr_off();
+    const uint16_t cycles = uint16_t(ISRProfiler::now() - start) - uint16_t(ISRProfiler::nested - nested_start);
+    // A whole ISR counts as preemption for any section it interrupted
+    if (id == PROFILE_STEPPER_ISR || id == PROFILE_TEMPERATURE_ISR) ISRProfiler::nested += cycles;
+    if (irqon) hal.isr_on();
+    ISRProfiler::record(id, cycles);
+  }
+};
@@ -0,0 +1,92 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * link_benchmark.cpp - Serial link throughput benchmark
+ *
+ * Start with 'M585 S1', stream G0/G1 lines from the host, then send 'M585 S0'.
+ * The lines go through get_serial_commands, the parser and the planner as in a
+ * print, but the blocks are released without being stepped. Reported:
+ *  - Lines and bytes per second, from the first line to the last
+ *  - Parse time per line, including moves parsed into the queue
+ *  - Time per move spent in G0/G1, i.e. kinematics and the planner
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(LINK_BENCHMARK)
+
+#include "link_benchmark.h"
+
+#include "../MarlinCore.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+
+LinkBenchmark link_benchmark;
+
+bool LinkBenchmark::active; // = false
+LinkBenchmark::stats_t LinkBenchmark::stats;
+
+static xyze_pos_t saved_position;
+#if ENABLED(PREVENT_COLD_EXTRUSION)
+  static bool saved_cold_extrude;
+#endif
+
+void LinkBenchmark::start() {
+  if (active) return;
+  planner.synchronize();
+  saved_position = current_position;
+  #if ENABLED(PREVENT_COLD_EXTRUSION)
+    saved_cold_extrude = thermalManager.allow_cold_extrude;
+    thermalManager.allow_cold_extrude = true;
+  #endif
+  stats = {};
+  active = true;
+  SERIAL_ECHO_MSG("Link benchmark started");
+}
+
+void LinkBenchmark::discard() {
+  while (planner.get_current_block()) planner.release_current_block();
+}
+
+void LinkBenchmark::stop() {
+  if (!active) return;
+  // Blocks still held back by the planner would go to the Stepper ISR
+  while (planner.has_blocks_queued()) idle();
+  active = false;
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = saved_cold_extrude);
+  current_position = saved_position;
+  sync_plan_position();
+}
+
+void LinkBenchmark::report() {
+  const millis_t ms = stats.last_ms - stats.first_ms;
+  const float s = ms ? ms * 0.001f : 1.0f;
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM("Link benchmark ", stats.lines, " lines ", stats.bytes, " bytes ", ms, " ms");
+  SERIAL_ECHOPGM(" lines/s:", uint32_t(stats.lines / s), " bytes/s:", uint32_t(stats.bytes / s));
+  SERIAL_ECHOPGM(" parse:", stats.lines ? stats.parse_us / stats.lines : 0UL, "us/line");
+  SERIAL_ECHOLNPGM(" move:", stats.moves ? stats.move_us / stats.moves : 0UL, "us/move");
+}
+
+#endif // LINK_BENCHMARK
@@ -0,0 +1,68 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * link_benchmark.h - Measure how fast G-code lines can arrive and be run
+ *
+ * While active, planned blocks are thrown away instead of being stepped, so a
+ * host can stream moves at full speed and nothing moves.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class LinkBenchmark {
+public:
+  static bool active;                     // Blocks are discarded, not stepped
+
+  static void start();
+  static void stop();                     // Drop the queued blocks and restore the position
+  static void report();
+
+  static void idle() { if (active) discard(); }
+
+  // Hooks for the queue and GcodeSuite
+  static void line(const uint8_t len) {
+    if (!active) return;
+    if (!stats.lines) stats.first_ms = millis();
+    stats.last_ms = millis();
+    stats.lines++;
+    stats.bytes += len + 1;               // The line and its terminator
+  }
+  static void parsed(const uint32_t start_us) { if (active) stats.parse_us += micros() - start_us; }
+  static void moved(const uint32_t start_us) {
+    if (!active) return;
+    stats.move_us += micros() - start_us;
+    stats.moves++;
+  }
+
+private:
+  static struct stats_t {
+    uint32_t lines, bytes, moves,
+             parse_us, move_us;
+    millis_t first_ms, last_ms;
+  } stats;
+
+  static void discard();                  // Release the blocks the Stepper ISR would have taken
+};
+
+extern LinkBenchmark link_benchmark;
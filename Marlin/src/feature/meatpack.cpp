@@ -43,6 +43,14 @@
 
 #include "meatpack.h"
 
+#if ENABLED(BINARY_MOTION)
+  #include "binary_motion.h"
+#endif
+
+#if ENABLED(MEATPACK_DICTIONARY)
+  #include "../libs/crc16.h"
+#endif
+
 #define MeatPack_ProtocolVersion "PV01"
 //#define MP_DEBUG
 
@@ -66,6 +74,7 @@ void MeatPack::reset_state() {
   cmd_is_next = false;
   second_char = 0;
   cmd_count = full_char_count = char_out_count = 0;
+  TERN_(MEATPACK_DICTIONARY, load_state = MPLoad_Idle);
   TERN_(MP_DEBUG, chars_decoded = 0);
 }
 
@@ -95,12 +104,79 @@ uint8_t MeatPack::unpack_chars(const uint8_t pk, uint8_t* __restrict const chars
   return out;
 }
 
+#if ENABLED(MEATPACK_DICTIONARY)
+
+  /**
+   * Output a literal character or the token for a dictionary code
+   */
+  void MeatPack::unpack_token(const uint8_t c) {
+    if (c < kFirstToken) return handle_output_char(c);
+    const uint8_t i = c - kFirstToken;
+    if (i < dict_count)
+      for (uint8_t j = dict_offset[i]; j < dict_offset[i + 1]; ++j)
+        handle_output_char(dict_pool[j]);
+  }
+
+  /**
+   * Take one byte of a dictionary upload.
+   * The dictionary is used once the whole upload passes the CRC check.
+   */
+  void MeatPack::load_dictionary(const uint8_t c, const serial_index_t serial_ind) {
+    if (load_state < MPLoad_CRC0) crc16(&load_crc, &c, 1);
+
+    bool bad = false;
+    switch (load_state) {
+      case MPLoad_Count:
+        bad = !WITHIN(c, 1, kMaxTokens);
+        dict_count = c;
+        load_index = load_pos = 0;
+        dict_offset[0] = 0;
+        load_state = MPLoad_Length;
+        break;
+
+      case MPLoad_Length:
+        bad = !WITHIN(c, 1, kTokenMax) || dict_offset[load_index] + c > MEATPACK_DICT_BYTES;
+        dict_offset[load_index + 1] = dict_offset[load_index] + c;
+        load_state = MPLoad_Chars;
+        break;
+
+      case MPLoad_Chars:
+        dict_pool[load_pos++] = c;
+        if (load_pos == dict_offset[load_index + 1])
+          load_state = ++load_index < dict_count ? MPLoad_Length : MPLoad_CRC0;
+        break;
+
+      case MPLoad_CRC0: load_pos = c; load_state = MPLoad_CRC1; return;
+
+      case MPLoad_CRC1:
+        bad = load_crc != (uint16_t(c) << 8 | load_pos);
+        if (!bad) SBI(state, MPConfig_Bit_Dictionary);
+        break;
+
+      default: return;
+    }
+
+    if (bad || load_state == MPLoad_CRC1) {
+      // The rest of a bad upload can't be followed, so it goes on to the G-code parser as noise
+      load_state = MPLoad_Idle;
+      if (bad) dict_count = 0;
+      PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));
+      if (bad) SERIAL_ECHOLNPGM("[MP] Bad dictionary");
+      report_state();
+    }
+  }
+
+#endif // MEATPACK_DICTIONARY
+
 /**
  * Interpret a single (non-command) character
  * according to the current MeatPack state.
  */
 void MeatPack::handle_rx_char_inner(const uint8_t c) {
   if (TEST(state, MPConfig_Bit_Active)) {                   // Is MeatPack active?
+    #if ENABLED(MEATPACK_DICTIONARY)
+      if (TEST(state, MPConfig_Bit_Dictionary)) return unpack_token(c);
+    #endif
     if (!full_char_count) {                                 // No literal characters to fetch?
       uint8_t buf[2] = { 0, 0 };
       const uint8_t res = unpack_chars(c, buf);             // Decode the byte into one or two characters.
@@ -161,6 +237,15 @@ void MeatPack::handle_command(const MeatPack_Command c) {
     case MPCommand_DisableNoSpaces:
       CBI(state, MPConfig_Bit_NoSpaces);
       meatPackLookupTable[kSpaceCharIdx] = ' ';                        DEBUG_ECHOLNPGM("[MPDBG] DIS NSP");   break;
+    #if ENABLED(MEATPACK_DICTIONARY)
+      case MPCommand_LoadDictionary:
+        CBI(state, MPConfig_Bit_Dictionary);
+        load_state = MPLoad_Count;
+        load_crc = 0xFFFF;                                             DEBUG_ECHOLNPGM("[MPDBG] DICT LOAD"); return;
+      case MPCommand_ClearDictionary:
+        CBI(state, MPConfig_Bit_Dictionary);
+        dict_count = 0;                                                DEBUG_ECHOLNPGM("[MPDBG] DICT CLR");  break;
+    #endif
     default:                                                           DEBUG_ECHOLNPGM("[MPDBG] UNK CMD REC");
   }
   report_state();
@@ -171,7 +256,12 @@ void MeatPack::report_state() {
   // should not contain the "PV' substring, as this is used to indicate protocol version
   SERIAL_ECHOPGM("[MP] " MeatPack_ProtocolVersion " ");
   serialprint_onoff(TEST(state, MPConfig_Bit_Active));
-  SERIAL_ECHOF(TEST(state, MPConfig_Bit_NoSpaces) ? F(" NSP\n") : F(" ESP\n"));
+  #if ENABLED(MEATPACK_DICTIONARY)
+    SERIAL_ECHOF(TEST(state, MPConfig_Bit_NoSpaces) ? F(" NSP") : F(" ESP"));
+    SERIAL_ECHOLNPGM(" DICT:", TEST(state, MPConfig_Bit_Dictionary) ? dict_count : 0);
+  #else
+    SERIAL_ECHOF(TEST(state, MPConfig_Bit_NoSpaces) ? F(" NSP\n") : F(" ESP\n"));
+  #endif
 }
 
 /**
@@ -179,6 +269,14 @@ void MeatPack::report_state() {
  * according to the current meatpack state.
  */
 void MeatPack::handle_rx_char(const uint8_t c, const serial_index_t serial_ind) {
+  #if ENABLED(BINARY_MOTION)
+    if (binary_motion.active) return handle_output_char(c); // Binary frames may contain 0xFF 0xFF
+  #endif
+
+  #if ENABLED(MEATPACK_DICTIONARY)
+    if (load_state) return load_dictionary(c, serial_ind);
+  #endif
+
   if (c == kCommandByte) {                // A command (0xFF) byte?
     if (cmd_count) {                      // In fact, two in a row?
       cmd_is_next = true;                 // Then a MeatPack command follows
@@ -70,14 +70,31 @@ enum MeatPack_Command : uint8_t {
   MPCommand_ResetAll        = 0xF9,
   MPCommand_QueryConfig     = 0xF8,
   MPCommand_EnableNoSpaces  = 0xF7,
-  MPCommand_DisableNoSpaces = 0xF6
+  MPCommand_DisableNoSpaces = 0xF6,
+  MPCommand_LoadDictionary  = 0xF5,
+  MPCommand_ClearDictionary = 0xF4
 };
 
 enum MeatPack_ConfigStateBits : uint8_t {
-  MPConfig_Bit_Active   = 0,
-  MPConfig_Bit_NoSpaces = 1
+  MPConfig_Bit_Active     = 0,
+  MPConfig_Bit_NoSpaces   = 1,
+  MPConfig_Bit_Dictionary = 2
 };
 
+#if ENABLED(MEATPACK_DICTIONARY)
+  /**
+   * Dictionary packing (MeatPack v2)
+   *
+   * The host uploads up to 64 tokens of 1 to 8 characters, e.g., "G1 X", " E", "\n".
+   * With packing active each stream byte is then either a literal character
+   * (0x00-0x7F) or a token code (0x80-0xBF). Codes 0xC0-0xFE are reserved.
+   *
+   * Upload: 0xFF 0xFF MPCommand_LoadDictionary, count, { length, chars... } * count,
+   *         then the CRC-16/CCITT (seed 0xFFFF) of count through the last char, low byte first.
+   */
+  enum MeatPack_LoadState : uint8_t { MPLoad_Idle, MPLoad_Count, MPLoad_Length, MPLoad_Chars, MPLoad_CRC0, MPLoad_CRC1 };
+#endif
+
 class MeatPack {
 
   // Utility definitions
@@ -96,7 +113,25 @@ class MeatPack {
   uint8_t cmd_count,       // Counter of command bytes received (need 2)
           full_char_count, // Counter for full-width characters to be received
           char_out_count;  // Stores number of characters to be read out.
-  uint8_t char_out_buf[2]; // Output buffer for caching up to 2 characters
+  #if ENABLED(MEATPACK_DICTIONARY)
+    static const uint8_t kFirstToken = 0x80,
+                         kMaxTokens  = 64,
+                         kTokenMax   = 8;
+
+    MeatPack_LoadState load_state;
+    uint8_t dict_count,                  // Number of tokens in the dictionary
+            load_index,                  // Token being uploaded
+            load_pos;                    // Next pool byte being uploaded, then the CRC low byte
+    uint16_t load_crc;
+    uint8_t dict_offset[kMaxTokens + 1]; // Token i is dict_pool[dict_offset[i] ... dict_offset[i + 1] - 1]
+    char dict_pool[MEATPACK_DICT_BYTES];
+  #endif
+
+public:
+  static const uint8_t kOutputMax = TERN(MEATPACK_DICTIONARY, kTokenMax, 2);
+
+private:
+  uint8_t char_out_buf[kOutputMax]; // Output buffer for caching up to 2 characters, or a whole token
 
 public:
   // Pass in a character rx'd by SD card or serial. Automatically parses command/ctrl sequences,
@@ -105,9 +140,9 @@ public:
 
   /**
    * After passing in rx'd char using above method, call this to get characters out.
-   * Can return from 0 to 2 characters at once.
+   * Can return from 0 to kOutputMax characters at once.
    * @param out [in] Output pointer for unpacked/processed data.
-   * @return Number of characters returned. Range from 0 to 2.
+   * @return Number of characters returned. Range from 0 to kOutputMax.
    */
   uint8_t get_result_char(char * const __restrict out);
 
@@ -117,8 +152,13 @@ public:
   void handle_command(const MeatPack_Command c);
   void handle_output_char(const uint8_t c);
   void handle_rx_char_inner(const uint8_t c);
+  #if ENABLED(MEATPACK_DICTIONARY)
+    void unpack_token(const uint8_t c);
+    void load_dictionary(const uint8_t c, const serial_index_t serial_ind);
+  #endif
 
-  MeatPack() : cmd_is_next(false), state(0), second_char(0), cmd_count(0), full_char_count(0), char_out_count(0) {}
+  MeatPack() : cmd_is_next(false), state(0), second_char(0), cmd_count(0), full_char_count(0), char_out_count(0)
+    OPTARG(MEATPACK_DICTIONARY, load_state(MPLoad_Idle), dict_count(0)) {}
 };
 
 // Implement the MeatPack serial class so it's transparent to rest of the code
@@ -129,11 +169,16 @@ struct MeatpackSerial : public SerialBase <MeatpackSerial < SerialT >> {
   SerialT & out;
   MeatPack meatpack;
 
-  char serialBuffer[2];
+  char serialBuffer[MeatPack::kOutputMax];
   uint8_t charCount;
   uint8_t readIndex;
 
   NO_INLINE void write(uint8_t c)     { out.write(c); }
+  bool writeBlock(const uint8_t *buffer, size_t size) {
+    if (!CALL_IF_EXISTS(bool, &out, writeBlock, buffer, size))
+      while (size--) out.write(*buffer++);
+    return true;
+  }
   void flush()                        { out.flush();  }
   void begin(long br)                 { out.begin(br); readIndex = 0; }
   void end()                          { out.end(); }
@@ -42,6 +42,10 @@ int_fast8_t   Mixer::runner = 0;
 mixer_comp_t  Mixer::s_color[MIXING_STEPPERS];
 mixer_accu_t  Mixer::accu[MIXING_STEPPERS] = { 0 };
 
+#ifdef MIXER_STEP_PATTERN
+  uint8_t Mixer::pattern[MIXER_STEP_PATTERN], Mixer::pattern_index;
+#endif
+
 #if ANY(HAS_DUAL_MIXING, GRADIENT_MIX)
   mixer_perc_t Mixer::mix[MIXING_STEPPERS];
 #endif
@@ -125,6 +129,47 @@ void Mixer::reset_vtools() {
   #endif
 }
 
+#ifdef MIXER_STEP_PATTERN
+
+  /**
+   * Fill the E step table for s_color, called by the Stepper when a block
+   * brings a new mix. Each stepper gets its share of the table, rounded by
+   * largest remainder, and smooth weighted round-robin spreads those steps
+   * as evenly as the accumulators would.
+   */
+  void Mixer::build_pattern() {
+    uint32_t sum = 0;
+    MIXER_STEPPER_LOOP(i) sum += s_color[i];
+    if (!sum) { ZERO(pattern); return; }
+
+    uint8_t share[MIXING_STEPPERS], rem[MIXING_STEPPERS], given = 0;
+    MIXER_STEPPER_LOOP(i) {
+      const uint32_t n = uint32_t(s_color[i]) * (MIXER_STEP_PATTERN);
+      share[i] = n / sum;
+      rem[i] = (n % sum) * 255 / sum;
+      given += share[i];
+    }
+    while (given < (MIXER_STEP_PATTERN)) {
+      uint_fast8_t best = 0;
+      MIXER_STEPPER_LOOP(i) if (rem[i] > rem[best]) best = i;
+      share[best]++; rem[best] = 0; given++;
+    }
+
+    int16_t credit[MIXING_STEPPERS] = { 0 };
+    for (uint8_t k = 0; k < (MIXER_STEP_PATTERN); ++k) {
+      uint_fast8_t best = 0;
+      MIXER_STEPPER_LOOP(i) {
+        credit[i] += share[i];
+        if (credit[i] > credit[best]) best = i;
+      }
+      credit[best] -= MIXER_STEP_PATTERN;
+      pattern[k] = best;
+    }
+    pattern_index = 0;
+  }
+
+#endif
+
 // called at boot
 void Mixer::init() {
 
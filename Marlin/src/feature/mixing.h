@@ -119,7 +119,14 @@ class Mixer {
   }
 
   FORCE_INLINE static void stepper_setup(mixer_comp_t (&b_color)[MIXING_STEPPERS]) {
-    MIXER_STEPPER_LOOP(i) s_color[i] = b_color[i];
+    #ifdef MIXER_STEP_PATTERN
+      // Most blocks keep the mix of the one before, so only rebuild on a change
+      bool same = true;
+      MIXER_STEPPER_LOOP(i) if (s_color[i] != b_color[i]) { s_color[i] = b_color[i]; same = false; }
+      if (!same) build_pattern();
+    #else
+      MIXER_STEPPER_LOOP(i) s_color[i] = b_color[i];
+    #endif
   }
 
   #if ANY(HAS_DUAL_MIXING, GRADIENT_MIX)
@@ -230,6 +237,11 @@ class Mixer {
   // Used in Stepper
   FORCE_INLINE static uint8_t get_stepper() { return runner; }
   FORCE_INLINE static uint8_t get_next_stepper() {
+    #ifdef MIXER_STEP_PATTERN
+      runner = pattern[pattern_index];
+      if (++pattern_index >= MIXER_STEP_PATTERN) pattern_index = 0;
+      return runner;
+    #endif
     for (;;) {
       if (--runner < 0) runner = MIXING_STEPPERS - 1;
       accu[runner] += s_color[runner];
@@ -250,6 +262,11 @@ class Mixer {
   static int_fast8_t  runner;
   static mixer_comp_t s_color[MIXING_STEPPERS];
   static mixer_accu_t accu[MIXING_STEPPERS];
+
+  #ifdef MIXER_STEP_PATTERN
+    static uint8_t pattern[MIXER_STEP_PATTERN], pattern_index;
+    static void build_pattern();
+  #endif
 };
 
 extern Mixer mixer;
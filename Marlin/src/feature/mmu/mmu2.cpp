@@ -1051,11 +1051,12 @@ void MMU2::execute_extruder_sequence(const E_Step * sequence, int steps) {
 
     current_position.e += es;
     line_to_current_position(MMM_TO_MMS(fr_mm_m));
-    planner.synchronize();
+    if (DISABLED(MMU2_SEQUENCE_LOOKAHEAD)) planner.synchronize();
 
     step++;
   }
 
+  TERN_(MMU2_SEQUENCE_LOOKAHEAD, planner.synchronize());
   stepper.disable_extruder();
 }
 
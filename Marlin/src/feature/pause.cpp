@@ -102,6 +102,16 @@ fil_change_settings_t fc_settings[EXTRUDERS];
   #define _PMSG(L) L##_LCD
 #endif
 
+/**
+ * Queue an E move without waiting for it, so moves that follow
+ * one another run without a stop in between.
+ */
+static void buffer_e_move(const_float_t length, const_feedRate_t fr_mm_s) {
+  TERN_(HAS_FILAMENT_SENSOR, runout.reset());
+  current_position.e += length / planner.e_factor[active_extruder];
+  line_to_current_position(fr_mm_s);
+}
+
 #if HAS_SOUND
   static void impatient_beep(const int8_t max_beep_count, const bool restart=false) {
 
@@ -236,22 +246,25 @@ bool load_filament(const_float_t slow_load_length/*=0*/, const_float_t fast_load
   TERN_(BELTPRINTER, do_blocking_move_to_xy(0.00, 50.00));
 
   // Slow Load filament
-  if (slow_load_length) unscaled_e_move(slow_load_length, FILAMENT_CHANGE_SLOW_LOAD_FEEDRATE);
+  if (slow_load_length) buffer_e_move(slow_load_length, FILAMENT_CHANGE_SLOW_LOAD_FEEDRATE);
 
-  // Fast Load Filament
+  // Fast Load Filament, right after the slow load
   if (fast_load_length) {
     #if FILAMENT_CHANGE_FAST_LOAD_ACCEL > 0
       const float saved_acceleration = planner.settings.retract_acceleration;
       planner.settings.retract_acceleration = FILAMENT_CHANGE_FAST_LOAD_ACCEL;
     #endif
 
-    unscaled_e_move(fast_load_length, FILAMENT_CHANGE_FAST_LOAD_FEEDRATE);
+    buffer_e_move(fast_load_length, FILAMENT_CHANGE_FAST_LOAD_FEEDRATE);
 
+    // The block has its acceleration, so restore it without waiting
     #if FILAMENT_CHANGE_FAST_LOAD_ACCEL > 0
       planner.settings.retract_acceleration = saved_acceleration;
     #endif
   }
 
+  planner.synchronize();
+
   #if ENABLED(DUAL_X_CARRIAGE)      // Tie the two extruders movement back together.
     set_duplication_enabled(saved_ext_dup_mode, saved_ext);
   #endif
@@ -357,21 +370,23 @@ bool unload_filament(const_float_t unload_length, const bool show_lcd/*=false*/,
   safe_delay(FILAMENT_UNLOAD_PURGE_DELAY);
 
   // Quickly purge
-  unscaled_e_move((FILAMENT_UNLOAD_PURGE_RETRACT + FILAMENT_UNLOAD_PURGE_LENGTH) * mix_multiplier,
-                  (FILAMENT_UNLOAD_PURGE_FEEDRATE) * mix_multiplier);
+  buffer_e_move((FILAMENT_UNLOAD_PURGE_RETRACT + FILAMENT_UNLOAD_PURGE_LENGTH) * mix_multiplier,
+                (FILAMENT_UNLOAD_PURGE_FEEDRATE) * mix_multiplier);
 
-  // Unload filament
+  // Unload filament, right after the purge
   #if FILAMENT_CHANGE_UNLOAD_ACCEL > 0
     const float saved_acceleration = planner.settings.retract_acceleration;
     planner.settings.retract_acceleration = FILAMENT_CHANGE_UNLOAD_ACCEL;
   #endif
 
-  unscaled_e_move(unload_length * mix_multiplier, (FILAMENT_CHANGE_UNLOAD_FEEDRATE) * mix_multiplier);
+  buffer_e_move(unload_length * mix_multiplier, (FILAMENT_CHANGE_UNLOAD_FEEDRATE) * mix_multiplier);
 
   #if FILAMENT_CHANGE_FAST_LOAD_ACCEL > 0
     planner.settings.retract_acceleration = saved_acceleration;
   #endif
 
+  planner.synchronize();
+
   // Disable the Extruder for manual change
   disable_active_extruder();
 
@@ -605,6 +620,8 @@ void wait_for_confirmation(const bool is_reload/*=false*/, const int8_t max_beep
  * - Send host action for resume, if configured
  * - Resume the current SD print job, if any
  */
+static void finish_resume_print(const celsius_t targetTemp);
+
 void resume_print(const_float_t slow_load_length/*=0*/, const_float_t fast_load_length/*=0*/, const_float_t purge_length/*=ADVANCED_PAUSE_PURGE_LENGTH*/, const int8_t max_beep_count/*=0*/, const celsius_t targetTemp/*=0*/ DXC_ARGS) {
   DEBUG_SECTION(rp, "resume_print", true);
   DEBUG_ECHOLNPGM("... slowlen:", slow_load_length, " fastlen:", fast_load_length, " purgelen:", purge_length, " maxbeep:", max_beep_count, " targetTemp:", targetTemp DXC_SAY);
@@ -634,6 +651,13 @@ void resume_print(const_float_t slow_load_length/*=0*/, const_float_t fast_load_
   // Load the new filament
   load_filament(slow_load_length, fast_load_length, purge_length, max_beep_count, true, nozzle_timed_out, PAUSE_MODE_SAME DXC_PASS);
 
+  finish_resume_print(targetTemp);
+}
+
+/**
+ * The part of resume_print after the new filament is loaded
+ */
+static void finish_resume_print(const celsius_t targetTemp) {
   if (targetTemp > 0) {
     thermalManager.setTargetHotend(targetTemp, active_extruder);
     thermalManager.wait_for_hotend(active_extruder, false);
@@ -719,4 +743,234 @@ void resume_print(const_float_t slow_load_length/*=0*/, const_float_t fast_load_
   ui.return_to_status();
 }
 
+
+#if ENABLED(ADVANCED_PAUSE_NONBLOCKING)
+
+FilamentChange filament_change;
+
+FilamentChange::ChangeState FilamentChange::state; // = CHANGE_IDLE
+float FilamentChange::slow_load, FilamentChange::fast_load, FilamentChange::purge_length, FilamentChange::purge_left;
+int8_t FilamentChange::beeps;
+celsius_t FilamentChange::target;
+
+/**
+ * Begin waiting for the user after M600 has parked and unloaded.
+ * The same prompts as wait_for_confirmation(true).
+ */
+void FilamentChange::start(const_float_t slow_load_length, const_float_t fast_load_length, const_float_t purge,
+                           const int8_t max_beep_count, const celsius_t targetTemp
+) {
+  slow_load = slow_load_length;
+  fast_load = fast_load_length;
+  purge_length = purge;
+  beeps = max_beep_count;
+  target = targetTemp;
+
+  show_continue_prompt(true);
+  first_impatient_beep(beeps);
+
+  const millis_t nozzle_timeout = SEC_TO_MS(PAUSE_PARK_NOZZLE_TIMEOUT);
+  HOTEND_LOOP() thermalManager.heater_idle[e].start(nozzle_timeout);
+
+  TERN_(HOST_PROMPT_SUPPORT, hostui.continue_prompt(GET_TEXT_F(MSG_NOZZLE_PARKED)));
+  TERN_(EXTENSIBLE_UI, ExtUI::onUserConfirmRequired(GET_TEXT_F(MSG_NOZZLE_PARKED)));
+  wait_for_user = true;    // LCD click or M108 will clear this
+  state = CHANGE_WAIT_USER;
+}
+
+// As ensure_safe_temperature(false), with the waiting done by heated()
+void FilamentChange::begin_heating() {
+  #if ENABLED(PREVENT_COLD_EXTRUSION)
+    if (!DEBUGGING(DRYRUN) && thermalManager.targetTooColdToExtrude(active_extruder))
+      thermalManager.setTargetHotend(thermalManager.extrude_min_temp, active_extruder);
+  #endif
+  ui.pause_show_message(PAUSE_MESSAGE_HEATING);
+  wait_for_heatup = TERN1(PREVENT_COLD_EXTRUSION, !thermalManager.allow_cold_extrude);
+}
+
+bool FilamentChange::heated() {
+  if (wait_for_heatup && ABS(thermalManager.wholeDegHotend(active_extruder) - thermalManager.degTargetHotend(active_extruder)) > (TEMP_WINDOW))
+    return false;
+  wait_for_heatup = false;
+  return true;
+}
+
+// Purge as load_filament does, queueing the moves
+void FilamentChange::begin_purge() {
+  #if ENABLED(ADVANCED_PAUSE_CONTINUOUS_PURGE)
+    ui.pause_show_message(PAUSE_MESSAGE_PURGE);
+    TERN_(EXTENSIBLE_UI, ExtUI::onUserConfirmRequired(GET_TEXT_F(MSG_FILAMENT_CHANGE_PURGE)));
+    TERN_(HOST_PROMPT_SUPPORT, hostui.continue_prompt(GET_TEXT_F(MSG_FILAMENT_CHANGE_PURGE)));
+    wait_for_user = true; // A click or M108 stops the purge
+    purge_left = purge_length;
+  #else
+    if (purge_length > 0) {
+      ui.pause_show_message(PAUSE_MESSAGE_PURGE);
+      buffer_e_move(purge_length, ADVANCED_PAUSE_PURGE_FEEDRATE);
+    }
+  #endif
+  state = CHANGE_PURGE;
+}
+
+/**
+ * Advance the filament change, called from the main loop so
+ * moves are never started from within another command.
+ */
+void FilamentChange::task() {
+  if (state == CHANGE_IDLE) return;
+
+  // An aborted print ends the change where it is
+  if (!did_pause_print) {
+    wait_for_user = wait_for_heatup = false;
+    TERN_(HOST_KEEPALIVE_FEATURE, gcode.busy_state = GcodeSuite::NOT_BUSY);
+    state = CHANGE_IDLE;
+    return;
+  }
+
+  // Parked steppers stay on, as with idle_no_sleep()
+  gcode.reset_stepper_timeout();
+
+  #if ENABLED(HOST_KEEPALIVE_FEATURE)
+    gcode.busy_state = WITHIN(state, CHANGE_HEAT_LOAD, CHANGE_PURGE) ? GcodeSuite::IN_PROCESS : GcodeSuite::PAUSED_FOR_USER;
+  #endif
+
+  switch (state) {
+    default: break;
+
+    case CHANGE_WAIT_USER:
+      if (wait_for_user) {
+        impatient_beep(beeps);
+
+        bool nozzle_timed_out = false;
+        HOTEND_LOOP() nozzle_timed_out |= thermalManager.heater_idle[e].timed_out;
+        if (!nozzle_timed_out) break;
+
+        ui.pause_show_message(PAUSE_MESSAGE_HEAT);
+        SERIAL_ECHO_MSG(_PMSG(STR_FILAMENT_CHANGE_HEAT));
+        TERN_(HOST_PROMPT_SUPPORT, hostui.prompt_do(PROMPT_USER_CONTINUE, GET_TEXT_F(MSG_HEATER_TIMEOUT), GET_TEXT_F(MSG_REHEAT)));
+        TERN_(EXTENSIBLE_UI, ExtUI::onUserConfirmRequired(GET_TEXT_F(MSG_HEATER_TIMEOUT)));
+        wait_for_user = ENABLED(HAS_RESUME_CONTINUE); // Wait for LCD click or M108
+        state = CHANGE_HEATER_TIMEOUT;
+        break;
+      }
+
+      // Confirmed. Re-enable the heaters, as resume_print does.
+      HOTEND_LOOP() thermalManager.reset_hotend_idle_timer(e);
+      if (target > thermalManager.degTargetHotend(active_extruder))
+        thermalManager.setTargetHotend(target, active_extruder);
+      begin_heating();
+      state = CHANGE_HEAT_LOAD;
+      break;
+
+    case CHANGE_HEATER_TIMEOUT:
+      if (wait_for_user) break;
+      TERN_(HOST_PROMPT_SUPPORT, hostui.prompt_do(PROMPT_INFO, GET_TEXT_F(MSG_REHEATING)));
+      LCD_MESSAGE(MSG_REHEATING);
+      HOTEND_LOOP() thermalManager.reset_hotend_idle_timer(e);
+      begin_heating();
+      state = CHANGE_REHEAT;
+      break;
+
+    case CHANGE_REHEAT: {
+      if (!heated()) break;
+
+      // Show the prompt to continue and restart the idle timers
+      show_continue_prompt(true);
+      const millis_t nozzle_timeout = SEC_TO_MS(PAUSE_PARK_NOZZLE_TIMEOUT);
+      HOTEND_LOOP() thermalManager.heater_idle[e].start(nozzle_timeout);
+
+      TERN_(HOST_PROMPT_SUPPORT, hostui.continue_prompt(GET_TEXT_F(MSG_REHEATDONE)));
+      #if ENABLED(EXTENSIBLE_UI)
+        ExtUI::onUserConfirmRequired(GET_TEXT_F(MSG_REHEATDONE));
+      #else
+        LCD_MESSAGE(MSG_REHEATDONE);
+      #endif
+
+      IF_DISABLED(PAUSE_REHEAT_FAST_RESUME, wait_for_user = true);
+      first_impatient_beep(beeps);
+      state = CHANGE_WAIT_USER;
+    } break;
+
+    case CHANGE_HEAT_LOAD:
+      if (!heated()) break;
+
+      #if ENABLED(PREVENT_COLD_EXTRUSION)
+        // A user can cancel wait-for-heating with M108
+        if (!DEBUGGING(DRYRUN) && thermalManager.targetTooColdToExtrude(active_extruder)) {
+          SERIAL_ECHO_MSG(STR_ERR_HOTEND_TOO_COLD);
+          ui.pause_show_message(PAUSE_MESSAGE_STATUS);
+          state = CHANGE_RESUME;
+          break;
+        }
+      #endif
+
+      ui.pause_show_message(PAUSE_MESSAGE_LOAD);
+      if (slow_load) buffer_e_move(slow_load, FILAMENT_CHANGE_SLOW_LOAD_FEEDRATE);
+      if (fast_load) {
+        #if FILAMENT_CHANGE_FAST_LOAD_ACCEL > 0
+          const float saved_acceleration = planner.settings.retract_acceleration;
+          planner.settings.retract_acceleration = FILAMENT_CHANGE_FAST_LOAD_ACCEL;
+        #endif
+        buffer_e_move(fast_load, FILAMENT_CHANGE_FAST_LOAD_FEEDRATE);
+        #if FILAMENT_CHANGE_FAST_LOAD_ACCEL > 0
+          planner.settings.retract_acceleration = saved_acceleration;
+        #endif
+      }
+      state = CHANGE_LOAD;
+      break;
+
+    case CHANGE_LOAD:
+      if (!planner.has_blocks_queued()) begin_purge();
+      break;
+
+    case CHANGE_PURGE:
+      #if ENABLED(ADVANCED_PAUSE_CONTINUOUS_PURGE)
+        // Keep a couple of 1mm moves queued so a click stops the purge quickly
+        while (purge_left > 0 && wait_for_user && planner.movesplanned() < 2) {
+          buffer_e_move(1, ADVANCED_PAUSE_PURGE_FEEDRATE);
+          --purge_left;
+        }
+        if ((purge_left > 0 && wait_for_user) || planner.has_blocks_queued()) break;
+        wait_for_user = false;
+      #else
+        if (planner.has_blocks_queued()) break;
+
+        TERN_(HOST_PROMPT_SUPPORT, hostui.filament_load_prompt()); // Initiate another host prompt.
+
+        #if M600_PURGE_MORE_RESUMABLE
+          // Show "Purge More" / "Resume" menu and wait for reply
+          wait_for_user = false;
+          #if ANY(HAS_MARLINUI_MENU, DWIN_LCD_PROUI)
+            ui.pause_show_message(PAUSE_MESSAGE_OPTION); // Also sets PAUSE_RESPONSE_WAIT_FOR
+          #else
+            pause_menu_response = PAUSE_RESPONSE_WAIT_FOR;
+          #endif
+          state = CHANGE_PURGE_MORE;
+          break;
+        #endif
+      #endif
+      TERN_(HOST_PROMPT_SUPPORT, hostui.prompt_end());
+      state = CHANGE_RESUME;
+      break;
+
+    #if M600_PURGE_MORE_RESUMABLE && DISABLED(ADVANCED_PAUSE_CONTINUOUS_PURGE)
+      case CHANGE_PURGE_MORE:
+        if (pause_menu_response == PAUSE_RESPONSE_WAIT_FOR) break;
+        if (pause_menu_response == PAUSE_RESPONSE_EXTRUDE_MORE) { begin_purge(); break; }
+        TERN_(HOST_PROMPT_SUPPORT, hostui.prompt_end());
+        state = CHANGE_RESUME;
+        break;
+    #endif
+
+    case CHANGE_RESUME:
+      // Return to the print and let the queue go on
+      finish_resume_print(target);
+      TERN_(HOST_KEEPALIVE_FEATURE, gcode.busy_state = GcodeSuite::NOT_BUSY);
+      state = CHANGE_IDLE;
+      break;
+  }
+}
+
+#endif // ADVANCED_PAUSE_NONBLOCKING
+
 #endif // ADVANCED_PAUSE_FEATURE
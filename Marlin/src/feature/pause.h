@@ -122,6 +122,46 @@ bool unload_filament(
   #endif
 );
 
+#if ENABLED(ADVANCED_PAUSE_NONBLOCKING)
+
+  /**
+   * The wait, reload, and purge of M600 as a state machine run from the main
+   * loop. M600 parks and unloads, then returns. Further commands stay in the
+   * queue until the print resumes, while heaters, displays, and serial go on.
+   */
+  class FilamentChange {
+  public:
+    static void start(const_float_t slow_load_length, const_float_t fast_load_length, const_float_t purge_length,
+                      const int8_t max_beep_count, const celsius_t targetTemp);
+    static bool active() { return state != CHANGE_IDLE; }
+    static void task();
+
+  private:
+    enum ChangeState : uint8_t {
+      CHANGE_IDLE,
+      CHANGE_WAIT_USER,       // Insert filament and confirm
+      CHANGE_HEATER_TIMEOUT,  // Heaters timed out. Confirm to reheat.
+      CHANGE_REHEAT,          // Reheating, then back to CHANGE_WAIT_USER
+      CHANGE_HEAT_LOAD,       // Heating to load
+      CHANGE_LOAD,            // Load moves are running
+      CHANGE_PURGE,           // Purge moves are running
+      CHANGE_PURGE_MORE,      // Purge more or resume?
+      CHANGE_RESUME
+    };
+    static ChangeState state;
+    static float slow_load, fast_load, purge_length, purge_left;
+    static int8_t beeps;
+    static celsius_t target;
+
+    static void begin_heating();
+    static bool heated();
+    static void begin_purge();
+  };
+
+  extern FilamentChange filament_change;
+
+#endif
+
 #else // !ADVANCED_PAUSE_FEATURE
 
   constexpr uint8_t did_pause_print = 0;
@@ -42,6 +42,12 @@ uint8_t PowerMonitor::flags; // = 0
   pm_lpf_t<PowerMonitor::volts_adc_scale, PM_K_VALUE, PM_K_SCALE> PowerMonitor::volts;
 #endif
 
+#if ENABLED(POWER_MONITOR_ENERGY)
+  uint32_t PowerMonitor::energy_j;
+  float PowerMonitor::energy_frac;
+  millis_t PowerMonitor::energy_ms;
+#endif
+
 millis_t PowerMonitor::display_item_ms;
 uint8_t PowerMonitor::display_item;
 
@@ -84,6 +84,27 @@ public:
     FORCE_INLINE static float getPower() { return getAmps() * getVolts(); }
   #endif
 
+  #if ENABLED(POWER_MONITOR_ENERGY)
+    static uint32_t energy_j;    // Whole joules since the last reset
+    static float energy_frac;    // Joules not yet carried into energy_j
+    static millis_t energy_ms;   // Time of the last capture
+
+    FORCE_INLINE static float getWattHours() { return (energy_j + energy_frac) * (1.0f / 3600.0f); }
+    static void reset_energy() { energy_j = 0; energy_frac = 0; energy_ms = millis(); }
+
+    // Add the power since the last capture. Called with each new reading.
+    static void integrate_energy() {
+      const millis_t ms = millis();
+      energy_frac += getPower() * (ms - energy_ms) * 0.001f;
+      energy_ms = ms;
+      if (energy_frac >= 1.0f) {
+        const uint32_t j = uint32_t(energy_frac);
+        energy_j += j;
+        energy_frac -= j;
+      }
+    }
+  #endif
+
   #if HAS_WIRED_LCD
     #if HAS_MARLINUI_U8GLIB && DISABLED(LIGHTWEIGHT_UI)
       FORCE_INLINE static bool display_enabled() { return flags != 0x00; }
@@ -119,6 +140,8 @@ public:
       volts.reset();
     #endif
 
+    TERN_(POWER_MONITOR_ENERGY, reset_energy());
+
     #if HAS_MEDIA
       display_item_ms = 0;
       display_item = 0;
@@ -132,6 +155,7 @@ public:
     #if ENABLED(POWER_MONITOR_VOLTAGE)
       volts.capture();
     #endif
+    TERN_(POWER_MONITOR_ENERGY, integrate_energy());
   }
 };
 
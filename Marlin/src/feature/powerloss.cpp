@@ -62,11 +62,37 @@ uint32_t PrintJobRecovery::cmd_sdpos, // = 0
   #include "fwretract.h"
 #endif
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+  #include "../libs/crc16.h"
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_POWER_LOSS_RECOVERY)
 #include "../core/debug_out.h"
 
 PrintJobRecovery recovery;
 
+#if ENABLED(POWER_LOSS_JOURNAL)
+
+  // One journal record per 512-byte block
+  typedef struct {
+    uint32_t sequence;          // Newest is highest. Zero for a cleared block.
+    job_recovery_info_t info;
+    uint16_t crc;               // CRC16 of the fields above
+  } plr_record_t;
+
+  static_assert(sizeof(plr_record_t) <= 512, "job_recovery_info_t is too large for POWER_LOSS_JOURNAL.");
+
+  uint32_t PrintJobRecovery::journal_block, PrintJobRecovery::journal_sequence;
+  uint8_t PrintJobRecovery::journal_slot;
+
+  static uint16_t record_crc(const plr_record_t &rec) {
+    uint16_t crc = 0;
+    crc16(&crc, &rec, offsetof(plr_record_t, crc));
+    return crc;
+  }
+
+#endif
+
 #if DISABLED(BACKUP_POWER_SUPPLY)
   #undef POWER_LOSS_RETRACT_LEN   // No retract at outage without backup power
 #endif
@@ -88,7 +114,10 @@ PrintJobRecovery recovery;
 /**
  * Clear the recovery info
  */
-void PrintJobRecovery::init() { memset(&info, 0, sizeof(info)); }
+void PrintJobRecovery::init() {
+  memset(&info, 0, sizeof(info));
+  TERN_(POWER_LOSS_JOURNAL, journal_block = 0); // The file may be removed or replaced
+}
 
 /**
  * Enable or disable then call changed()
@@ -134,6 +163,7 @@ bool PrintJobRecovery::check() {
  * Delete the recovery file and clear the recovery data
  */
 void PrintJobRecovery::purge() {
+  TERN_(SD_QUIET_WRITES, card.cancel_write(write));
   init();
   card.removeJobRecoveryFile();
 }
@@ -143,9 +173,25 @@ void PrintJobRecovery::purge() {
  */
 void PrintJobRecovery::load() {
   if (exists()) {
-    open(true);
-    (void)file.read(&info, sizeof(info));
-    close();
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      // Take the newest record with a good CRC. Continue the ring after it.
+      memset(&info, 0, sizeof(info));
+      journal_sequence = journal_slot = 0;
+      journal_block = card.openJournal(POWER_LOSS_JOURNAL_SLOTS);
+      if (journal_block) for (uint8_t s = 0; s < POWER_LOSS_JOURNAL_SLOTS; ++s) {
+        const plr_record_t * const rec = (plr_record_t*)card.rawRead(journal_block + s);
+        if (!rec) break;
+        if (rec->sequence > journal_sequence && rec->crc == record_crc(*rec)) {
+          journal_sequence = rec->sequence;
+          journal_slot = (s + 1) % (POWER_LOSS_JOURNAL_SLOTS);
+          info = rec->info;
+        }
+      }
+    #else
+      open(true);
+      (void)file.read(&info, sizeof(info));
+      close();
+    #endif
   }
   debug(F("Load"));
 }
@@ -156,6 +202,15 @@ void PrintJobRecovery::load() {
 void PrintJobRecovery::prepare() {
   card.getAbsFilenameInCWD(info.sd_filename);  // SD filename
   cmd_sdpos = 0;
+  #if ENABLED(POWER_LOSS_JOURNAL)
+    #if PIN_EXISTS(POWER_LOSS)
+      // With a sensor the outage is the only routine save, with no time to make the file.
+      // Open it now so the outage costs just one block write.
+      journal_block = enabled ? card.openJournal(POWER_LOSS_JOURNAL_SLOTS) : 0;
+    #else
+      journal_block = 0;  // Check the journal file again at the first save
+    #endif
+  #endif
 }
 
 /**
@@ -245,6 +300,9 @@ void PrintJobRecovery::save(const bool force/*=false*/, const float zraise/*=POW
     info.flag.dryrun = !!(marlin_debug_flags & MARLIN_DEBUG_DRYRUN);
     info.flag.allow_cold_extrusion = TERN0(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude);
 
+    // Periodic saves wait for a quiet moment on the card. Forced saves can't wait.
+    if (TERN0(SD_QUIET_WRITES, !force && card.defer_write(write))) return;
+    TERN_(SD_QUIET_WRITES, card.cancel_write(write));
     write();
   }
 }
@@ -342,11 +400,30 @@ void PrintJobRecovery::write() {
 
   debug(F("Write"));
 
-  open(false);
-  file.seekSet(0);
-  const int16_t ret = file.write(&info, sizeof(info));
-  if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
-  if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    if (!journal_block) journal_block = card.openJournal(POWER_LOSS_JOURNAL_SLOTS);
+    plr_record_t * const rec = journal_block ? (plr_record_t*)card.rawBuffer() : nullptr;
+    if (!rec) { DEBUG_ECHOLNPGM("Power-loss journal open failed."); return; }
+
+    rec->sequence = ++journal_sequence;
+    rec->info = info;
+    rec->crc = record_crc(*rec);
+    if (!card.rawWrite(journal_block + journal_slot, (uint8_t*)rec)) {
+      DEBUG_ECHOLNPGM("Power-loss journal write failed.");
+      journal_block = 0;
+    }
+    journal_slot = (journal_slot + 1) % (POWER_LOSS_JOURNAL_SLOTS);
+
+  #else
+
+    open(false);
+    file.seekSet(0);
+    const int16_t ret = file.write(&info, sizeof(info));
+    if (ret == -1) DEBUG_ECHOLNPGM("Power-loss file write failed.");
+    if (!file.close()) DEBUG_ECHOLNPGM("Power-loss file close failed.");
+
+  #endif
 }
 
 /**
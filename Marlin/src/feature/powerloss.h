@@ -215,6 +215,12 @@ class PrintJobRecovery {
   private:
     static void write();
 
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint32_t journal_block,    // First block of the journal file, 0 if not open
+                      journal_sequence; // Sequence number of the newest record
+      static uint8_t journal_slot;      // Slot for the next record
+    #endif
+
     #if ENABLED(BACKUP_POWER_SUPPLY)
       static void retract_and_lift(const_float_t zraise);
     #endif
@@ -0,0 +1,84 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * print_estimator.cpp - Remaining time of an SD print, measured by the firmware
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(ESTIMATE_REMAINING_TIME)
+
+#include "print_estimator.h"
+#include "../module/planner.h"
+#include "../sd/cardreader.h"
+
+// Bytes to consume before there's a usable rate
+#define ESTIMATE_MIN_BYTES 4096
+
+PrintEstimator print_estimator;
+
+uint32_t PrintEstimator::active_ms; // = 0
+millis_t PrintEstimator::last_ms;   // = 0
+
+void PrintEstimator::reset() { active_ms = 0; last_ms = millis(); }
+
+void PrintEstimator::update() {
+  const millis_t ms = millis();
+  if (IS_SD_PRINTING() && planner.has_blocks_queued()) active_ms += ms - last_ms;
+  last_ms = ms;
+}
+
+/**
+ * Seconds of motion still in the planner, from each block's step rates.
+ * A block takes step_event_count / nominal_rate at cruise speed, plus
+ * (nominal - entry)^2 / (2 * nominal * accel) for each ramp. Blocks that
+ * never reach cruise come out a little short.
+ */
+static float planned_seconds() {
+  float t = 0;
+  for (uint8_t b = planner.block_buffer_tail; b != planner.block_buffer_head; b = BLOCK_MOD(b + 1)) {
+    block_t * const block = &planner.block_buffer[b];
+    if (!block->is_move() || !block->nominal_rate) continue;
+    const float n = block->nominal_rate;
+    t += block->step_event_count / n;
+    if (block->acceleration_steps_per_s2)
+      t += (sq(n - block->initial_rate) + sq(n - block->final_rate)) / (2 * n * block->acceleration_steps_per_s2);
+  }
+  return t;
+}
+
+uint32_t PrintEstimator::remaining() {
+  if (!IS_SD_PRINTING() && !card.isPaused()) return 0;
+  const uint32_t pos = card.getIndex(), size = card.getFileSize();
+  if (pos < ESTIMATE_MIN_BYTES || !active_ms || pos >= size) return 0;
+  const float planned = planned_seconds(),
+              rate = (active_ms * 0.001f + planned) / pos; // Seconds per byte, queued moves included
+  return uint32_t(rate * (size - pos) + planned);
+}
+
+void PrintEstimator::report() {
+  const uint32_t s = remaining();
+  if (s) SERIAL_ECHOLNPGM("Estimated time left: ", s, "s");
+}
+
+#endif // ESTIMATE_REMAINING_TIME
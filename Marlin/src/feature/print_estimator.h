@@ -0,0 +1,48 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2023 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * print_estimator.h - Remaining time of an SD print, measured by the firmware
+ *
+ * While printing, the time the planner spends moving is accumulated and
+ * divided by the file bytes consumed, giving seconds per byte for this file.
+ * The remaining bytes at that rate, plus the moves still in the planner,
+ * give the estimate. Heating and other waits with no moves are not counted,
+ * so a long warm-up doesn't inflate the rate.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+class PrintEstimator {
+public:
+  static void reset();                      // A new file was opened
+  static void update();                     // Called from idle()
+  static uint32_t remaining();              // Seconds left, or 0 if not known yet
+  static void report();
+
+private:
+  static uint32_t active_ms;                // Time with moves in the planner during this print
+  static millis_t last_ms;
+};
+
+extern PrintEstimator print_estimator;
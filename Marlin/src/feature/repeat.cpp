@@ -37,6 +37,14 @@
 repeat_marker_t Repeat::marker[MAX_REPEAT_NESTING];
 uint8_t Repeat::index;
 
+#if ENABLED(GCODE_REPEAT_CACHE)
+  char Repeat::cache[GCODE_REPEAT_CACHE_SIZE];
+  uint16_t Repeat::cache_len, Repeat::replay_pos;
+  uint32_t Repeat::record_pos;
+  uint8_t Repeat::cache_marker;
+  bool Repeat::recording, Repeat::replaying;
+#endif
+
 void Repeat::add_marker(const uint32_t sdpos, const uint16_t count) {
   if (index >= MAX_REPEAT_NESTING)
     SERIAL_ECHO_MSG("!Too many markers.");
@@ -45,20 +53,75 @@ void Repeat::add_marker(const uint32_t sdpos, const uint16_t count) {
     marker[index].counter = count ? count - 1 : -1;
     index++;
     DEBUG_ECHOLNPGM("Add Marker ", index, " at ", sdpos, " (", count, ")");
+    #if ENABLED(GCODE_REPEAT_CACHE)
+      // Keep the body of the newest loop, dropping any outer one
+      cache_marker = index;
+      cache_len = 0;
+      record_pos = sdpos;
+      recording = true;
+    #endif
   }
 }
 
+#if ENABLED(GCODE_REPEAT_CACHE)
+
+  /**
+   * Store a line of the loop body along with its file position.
+   * Give up on the body when it doesn't fit.
+   */
+  void Repeat::record(const char * const cmd) {
+    const uint16_t len = strlen(cmd) + 1;
+    constexpr uint16_t pos_size = TERN0(POWER_LOSS_RECOVERY, sizeof(record_pos));
+    if (cache_len + pos_size + len > GCODE_REPEAT_CACHE_SIZE) { uncache(); return; }
+    TERN_(POWER_LOSS_RECOVERY, memcpy(&cache[cache_len], &record_pos, pos_size));
+    memcpy(&cache[cache_len + pos_size], cmd, len);
+    cache_len += pos_size + len;
+    record_pos = card.getIndex();
+  }
+
+  /**
+   * Copy the next cached line into a queue slot, returning its file position.
+   * Reaching the end of the body goes through the closing M808 once more.
+   */
+  uint32_t Repeat::replay_line(char * const cmd) {
+    uint32_t pos = 0;
+    #if ENABLED(POWER_LOSS_RECOVERY)
+      memcpy(&pos, &cache[replay_pos], sizeof(pos));
+      replay_pos += sizeof(pos);
+    #endif
+    strcpy(cmd, &cache[replay_pos]);
+    replay_pos += strlen(cmd) + 1;
+    if (replay_pos >= cache_len) loop();
+    return pos;
+  }
+
+#endif // GCODE_REPEAT_CACHE
+
 void Repeat::loop() {
   if (!index)                           // No marker?
     SERIAL_ECHO_MSG("!No marker set."); //  Inform the user.
   else {
     const uint8_t ind = index - 1;      // Active marker's index
+    #if ENABLED(GCODE_REPEAT_CACHE)
+      // The body just read (or replayed) belongs to this marker
+      const bool cached = cache_marker == index && cache_len;
+      if (cache_marker == index) recording = false;
+      replaying = false;
+    #endif
     if (!marker[ind].counter) {         // Did its counter run out?
       DEBUG_ECHOLNPGM("Pass Marker ", index);
       index--;                          //  Carry on. Previous marker on the next 'M808'.
+      TERN_(GCODE_REPEAT_CACHE, if (cached) uncache());
     }
     else {
-      card.setIndex(marker[ind].sdpos); // Loop back to the marker.
+      #if ENABLED(GCODE_REPEAT_CACHE)
+        if (cached) {                   // Replay the body from RAM. The card stays after this 'M808'.
+          replaying = true;
+          replay_pos = 0;
+        }
+        else
+      #endif
+          card.setIndex(marker[ind].sdpos); // Loop back to the marker.
       if (marker[ind].counter > 0)      // Ignore a negative (or zero) counter.
         --marker[ind].counter;          // Decrement the counter. If zero this 'M808' will be skipped next time.
       DEBUG_ECHOLNPGM("Goto Marker ", index, " at ", marker[ind].sdpos, " (", marker[ind].counter, ")");
@@ -77,6 +140,10 @@ void Repeat::early_parse_M808(char * const cmd) {
     else
       Repeat::loop();
   }
+  #if ENABLED(GCODE_REPEAT_CACHE)
+    else if (recording)
+      record(cmd);
+  #endif
 }
 
 #endif // GCODE_REPEAT_MARKERS
@@ -37,8 +37,22 @@ class Repeat {
 private:
   static repeat_marker_t marker[MAX_REPEAT_NESTING];
   static uint8_t index;
+
+  #if ENABLED(GCODE_REPEAT_CACHE)
+    // The body of the innermost loop, as the lines were queued
+    static char cache[GCODE_REPEAT_CACHE_SIZE];
+    static uint16_t cache_len, replay_pos;
+    static uint32_t record_pos;           // File position of the next line recorded
+    static uint8_t cache_marker;          // Marker count when the body began, or 0 for no cache
+    static bool recording, replaying;
+    static void record(const char * const cmd);
+  #endif
+
 public:
-  static void reset() { index = 0; }
+  static void reset() {
+    index = 0;
+    TERN_(GCODE_REPEAT_CACHE, uncache());
+  }
   static bool is_active() {
     for (uint8_t i = 0; i < index; ++i) if (marker[i].counter) return true;
     return false;
@@ -51,6 +65,12 @@ public:
   static uint8_t count() { return index; }
   static int16_t get_marker_counter(const uint8_t i) { return marker[i].counter; }
   static uint32_t get_marker_sdpos(const uint8_t i) { return marker[i].sdpos; }
+
+  #if ENABLED(GCODE_REPEAT_CACHE)
+    static void uncache() { cache_marker = 0; recording = replaying = false; }
+    static bool is_replaying() { return replaying; }
+    static uint32_t replay_line(char * const cmd);
+  #endif
 };
 
 extern Repeat repeat;
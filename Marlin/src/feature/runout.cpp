@@ -45,9 +45,16 @@ bool FilamentMonitorBase::enabled = true,
   #include "../core/debug_out.h"
 #endif
 
-#if HAS_FILAMENT_RUNOUT_DISTANCE
+#if ENABLED(FILAMENT_RUNOUT_STEP_TRACKING)
+  float RunoutResponseStepped::runout_distance_mm = FILAMENT_RUNOUT_DISTANCE_MM;
+  int32_t RunoutResponseStepped::runout_steps_countdown[NUM_RUNOUT_SENSORS],
+          RunoutResponseStepped::runout_steps[NUM_RUNOUT_SENSORS],
+          RunoutResponseStepped::last_e_steps;
+#elif HAS_FILAMENT_RUNOUT_DISTANCE
   float RunoutResponseDelayed::runout_distance_mm = FILAMENT_RUNOUT_DISTANCE_MM;
   volatile float RunoutResponseDelayed::runout_mm_countdown[NUM_RUNOUT_SENSORS];
+#endif
+#if HAS_FILAMENT_RUNOUT_DISTANCE
   #if ENABLED(FILAMENT_MOTION_SENSOR)
     uint8_t FilamentSensorEncoder::motion_detected;
   #endif
@@ -50,12 +50,13 @@ class TFilamentMonitor;
 class FilamentSensorEncoder;
 class FilamentSensorSwitch;
 class RunoutResponseDelayed;
+class RunoutResponseStepped;
 class RunoutResponseDebounced;
 
 /********************************* TEMPLATE SPECIALIZATION *********************************/
 
 typedef TFilamentMonitor<
-          TERN(HAS_FILAMENT_RUNOUT_DISTANCE, RunoutResponseDelayed, RunoutResponseDebounced),
+          TERN(HAS_FILAMENT_RUNOUT_DISTANCE, TERN(FILAMENT_RUNOUT_STEP_TRACKING, RunoutResponseStepped, RunoutResponseDelayed), RunoutResponseDebounced),
           TERN(FILAMENT_MOTION_SENSOR, FilamentSensorEncoder, FilamentSensorSwitch)
         > FilamentMonitor;
 
@@ -116,11 +117,17 @@ class TFilamentMonitor : public FilamentMonitorBase {
     // Give the response a chance to update its counter.
     static void run() {
       if (enabled && !filament_ran_out && (printingIsActive() || did_pause_print)) {
-        TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, cli()); // Prevent RunoutResponseDelayed::block_completed from accumulating here
+        #define RUNOUT_BLOCK_COUNTDOWN (HAS_FILAMENT_RUNOUT_DISTANCE && DISABLED(FILAMENT_RUNOUT_STEP_TRACKING))
+        #if RUNOUT_BLOCK_COUNTDOWN
+          cli(); // Prevent RunoutResponseDelayed::block_completed from accumulating here
+        #endif
         response.run();
         sensor.run();
         const uint8_t runout_flags = response.has_run_out();
-        TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, sei());
+        #if RUNOUT_BLOCK_COUNTDOWN
+          sei();
+        #endif
+        #undef RUNOUT_BLOCK_COUNTDOWN
         #if MULTI_FILAMENT_SENSOR
           #if ENABLED(WATCH_ALL_RUNOUT_SENSORS)
             const bool ran_out = !!runout_flags;  // any sensor triggers
@@ -283,7 +290,15 @@ class FilamentSensorBase {
         motion_detected = 0;
       }
 
-      static void run() { poll_motion_sensor(); }
+      static void run() {
+        poll_motion_sensor();
+        #if ENABLED(FILAMENT_RUNOUT_STEP_TRACKING)
+          // Motion counts at once, not at the end of the block
+          for (uint8_t e = 0; e < NUM_RUNOUT_SENSORS; ++e)
+            if (TEST(motion_detected, e)) filament_present(e);
+          motion_detected = 0;
+        #endif
+      }
   };
 
 #else
@@ -377,6 +392,69 @@ class FilamentSensorBase {
       }
   };
 
+  #if ENABLED(FILAMENT_RUNOUT_STEP_TRACKING)
+
+    // RunoutResponseStepped is RunoutResponseDelayed counting in E steps.
+    // The steps taken since the last check come from the stepper position,
+    // so nothing is added in the stepper ISR and no finished block is awaited.
+    class RunoutResponseStepped {
+      private:
+        static int32_t runout_steps_countdown[NUM_RUNOUT_SENSORS],
+                       runout_steps[NUM_RUNOUT_SENSORS],
+                       last_e_steps;
+
+        // The runout distance in steps, following M92 and M412 changes
+        static void update_runout_steps() {
+          for (uint8_t i = 0; i < NUM_RUNOUT_SENSORS; ++i)
+            runout_steps[i] = LROUND(runout_distance_mm * planner.settings.axis_steps_per_mm[E_AXIS_N(i)]);
+        }
+
+      public:
+        static float runout_distance_mm;
+
+        static void reset() {
+          update_runout_steps();
+          last_e_steps = stepper.e_steps_moved();
+          for (uint8_t i = 0; i < NUM_RUNOUT_SENSORS; ++i) filament_present(i);
+        }
+
+        static void run() {
+          update_runout_steps();
+
+          // Retraction winds the countdown back up, but never past the full distance
+          const int32_t e_steps = stepper.e_steps_moved();
+          const uint8_t e = stepper.last_moved_extruder;
+          if (e < NUM_RUNOUT_SENSORS)
+            runout_steps_countdown[e] = _MIN(runout_steps_countdown[e] - (e_steps - last_e_steps), runout_steps[e]);
+          last_e_steps = e_steps;
+
+          #if ENABLED(FILAMENT_RUNOUT_SENSOR_DEBUG)
+            static millis_t t = 0;
+            const millis_t ms = millis();
+            if (ELAPSED(ms, t)) {
+              t = millis() + 1000UL;
+              for (uint8_t i = 0; i < NUM_RUNOUT_SENSORS; ++i)
+                SERIAL_ECHOF(i ? F(", ") : F("Remaining mm: "), runout_steps_countdown[i] * planner.mm_per_step[E_AXIS_N(i)]);
+              SERIAL_EOL();
+            }
+          #endif
+        }
+
+        static uint8_t has_run_out() {
+          uint8_t runout_flags = 0;
+          for (uint8_t i = 0; i < NUM_RUNOUT_SENSORS; ++i) if (runout_steps_countdown[i] < 0) SBI(runout_flags, i);
+          return runout_flags;
+        }
+
+        static void filament_present(const uint8_t extruder) {
+          runout_steps_countdown[extruder] = runout_steps[extruder];
+        }
+
+        static void block_completed(const block_t * const) { }
+    };
+
+  #endif
+
 #else // !HAS_FILAMENT_RUNOUT_DISTANCE
 
   // RunoutResponseDebounced triggers a runout event after a runout
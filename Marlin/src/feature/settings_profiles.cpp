@@ -0,0 +1,129 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * settings_profiles.cpp - Named sets of motion and tuning settings in RAM
+ *
+ * A profile is applied in one step, with one refresh of the values derived
+ * from it, instead of a script of M201/M204/M205/M900/M301/M851 commands.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(SETTINGS_PROFILES)
+
+#include "settings_profiles.h"
+
+#if HAS_BED_PROBE
+  #include "../module/probe.h"
+#endif
+
+SettingsProfiles settings_profiles;
+
+settings_profile_t SettingsProfiles::profile[SETTINGS_PROFILE_COUNT];
+int8_t SettingsProfiles::active = -1;
+
+void SettingsProfiles::reset() {
+  for (uint8_t p = 0; p < SETTINGS_PROFILE_COUNT; ++p) store(p);
+  active = -1;
+}
+
+void SettingsProfiles::store(const uint8_t p) {
+  settings_profile_t &sp = profile[p];
+  COPY(sp.max_acceleration_mm_per_s2, planner.settings.max_acceleration_mm_per_s2);
+  sp.acceleration = planner.settings.acceleration;
+  sp.retract_acceleration = planner.settings.retract_acceleration;
+  sp.travel_acceleration = planner.settings.travel_acceleration;
+  TERN_(HAS_CLASSIC_JERK, sp.max_jerk = planner.max_jerk);
+  TERN_(HAS_JUNCTION_DEVIATION, sp.junction_deviation_mm = planner.junction_deviation_mm);
+  #if ENABLED(LIN_ADVANCE)
+    COPY(sp.advance_K, planner.extruder_advance_K);
+  #endif
+  #if ENABLED(PIDTEMP)
+    HOTEND_LOOP() {
+      const hotend_pid_t &pid = thermalManager.temp_hotend[e].pid;
+      sp.hotend_pid[e] = { pid.p(), pid.i(), pid.d() };
+    }
+  #endif
+  TERN_(HAS_BED_PROBE, sp.z_offset = probe.offset.z);
+}
+
+void SettingsProfiles::apply(const uint8_t p) {
+  const settings_profile_t &sp = profile[p];
+
+  #if ENABLED(LIN_ADVANCE)
+    // Blocks already in the queue were planned with the old K
+    if (memcmp(sp.advance_K, planner.extruder_advance_K, sizeof(sp.advance_K))) {
+      planner.synchronize();
+      COPY(planner.extruder_advance_K, sp.advance_K);
+    }
+  #endif
+
+  COPY(planner.settings.max_acceleration_mm_per_s2, sp.max_acceleration_mm_per_s2);
+  planner.settings.acceleration = sp.acceleration;
+  planner.settings.retract_acceleration = sp.retract_acceleration;
+  planner.settings.travel_acceleration = sp.travel_acceleration;
+  TERN_(HAS_CLASSIC_JERK, planner.max_jerk = sp.max_jerk);
+  TERN_(HAS_JUNCTION_DEVIATION, planner.junction_deviation_mm = sp.junction_deviation_mm);
+  #if ENABLED(PIDTEMP)
+    HOTEND_LOOP() {
+      hotend_pid_t &pid = thermalManager.temp_hotend[e].pid;
+      pid.set_Kp(sp.hotend_pid[e].p);
+      pid.set_Ki(sp.hotend_pid[e].i);
+      pid.set_Kd(sp.hotend_pid[e].d);
+    }
+  #endif
+  TERN_(HAS_BED_PROBE, probe.offset.z = sp.z_offset);
+
+  // Refresh only what depends on the values above
+  planner.refresh_acceleration_rates();
+  TERN_(HAS_LINEAR_E_JERK, planner.recalculate_max_e_jerk());
+  TERN_(PIDTEMP, thermalManager.updatePID());
+
+  active = p;
+}
+
+void SettingsProfiles::report(const uint8_t p) {
+  const settings_profile_t &sp = profile[p];
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM("Profile ", p);
+  if (int8_t(p) == active) SERIAL_ECHOPGM(" (active)");
+  SERIAL_ECHOPGM(": Accel P", sp.acceleration, " R", sp.retract_acceleration, " T", sp.travel_acceleration);
+  #if HAS_CLASSIC_JERK
+    SERIAL_ECHOPGM(" Jerk X", sp.max_jerk.x, " Y", sp.max_jerk.y, " Z", sp.max_jerk.z);
+  #endif
+  #if HAS_JUNCTION_DEVIATION
+    SERIAL_ECHOPGM(" J", sp.junction_deviation_mm);
+  #endif
+  #if ENABLED(LIN_ADVANCE)
+    SERIAL_ECHOPGM(" K", sp.advance_K[0]);
+  #endif
+  #if ENABLED(PIDTEMP)
+    SERIAL_ECHOPGM(" PID P", sp.hotend_pid[0].p, " I", sp.hotend_pid[0].i, " D", sp.hotend_pid[0].d);
+  #endif
+  #if HAS_BED_PROBE
+    SERIAL_ECHOPGM(" Offset Z", sp.z_offset);
+  #endif
+  SERIAL_EOL();
+}
+
+#endif // SETTINGS_PROFILES
@@ -0,0 +1,64 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * settings_profiles.h - Named sets of motion and tuning settings in RAM
+ */
+
+#include "../module/planner.h"
+#include "../module/temperature.h"
+
+typedef struct {
+  uint32_t max_acceleration_mm_per_s2[DISTINCT_AXES];     // M201 XYZE
+  float acceleration,                                     // M204 P
+        retract_acceleration,                             // M204 R
+        travel_acceleration;                              // M204 T
+  #if HAS_CLASSIC_JERK
+    decltype(planner.max_jerk) max_jerk;                  // M205 XYZE
+  #endif
+  #if HAS_JUNCTION_DEVIATION
+    float junction_deviation_mm;                          // M205 J
+  #endif
+  #if ENABLED(LIN_ADVANCE)
+    float advance_K[DISTINCT_E];                          // M900 K
+  #endif
+  #if ENABLED(PIDTEMP)
+    raw_pid_t hotend_pid[HOTENDS];                        // M301 PID
+  #endif
+  #if HAS_BED_PROBE
+    float z_offset;                                       // M851 Z
+  #endif
+} settings_profile_t;
+
+class SettingsProfiles {
+public:
+  static settings_profile_t profile[SETTINGS_PROFILE_COUNT];   // Saved with M500
+  static int8_t active;                                   // Last applied profile, or -1
+
+  static void reset();                                    // Fill all profiles from the current settings
+  static void store(const uint8_t p);                     // Copy the current settings into a profile
+  static void apply(const uint8_t p);                     // Replace the current settings with a profile
+  static void report(const uint8_t p);
+};
+
+extern SettingsProfiles settings_profiles;
@@ -0,0 +1,89 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * stack_monitor.cpp - Track the stack high-water mark, idle() depth and ISR nesting
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STACK_MONITOR)
+
+#include "stack_monitor.h"
+
+StackMonitor stack_monitor;
+
+uint8_t *StackMonitor::low_water;
+uint8_t StackMonitor::idle_depth, StackMonitor::max_idle_depth;
+volatile uint8_t StackMonitor::isr_depth;
+uint8_t StackMonitor::max_isr_depth;
+uint16_t StackMonitor::min_isr_free = 0xFFFF;
+uint32_t StackMonitor::nested_isrs;
+
+/**
+ * Paint the free RAM before the C runtime starts. At this point the
+ * stack is empty and the stack pointer is at the top of RAM.
+ */
+extern "C" void stack_monitor_paint() __attribute__((naked, used, section(".init3")));
+void stack_monitor_paint() {
+  extern uint8_t __heap_start;
+  for (uint8_t *p = &__heap_start; p < (uint8_t*)SP; ++p) *p = STACK_CANARY;
+}
+
+// Find the lowest stack byte written since boot, starting from the bottom of the free RAM
+void StackMonitor::init() {
+  uint8_t *p = heap_start();
+  while (p < (uint8_t*)SP && *p == STACK_CANARY) ++p;
+  low_water = p;
+}
+
+void StackMonitor::reset() {
+  max_idle_depth = idle_depth;
+  hal.isr_off();
+  max_isr_depth = 0;
+  min_isr_free = 0xFFFF;
+  nested_isrs = 0;
+  hal.isr_on();
+}
+
+/**
+ * Report the stack usage
+ *
+ * Returns "STACK" followed by:
+ *  FREE<bytes>     Least free stack since boot
+ *  NOW<bytes>      Free stack now
+ *  ISRFREE<bytes>  Least free stack seen at ISR entry
+ *  IDLE<depth>     Deepest idle() recursion
+ *  ISR<depth>      Deepest ISR nesting
+ *  NESTED<n>       ISRs entered while another one was running
+ */
+void StackMonitor::report() {
+  hal.isr_off();
+  const uint8_t isr_max = max_isr_depth;
+  const uint16_t isr_free = min_isr_free;
+  const uint32_t nested = nested_isrs;
+  hal.isr_on();
+  SERIAL_ECHOLNPGM("STACK FREE", min_free(), " NOW", free_now(), " ISRFREE", isr_free,
+                   " IDLE", max_idle_depth, " ISR", isr_max, " NESTED", nested);
+}
+
+#endif // STACK_MONITOR
@@ -0,0 +1,83 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * stack_monitor.h - Track the stack high-water mark, idle() depth and ISR nesting
+ *
+ * The free RAM between the end of .bss/.noinit and the stack is painted at boot.
+ * The lowest stack byte ever written is found by walking down from the last
+ * known mark, so each check costs a few reads unless the stack grew.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define STACK_CANARY 0xC5
+
+class StackMonitor {
+public:
+  static uint8_t *low_water;            // Lowest stack address found written
+  static uint8_t idle_depth, max_idle_depth;
+  static volatile uint8_t isr_depth;
+  static uint8_t max_isr_depth;
+  static uint16_t min_isr_free;         // Least free stack seen at ISR entry
+  static uint32_t nested_isrs;          // ISRs entered while another one was running
+
+  static void init();
+  static void reset();
+  static void report();
+
+  static uint16_t free_now() { return (uint8_t*)SP - heap_start(); }
+  static uint16_t min_free() { check(); return low_water - heap_start(); }
+
+  // Move the mark down past any stack bytes written below it
+  static void check() {
+    uint8_t *b = low_water;
+    for (uint8_t n = 0; n < 4 && b > heap_start();) {
+      if (*--b != STACK_CANARY) { low_water = b; n = 0; } else ++n;
+    }
+  }
+
+  static void enter_idle() {
+    if (++idle_depth > max_idle_depth) max_idle_depth = idle_depth;
+    check();
+  }
+  static void exit_idle() { --idle_depth; }
+
+  static void enter_isr() {
+    if (++isr_depth > 1) nested_isrs++;
+    NOLESS(max_isr_depth, isr_depth);
+    NOMORE(min_isr_free, free_now());
+  }
+  static void exit_isr() { --isr_depth; }
+
+private:
+  static uint8_t* heap_start() { extern uint8_t __heap_start; return &__heap_start; }
+};
+
+extern StackMonitor stack_monitor;
+
+// Count an ISR as running for as long as this object is in scope
+struct StackMonitorISR {
+  StackMonitorISR() { StackMonitor::enter_isr(); }
+  ~StackMonitorISR() { StackMonitor::exit_isr(); }
+};
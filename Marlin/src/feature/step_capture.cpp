@@ -0,0 +1,116 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * step_capture.cpp - Step timing capture with a timer input capture unit
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(STEP_CAPTURE)
+
+#include "step_capture.h"
+
+#include "../module/motion.h"
+#include "../module/planner.h"
+
+StepCapture step_capture;
+
+volatile uint32_t StepCapture::edges;
+uint32_t StepCapture::first, StepCapture::last;
+volatile uint16_t StepCapture::count;
+uint16_t StepCapture::stamps[STEP_CAPTURE_SIZE];
+
+#define SC_REG(R)     CAT(R, STEP_CAPTURE_TIMER)
+#define SC_REG_(R,S)  CAT(CAT(R, STEP_CAPTURE_TIMER), S)
+
+ISR(SC_REG_(TIMER, _CAPT_vect)) { StepCapture::edge(SC_REG(ICR)); }
+
+void StepCapture::run(const AxisEnum axis, const_float_t distance, const_feedRate_t fr_mm_s) {
+  planner.synchronize();
+
+  // Capture the leading edge of each STEP pulse
+  static constexpr bool inverted[] = { NUM_AXIS_LIST(INVERT_X_STEP_PIN, INVERT_Y_STEP_PIN, INVERT_Z_STEP_PIN,
+                                                     INVERT_I_STEP_PIN, INVERT_J_STEP_PIN, INVERT_K_STEP_PIN,
+                                                     INVERT_U_STEP_PIN, INVERT_V_STEP_PIN, INVERT_W_STEP_PIN) };
+
+  // Normal mode, clock / 8, noise canceler on. Count from the start of the move.
+  edges = count = 0;
+  first = last = UINT32_MAX;
+  SC_REG_(TCCR, A) = 0;
+  SC_REG_(TCCR, B) = _BV(SC_REG_(ICNC, )) | (inverted[axis] ? 0 : _BV(SC_REG_(ICES, ))) | _BV(SC_REG_(CS, 1));
+  SC_REG_(TIFR, ) = _BV(SC_REG_(ICF, ));
+  SC_REG_(TIMSK, ) = _BV(SC_REG_(ICIE, ));
+
+  current_position[axis] += distance;
+  apply_motion_limits(current_position);
+  line_to_current_position(fr_mm_s);
+
+  // With nothing else queued the block is final. Keep the edges of its cruise.
+  const block_t &block = planner.block_buffer[block_dec_mod(planner.block_buffer_head, 1)];
+  const uint32_t rate = block.nominal_rate, steps = block.step_event_count;
+  hal.isr_off();
+  first = block.accelerate_until;
+  last = block.decelerate_after;
+  hal.isr_on();
+
+  planner.synchronize();
+  SC_REG_(TIMSK, ) = 0;
+
+  report(axis, rate, steps);
+}
+
+void StepCapture::report(const AxisEnum axis, const uint32_t rate, const uint32_t steps) {
+  const float planned = float(STEP_CAPTURE_HZ) / rate,
+              us = 1e6f / (STEP_CAPTURE_HZ);
+
+  SERIAL_ECHO_START();
+  SERIAL_CHAR(AXIS_CHAR(axis));
+  SERIAL_ECHOLNPGM(" step capture. Edges:", edges, " planned:", steps);
+  if (count < 2) { SERIAL_ECHO_MSG("No cruise captured"); return; }
+
+  uint16_t dmin = 0xFFFF, dmax = 0;
+  uint32_t total = 0;
+  float sq_dev = 0, max_dev = 0;
+  for (uint16_t i = 1; i < count; ++i) {
+    const uint16_t d = stamps[i] - stamps[i - 1];
+    NOMORE(dmin, d);
+    NOLESS(dmax, d);
+    total += d;
+    const float dev = d - planned;
+    sq_dev += sq(dev);
+    NOLESS(max_dev, ABS(dev));
+  }
+  const uint16_t n = count - 1;
+  SERIAL_ECHO_START();
+  auto echo_us = [&](FSTR_P const label, const float counts) { SERIAL_ECHOF(label); SERIAL_PRINT(counts * us, 2); };
+  SERIAL_ECHOPGM("Cruise intervals:", n, " rate:", rate, " steps/s. Times in us");
+  echo_us(F(" planned:"), planned);
+  echo_us(F(" min:"), dmin);
+  echo_us(F(" avg:"), float(total) / n);
+  echo_us(F(" max:"), dmax);
+  echo_us(F(" jitter max:"), max_dev);
+  echo_us(F(" rms:"), SQRT(sq_dev / n));
+  SERIAL_EOL();
+}
+
+#endif // STEP_CAPTURE
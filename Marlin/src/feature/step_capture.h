@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * step_capture.h - Timestamp the STEP edges of one axis with a timer input capture
+ *
+ * Wire the STEP pin of the axis to the ICP pin of STEP_CAPTURE_TIMER. The
+ * timer latches each edge in hardware, so ISR latency doesn't affect the
+ * timestamps. The cruise of a test move is compared to the planned rate.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define STEP_CAPTURE_HZ (F_CPU / 8)     // Timer clock. Intervals over 65535 counts wrap.
+
+class StepCapture {
+public:
+  // Move an axis by 'distance', capture its STEP edges and report the timing
+  static void run(const AxisEnum axis, const_float_t distance, const_feedRate_t fr_mm_s);
+
+  static void edge(const uint16_t t) {
+    if (WITHIN(edges, first, last) && count < STEP_CAPTURE_SIZE) stamps[count++] = t;
+    edges++;
+  }
+
+private:
+  static volatile uint32_t edges;         // Edges since the capture started
+  static uint32_t first, last;            // Edges to keep: the cruise of the block
+  static volatile uint16_t count;
+  static uint16_t stamps[STEP_CAPTURE_SIZE];
+
+  static void report(const AxisEnum axis, const uint32_t rate, const uint32_t steps);
+};
+
+extern StepCapture step_capture;
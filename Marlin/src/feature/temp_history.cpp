@@ -0,0 +1,132 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * temp_history.cpp - Keep a downsampled record of each heater in SRAM
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if ENABLED(TEMP_HISTORY)
+
+#include "temp_history.h"
+#include "../module/temperature.h"
+#include "../libs/hex_print.h"
+
+TempHistory temp_history;
+
+temp_sample_t TempHistory::ring[TEMP_HISTORY_SIZE][TEMP_HISTORY_HEATERS];
+uint8_t TempHistory::head, TempHistory::count, TempHistory::readings;
+millis_t TempHistory::next_ms;
+float TempHistory::temp_sum[TEMP_HISTORY_HEATERS];
+uint16_t TempHistory::power_sum[TEMP_HISTORY_HEATERS];
+
+// The heater behind each history column: hotends first, then the bed
+static const heater_info_t& history_heater(const uint8_t h) {
+  #if HAS_HEATED_BED
+    if (h == HOTENDS) return thermalManager.temp_bed;
+  #endif
+  return thermalManager.temp_hotend[h];
+}
+
+static uint8_t history_fan(const uint8_t h) {
+  #if HAS_FAN
+    if (h < HOTENDS) return thermalManager.fan_speed[_MIN(h, FAN_COUNT - 1)];
+  #endif
+  UNUSED(h);
+  return 0;
+}
+
+void TempHistory::reset() {
+  head = count = readings = 0;
+  for (uint8_t h = 0; h < TEMP_HISTORY_HEATERS; ++h) { temp_sum[h] = 0; power_sum[h] = 0; }
+}
+
+/**
+ * Add the latest reading to the running sums. Once the interval
+ * has passed, store the averages as the newest sample.
+ */
+void TempHistory::record(const millis_t &ms) {
+  if (readings < 255) {
+    for (uint8_t h = 0; h < TEMP_HISTORY_HEATERS; ++h) {
+      const heater_info_t &heater = history_heater(h);
+      temp_sum[h] += heater.celsius;
+      power_sum[h] += heater.soft_pwm_amount;
+    }
+    ++readings;
+  }
+
+  if (PENDING(ms, next_ms)) return;
+  next_ms = ms + (TEMP_HISTORY_INTERVAL);
+
+  temp_sample_t * const sample = ring[head];
+  const float scale = 1.0f / readings;
+  for (uint8_t h = 0; h < TEMP_HISTORY_HEATERS; ++h) {
+    const heater_info_t &heater = history_heater(h);
+    sample[h].temp = int16_t(temp_sum[h] * scale * 16.0f);
+    sample[h].target = heater.target;
+    sample[h].power = uint8_t(power_sum[h] / readings);
+    sample[h].fan = history_fan(h);
+    temp_sum[h] = 0;
+    power_sum[h] = 0;
+  }
+  readings = 0;
+
+  if (++head >= TEMP_HISTORY_SIZE) head = 0;
+  if (count < TEMP_HISTORY_SIZE) ++count;
+}
+
+/**
+ * Print the samples from oldest to newest, one line per sample.
+ * CSV has temp (°C), target (°C), power (0-127), and fan (0-255)
+ * for each heater. Hex is the raw temp_sample_t bytes of each heater.
+ */
+void TempHistory::dump(const bool hex) {
+  SERIAL_ECHOPGM("Temp history interval:", TEMP_HISTORY_INTERVAL, "ms samples:", count, " heaters:");
+  for (uint8_t h = 0; h < TEMP_HISTORY_HEATERS; ++h) {
+    SERIAL_CHAR(' ');
+    if (TERN0(HAS_HEATED_BED, h == HOTENDS)) SERIAL_CHAR('B'); else { SERIAL_CHAR('E'); SERIAL_ECHO(h); }
+  }
+  SERIAL_EOL();
+
+  uint8_t i = (head + TEMP_HISTORY_SIZE - count) % (TEMP_HISTORY_SIZE);
+  for (uint8_t n = 0; n < count; ++n) {
+    const temp_sample_t * const sample = ring[i];
+    for (uint8_t h = 0; h < TEMP_HISTORY_HEATERS; ++h) {
+      if (hex) {
+        const uint8_t * const b = (const uint8_t*)&sample[h];
+        for (uint8_t k = 0; k < sizeof(temp_sample_t); ++k) {
+          SERIAL_CHAR(hex_nybble(b[k] >> 4), hex_nybble(b[k]));
+        }
+      }
+      else {
+        if (h) SERIAL_CHAR(',');
+        SERIAL_PRINT(sample[h].temp * (1.0f / 16.0f), 1);
+        SERIAL_ECHOPGM(",", sample[h].target, ",", sample[h].power, ",", sample[h].fan);
+      }
+    }
+    SERIAL_EOL();
+    if (++i >= TEMP_HISTORY_SIZE) i = 0;
+  }
+}
+
+#endif // TEMP_HISTORY
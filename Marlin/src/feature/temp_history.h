@@ -0,0 +1,60 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * temp_history.h - Keep a downsampled record of each heater in SRAM
+ *
+ * Temperature::task() feeds every new reading in. Temperature and heater power
+ * are averaged over each TEMP_HISTORY_INTERVAL and stored with the target and
+ * fan speed at the end of the interval. The oldest sample is overwritten first.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#define TEMP_HISTORY_HEATERS (HOTENDS + ENABLED(HAS_HEATED_BED))
+
+typedef struct {
+  int16_t temp;     // (1/16 °C) Average over the interval
+  int16_t target;   // (°C)
+  uint8_t power;    // Average soft PWM, 0-127
+  uint8_t fan;      // Part cooling fan speed, 0-255
+} temp_sample_t;
+
+class TempHistory {
+public:
+  static void record(const millis_t &ms);
+  static void reset();
+  static void dump(const bool hex);
+
+private:
+  static temp_sample_t ring[TEMP_HISTORY_SIZE][TEMP_HISTORY_HEATERS];
+  static uint8_t head, count;
+  static millis_t next_ms;
+
+  // Sums for the interval in progress
+  static float temp_sum[TEMP_HISTORY_HEATERS];
+  static uint16_t power_sum[TEMP_HISTORY_HEATERS];
+  static uint8_t readings;
+};
+
+extern TempHistory temp_history;
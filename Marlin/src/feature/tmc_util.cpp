@@ -200,6 +200,36 @@
 
   #endif // TMC2660
 
+  #if ENABLED(HYBRID_THRESHOLD_AUTO)
+
+    // TSTEP at which stealthChop ran out of voltage, or 0 while there's headroom
+    #if HAS_TMCX1X0
+      static uint32_t stealth_limit(TMC2130Stepper&, const uint32_t) { return 0; }
+    #endif
+    #if HAS_TMC220x
+      static uint32_t stealth_limit(TMC2208Stepper &st, const uint32_t ds) {
+        constexpr uint8_t STEALTH_bp = 30, STST_bp = 31;
+        const uint8_t spart = ds >> 24;
+        if (!TEST(spart, STEALTH_bp - 24) || TEST(spart, STST_bp - 24)) return 0; // Not moving in stealthChop
+        return st.pwm_scale_sum() >= (HYBRID_AUTO_PWM_SCALE) ? st.TSTEP() : 0;
+      }
+    #endif
+
+    // Lower the hybrid threshold to just below the speed where stealthChop gave out
+    template<typename TMC>
+    void tune_hybrid_threshold(TMC &st, const uint32_t ds) {
+      const uint32_t tstep = stealth_limit(st, ds);
+      if (!tstep) return;
+      const uint32_t thrs = _MIN(tstep + tstep * (HYBRID_AUTO_MARGIN) / 100, 0xFFFFFUL);
+      if (thrs <= st.TPWMTHRS()) return;  // Already switching at a lower speed
+      st.TPWMTHRS(thrs);
+      TERN_(HAS_MARLINUI_MENU, st.stored.hybrid_thrs = st.get_pwm_thrs());
+      st.printLabel();
+      SERIAL_ECHOLNPGM(" hybrid threshold lowered to ", st.get_pwm_thrs());
+    }
+
+  #endif
+
   #if ENABLED(STOP_ON_ERROR)
     void report_driver_error(const TMC_driver_data &data) {
       SERIAL_ECHOPGM(" driver error detected: 0x");
@@ -280,6 +310,7 @@
 
   template<typename TMC>
   bool monitor_tmc_driver(TMC &st, const bool need_update_error_counters, const bool need_debug_reporting) {
+    if (!need_update_error_counters && !need_debug_reporting) return false;  // Not this driver's turn
     TMC_driver_data data = get_driver_data(st);
     if (data.drv_status == 0xFFFFFFFF || data.drv_status == 0x0) return false;
 
@@ -312,6 +343,8 @@
         st.flag_otpw = true;
       }
       else if (st.otpw_count > 0) st.otpw_count = 0;
+
+      TERN_(HYBRID_THRESHOLD_AUTO, tune_hybrid_threshold(st, data.drv_status));
     }
 
     #if ENABLED(TMC_DEBUG)
@@ -327,7 +360,16 @@
     // Poll TMC drivers at the configured interval
     static millis_t next_poll = 0;
     const bool need_update_error_counters = ELAPSED(ms, next_poll);
-    if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
+    #if ENABLED(TMC_MONITOR_ROUND_ROBIN)
+      // Poll one driver per call, spreading the drivers over the interval
+      static uint8_t poll_slot = 0, slot_count = 1;
+      uint8_t slot = 0;
+      #define NEED_UPDATE() (slot++ == poll_slot && need_update_error_counters)
+      if (need_update_error_counters) next_poll = ms + (MONITOR_DRIVER_STATUS_INTERVAL_MS) / slot_count;
+    #else
+      #define NEED_UPDATE() need_update_error_counters
+      if (need_update_error_counters) next_poll = ms + MONITOR_DRIVER_STATUS_INTERVAL_MS;
+    #endif
 
     // Also poll at intervals for debugging
     #if ENABLED(TMC_DEBUG)
@@ -344,10 +386,10 @@
       {
         bool result = false;
         #if AXIS_IS_TMC(X)
-          if (monitor_tmc_driver(stepperX, need_update_error_counters, need_debug_reporting)) result = true;
+          if (monitor_tmc_driver(stepperX, NEED_UPDATE(), need_debug_reporting)) result = true;
         #endif
         #if AXIS_IS_TMC(X2)
-          if (monitor_tmc_driver(stepperX2, need_update_error_counters, need_debug_reporting)) result = true;
+          if (monitor_tmc_driver(stepperX2, NEED_UPDATE(), need_debug_reporting)) result = true;
         #endif
         if (result) {
           #if AXIS_IS_TMC(X)
@@ -364,10 +406,10 @@
       {
         bool result = false;
         #if AXIS_IS_TMC(Y)
-          if (monitor_tmc_driver(stepperY, need_update_error_counters, need_debug_reporting)) result = true;
+          if (monitor_tmc_driver(stepperY, NEED_UPDATE(), need_debug_reporting)) result = true;
         #endif
         #if AXIS_IS_TMC(Y2)
-          if (monitor_tmc_driver(stepperY2, need_update_error_counters, need_debug_reporting)) result = true;
+          if (monitor_tmc_driver(stepperY2, NEED_UPDATE(), need_debug_reporting)) result = true;
         #endif
         if (result) {
           #if AXIS_IS_TMC(Y)
@@ -384,16 +426,16 @@
       {
         bool result = false;
         #if AXIS_IS_TMC(Z)
-          if (monitor_tmc_driver(stepperZ, need_update_error_counters, need_debug_reporting)) result = true;
+          if (monitor_tmc_driver(stepperZ, NEED_UPDATE(), need_debug_reporting)) result = true;
         #endif
         #if AXIS_IS_TMC(Z2)
-          if (monitor_tmc_driver(stepperZ2, need_update_error_counters, need_debug_reporting)) result = true;
+          if (monitor_tmc_driver(stepperZ2, NEED_UPDATE(), need_debug_reporting)) result = true;
         #endif
         #if AXIS_IS_TMC(Z3)
-          if (monitor_tmc_driver(stepperZ3, need_update_error_counters, need_debug_reporting)) result = true;
+          if (monitor_tmc_driver(stepperZ3, NEED_UPDATE(), need_debug_reporting)) result = true;
         #endif
         #if AXIS_IS_TMC(Z4)
-          if (monitor_tmc_driver(stepperZ4, need_update_error_counters, need_debug_reporting)) result = true;
+          if (monitor_tmc_driver(stepperZ4, NEED_UPDATE(), need_debug_reporting)) result = true;
         #endif
         if (result) {
           #if AXIS_IS_TMC(Z)
@@ -413,57 +455,66 @@
       #endif
 
       #if AXIS_IS_TMC(I)
-        if (monitor_tmc_driver(stepperI, need_update_error_counters, need_debug_reporting))
+        if (monitor_tmc_driver(stepperI, NEED_UPDATE(), need_debug_reporting))
           step_current_down(stepperI);
       #endif
       #if AXIS_IS_TMC(J)
-        if (monitor_tmc_driver(stepperJ, need_update_error_counters, need_debug_reporting))
+        if (monitor_tmc_driver(stepperJ, NEED_UPDATE(), need_debug_reporting))
           step_current_down(stepperJ);
       #endif
       #if AXIS_IS_TMC(K)
-        if (monitor_tmc_driver(stepperK, need_update_error_counters, need_debug_reporting))
+        if (monitor_tmc_driver(stepperK, NEED_UPDATE(), need_debug_reporting))
           step_current_down(stepperK);
       #endif
       #if AXIS_IS_TMC(U)
-        if (monitor_tmc_driver(stepperU, need_update_error_counters, need_debug_reporting))
+        if (monitor_tmc_driver(stepperU, NEED_UPDATE(), need_debug_reporting))
           step_current_down(stepperU);
       #endif
       #if AXIS_IS_TMC(V)
-        if (monitor_tmc_driver(stepperV, need_update_error_counters, need_debug_reporting))
+        if (monitor_tmc_driver(stepperV, NEED_UPDATE(), need_debug_reporting))
           step_current_down(stepperV);
       #endif
       #if AXIS_IS_TMC(W)
-        if (monitor_tmc_driver(stepperW, need_update_error_counters, need_debug_reporting))
+        if (monitor_tmc_driver(stepperW, NEED_UPDATE(), need_debug_reporting))
           step_current_down(stepperW);
       #endif
 
       #if AXIS_IS_TMC(E0)
-        (void)monitor_tmc_driver(stepperE0, need_update_error_counters, need_debug_reporting);
+        (void)monitor_tmc_driver(stepperE0, NEED_UPDATE(), need_debug_reporting);
       #endif
       #if AXIS_IS_TMC(E1)
-        (void)monitor_tmc_driver(stepperE1, need_update_error_counters, need_debug_reporting);
+        (void)monitor_tmc_driver(stepperE1, NEED_UPDATE(), need_debug_reporting);
       #endif
       #if AXIS_IS_TMC(E2)
-        (void)monitor_tmc_driver(stepperE2, need_update_error_counters, need_debug_reporting);
+        (void)monitor_tmc_driver(stepperE2, NEED_UPDATE(), need_debug_reporting);
       #endif
       #if AXIS_IS_TMC(E3)
-        (void)monitor_tmc_driver(stepperE3, need_update_error_counters, need_debug_reporting);
+        (void)monitor_tmc_driver(stepperE3, NEED_UPDATE(), need_debug_reporting);
       #endif
       #if AXIS_IS_TMC(E4)
-        (void)monitor_tmc_driver(stepperE4, need_update_error_counters, need_debug_reporting);
+        (void)monitor_tmc_driver(stepperE4, NEED_UPDATE(), need_debug_reporting);
       #endif
       #if AXIS_IS_TMC(E5)
-        (void)monitor_tmc_driver(stepperE5, need_update_error_counters, need_debug_reporting);
+        (void)monitor_tmc_driver(stepperE5, NEED_UPDATE(), need_debug_reporting);
       #endif
       #if AXIS_IS_TMC(E6)
-        (void)monitor_tmc_driver(stepperE6, need_update_error_counters, need_debug_reporting);
+        (void)monitor_tmc_driver(stepperE6, NEED_UPDATE(), need_debug_reporting);
       #endif
       #if AXIS_IS_TMC(E7)
-        (void)monitor_tmc_driver(stepperE7, need_update_error_counters, need_debug_reporting);
+        (void)monitor_tmc_driver(stepperE7, NEED_UPDATE(), need_debug_reporting);
       #endif
 
       if (TERN0(TMC_DEBUG, need_debug_reporting)) SERIAL_EOL();
+
+      #if ENABLED(TMC_MONITOR_ROUND_ROBIN)
+        if (need_update_error_counters) {
+          slot_count = slot;
+          if (++poll_slot >= slot_count) poll_slot = 0;
+        }
+      #endif
     }
+
+    #undef NEED_UPDATE
   }
 
 #endif // MONITOR_DRIVER_STATUS
@@ -0,0 +1,191 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * virtual_stepper.cpp - Virtual stepping for print time estimation
+ *
+ * Two clocks are kept in µs:
+ *  - The machine clock follows real time, and jumps ahead wherever the firmware
+ *    would have waited for the stepper: a full block buffer, a synchronize or
+ *    a dwell. Each block arrives at the machine time it was first seen.
+ *  - The motion clock is where the stepper would finish the latest block. A
+ *    block starts at its arrival or when the one before ends, whichever is
+ *    later. It's released once it ends, so the planner sees the buffer the
+ *    Stepper ISR would have left.
+ *
+ * A block that arrives after the stepper ran dry is an underrun, unless the
+ * firmware drained the buffer on purpose.
+ *
+ * Heating, homing, probing and filament changes are skipped and not timed.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ENABLED(VIRTUAL_STEPPING)
+
+#include "virtual_stepper.h"
+
+#include "../MarlinCore.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+#include "../gcode/parser.h"
+
+VirtualStepper virtual_stepper;
+
+bool VirtualStepper::active; // = false
+
+static struct {
+  uint64_t machine_us,                    // Real time plus the skipped waits
+           motion_us;                     // When the last block taken would end
+  uint32_t last_us,                       // micros() at the last update of machine_us
+           arrival_us[BLOCK_BUFFER_SIZE], // Low word of machine_us when each block was seen
+           start_ms,                      // Real time of the start
+           blocks, underruns, skipped;
+  block_t *current;                       // The block the stepper would be running
+  uint8_t seen_head;                      // The next block to get an arrival time
+  bool drained;                           // Stepper idle on purpose, not an underrun
+} vstep;
+
+static xyze_pos_t saved_position;
+#if ENABLED(PREVENT_COLD_EXTRUSION)
+  static bool saved_cold_extrude;
+#endif
+
+// Time to run a block at its planned rates, in µs
+static uint32_t block_time_us(const block_t * const b) {
+  const float vi = b->initial_rate, vf = b->final_rate, a = b->acceleration_steps_per_s2,
+              accel_steps = b->accelerate_until,
+              cruise_steps = b->decelerate_after - b->accelerate_until,
+              decel_steps = b->step_event_count - b->decelerate_after,
+              // A short block may turn to decelerate before the nominal rate
+              vp = _MIN(float(b->nominal_rate), SQRT(sq(vi) + 2.0f * a * accel_steps));
+  return 1e6f * ((accel_steps ? 2.0f * accel_steps / (vi + vp) : 0)
+                + (cruise_steps ? cruise_steps / vp : 0)
+                + (decel_steps ? 2.0f * decel_steps / (vp + vf) : 0));
+}
+
+void VirtualStepper::start() {
+  if (active) return;
+  planner.synchronize();
+  saved_position = current_position;
+  #if ENABLED(PREVENT_COLD_EXTRUSION)
+    saved_cold_extrude = thermalManager.allow_cold_extrude;
+    thermalManager.allow_cold_extrude = true;
+  #endif
+  vstep = {};
+  vstep.last_us = micros();
+  vstep.start_ms = millis();
+  vstep.seen_head = planner.block_buffer_head;
+  vstep.drained = true;
+  active = true;
+  SERIAL_ECHO_MSG("Virtual stepping started");
+}
+
+void VirtualStepper::consume(const bool all) {
+  static bool busy; // idle() may be called while consuming
+  if (busy) return;
+  busy = true;
+
+  const uint32_t now = micros();
+  vstep.machine_us += now - vstep.last_us;
+  vstep.last_us = now;
+
+  // Blocks planned since the last call arrive now
+  const uint8_t head = planner.block_buffer_head;
+  for (; vstep.seen_head != head; vstep.seen_head = block_inc_mod(vstep.seen_head, 1))
+    vstep.arrival_us[vstep.seen_head] = uint32_t(vstep.machine_us);
+
+  for (;;) {
+    if (!vstep.current) {
+      if (!planner.has_blocks_queued()) break;
+      const uint8_t index = planner.block_buffer_tail;
+      block_t * const b = planner.get_current_block();
+      if (!b) {
+        if (all) continue;                // Held back for merging. Ask again.
+        break;
+      }
+      if (b->is_move()) {
+        const uint64_t arrival = vstep.machine_us - uint32_t(uint32_t(vstep.machine_us) - vstep.arrival_us[index]);
+        if (arrival > vstep.motion_us) {
+          if (!vstep.drained) ++vstep.underruns;
+          vstep.motion_us = arrival;
+        }
+        vstep.motion_us += block_time_us(b);
+        vstep.drained = false;
+        ++vstep.blocks;
+      }
+      vstep.current = b;
+    }
+
+    // Release the block once it would be done, or wait for it if the planner needs the slot
+    const bool wait = all || planner.is_full();
+    if (!wait && vstep.motion_us > vstep.machine_us) break;
+    if (wait) NOLESS(vstep.machine_us, vstep.motion_us);
+    vstep.current = nullptr;
+    planner.release_current_block();
+  }
+
+  if (all) vstep.drained = true;
+
+  busy = false;
+}
+
+void VirtualStepper::dwell(const millis_t ms) {
+  finish();
+  vstep.machine_us += uint64_t(ms) * 1000UL;
+  vstep.motion_us = vstep.machine_us;
+}
+
+bool VirtualStepper::skip_command() {
+  bool skip = false;
+  switch (parser.command_letter) {
+    case 'G': switch (parser.codenum) {
+      case 28: case 29: case 30: case 34: skip = true;
+      default: break;
+    } break;
+    case 'M': switch (parser.codenum) {
+      case 48: case 104: case 109: case 140: case 141: case 190: case 191: case 194: case 303: case 600: skip = true;
+      default: break;
+    } break;
+  }
+  if (skip) ++vstep.skipped;
+  return skip;
+}
+
+void VirtualStepper::stop() {
+  if (!active) return;
+  finish();
+  active = false;
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = saved_cold_extrude);
+  current_position = saved_position;
+  sync_plan_position();
+}
+
+void VirtualStepper::report() {
+  const uint32_t s = uint32_t(_MAX(vstep.motion_us, vstep.machine_us) / 1000000UL);
+  SERIAL_ECHO_START();
+  SERIAL_ECHOPGM("Print time ", s / 3600, "h", s / 60 % 60, "m", s % 60, "s (", s, "s) blocks:", vstep.blocks);
+  SERIAL_ECHOLNPGM(" underruns:", vstep.underruns, " skipped:", vstep.skipped, " run:", (millis() - vstep.start_ms) / 1000UL, "s");
+}
+
+#endif // VIRTUAL_STEPPING
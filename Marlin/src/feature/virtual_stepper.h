@@ -0,0 +1,51 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * virtual_stepper.h - Take planned blocks at simulated time instead of stepping
+ *
+ * With the Stepper ISR left idle, a print runs through the queue, parser and
+ * planner as fast as the CPU allows while the blocks are timed as the stepper
+ * would run them, for a firmware-side estimate of the print time.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class VirtualStepper {
+public:
+  static bool active;                     // Blocks go to the virtual stepper, not the Stepper ISR
+
+  static void start();
+  static void stop();                     // Drop the queued blocks and restore the position
+  static void report();
+
+  static void idle() { if (active) consume(false); }
+  static void finish() { if (active) consume(true); }   // Planner::synchronize()
+  static void dwell(const millis_t ms);                 // G4 waits in simulated time
+  static bool skip_command();             // Heating, homing and probing are skipped
+
+private:
+  static void consume(const bool all);
+};
+
+extern VirtualStepper virtual_stepper;
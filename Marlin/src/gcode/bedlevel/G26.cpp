@@ -781,7 +781,7 @@ void GcodeSuite::G26() {
 
         g26.recover_filament(destination);
 
-        { REMEMBER(fr, feedrate_mm_s, PLANNER_XY_FEEDRATE() * 0.1f);
+        { REMEMBER(fr, feedrate_mm_s, feedRate_t(G26_XY_FEEDRATE)); // Same rate as the lines
           plan_arc(endpoint, arc_offset, false, 0);  // Draw a counter-clockwise arc
           destination = current_position;
         }
@@ -835,7 +835,8 @@ void GcodeSuite::G26() {
       g26.connect_neighbor_with_line(location.pos,  1,  0);
       g26.connect_neighbor_with_line(location.pos,  0, -1);
       g26.connect_neighbor_with_line(location.pos,  0,  1);
-      planner.synchronize();
+      // Keep the planner fed across circles, unless a display is following the progress
+      TERN_(EXTENSIBLE_UI, planner.synchronize());
       TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(location.pos, ExtUI::G26_POINT_FINISH));
       if (TERN0(HAS_MARLINUI_MENU, user_canceled())) goto LEAVE;
     }
@@ -37,6 +37,10 @@
   #include "../../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+  #include "../../module/temperature.h"
+#endif
+
 //#define M420_C_USE_MEAN
 
 /**
@@ -51,6 +55,12 @@
  *   L[index]  Load UBL mesh from index (0 is default)
  *   T[map]    0:Human-readable 1:CSV 2:"LCD" 4:Compact
  *
+ * With BILINEAR_MESH_SLOTS only:
+ *
+ *   W[index]  Save the current mesh to a slot, noting the bed temperature
+ *   L[index]  Load a mesh from a slot
+ *   B[bool]   With BILINEAR_MESH_TEMP_BLEND, blend the slots to follow the bed temperature
+ *
  * With mesh-based leveling only:
  *
  *   C         Center mesh on the mean of the lowest and highest
@@ -136,6 +146,40 @@ void GcodeSuite::M420() {
 
   #endif // AUTO_BED_LEVELING_UBL
 
+  #ifdef BILINEAR_MESH_SLOTS
+
+    // W to save the current mesh to a slot
+    if (parser.seen('W')) {
+      if (!leveling_is_valid()) {
+        SERIAL_ECHOLNPGM("?No mesh to save.");
+        return;
+      }
+      settings.store_mesh(parser.value_int());
+    }
+
+    // L to load a mesh from a slot
+    if (parser.seen('L')) {
+      set_bed_leveling_enabled(false);
+      TERN_(BILINEAR_MESH_TEMP_BLEND, bedlevel.temp_blend = false);
+      settings.load_mesh(parser.value_int());
+    }
+
+    #if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+      // B to follow the bed temperature
+      if (parser.seen('B')) {
+        bedlevel.temp_blend = parser.value_bool();
+        if (bedlevel.temp_blend) {
+          set_bed_leveling_enabled(false);
+          if (!settings.blend_meshes(thermalManager.degBed())) {
+            bedlevel.temp_blend = false;
+            SERIAL_ECHOLNPGM("?No mesh slots to blend.");
+          }
+        }
+      }
+    #endif
+
+  #endif
+
   const bool seenV = parser.seen_test('V');
 
   #if HAS_MESH
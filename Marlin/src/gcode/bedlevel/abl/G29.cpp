@@ -35,7 +35,7 @@
 #include "../../../module/probe.h"
 #include "../../queue.h"
 
-#if ENABLED(AUTO_BED_LEVELING_LINEAR)
+#if EITHER(AUTO_BED_LEVELING_LINEAR, ABL_PARTIAL_PROBING)
   #include "../../../libs/least_squares_fit.h"
 #endif
 
@@ -132,6 +132,42 @@ public:
     #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
       float Z_offset;
       bed_mesh_t z_values;
+
+      #if ENABLED(ABL_PARTIAL_PROBING)
+        bool partial;                       // Probe only the points from partial_lo to partial_hi
+        xy_uint8_t partial_lo, partial_hi;
+        bool in_partial(const uint8_t x, const uint8_t y) const {
+          return WITHIN(x, partial_lo.x, partial_hi.x) && WITHIN(y, partial_lo.y, partial_hi.y);
+        }
+      #endif
+
+      #if ENABLED(ADAPTIVE_PROBING)
+        /**
+         * Predict the measured Z at meshCount from the points probed before it in the
+         * serpentine: the previous point in this row, the one beside it in the last row,
+         * and the diagonal point between, or else the last two points in this row.
+         */
+        float predict_z(const int8_t inInc) const {
+          #if ENABLED(PROBE_Y_FIRST)
+            const int8_t o = meshCount.x, i = meshCount.y, isize = grid_points.y;
+            #define _ZV(O, I) (z_values[O][I] - Z_offset)
+          #else
+            const int8_t o = meshCount.y, i = meshCount.x, isize = grid_points.x;
+            #define _ZV(O, I) (z_values[I][O] - Z_offset)
+          #endif
+          const int8_t b = i - inInc, b2 = b - inInc;
+          const bool has_back = WITHIN(b, 0, isize - 1), has_row = o > 0;
+          float z = NAN;
+          if (has_back && has_row)
+            z = _ZV(o, b) + _ZV(o - 1, i) - _ZV(o - 1, b);
+          else if (has_back)
+            z = WITHIN(b2, 0, isize - 1) ? 2 * _ZV(o, b) - _ZV(o, b2) : _ZV(o, b);
+          else if (has_row)
+            z = _ZV(o - 1, i);
+          #undef _ZV
+          return z;
+        }
+      #endif
     #endif
 
     #if ENABLED(AUTO_BED_LEVELING_LINEAR)
@@ -201,6 +237,9 @@ public:
  *
  *  Z  Supply an additional Z probe offset
  *
+ *  U  With ABL_PARTIAL_PROBING, keep the stored mesh and probe only
+ *     around the area given by L, R, F, B or H (e.g., the job bounds)
+ *
  * Extra parameters with PROBE_MANUALLY:
  *
  *  To do manual probing simply repeat G29 until the procedure is complete.
@@ -420,6 +459,24 @@ G29_TYPE GcodeSuite::G29() {
       abl.gridSpacing.set((abl.probe_position_rb.x - abl.probe_position_lf.x) / (abl.grid_points.x - 1),
                           (abl.probe_position_rb.y - abl.probe_position_lf.y) / (abl.grid_points.y - 1));
 
+      #if ENABLED(ABL_PARTIAL_PROBING)
+        // Keep the stored grid and probe only the points around the given area
+        abl.partial = !abl.dryrun && parser.seen_test('U') && leveling_is_valid();
+        if (abl.partial) {
+          const xy_pos_t &gs = bedlevel.grid_start, &sp = bedlevel.grid_spacing;
+          constexpr xy_pos_t margin = { ABL_PARTIAL_MARGIN, ABL_PARTIAL_MARGIN };
+          const xy_pos_t lf = (abl.probe_position_lf - margin - gs) / sp,
+                         rb = (abl.probe_position_rb + margin - gs) / sp;
+          abl.partial_lo.set(constrain(FLOOR(lf.x), 0, GRID_MAX_POINTS_X - 1), constrain(FLOOR(lf.y), 0, GRID_MAX_POINTS_Y - 1));
+          abl.partial_hi.set(constrain(CEIL(rb.x), 0, GRID_MAX_POINTS_X - 1), constrain(CEIL(rb.y), 0, GRID_MAX_POINTS_Y - 1));
+          abl.probe_position_lf = gs;
+          abl.probe_position_rb = gs + sp * xy_float_t({ GRID_MAX_CELLS_X, GRID_MAX_CELLS_Y });
+          abl.gridSpacing = sp;
+          COPY(abl.z_values, bedlevel.z_values);
+          if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing points X", abl.partial_lo.x, "-", abl.partial_hi.x, " Y", abl.partial_lo.y, "-", abl.partial_hi.y);
+        }
+      #endif
+
     #endif // ABL_USES_GRID
 
     if (abl.verbose_level > 0) {
@@ -698,9 +755,16 @@ G29_TYPE GcodeSuite::G29() {
           // Avoid probing outside the round or hexagonal area
           if (TERN0(IS_KINEMATIC, !probe.can_reach(abl.probePos))) continue;
 
+          // Keep the stored points outside the job area
+          if (TERN0(ABL_PARTIAL_PROBING, abl.partial && !abl.in_partial(abl.meshCount.x, abl.meshCount.y))) continue;
+
           if (abl.verbose_level) SERIAL_ECHOLNPGM("Probing mesh point ", pt_index, "/", abl.abl_points, ".");
           TERN_(HAS_STATUS_MESSAGE, ui.status_printf(0, F(S_FMT " %i/%i"), GET_TEXT(MSG_PROBING_POINT), int(pt_index), int(abl.abl_points)));
 
+          #if BOTH(ADAPTIVE_PROBING, AUTO_BED_LEVELING_BILINEAR)
+            probe.predicted_z = abl.predict_z(inInc);
+          #endif
+
           abl.measured_z = faux ? 0.001f * random(-100, 101) : probe.probe_at_point(abl.probePos, raise_after, abl.verbose_level);
 
           if (isnan(abl.measured_z)) {
@@ -795,6 +859,28 @@ G29_TYPE GcodeSuite::G29() {
       if (abl.dryrun)
         bedlevel.print_leveling_grid(&abl.z_values);
       else {
+        TERN_(BILINEAR_MESH_TEMP_BLEND, bedlevel.temp_blend = false);
+
+        #if ENABLED(ABL_PARTIAL_PROBING)
+          if (abl.partial) {
+            // Fit a plane to the change at the probed points, or just the mean
+            // if they're too few, and shift the stored points by it
+            linear_fit_data lsf;
+            incremental_LSF_reset(&lsf);
+            float change_sum = 0;
+            GRID_LOOP(x, y) if (abl.in_partial(x, y)) {
+              const float dz = abl.z_values[x][y] - bedlevel.z_values[x][y];
+              incremental_LSF(&lsf, x, y, dz);
+              change_sum += dz;
+            }
+            const bool plane = abl.partial_hi.x - abl.partial_lo.x >= 2 && abl.partial_hi.y - abl.partial_lo.y >= 2
+                            && !finish_incremental_LSF(&lsf);
+            const float change_mean = change_sum / lsf.N;
+            GRID_LOOP(x, y) if (!abl.in_partial(x, y))
+              abl.z_values[x][y] += plane ? -(lsf.A * x + lsf.B * y + lsf.D) : change_mean;
+          }
+        #endif
+
         bedlevel.set_grid(abl.gridSpacing, abl.probe_position_lf);
         COPY(bedlevel.z_values, abl.z_values);
         TERN_(IS_KINEMATIC, bedlevel.extrapolate_unprobed_bed_level());
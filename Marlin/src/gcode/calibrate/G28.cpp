@@ -436,14 +436,22 @@ void GcodeSuite::G28() {
     // Diagonal move first if both are homing
     TERN_(QUICK_HOME, if (doX && doY) quick_home_xy());
 
+    // Home X and Y together, each stopping at its own endstop
+    #if ENABLED(PARALLEL_XY_HOMING)
+      const bool home_xy_together = doX && doY;
+      if (home_xy_together) homeaxis_xy();
+    #else
+      constexpr bool home_xy_together = false;
+    #endif
+
     #if HAS_Y_AXIS
       // Home Y (before X)
-      if (ENABLED(HOME_Y_BEFORE_X) && (doY || TERN0(CODEPENDENT_XY_HOMING, doX)))
+      if (ENABLED(HOME_Y_BEFORE_X) && !home_xy_together && (doY || TERN0(CODEPENDENT_XY_HOMING, doX)))
         homeaxis(Y_AXIS);
     #endif
 
     // Home X
-    if (doX || (doY && ENABLED(CODEPENDENT_XY_HOMING) && DISABLED(HOME_Y_BEFORE_X))) {
+    if (!home_xy_together && (doX || (doY && ENABLED(CODEPENDENT_XY_HOMING) && DISABLED(HOME_Y_BEFORE_X)))) {
 
       #if ENABLED(DUAL_X_CARRIAGE)
 
@@ -475,7 +483,7 @@ void GcodeSuite::G28() {
 
     #if HAS_Y_AXIS
       // Home Y (after X)
-      if (DISABLED(HOME_Y_BEFORE_X) && doY)
+      if (DISABLED(HOME_Y_BEFORE_X) && !home_xy_together && doY)
         homeaxis(Y_AXIS);
     #endif
 
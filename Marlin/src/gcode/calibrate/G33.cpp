@@ -354,6 +354,38 @@ static float auto_tune_a(const float dcr) {
   return a_fac;
 }
 
+#if ENABLED(DELTA_CALIBRATION_REUSE_FACTORS)
+
+  /**
+   * The factors move very little with the small radius and angle corrections of
+   * each iteration, so keep them for the geometry they came from. Any change to
+   * the rod length or probe radius, or a larger correction, computes them again.
+   */
+  static void auto_tune_factors(const float dcr, float &h_factor, float &r_factor, float &a_factor) {
+    static struct { bool valid; float dcr, rod, radius; abc_float_t trim; float h, r, a; } cache;
+    auto moved = [](const float a, const float b) { return ABS(a - b) > 0.5f; };
+    if (!cache.valid || cache.dcr != dcr || cache.rod != delta_diagonal_rod
+      || moved(cache.radius, delta_radius)
+      || moved(cache.trim.a, delta_tower_angle_trim.a)
+      || moved(cache.trim.b, delta_tower_angle_trim.b)
+      || moved(cache.trim.c, delta_tower_angle_trim.c)
+    ) {
+      cache.h = auto_tune_h(dcr);
+      cache.r = auto_tune_r(dcr);
+      cache.a = auto_tune_a(dcr);
+      cache.dcr = dcr;
+      cache.rod = delta_diagonal_rod;
+      cache.radius = delta_radius;
+      cache.trim = delta_tower_angle_trim;
+      cache.valid = true;
+    }
+    h_factor = cache.h;
+    r_factor = cache.r;
+    a_factor = cache.a;
+  }
+
+#endif
+
 /**
  * G33 - Delta '1-4-7-point' Auto-Calibration
  *       Calibrate height, z_offset, endstops, delta radius, and tower angles.
@@ -545,9 +577,13 @@ void GcodeSuite::G33() {
 
       // calculate factors
       if (_7p_9_center) dcr *= 0.9f;
-      h_factor = auto_tune_h(dcr);
-      r_factor = auto_tune_r(dcr);
-      a_factor = auto_tune_a(dcr);
+      #if ENABLED(DELTA_CALIBRATION_REUSE_FACTORS)
+        auto_tune_factors(dcr, h_factor, r_factor, a_factor);
+      #else
+        h_factor = auto_tune_h(dcr);
+        r_factor = auto_tune_r(dcr);
+        a_factor = auto_tune_a(dcr);
+      #endif
       if (_7p_9_center) dcr /= 0.9f;
 
       switch (probe_points) {
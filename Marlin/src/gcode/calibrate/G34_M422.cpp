@@ -52,6 +52,11 @@
 #define DEBUG_OUT ENABLED(DEBUG_LEVELING_FEATURE)
 #include "../../core/debug_out.h"
 
+#if ENABLED(Z_STEPPER_ALIGN_LEARN_AMP)
+  // The amplification fitted by the last G34, or 0 before the first
+  static float z_align_learned_amp; // = 0
+#endif
+
 #if NUM_Z_STEPPERS >= 3
   #define TRIPLE_Z 1
   #if NUM_Z_STEPPERS >= 4
@@ -190,6 +195,13 @@ void GcodeSuite::G34() {
             z_maxdiff = 0.0f,
             amplification = z_auto_align_amplification;
 
+      #if ENABLED(Z_STEPPER_ALIGN_LEARN_AMP)
+        // Start from the bed's response found by the last G34
+        if (z_align_learned_amp && !parser.seen('A')) amplification = z_align_learned_amp;
+        // Deviations from the mean, and the moves applied, in the last iteration
+        float z_last_dev[NUM_Z_STEPPERS] = { 0 }, z_last_move[NUM_Z_STEPPERS] = { 0 };
+      #endif
+
       #if !HAS_Z_STEPPER_ALIGN_STEPPER_XY
         bool adjustment_reverse = false;
       #endif
@@ -364,6 +376,32 @@ void GcodeSuite::G34() {
           last_z_align_level_indicator = z_align_level_indicator;
         #endif
 
+        #if ENABLED(Z_STEPPER_ALIGN_LEARN_AMP)
+          // The deviations should fall by (move / amplification). Fit the
+          // actual ratio by least squares and use its inverse from now on.
+          float z_dev_mean = 0.0f;
+          for (uint8_t zstepper = 0; zstepper < NUM_Z_STEPPERS; ++zstepper) z_dev_mean += z_measured[zstepper];
+          z_dev_mean /= NUM_Z_STEPPERS;
+          if (iteration) {
+            float sum_rd = 0.0f, sum_rr = 0.0f;
+            for (uint8_t zstepper = 0; zstepper < NUM_Z_STEPPERS; ++zstepper) {
+              const float r = z_last_move[zstepper];
+              sum_rd += r * (z_last_dev[zstepper] - (z_measured[zstepper] - z_dev_mean));
+              sum_rr += sq(r);
+            }
+            // Keep the last value if nothing moved, or if the fit disagrees with the A limits
+            if (sum_rr > sq(z_auto_align_accuracy)) {
+              const float gain = sum_rd / sum_rr;
+              if (WITHIN(gain, 0.5f, 2.0f)) {
+                amplification = z_align_learned_amp = 1.0f / gain;
+                if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("> Fitted amplification ", amplification);
+              }
+            }
+          }
+          for (uint8_t zstepper = 0; zstepper < NUM_Z_STEPPERS; ++zstepper)
+            z_last_dev[zstepper] = z_measured[zstepper] - z_dev_mean;
+        #endif
+
         // The following correction actions are to be enabled for select Z-steppers only
         stepper.set_separate_multi_axis(true);
 
@@ -375,8 +413,10 @@ void GcodeSuite::G34() {
           const float z_align_abs = ABS(z_align_move);
 
           #if !HAS_Z_STEPPER_ALIGN_STEPPER_XY
-            // Optimize one iteration's correction based on the first measurements
-            if (z_align_abs) amplification = (iteration == 1) ? _MIN(last_z_align_move[zstepper] / z_align_abs, 2.0f) : z_auto_align_amplification;
+            #if DISABLED(Z_STEPPER_ALIGN_LEARN_AMP)
+              // Optimize one iteration's correction based on the first measurements
+              if (z_align_abs) amplification = (iteration == 1) ? _MIN(last_z_align_move[zstepper] / z_align_abs, 2.0f) : z_auto_align_amplification;
+            #endif
 
             // Check for less accuracy compared to last move
             if (decreasing_accuracy(last_z_align_move[zstepper], z_align_abs)) {
@@ -407,10 +447,20 @@ void GcodeSuite::G34() {
             }
           #endif
 
+          TERN_(Z_STEPPER_ALIGN_LEARN_AMP, z_last_move[zstepper] = amplification * z_align_move);
+
           // Do a move to correct part of the misalignment for the current stepper
           do_blocking_move_to_z(amplification * z_align_move + current_position.z);
         } // for (zstepper)
 
+        #if ENABLED(Z_STEPPER_ALIGN_LEARN_AMP)
+          // Only the moves relative to each other change the deviations
+          float z_move_mean = 0.0f;
+          for (uint8_t zstepper = 0; zstepper < NUM_Z_STEPPERS; ++zstepper) z_move_mean += z_last_move[zstepper];
+          z_move_mean /= NUM_Z_STEPPERS;
+          for (uint8_t zstepper = 0; zstepper < NUM_Z_STEPPERS; ++zstepper) z_last_move[zstepper] -= z_move_mean;
+        #endif
+
         // Back to normal stepper operations
         stepper.set_all_z_lock(false);
         stepper.set_separate_multi_axis(false);
@@ -43,7 +43,7 @@
  * M48: Z probe repeatability measurement function.
  *
  * Usage:
- *   M48 <P#> <X#> <Y#> <V#> <E> <L#> <S> <C#>
+ *   M48 <P#> <X#> <Y#> <V#> <E> <L#> <S> <C#> <B>
  *     P = Number of sampled points (4-50, default 10)
  *     X = Sample X position
  *     Y = Sample Y position
@@ -52,6 +52,8 @@
  *     L = Number of legs of movement before probe
  *     S = Schizoid (Or Star if you prefer)
  *     C = Enable probe temperature compensation (0 or 1, default 1)
+ *     B = Batch mode. Keep the probe deployed, raise only Z_CLEARANCE_MULTI_PROBE
+ *         between samples, and report the running statistics after each one.
  *
  * This function requires the machine to be homed before invocation.
  */
@@ -72,7 +74,14 @@ void GcodeSuite::M48() {
     return;
   }
 
-  const ProbePtRaise raise_after = parser.boolval('E') ? PROBE_PT_STOW : PROBE_PT_RAISE;
+  // Batch mode probes in place, so the probe stays out and there are no legs
+  const bool batch = parser.boolval('B');
+  if (batch && (parser.seen('E') || parser.seen('L') || parser.seen('S'))) {
+    SERIAL_ECHOLNPGM("?(B)atch mode can't use E, L, or S.");
+    return;
+  }
+
+  const ProbePtRaise raise_after = batch ? PROBE_PT_NONE : parser.boolval('E') ? PROBE_PT_STOW : PROBE_PT_RAISE;
 
   // Test at the current position by default, overridden by X and Y
   const xy_pos_t test_position = {
@@ -122,7 +131,7 @@ void GcodeSuite::M48() {
         sigma = 0.0,    // Standard deviation of all points so far
         min = 99999.9,  // Smallest value sampled so far
         max = -99999.9, // Largest value sampled so far
-        sample_set[n_samples];  // Storage for sampled values
+        m2 = 0.0;       // Sum of squared differences from the mean so far
 
   auto dev_report = [](const bool verbose, const_float_t mean, const_float_t sigma, const_float_t min, const_float_t max, const bool final=false) {
     if (verbose) {
@@ -143,11 +152,13 @@ void GcodeSuite::M48() {
   const float t = probe.probe_at_point(test_position, raise_after, verbose_level);
   bool probing_good = !isnan(t);
 
+  // In batch mode only lift clear of the bed for the next sample
+  auto batch_raise = [&]{ if (batch) do_blocking_move_to_z(current_position.z + Z_CLEARANCE_MULTI_PROBE, z_probe_fast_mm_s); };
+
   if (probing_good) {
+    batch_raise();
     randomSeed(millis());
 
-    float sample_sum = 0.0;
-
     for (uint8_t n = 0; n < n_samples; ++n) {
       #if HAS_STATUS_MESSAGE
         // Display M48 progress in the status bar
@@ -228,30 +239,25 @@ void GcodeSuite::M48() {
       // Break the loop if the probe fails
       probing_good = !isnan(pz);
       if (!probing_good) break;
-
-      // Store the new sample
-      sample_set[n] = pz;
+      batch_raise();
 
       // Keep track of the largest and smallest samples
       NOMORE(min, pz);
       NOLESS(max, pz);
 
-      // Get the mean value of all samples thus far
-      sample_sum += pz;
-      mean = sample_sum / (n + 1);
-
-      // Calculate the standard deviation so far.
+      // Update the mean and standard deviation so far (Welford's method).
       // The value after the last sample will be the final output.
-      float dev_sum = 0.0;
-      for (uint8_t j = 0; j <= n; ++j) dev_sum += sq(sample_set[j] - mean);
-      sigma = SQRT(dev_sum / (n + 1));
+      const float d = pz - mean;
+      mean += d / (n + 1);
+      m2 += d * (pz - mean);
+      sigma = SQRT(m2 / (n + 1));
 
-      if (verbose_level > 1) {
+      if (verbose_level > 1 || (batch && verbose_level)) {
         SERIAL_ECHO(n + 1);
         SERIAL_ECHOPGM(" of ", n_samples);
         SERIAL_ECHOPAIR_F(": z: ", pz, 3);
         SERIAL_CHAR(' ');
-        dev_report(verbose_level > 2, mean, sigma, min, max);
+        dev_report(verbose_level > 2 || batch, mean, sigma, min, max);
         SERIAL_EOL();
       }
 
@@ -44,13 +44,17 @@
  * With PID_FAN_SCALING:
  *
  *   F[float] Kf term
+ *
+ * With PID_FLOW_FEEDFORWARD:
+ *
+ *   V[float] Kv term (W per mm³/s of queued flow)
  */
 void GcodeSuite::M301() {
   // multi-extruder PID patch: M301 updates or prints a single extruder's PID values
   // default behavior (omitting E parameter) is to update for extruder 0 only
   int8_t e = E_TERN0(parser.byteval('E', -1)); // extruder being updated
 
-  if (!parser.seen("PID" TERN_(PID_EXTRUSION_SCALING, "CL") TERN_(PID_FAN_SCALING, "F")))
+  if (!parser.seen("PID" TERN_(PID_EXTRUSION_SCALING, "CL") TERN_(PID_FAN_SCALING, "F") TERN_(PID_FLOW_FEEDFORWARD, "V")))
     return M301_report(true E_OPTARG(e));
 
   if (e == -1) e = 0;
@@ -71,6 +75,10 @@ void GcodeSuite::M301() {
       if (parser.seenval('F')) SET_HOTEND_PID(Kf, e, parser.value_float());
     #endif
 
+    #if ENABLED(PID_FLOW_FEEDFORWARD)
+      if (parser.seenval('V')) thermalManager.flow_ff[e] = _MAX(parser.value_float(), 0.0f);
+    #endif
+
     thermalManager.updatePID();
   }
   else
@@ -99,6 +107,9 @@ void GcodeSuite::M301_report(const bool forReplay/*=true*/ E_OPTARG(const int8_t
       #if ENABLED(PID_FAN_SCALING)
         SERIAL_ECHOPGM(" F", pid.f());
       #endif
+      #if ENABLED(PID_FLOW_FEEDFORWARD)
+        SERIAL_ECHOPGM(" V", thermalManager.flow_ff[e]);
+      #endif
       SERIAL_EOL();
     }
   }
@@ -108,7 +108,8 @@ void GcodeSuite::M3_M4(const bool is_M4) {
         // With power sync we only set power so it does not effect queued inline power sets
         planner.buffer_sync_block(BLOCK_BIT_LASER_PWR);                                            // Send the flag, queueing inline power
       #else
-        planner.synchronize();
+        // Inline power only goes into moves planned after this
+        IF_DISABLED(LASER_POWER_INLINE_M3, planner.synchronize());
         cutter.inline_power(cutter.power);
       #endif
     #endif
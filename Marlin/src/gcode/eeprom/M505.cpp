@@ -0,0 +1,133 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(EEPROM_IMAGE)
+
+#include "../gcode.h"
+#include "../../module/settings.h"
+#include "../../libs/crc16.h"
+#include "../../libs/hex_print.h"
+
+#define IMAGE_BLOCK_SIZE 32 // Bytes per line, keeping lines under MAX_CMD_SIZE
+
+static bool image_writing; // = false
+
+static int8_t hex_nybble(const char c) {
+  if (WITHIN(c, '0', '9')) return c - '0';
+  if (WITHIN(c, 'A', 'F')) return c - 'A' + 10;
+  if (WITHIN(c, 'a', 'f')) return c - 'a' + 10;
+  return -1;
+}
+
+// Read a hex byte. Return false on a bad digit.
+static bool hex_read_byte(const char * &p, uint8_t &b) {
+  const int8_t h = hex_nybble(p[0]), l = h < 0 ? -1 : hex_nybble(p[1]);
+  if (l < 0) return false;
+  b = (h << 4) | l;
+  p += 2;
+  return true;
+}
+
+static bool hex_read_word(const char * &p, uint16_t &w) {
+  uint8_t h, l;
+  if (!hex_read_byte(p, h) || !hex_read_byte(p, l)) return false;
+  w = (h << 8) | l;
+  return true;
+}
+
+static uint16_t block_crc(const uint16_t addr, const uint8_t * const data, const uint8_t len) {
+  uint16_t crc = 0;
+  crc16(&crc, &addr, sizeof(addr));
+  crc16(&crc, data, len);
+  return crc;
+}
+
+/**
+ * Print the store from the settings to the end as "M505 aaaa:dd..dd:cccc"
+ * lines, with the address, data and a CRC16 of both, then "M505 end".
+ */
+static void export_image() {
+  if (!persistentStore.access_start()) { SERIAL_ERROR_MSG("No EEPROM."); return; }
+  const uint16_t end = persistentStore.capacity();
+  uint8_t data[IMAGE_BLOCK_SIZE];
+  for (uint16_t addr = EEPROM_OFFSET; addr < end; addr += IMAGE_BLOCK_SIZE) {
+    const uint8_t len = _MIN(end - addr, IMAGE_BLOCK_SIZE);
+    int pos = addr;
+    uint16_t dummy_crc = 0;
+    persistentStore.read_data(pos, data, len, &dummy_crc, false);
+    SERIAL_ECHOPGM("M505 ", hex_word(addr), ":");
+    for (uint8_t i = 0; i < len; ++i) SERIAL_ECHO(hex_byte(data[i]));
+    SERIAL_ECHOLNPGM(":", hex_word(block_crc(addr, data, len)));
+    idle_no_sleep();
+  }
+  persistentStore.access_finish();
+  SERIAL_ECHOLNPGM("M505 end");
+}
+
+/**
+ * Write one exported line back to the store. The store is kept open until
+ * "M505 end" so emulated EEPROM is only committed once.
+ */
+static void import_block(const char *p) {
+  uint16_t addr, crc;
+  uint8_t data[IMAGE_BLOCK_SIZE], len = 0;
+  bool ok = hex_read_word(p, addr) && *p++ == ':';
+  while (ok && *p != ':' && len < IMAGE_BLOCK_SIZE) ok = hex_read_byte(p, data[len++]);
+  ok = ok && len && *p++ == ':' && hex_read_word(p, crc);
+  if (!ok || crc != block_crc(addr, data, len) || addr < EEPROM_OFFSET || addr + len > persistentStore.capacity()) {
+    SERIAL_ERROR_MSG("M505 bad block");
+    return;
+  }
+  if (!image_writing) {
+    if (!persistentStore.access_start()) { SERIAL_ERROR_MSG("No EEPROM."); return; }
+    image_writing = true;
+  }
+  int pos = addr;
+  uint16_t dummy_crc = 0;
+  if (persistentStore.write_data(pos, data, len, &dummy_crc))
+    SERIAL_ERROR_MSG("M505 write failed");
+}
+
+/**
+ * M505: Export or import the settings store
+ *
+ *   M505                   Print the store as M505 lines
+ *   M505 aaaa:dd..dd:cccc  Write a block printed by M505
+ *   M505 end               Finish writing and load the new settings
+ *
+ * Sending the output of M505 to a printer with the same firmware gives it the
+ * same settings and meshes. The print counter is not included.
+ */
+void GcodeSuite::M505() {
+  const char * const p = parser.string_arg;
+  if (!p || !*p) return export_image();
+  if (strcasecmp_P(p, PSTR("end"))) return import_block(p);
+  if (image_writing) {
+    persistentStore.access_finish();
+    image_writing = false;
+    (void)settings.load();
+  }
+}
+
+#endif // EEPROM_IMAGE
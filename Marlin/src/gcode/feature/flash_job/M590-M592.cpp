@@ -0,0 +1,57 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(FLASH_JOB_STORAGE)
+
+#include "../../gcode.h"
+#include "../../../feature/flash_job.h"
+
+/**
+ * M590: Store the following lines as the flash job, until M591
+ */
+void GcodeSuite::M590() {
+  if (flash_job.printing)
+    SERIAL_ERROR_MSG("Flash job is printing");
+  else
+    flash_job.begin_write();
+}
+
+/**
+ * M591: Report the flash job. M591 ends a job being written (handled by the queue).
+ */
+void GcodeSuite::M591() { flash_job.report(); }
+
+/**
+ * M592: Print the flash job
+ *
+ *  S0 : Stop printing the flash job
+ */
+void GcodeSuite::M592() {
+  if (parser.seen('S') && !parser.value_bool())
+    flash_job.stop_print();
+  else
+    flash_job.start_print();
+}
+
+#endif // FLASH_JOB_STORAGE
@@ -150,6 +150,17 @@ void GcodeSuite::M600() {
 
   if (pause_print(retract, park_point, true, unload_length DXC_PASS)) {
     if (standardM600) {
+      #if ENABLED(ADVANCED_PAUSE_NONBLOCKING)
+        // Wait, reload, and resume from the main loop
+        filament_change.start(
+          FILAMENT_CHANGE_SLOW_LOAD_LENGTH,
+          ABS(parser.axisunitsval('L', E_AXIS, fc_settings[active_extruder].load_length)),
+          ADVANCED_PAUSE_PURGE_LENGTH,
+          beep_count,
+          parser.celsiusval('R')
+        );
+        return;
+      #endif
       wait_for_confirmation(true, beep_count DXC_PASS);
       resume_print(
         FILAMENT_CHANGE_SLOW_LOAD_LENGTH,
@@ -35,9 +35,13 @@
  *  I[bool] - Set Display of current on the LCD
  *  V[bool] - Set Display of voltage on the LCD
  *  W[bool] - Set Display of power on the LCD
+ *  R       - Reset the energy total (Requires POWER_MONITOR_ENERGY)
  */
 void GcodeSuite::M430() {
   bool do_report = true;
+  #if ENABLED(POWER_MONITOR_ENERGY)
+    if (parser.seen_test('R')) { power_monitor.reset_energy(); do_report = false; }
+  #endif
   #if HAS_WIRED_LCD
     #if ENABLED(POWER_MONITOR_CURRENT)
       if (parser.seen('I')) { power_monitor.set_current_display(parser.value_bool()); do_report = false; }
@@ -61,6 +65,9 @@ void GcodeSuite::M430() {
       #if HAS_POWER_MONITOR_WATTS
         "  Power: ", power_monitor.getPower(), "W"
       #endif
+      #if ENABLED(POWER_MONITOR_ENERGY)
+        "  Energy: ", power_monitor.getWattHours(), "Wh"
+      #endif
     );
   }
 }
@@ -0,0 +1,61 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(SETTINGS_PROFILES)
+
+#include "../../gcode.h"
+#include "../../../feature/settings_profiles.h"
+
+/**
+ * M824: Settings profiles
+ *
+ *  S<index> : Apply a stored profile
+ *  W<index> : Store the current settings as a profile
+ *
+ * With no parameters report all profiles.
+ * A profile holds the M201, M204 P R T, M205 and M900 K settings, the hotend
+ * PID (M301) and the probe Z offset (M851 Z). Use M500 to save the profiles.
+ */
+void GcodeSuite::M824() {
+  auto bad_index = [](const char ltr) {
+    SERIAL_ECHOLNPGM("?", C(ltr), " out of range (0..", SETTINGS_PROFILE_COUNT - 1, ").");
+  };
+
+  if (parser.seen('W')) {
+    const uint8_t p = parser.value_byte();
+    if (p >= SETTINGS_PROFILE_COUNT) return bad_index('W');
+    settings_profiles.store(p);
+  }
+
+  if (parser.seen('S')) {
+    const uint8_t p = parser.value_byte();
+    if (p >= SETTINGS_PROFILE_COUNT) return bad_index('S');
+    settings_profiles.apply(p);
+  }
+
+  if (!parser.seen("SW"))
+    for (uint8_t p = 0; p < SETTINGS_PROFILE_COUNT; ++p) settings_profiles.report(p);
+}
+
+#endif // SETTINGS_PROFILES
@@ -53,6 +53,10 @@ GcodeSuite gcode;
   #include "../feature/cancel_object.h"
 #endif
 
+#if ENABLED(SEGMENT_COALESCING)
+  #include "../feature/coalesce.h"
+#endif
+
 #if ENABLED(LASER_FEATURE)
   #include "../feature/spindle_laser.h"
 #endif
@@ -69,6 +73,22 @@ GcodeSuite gcode;
   #include "../feature/fancheck.h"
 #endif
 
+#if ENABLED(LINK_BENCHMARK)
+  #include "../feature/link_benchmark.h"
+#endif
+
+#if ENABLED(VIRTUAL_STEPPING)
+  #include "../feature/virtual_stepper.h"
+#endif
+
+#if ENABLED(CRASH_TRACE)
+  #include "../feature/crash_trace.h"
+#endif
+
+#if ENABLED(COMMAND_LATENCY)
+  #include "../feature/command_latency.h"
+#endif
+
 #include "../MarlinCore.h" // for idle, kill
 
 // Inactivity shutdown
@@ -251,10 +271,55 @@ void GcodeSuite::get_destination_from_command() {
   #endif // LASER_FEATURE
 }
 
+#if ENABLED(PREPARSED_MOVES)
+
+  /**
+   * Set XYZE destination and feedrate from a move parsed when it was queued.
+   * The same as get_destination_from_command for a plain G0/G1.
+   */
+  void GcodeSuite::get_destination_from_move(const GCodeQueue::MoveRecord &move) {
+    #if ENABLED(CANCEL_OBJECTS)
+      const bool &skip_move = cancelable.skipping;
+    #else
+      constexpr bool skip_move = false;
+    #endif
+
+    LOOP_NUM_AXES(i) {
+      if (TEST(move.seen, i) && !skip_move) {
+        const float v = parser.axis_value_to_mm(AxisEnum(i), move.value[i]);
+        destination[i] = axis_is_relative(AxisEnum(i)) ? current_position[i] + v : LOGICAL_TO_NATIVE(v, i);
+      }
+      else
+        destination[i] = current_position[i];
+    }
+
+    #if HAS_EXTRUDERS
+      if (TEST(move.seen, move.E_BIT)) {
+        const float v = parser.axis_value_to_mm(E_AXIS, move.value[move.E_BIT]);
+        destination.e = axis_is_relative(E_AXIS) ? current_position.e + v : v;
+      }
+      else
+        destination.e = current_position.e;
+    #endif
+
+    if (TEST(move.seen, move.F_BIT) && move.value[move.F_BIT] > 0)
+      feedrate_mm_s = MMM_TO_MMS(parser.linear_value_to_mm(move.value[move.F_BIT]));
+
+    #if ALL(PRINTCOUNTER, HAS_EXTRUDERS)
+      if (!DEBUGGING(DRYRUN) && !skip_move)
+        print_job_timer.incFilamentUsed(destination.e - current_position.e);
+    #endif
+  }
+
+#endif // PREPARSED_MOVES
+
 /**
  * Dwell waits immediately. It does not synchronize. Use M400 instead of G4
  */
 void GcodeSuite::dwell(millis_t time) {
+  #if ENABLED(VIRTUAL_STEPPING)
+    if (VirtualStepper::active) return virtual_stepper.dwell(time);
+  #endif
   time += millis();
   while (PENDING(millis(), time)) idle();
 }
@@ -326,6 +391,8 @@ void GcodeSuite::dwell(millis_t time) {
 void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
   TERN_(HAS_FANCHECK, fan_check.check_deferred_error());
 
+  TERN_(CRASH_TRACE, crash_trace.record(parser.command_letter, parser.codenum));
+
   KEEPALIVE_STATE(IN_HANDLER);
 
  /**
@@ -347,6 +414,19 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
     }
   #endif
 
+  // Virtual stepping has no heaters, endstops or probe to wait for
+  #if ENABLED(VIRTUAL_STEPPING)
+    if (VirtualStepper::active && VirtualStepper::skip_command()) {
+      if (!no_ok) queue.ok_to_send();
+      return;
+    }
+  #endif
+
+  // Plan held G0/G1 moves before any other command
+  #if ENABLED(SEGMENT_COALESCING)
+    if (!parser.is_command('G', 0) && !parser.is_command('G', 1)) coalescer.flush();
+  #endif
+
   // Handle a known command or reply "unknown command"
 
   switch (parser.command_letter) {
@@ -600,9 +680,7 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 108: M108(); break;                                  // M108: Cancel Waiting
         case 112: M112(); break;                                  // M112: Full Shutdown
         case 410: M410(); break;                                  // M410: Quickstop - Abort all the planned moves.
-        #if ENABLED(HOST_PROMPT_SUPPORT)
-          case 876: M876(); break;                                // M876: Handle Host prompt responses
-        #endif
+        TERN_(HOST_PROMPT_SUPPORT, case 876: break;)              // M876: Handled by GCodeQueue as it arrives
       #else
         case 108: case 112: case 410:
         TERN_(HOST_PROMPT_SUPPORT, case 876:)
@@ -636,6 +714,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 193: M193(); break;                                  // M193: Wait for cooler temperature to reach target
       #endif
 
+      #if ENABLED(PARALLEL_PREHEAT)
+        case 194: M194(); break;                                  // M194: Heat hotend and bed together
+      #endif
+
       #if ENABLED(AUTO_REPORT_POSITION)
         case 154: M154(); break;                                  // M154: Set position auto-report interval
       #endif
@@ -905,6 +987,9 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
       #if ENABLED(EEPROM_SETTINGS)
         case 504: M504(); break;                                  // M504: Validate EEPROM contents
       #endif
+      #if ENABLED(EEPROM_IMAGE)
+        case 505: M505(); break;                                  // M505: Export / import the settings store
+      #endif
 
       #if ENABLED(PASSWORD_FEATURE)
         case 510: M510(); break;                                  // M510: Lock Printer
@@ -934,10 +1019,72 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if ENABLED(PLANNER_TELEMETRY)
+        case 577: M577(); break;                                  // M577: Report planner telemetry
+      #endif
+
+      #if ENABLED(ISR_PROFILER)
+        case 578: M578(); break;                                  // M578: Report ISR profile
+      #endif
+
+      #if ENABLED(ADAPTIVE_MULTISTEPPING)
+        case 579: M579(); break;                                  // M579: Report multistepping
+      #endif
+
+      #if ENABLED(BINARY_MOTION)
+        case 580: M580(); break;                                  // M580: Binary motion frames
+      #endif
+
+      #if ENABLED(SERIAL_LINK_STATS)
+        case 581: M581(); break;                                  // M581: Report serial link statistics
+      #endif
+
+      #if ENABLED(TEMP_HISTORY)
+        case 582: M582(); break;                                  // M582: Dump temperature history
+      #endif
+
+      #if ENABLED(IDLE_PROFILER)
+        case 583: M583(); break;                                  // M583: Report idle task profile
+      #endif
+
+      #if ENABLED(STACK_MONITOR)
+        case 584: M584(); break;                                  // M584: Report stack usage
+      #endif
+
+      #if ENABLED(LINK_BENCHMARK)
+        case 585: M585(); break;                                  // M585: Serial link benchmark
+      #endif
+
+      #if ENABLED(VIRTUAL_STEPPING)
+        case 586: M586(); break;                                  // M586: Virtual stepping
+      #endif
+
+      #if ENABLED(STEP_CAPTURE)
+        case 587: M587(); break;                                  // M587: Step timing capture
+      #endif
+
+      #if ENABLED(COMMAND_LATENCY)
+        case 588: M588(); break;                                  // M588: Command latency histogram
+      #endif
+
+      #if ENABLED(BUFFER_OCCUPANCY_REPORT)
+        case 589: M589(); break;                                  // M589: Buffer occupancy report
+      #endif
+
+      #if ENABLED(FLASH_JOB_STORAGE)
+        case 590: M590(); break;                                  // M590: Store a flash job
+        case 591: M591(); break;                                  // M591: Report the flash job
+        case 592: M592(); break;                                  // M592: Print the flash job
+      #endif
+
       #if HAS_ZV_SHAPING
         case 593: M593(); break;                                  // M593: Set Input Shaping parameters
       #endif
 
+      #if ENABLED(FLEET_TELEMETRY)
+        case 594: M594(); break;                                  // M594: Fleet telemetry frame
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
@@ -974,6 +1121,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         M810_819(); break;                                        // M810-M819: Define/execute G-code macro
       #endif
 
+      #if ENABLED(SETTINGS_PROFILES)
+        case 824: M824(); break;                                  // M824: Settings profiles
+      #endif
+
       #if HAS_BED_PROBE
         case 851: M851(); break;                                  // M851: Set Z Probe Z Offset
       #endif
@@ -1153,10 +1304,61 @@ void GcodeSuite::process_next_command() {
   }
 
   // Parse the next command in the queue
+  TERN_(LINK_BENCHMARK, const uint32_t parse_us = micros());
   parser.parse(command.buffer);
-  process_parsed_command();
+  TERN_(LINK_BENCHMARK, link_benchmark.parsed(parse_us));
+
+  #if ANY(LINK_BENCHMARK, COMMAND_LATENCY)
+    // Subcommands may parse over the command, so keep what it was
+    const char letter = parser.command_letter;
+    const uint16_t codenum = parser.codenum;
+    const uint32_t run_us = micros();
+    process_parsed_command();
+    TERN_(LINK_BENCHMARK, if (letter == 'G' && codenum <= 1) link_benchmark.moved(run_us));
+    TERN_(COMMAND_LATENCY, command_latency.record(letter, codenum, micros() - run_us));
+  #else
+    process_parsed_command();
+  #endif
 }
 
+#if ENABLED(PREPARSED_MOVES)
+
+  /**
+   * Run the next parsed move from the queue, skipping the parser
+   */
+  void GcodeSuite::process_next_move() {
+    const GCodeQueue::MoveRecord &move = queue.ring_buffer.peek_next_move();
+
+    PORT_REDIRECT(SERIAL_PORTMASK(move.port));
+
+    TERN_(HAS_FANCHECK, fan_check.check_deferred_error());
+
+    TERN_(CRASH_TRACE, crash_trace.record('G', move.codenum));
+
+    KEEPALIVE_STATE(IN_HANDLER);
+
+    // Bare X Y Z lines that follow get the motion mode, as from GCodeParser::parse
+    #if ENABLED(GCODE_MOTION_MODES)
+      parser.motion_mode_codenum = move.codenum;
+      TERN_(USE_GCODE_SUBCODES, parser.motion_mode_subcode = 0);
+    #endif
+
+    #if ANY(LINK_BENCHMARK, COMMAND_LATENCY)
+      const uint32_t run_us = micros();
+      G0_G1(move);
+      TERN_(LINK_BENCHMARK, link_benchmark.moved(run_us));
+      TERN_(COMMAND_LATENCY, command_latency.record('G', move.codenum, micros() - run_us));
+    #else
+      G0_G1(move);
+    #endif
+
+    queue.ring_buffer.ok_to_send(move);
+
+    SERIAL_IMPL.msgDone(); // Call the msgDone serial hook to signal command processing done
+  }
+
+#endif
+
 #pragma GCC diagnostic push
 #if GCC_VERSION >= 80000
   #pragma GCC diagnostic ignored "-Wstringop-truncation"
@@ -1210,7 +1412,7 @@ void GcodeSuite::process_subcommands_now(char * gcode) {
     static millis_t next_busy_signal_ms = 0;
     if (!autoreport_paused && host_keepalive_interval && busy_state != NOT_BUSY) {
       if (PENDING(ms, next_busy_signal_ms)) return;
-      PORT_REDIRECT(SerialMask::All);
+      PORT_REDIRECT(SERIAL_NOTICE_PORTS);
       switch (busy_state) {
         case IN_HANDLER:
         case IN_PROCESS:
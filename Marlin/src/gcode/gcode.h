@@ -173,7 +173,7 @@
  * M149 - Set temperature units. (Requires TEMPERATURE_UNITS_SUPPORT)
  * M150 - Set Status LED Color as R<red> U<green> B<blue> W<white> P<bright>. Values 0-255. (Requires BLINKM, RGB_LED, RGBW_LED, NEOPIXEL_LED, PCA9533, or PCA9632).
  * M154 - Auto-report position with interval of S<seconds>. (Requires AUTO_REPORT_POSITION)
- * M155 - Auto-report temperatures with interval of S<seconds>. (Requires AUTO_REPORT_TEMPERATURES)
+ * M155 - Auto-report temperatures with interval of S<seconds>. Only on a change of D<degrees> with AUTO_REPORT_TEMP_CHANGES. (Requires AUTO_REPORT_TEMPERATURES)
  * M163 - Set a single proportion for a mixing extruder. (Requires MIXING_EXTRUDER)
  * M164 - Commit the mix and save to a virtual tool (current, or as specified by 'S'). (Requires MIXING_EXTRUDER)
  * M165 - Set the mix for the mixing extruder (and current virtual tool) with parameters ABCDHI. (Requires MIXING_EXTRUDER and DIRECT_MIXING_IN_G1)
@@ -181,6 +181,7 @@
  * M190 - Set bed target temperature and wait. R<temp> Set target temperature and wait. S<temp> Set, but only wait when heating. (Requires TEMP_SENSOR_BED)
  * M192 - Wait for probe to reach target temperature. (Requires TEMP_SENSOR_PROBE)
  * M193 - R<temp> Wait for cooler to reach target temp. ** Wait for cooling. **
+ * M194 - Heat hotend S<temp> and bed B<temp> together so both reach their targets at once. (Requires PARALLEL_PREHEAT)
  * M200 - Set filament diameter, D<diameter>, setting E axis units to cubic. (Use S0 to revert to linear units.)
  * M201 - Set max acceleration in units/s^2 for print moves: "M201 X<accel> Y<accel> Z<accel> E<accel>"
  * M202 - Set max acceleration in units/s^2 for travel moves: "M202 X<accel> Y<accel> Z<accel> E<accel>" ** UNUSED IN MARLIN! **
@@ -249,6 +250,7 @@
  * M502 - Revert to the default "factory settings". ** Does not write them to EEPROM! **
  * M503 - Print the current settings (in memory): "M503 S<verbose>". S0 specifies compact output.
  * M504 - Validate EEPROM contents. (Requires EEPROM_SETTINGS)
+ * M505 - Export or import the raw settings store. (Requires EEPROM_IMAGE)
  * M510 - Lock Printer (Requires PASSWORD_FEATURE)
  * M511 - Unlock Printer (Requires PASSWORD_UNLOCK_GCODE)
  * M512 - Set/Change/Remove Password (Requires PASSWORD_CHANGE_GCODE)
@@ -259,7 +261,24 @@
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
  * M575 - Change the serial baud rate. (Requires BAUD_RATE_GCODE)
+ * M577 - Report planner block timing and underruns. (Requires PLANNER_TELEMETRY)
+ * M578 - Report ISR cycle counts. (Requires ISR_PROFILER)
+ * M579 - Report step events per multistepping factor. (Requires ADAPTIVE_MULTISTEPPING)
+ * M580 - Switch the host port to binary motion frames. (Requires BINARY_MOTION)
+ * M581 - Report serial link statistics. S<seconds> to auto-report. (Requires SERIAL_LINK_STATS)
+ * M582 - Dump the temperature history as CSV, or B for hex. R to clear. (Requires TEMP_HISTORY)
+ * M583 - Report the time spent in each idle() and loop() task. S<seconds> to auto-report. (Requires IDLE_PROFILER)
+ * M584 - Report the stack high-water mark, idle() depth and ISR nesting. R to reset. (Requires STACK_MONITOR)
+ * M585 - Serial link benchmark. S1 to start, S0 to stop and report. (Requires LINK_BENCHMARK)
+ * M586 - Virtual stepping print time estimate. S1 to start, S0 to stop and report. (Requires VIRTUAL_STEPPING)
+ * M587 - Capture the STEP timing of an axis during a test move. (Requires STEP_CAPTURE)
+ * M588 - Report the command latency histogram. R to reset. (Requires COMMAND_LATENCY)
+ * M589 - Report planner and command queue occupancy. S<seconds> to auto-report. (Requires BUFFER_OCCUPANCY_REPORT)
+ * M590 - Store the following lines in SPI flash as the flash job, until M591. (Requires FLASH_JOB_STORAGE)
+ * M591 - Report the flash job. (Requires FLASH_JOB_STORAGE)
+ * M592 - Print the flash job. S0 to stop. (Requires FLASH_JOB_STORAGE)
  * M593 - Get or set input shaping parameters. (Requires INPUT_SHAPING_[XY])
+ * M594 - Send a binary fleet telemetry frame. S<seconds> to auto-report. (Requires FLEET_TELEMETRY)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -272,6 +291,7 @@
  * M702 - Unload filament (Requires FILAMENT_LOAD_UNLOAD_GCODES)
  * M808 - Set or Goto a Repeat Marker (Requires GCODE_REPEAT_MARKERS)
  * M810-M819 - Define/execute a G-code macro (Requires GCODE_MACROS)
+ * M824 - Apply with S<index>, store with W<index>, or report settings profiles. (Requires SETTINGS_PROFILES)
  * M851 - Set Z probe's XYZ offsets in current units. (Negative values: X=left, Y=front, Z=below)
  * M852 - Set skew factors: "M852 [I<xy>] [J<xz>] [K<yz>]". (Requires SKEW_CORRECTION_GCODE, plus SKEW_CORRECTION_FOR_Z for IJ)
  *
@@ -288,7 +308,7 @@
  * M869 - Report position encoder module error.
  *
  * M871 - Print/reset/clear first layer temperature offset values. (Requires PTC_PROBE, PTC_BED, or PTC_HOTEND)
- * M876 - Handle Prompt Response. (Requires HOST_PROMPT_SUPPORT and not EMERGENCY_PARSER)
+ * M876 - Handle Prompt Response. Handled as soon as the line is read. (Requires HOST_PROMPT_SUPPORT)
  * M900 - Get or Set Linear Advance K-factor. (Requires LIN_ADVANCE)
  * M906 - Set or get motor current in milliamps using axis codes XYZE, etc. Report values if no axis codes given. (Requires at least one _DRIVER_TYPE defined as TMC2130/2160/5130/5160/2208/2209/2660)
  * M907 - Set digital trimpot motor current using axis codes. (Requires a board with digital trimpots)
@@ -332,6 +352,10 @@
 #include "../inc/MarlinConfig.h"
 #include "parser.h"
 
+#if ENABLED(PREPARSED_MOVES)
+  #include "queue.h"
+#endif
+
 #if ENABLED(I2C_POSITION_ENCODERS)
   #include "../feature/encoder_i2c.h"
 #endif
@@ -434,6 +458,11 @@ public:
   static void process_parsed_command(const bool no_ok=false);
   static void process_next_command();
 
+  #if ENABLED(PREPARSED_MOVES)
+    static void get_destination_from_move(const GCodeQueue::MoveRecord &move);
+    static void process_next_move();
+  #endif
+
   // Execute G-code in-place, preserving current G-code parameters
   static void process_subcommands_now(FSTR_P fgcode);
   static void process_subcommands_now(char * gcode);
@@ -489,6 +518,9 @@ private:
   #endif
 
   static void G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move=false));
+  #if ENABLED(PREPARSED_MOVES)
+    static void G0_G1(const GCodeQueue::MoveRecord &move);
+  #endif
 
   #if ENABLED(ARC_SUPPORT)
     static void G2_G3(const bool clockwise);
@@ -737,9 +769,6 @@ private:
     static void M108();
     static void M112();
     static void M410();
-    #if ENABLED(HOST_PROMPT_SUPPORT)
-      static void M876();
-    #endif
   #endif
 
   static void M110();
@@ -800,6 +829,10 @@ private:
     static void M193();
   #endif
 
+  #if ENABLED(PARALLEL_PREHEAT)
+    static void M194();
+  #endif
+
   #if HAS_PREHEAT
     static void M145();
     static void M145_report(const bool forReplay=true);
@@ -1051,6 +1084,9 @@ private:
   #if ENABLED(EEPROM_SETTINGS)
     static void M504();
   #endif
+  #if ENABLED(EEPROM_IMAGE)
+    static void M505();
+  #endif
 
   #if ENABLED(PASSWORD_FEATURE)
     static void M510();
@@ -1088,11 +1124,73 @@ private:
     static void M575();
   #endif
 
+  #if ENABLED(PLANNER_TELEMETRY)
+    static void M577();
+  #endif
+
+  #if ENABLED(ISR_PROFILER)
+    static void M578();
+  #endif
+
+  #if ENABLED(ADAPTIVE_MULTISTEPPING)
+    static void M579();
+  #endif
+
+  #if ENABLED(BINARY_MOTION)
+    static void M580();
+  #endif
+
+  #if ENABLED(SERIAL_LINK_STATS)
+    static void M581();
+  #endif
+
+  #if ENABLED(TEMP_HISTORY)
+    static void M582();
+  #endif
+
+  #if ENABLED(IDLE_PROFILER)
+    static void M583();
+  #endif
+
+  #if ENABLED(STACK_MONITOR)
+    static void M584();
+  #endif
+
+  #if ENABLED(LINK_BENCHMARK)
+    static void M585();
+  #endif
+
+  #if ENABLED(VIRTUAL_STEPPING)
+    static void M586();
+  #endif
+
+  #if ENABLED(STEP_CAPTURE)
+    static void M587();
+  #endif
+
+  #if ENABLED(COMMAND_LATENCY)
+    static void M588();
+  #endif
+
+  #if ENABLED(BUFFER_OCCUPANCY_REPORT)
+    static void M589();
+  #endif
+
+  #if ENABLED(FLASH_JOB_STORAGE)
+    static void M590();
+    static void M591();
+    static void M592();
+  #endif
+
   #if HAS_ZV_SHAPING
     static void M593();
     static void M593_report(const bool forReplay=true);
   #endif
 
+  #if ENABLED(FLEET_TELEMETRY)
+    static void M594();
+  #endif
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
@@ -1130,6 +1228,10 @@ private:
     static void M810_819();
   #endif
 
+  #if ENABLED(SETTINGS_PROFILES)
+    static void M824();
+  #endif
+
   #if HAS_BED_PROBE
     static void M851();
     static void M851_report(const bool forReplay=true);
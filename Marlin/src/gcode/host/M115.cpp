@@ -108,6 +108,12 @@ void GcodeSuite::M115() {
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(F("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER)); // TODO: Use SERIAL_IMPL.has_feature(port, SerialFeature::BinaryFileTransfer) once implemented
 
+    // BINARY_MOTION (M580 S1)
+    cap_line(F("BINARY_MOTION"), ENABLED(BINARY_MOTION));
+
+    // FLEET_TELEMETRY (M594)
+    cap_line(F("FLEET_TELEMETRY"), ENABLED(FLEET_TELEMETRY));
+
     // EEPROM (M500, M501)
     cap_line(F("EEPROM"), ENABLED(EEPROM_SETTINGS));
 
@@ -0,0 +1,45 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(PLANNER_TELEMETRY)
+
+#include "../gcode.h"
+#include "../../module/planner.h"
+#include "../../module/stepper.h"
+
+/**
+ * M577: Report planner block timing and underrun counters
+ *
+ *  R : Reset the telemetry after reporting
+ */
+void GcodeSuite::M577() {
+  planner.report_telemetry();
+  if (parser.seen_test('R')) {
+    const bool was_enabled = stepper.suspend();
+    planner.telemetry.reset();
+    if (was_enabled) stepper.wake_up();
+  }
+}
+
+#endif // PLANNER_TELEMETRY
@@ -0,0 +1,40 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(ADAPTIVE_MULTISTEPPING)
+
+#include "../gcode.h"
+#include "../../module/stepper.h"
+
+/**
+ * M579: Report the adaptive multistepping limit and the step events done at each factor
+ *
+ *  R : Reset the counters and limits after reporting
+ */
+void GcodeSuite::M579() {
+  stepper.report_multistepping();
+  if (parser.seen_test('R')) stepper.reset_multistepping();
+}
+
+#endif // ADAPTIVE_MULTISTEPPING
@@ -0,0 +1,50 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2021 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(BINARY_MOTION)
+
+#include "../gcode.h"
+#include "../queue.h"
+#include "../../feature/binary_motion.h"
+
+/**
+ * M580: Switch the host port to binary motion frames
+ *
+ *  S1 : Expect frames after the "ok" for this command (see feature/binary_motion.h)
+ *
+ * Without S, report the frame window in bytes.
+ */
+void GcodeSuite::M580() {
+  SERIAL_ECHOLNPGM("BINARY_MOTION WINDOW:", BINARY_MOTION_WINDOW, " ACK:", BINARY_MOTION_ACK_FRAMES);
+  if (parser.seenval('S') && parser.value_bool() && !binary_motion.active) {
+    const serial_index_t port = queue.ring_buffer.command_port();
+    if (port.valid())
+      binary_motion.start(port);
+    else
+      SERIAL_ERROR_MSG("M580 S1 must come from a serial port");
+  }
+}
+
+#endif // BINARY_MOTION
@@ -0,0 +1,42 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(IDLE_PROFILER)
+
+#include "../gcode.h"
+#include "../../feature/idle_profiler.h"
+
+/**
+ * M583: Report the time spent in each idle() and loop() task and start a new interval
+ *
+ *  S<seconds> : Set the auto-report interval. 0 to disable.
+ */
+void GcodeSuite::M583() {
+  if (parser.seenval('S'))
+    idle_profiler.auto_reporter.set_interval(parser.value_byte());
+  else
+    idle_profiler.report();
+}
+
+#endif // IDLE_PROFILER
@@ -0,0 +1,51 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(LINK_BENCHMARK)
+
+#include "../gcode.h"
+#include "../../feature/link_benchmark.h"
+
+/**
+ * M585: Serial link throughput benchmark
+ *
+ *  S1 : Start. Planned moves are discarded, so nothing moves.
+ *  S0 : Stop, report and restore the position from before S1.
+ *
+ * Without 'S' report the results so far.
+ */
+void GcodeSuite::M585() {
+  if (parser.seenval('S')) {
+    if (parser.value_bool())
+      link_benchmark.start();
+    else {
+      link_benchmark.stop();
+      link_benchmark.report();
+    }
+  }
+  else
+    link_benchmark.report();
+}
+
+#endif // LINK_BENCHMARK
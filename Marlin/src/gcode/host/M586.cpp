@@ -0,0 +1,51 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfigPre.h"
+
+#if ENABLED(VIRTUAL_STEPPING)
+
+#include "../gcode.h"
+#include "../../feature/virtual_stepper.h"
+
+/**
+ * M586: Virtual stepping print time estimate
+ *
+ *  S1 : Start. Planned moves are timed by a virtual stepper, so nothing moves.
+ *  S0 : Stop, report and restore the position from before S1.
+ *
+ * Without 'S' report the estimate so far.
+ */
+void GcodeSuite::M586() {
+  if (parser.seenval('S')) {
+    if (parser.value_bool())
+      virtual_stepper.start();
+    else {
+      virtual_stepper.stop();
+      virtual_stepper.report();
+    }
+  }
+  else
+    virtual_stepper.report();
+}
+
+#endif // VIRTUAL_STEPPING
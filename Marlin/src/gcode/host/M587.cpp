@@ -0,0 +1,54 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(STEP_CAPTURE)
+
+#include "../gcode.h"
+#include "../../feature/step_capture.h"
+#include "../../module/motion.h"
+
+/**
+ * M587: Capture the STEP timing of one axis during a test move
+ *
+ *  X|Y|Z<distance> : The axis to move and the relative distance in current units
+ *  F<feedrate>     : Feedrate in current units. Default is the current feedrate.
+ *
+ * The STEP pin of the axis must be wired to the input capture pin of
+ * STEP_CAPTURE_TIMER. Reports the edge count and the cruise intervals
+ * against the planned step rate.
+ */
+void GcodeSuite::M587() {
+  if (homing_needed_error()) return;
+
+  const feedRate_t fr_mm_s = parser.seenval('F') ? parser.value_feedrate() : feedrate_mm_s;
+  LOOP_NUM_AXES(i) {
+    if (parser.seenval(AXIS_CHAR(i))) {
+      step_capture.run(AxisEnum(i), parser.value_axis_units(AxisEnum(i)), fr_mm_s);
+      return;
+    }
+  }
+  SERIAL_ECHO_MSG("?Axis and distance required.");
+}
+
+#endif // STEP_CAPTURE
@@ -83,6 +83,9 @@ void GcodeSuite::M73() {
       #if ENABLED(SET_REMAINING_TIME)
         SERIAL_ECHOPGM(" Time left: ", ui.remaining_time / 60, "m;");
       #endif
+      #if ENABLED(ESTIMATE_REMAINING_TIME)
+        SERIAL_ECHOPGM(" Estimate: ", print_estimator.remaining() / 60, "m;");
+      #endif
       #if ENABLED(SET_INTERACTION_TIME)
         SERIAL_ECHOPGM(" Change: ", ui.interaction_time / 60, "m;");
       #endif
@@ -31,6 +31,10 @@
 
 #include "../../sd/cardreader.h"
 
+#if ENABLED(SEGMENT_COALESCING)
+  #include "../../feature/coalesce.h"
+#endif
+
 #if ENABLED(NANODLP_Z_SYNC)
   #include "../../module/planner.h"
 #endif
@@ -97,6 +101,7 @@ void GcodeSuite::G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move/*=false*/)) {
           const float echange = destination.e - current_position.e;
           // Is this a retract or recover move?
           if (WITHIN(ABS(echange), MIN_AUTORETRACT, MAX_AUTORETRACT) && fwretract.retracted[active_extruder] == (echange > 0.0)) {
+            TERN_(SEGMENT_COALESCING, coalescer.flush()); // Plan held moves before the retract
             current_position.e = destination.e;       // Hide a G1-based retract/recover from calculations
             sync_plan_position_e();                   // AND from the planner
             return fwretract.retract(echange < 0.0);  // Firmware-based retract/recover (double-retract ignored)
@@ -108,6 +113,8 @@ void GcodeSuite::G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move/*=false*/)) {
 
     #if IS_SCARA
       fast_move ? prepare_fast_move_to_destination() : prepare_line_to_destination();
+    #elif ENABLED(SEGMENT_COALESCING)
+      coalescer.prepare_line_to_destination();
     #else
       prepare_line_to_destination();
     #endif
@@ -133,3 +140,23 @@ void GcodeSuite::G0_G1(TERN_(HAS_FAST_MOVES, const bool fast_move/*=false*/)) {
     #endif
   }
 }
+
+#if ENABLED(PREPARSED_MOVES)
+
+  /**
+   * G0, G1 parsed when queued. Features that need more of the line
+   * than X Y Z E F are excluded by SanityCheck.
+   */
+  void GcodeSuite::G0_G1(const GCodeQueue::MoveRecord &move) {
+    if (!IsRunning()) return;
+
+    get_destination_from_move(move);                // Get X Y [Z[I[J[K]]]] [E] F
+
+    #if ENABLED(SEGMENT_COALESCING)
+      coalescer.prepare_line_to_destination();
+    #else
+      prepare_line_to_destination();
+    #endif
+  }
+
+#endif
@@ -201,6 +201,8 @@ void plan_arc(
   const float ideal_segment_mm = (
     #if ARC_SEGMENTS_PER_SEC  // Length based on segments per second and feedrate
       constrain(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
+    #elif defined(ARC_CHORD_TOLERANCE) // Longest chord that stays within the tolerance of the true arc
+      constrain(2 * SQRT(_MAX(2 * radius - (ARC_CHORD_TOLERANCE), 0.0f) * (ARC_CHORD_TOLERANCE)), MIN_ARC_SEGMENT_MM, MAX_ARC_SEGMENT_MM)
     #else
       MAX_ARC_SEGMENT_MM      // Length using the maximum segment size
     #endif
@@ -254,10 +256,22 @@ void plan_arc(
   // do not calculate rotation parameters for trivial single-segment arcs
   if (segments > 1) {
     // Vector rotation matrix values
-    const float theta_per_segment = angular_travel / segments,
-                sq_theta_per_segment = sq(theta_per_segment),
-                sin_T = theta_per_segment - sq_theta_per_segment * theta_per_segment / 6,
-                cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
+    const float theta_per_segment = angular_travel / segments;
+    #ifdef ARC_CHORD_TOLERANCE
+      // Exact rotation, so the radius drifts only by float round-off (under 4 ulp per segment).
+      // Correct as seldom as half the chord tolerance allows, leaving the other half for the chords.
+      const float sin_T = sin(theta_per_segment), cos_T = cos(theta_per_segment);
+      #if N_ARC_CORRECTION > 1
+        const uint16_t arc_correction = constrain((ARC_CHORD_TOLERANCE) / (radius * 8 * 1.19e-7f), N_ARC_CORRECTION, segments);
+      #endif
+    #else
+      const float sq_theta_per_segment = sq(theta_per_segment),
+                  sin_T = theta_per_segment - sq_theta_per_segment * theta_per_segment / 6,
+                  cos_T = 1 - 0.5f * sq_theta_per_segment; // Small angle approximation
+      #if N_ARC_CORRECTION > 1
+        constexpr int8_t arc_correction = N_ARC_CORRECTION;
+      #endif
+    #endif
 
     #if DISABLED(AUTO_BED_LEVELING_UBL)
       ARC_LIJKUVW_CODE(
@@ -273,6 +287,11 @@ void plan_arc(
 
     CODE_ITEM_E(const float extruder_per_segment = travel_E / segments);
 
+    // All whole segments have the same length, so the planner can skip its own distance math
+    #if HAS_Z_AXIS && !HAS_I_AXIS
+      hints.millimeters = TERN(AUTO_BED_LEVELING_UBL, segment_mm, HYPOT(segment_mm, per_segment_L));
+    #endif
+
     // Initialize all linear axes and E
     ARC_LIJKUVWE_CODE(
       raw[axis_l] = current_position[axis_l],
@@ -288,7 +307,7 @@ void plan_arc(
     millis_t next_idle_ms = millis() + 200UL;
 
     #if N_ARC_CORRECTION > 1
-      int8_t arc_recalc_count = N_ARC_CORRECTION;
+      auto arc_recalc_count = arc_correction;
     #endif
 
     // An arc can always complete within limits from a speed which...
@@ -322,10 +341,10 @@ void plan_arc(
       #endif
       {
         #if N_ARC_CORRECTION > 1
-          arc_recalc_count = N_ARC_CORRECTION;
+          arc_recalc_count = arc_correction;
         #endif
 
-        // Arc correction to radius vector. Computed only every N_ARC_CORRECTION increments.
+        // Arc correction to radius vector. Computed only every arc_correction increments.
         // Compute exact location by applying transformation matrix from initial radius vector(=-offset).
         // To reduce stuttering, the sin and cos could be computed at different times.
         // For now, compute both at the same time.
@@ -383,7 +402,8 @@ void plan_arc(
     planner.apply_leveling(raw);
   #endif
 
-  hints.curve_radius = 0;
+  // The last segment may be shorter, but it still enters on the arc
+  hints.millimeters = 0;
   hints.safe_exit_speed_sqr = 0.0f;
   planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints);
 
@@ -53,7 +53,7 @@ void GcodeSuite::G6() {
   const page_idx_t page_idx = (page_idx_t)parser.value_ulong();
 
   uint16_t num_steps = DirectStepping::Config::TOTAL_STEPS;
-  if (parser.seen('S')) num_steps = parser.value_ushort();
+  if (parser.seen('S')) NOMORE(num_steps, parser.value_ushort()); // Never step past the end of the page
 
   planner.buffer_page(page_idx, 0, num_steps);
   reset_stepper_timeout();
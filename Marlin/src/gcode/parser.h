@@ -28,6 +28,7 @@
  */
 
 #include "../inc/MarlinConfig.h"
+#include "../libs/decimal.h"
 
 //#define DEBUG_GCODE_PARSER
 #if ENABLED(DEBUG_GCODE_PARSER)
@@ -254,23 +255,8 @@ public:
   // The value as a string
   static char* value_string() { return value_ptr; }
 
-  // Float removes 'E' to prevent scientific notation interpretation
-  static float value_float() {
-    if (!value_ptr) return 0;
-    char *e = value_ptr;
-    for (;;) {
-      const char c = *e;
-      if (c == '\0' || c == ' ') break;
-      if (c == 'E' || c == 'e' || c == 'X' || c == 'x') {
-        *e = '\0';
-        const float ret = strtof(value_ptr, nullptr);
-        *e = c;
-        return ret;
-      }
-      ++e;
-    }
-    return strtof(value_ptr, nullptr);
-  }
+  // Float with no scientific notation, since 'E' is a parameter
+  static float value_float() { return value_ptr ? decimal_to_float(value_ptr) : 0; }
 
   // Code value as a long or ulong
   static int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
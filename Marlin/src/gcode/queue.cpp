@@ -41,6 +41,115 @@ GCodeQueue queue;
   #include "../feature/binary_stream.h"
 #endif
 
+#if ENABLED(BINARY_MOTION)
+  #include "../feature/binary_motion.h"
+#endif
+
+#if ENABLED(REALTIME_OVERRIDES)
+  #include "../feature/e_parser.h"
+#endif
+
+#if ENABLED(HOST_PROMPT_SUPPORT) && DISABLED(EMERGENCY_PARSER)
+  #include "../feature/host_actions.h"
+#endif
+
+#if ENABLED(CANCEL_OBJECTS_PRESCAN)
+  #include "../feature/cancel_prescan.h"
+#endif
+
+#if ENABLED(ADVANCED_PAUSE_NONBLOCKING)
+  #include "../feature/pause.h"
+#endif
+
+#if ENABLED(LINK_BENCHMARK)
+  #include "../feature/link_benchmark.h"
+#endif
+
+#if ENABLED(SERIAL_LINK_STATS)
+
+  AutoReporter<GCodeQueue::LinkStatsReport> GCodeQueue::link_auto_reporter;
+
+  // Counters kept by some serial drivers
+  CALL_IF_EXISTS_IMPL(uint32_t, rxBytes, 0);
+  CALL_IF_EXISTS_IMPL(uint32_t, txBytes, 0);
+  CALL_IF_EXISTS_IMPL(uint16_t, rxMaxEnqueued, 0);
+  CALL_IF_EXISTS_IMPL(void, resetRxMaxEnqueued);
+
+  /**
+   * Per-port line timing for the current interval, plus the
+   * driver byte counts when the interval started
+   */
+  static struct {
+    struct {
+      uint32_t line_start_us,                 // When the first character of the current line was read
+               line_us_sum, line_us_max, lines,
+               wait_ms_sum, waits,
+               rx_mark, tx_mark;
+      uint16_t wait_ms_max;
+    } port[NUM_SERIAL];
+    millis_t mark_ms, starved_ms, starved_at;
+    bool starved;
+  } link_stats;
+
+  // A line was read in full and is about to be queued
+  static void link_stats_line(const uint8_t p) {
+    auto &ps = link_stats.port[p];
+    const uint32_t us = micros() - ps.line_start_us;
+    ps.line_us_sum += us;
+    NOLESS(ps.line_us_max, us);
+    ++ps.lines;
+  }
+
+  // The port a queued line came from, or -1 for SD lines
+  template<typename T>
+  static int8_t link_port(const T &rec) {
+    #if HAS_MULTI_SERIAL
+      return rec.port.index;
+    #else
+      UNUSED(rec);
+      return TERN0(HAS_MEDIA, IS_SD_PRINTING()) ? -1 : 0;
+    #endif
+  }
+
+  // A queued line or move is about to run
+  template<typename T>
+  static void link_stats_run(const T &rec) {
+    const int8_t p = link_port(rec);
+    if (!WITHIN(p, 0, NUM_SERIAL - 1)) return;
+    auto &ps = link_stats.port[p];
+    const uint16_t ms = uint16_t(millis()) - rec.queued_ms;
+    ps.wait_ms_sum += ms;
+    NOLESS(ps.wait_ms_max, ms);
+    ++ps.waits;
+  }
+
+  // Add up the time with nothing queued while moving with room in the planner
+  static void link_stats_starved(const bool starved) {
+    if (starved == link_stats.starved) return;
+    const millis_t ms = millis();
+    if (link_stats.starved) link_stats.starved_ms += ms - link_stats.starved_at;
+    link_stats.starved_at = ms;
+    link_stats.starved = starved;
+  }
+
+#endif // SERIAL_LINK_STATS
+
+#if ENABLED(BUFFER_OCCUPANCY_REPORT)
+
+  AutoReporter<GCodeQueue::OccupancyReport> GCodeQueue::occupancy_auto_reporter;
+
+  static struct {
+    millis_t mark_ms, sample_ms;
+    uint32_t samples, planned_sum, queued_sum, dry_ms;
+    uint8_t planned_min, planned_max, queued_max;
+  } occupancy = { 0, 0, 0, 0, 0, 0, 0xFF, 0, 0 };
+
+#endif
+
+#if ENABLED(FLASH_JOB_STORAGE)
+  #include "../feature/flash_job.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
@@ -91,6 +200,98 @@ PGM_P GCodeQueue::injected_commands_P; // = nullptr
  */
 char GCodeQueue::injected_commands[64]; // = { 0 }
 
+#if ENABLED(PREPARSED_MOVES)
+
+  /**
+   * Parse a plain G0/G1 with only axis, E, and F values into a move record.
+   * Return false for any other command, leaving it to GCodeParser.
+   */
+  static bool parse_move(const char *p, GCodeQueue::MoveRecord &move) {
+    while (*p == ' ') ++p;
+    if (*p == 'N') {
+      if (ENABLED(ADVANCED_OK)) return false;   // The "ok" echoes the line number
+      do ++p; while (NUMERIC(*p));
+      while (*p == ' ') ++p;
+    }
+    if (p[0] != 'G' || (p[1] != '0' && p[1] != '1') || NUMERIC(p[2]) || p[2] == '.') return false;
+    move.codenum = p[1] - '0';
+    p += 2;
+
+    move.seen = 0;
+    for (;;) {
+      while (*p == ' ') ++p;
+      if (*p == '\0' || *p == '*') return true;  // End of the line or checksum (already verified)
+
+      const char c = *p++;
+      uint8_t bit = 0xFF;
+      if (c == 'F') bit = move.F_BIT;
+      #if HAS_EXTRUDERS
+        else if (c == 'E') bit = move.E_BIT;
+      #endif
+      else LOOP_NUM_AXES(i) if (c == AXIS_CHAR(i)) { bit = i; break; }
+      if (bit == 0xFF || TEST(move.seen, bit)) return false;
+
+      char *end;
+      move.value[bit] = decimal_to_float(p, &end);
+      if (end == p) return false;               // No value
+      SBI(move.seen, bit);
+      p = end;
+    }
+  }
+
+  /**
+   * Get the record for the next move, or nullptr if there's no room for one.
+   * Fill it in, then call commit_move to queue it.
+   */
+  GCodeQueue::MoveRecord* GCodeQueue::RingBuffer::move_slot() {
+    // With every slot in use index_w is the next command to run, so the move can't go ahead of it
+    if (full() || moves.length >= PREPARSED_MOVES_SIZE || commands[index_w].moves_before == 255) return nullptr;
+    return &moves.records[moves.index_w];
+  }
+
+  void GCodeQueue::RingBuffer::commit_move(const bool skip_ok
+    OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind)
+  ) {
+    MoveRecord &move = moves.records[moves.index_w];
+    move.skip_ok = skip_ok;
+    TERN_(HAS_MULTI_SERIAL, move.port = serial_ind);
+    TERN_(SERIAL_LINK_STATS, move.queued_ms = uint16_t(millis()));
+
+    ++commands[index_w].moves_before;
+    if (++moves.index_w >= PREPARSED_MOVES_SIZE) moves.index_w = 0;
+    ++moves.length;
+  }
+
+  /**
+   * Queue a plain move as a record ahead of the next command slot.
+   * Return false to queue the line as text.
+   */
+  bool GCodeQueue::RingBuffer::add_move(const char * const cmd, const bool skip_ok
+    OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind)
+  ) {
+    if (!length) hold_moves = false;            // No M28 or M928 left in the queue
+    if (hold_moves || TERN0(HAS_MEDIA, card.flag.saving) || TERN0(FLASH_JOB_STORAGE, flash_job.saving) || DEBUGGING(ECHO)) return false;
+
+    MoveRecord * const move = move_slot();
+    if (!move) return false;
+    TERN_(LINK_BENCHMARK, const uint32_t parse_us = micros());
+    if (!parse_move(cmd, *move)) {
+      if (strstr_P(cmd, PSTR("M28")) || strstr_P(cmd, PSTR("M928")) || TERN0(FLASH_JOB_STORAGE, strstr_P(cmd, PSTR("M590")))) hold_moves = true;
+      return false;
+    }
+    TERN_(LINK_BENCHMARK, link_benchmark.parsed(parse_us));
+    commit_move(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
+    return true;
+  }
+
+  void GCodeQueue::RingBuffer::discard_moves() {
+    moves.length = moves.index_r = moves.index_w = 0;
+    hold_moves = false;
+    for (uint8_t i = 0; i < BUFSIZE; ++i) commands[i].moves_before = 0;
+  }
+
+#endif // PREPARSED_MOVES
+
 /**
  * Commit the accumulated G-code command to the ring buffer,
  * also setting its origin info.
@@ -98,8 +299,22 @@ char GCodeQueue::injected_commands[64]; // = { 0 }
 void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
+  // A plain move only needs a record
+  #if ENABLED(PREPARSED_MOVES)
+    if (add_move(commands[build_index()].buffer, skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind))) return;
+  #endif
+  #if ENABLED(SERIAL_ZERO_COPY)
+    // Swap places with the partly received serial line
+    const uint8_t b = build_index();
+    if (b != index_w) {
+      char * const cmd = commands[b].buffer, * const line = commands[index_w].buffer;
+      const int n = _MAX(serial_state[0].count, int(strlen(cmd)) + 1);
+      for (int i = 0; i < n; ++i) { const char c = cmd[i]; cmd[i] = line[i]; line[i] = c; }
+    }
+  #endif
   commands[index_w].skip_ok = skip_ok;
   TERN_(HAS_MULTI_SERIAL, commands[index_w].port = serial_ind);
+  TERN_(SERIAL_LINK_STATS, commands[index_w].queued_ms = uint16_t(millis()));
   TERN_(POWER_LOSS_RECOVERY, recovery.commit_sdpos(index_w));
   advance_pos(index_w, 1);
 }
@@ -112,8 +327,8 @@ void GCodeQueue::RingBuffer::commit_command(const bool skip_ok
 bool GCodeQueue::RingBuffer::enqueue(const char *cmd, const bool skip_ok/*=true*/
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
-  if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(commands[index_w].buffer, cmd);
+  if (*cmd == ';' || full(1 + serial_pending())) return false;
+  strcpy(commands[build_index()].buffer, cmd);
   commit_command(skip_ok OPTARG(HAS_MULTI_SERIAL, serial_ind));
   return true;
 }
@@ -258,10 +473,40 @@ void GCodeQueue::RingBuffer::ok_to_send() {
         SERIAL_CHAR(*p++);
     }
     SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, BUFSIZE - length);
+    TERN_(ADVANCED_OK_CREDITS, report_credits(command_port(), 1, 0));
   #endif
   SERIAL_EOL();
 }
 
+#if ENABLED(ADVANCED_OK_CREDITS)
+
+  void GCodeQueue::RingBuffer::report_credits(const serial_index_t serial_ind, const uint8_t freed_slots, const uint8_t freed_moves) const {
+    SERIAL_ECHOPGM(" S", serial_state[serial_ind.index].lines_read, " C", credits(freed_slots, freed_moves));
+  }
+
+#endif
+
+#if ENABLED(PREPARSED_MOVES)
+
+  void GCodeQueue::RingBuffer::ok_to_send(const MoveRecord &move) {
+    #if NO_TIMEOUTS > 0
+      last_command_time = millis();
+    #endif
+    #if HAS_MULTI_SERIAL
+      if (!move.port.valid()) return;
+      PORT_REDIRECT(SERIAL_PORTMASK(move.port));
+    #endif
+    if (move.skip_ok) return;
+    SERIAL_ECHOPGM(STR_OK);
+    #if ENABLED(ADVANCED_OK)
+      SERIAL_ECHOPGM_P(SP_P_STR, planner.moves_free(), SP_B_STR, BUFSIZE - length);
+      TERN_(ADVANCED_OK_CREDITS, report_credits(TERN0(HAS_MULTI_SERIAL, move.port), 0, 1));
+    #endif
+    SERIAL_EOL();
+  }
+
+#endif
+
 /**
  * Send a "Resend: nnn" message to the host to
  * indicate that a command needs to be re-sent.
@@ -317,7 +562,134 @@ inline int read_serial(const serial_index_t index) { return SERIAL_IMPL.read(ind
 
 #endif // (ARDUINO_ARCH_STM32F4 || ARDUINO_ARCH_STM32) && USBCON
 
+/**
+ * Check the "*nn" checksum at the end of a numbered line.
+ * Return 1 if it matches, 0 if it doesn't, and -1 if there is none.
+ */
+static int8_t line_checksum(const char * const command) {
+  const char * const apos = strrchr(command, '*');
+  if (!apos) return -1;
+  uint8_t checksum = 0, count = uint8_t(apos - command);
+  while (count) checksum ^= command[--count];
+  return strtol(apos + 1, nullptr, 10) == checksum;
+}
+
+/**
+ * Add a character just stored in the serial line to the running checksum.
+ * A backspace removes an unknown character, so leave that line for line_checksum().
+ */
+inline void serial_checksum_add(GCodeQueue::SerialState &serial, const char (&line)[MAX_CMD_SIZE], const int before) {
+  if (serial.count < before) { serial.cs_pos = -1; return; }
+  if (serial.count == before) return;
+  if (!before) serial.cs_xor = serial.cs_lead = serial.cs_pos = 0; // First character of a new line
+  else if (serial.cs_pos < 0) return;
+  const char c = line[before];
+  if (c == ' ' && before == serial.cs_lead) { ++serial.cs_lead; return; }
+  if (c == '*') { serial.cs_star_xor = serial.cs_xor; serial.cs_pos = serial.count; }
+  serial.cs_xor ^= c;
+}
+
+// The same result as line_checksum() for a complete, terminated serial line
+inline int8_t serial_checksum(const GCodeQueue::SerialState &serial, const char * const line, const char * const command) {
+  if (serial.cs_pos < 0) return line_checksum(command);
+  if (!serial.cs_pos) return -1;
+  return strtol(line + serial.cs_pos, nullptr, 10) == serial.cs_star_xor;
+}
+
+#if ENABLED(RESEND_WINDOW)
+
+  /**
+   * Lines that arrive after a bad line are held here until the bad line
+   * comes again, instead of being dropped with the rest of the stream.
+   * Copies of held lines that the host sends with the resend get an "ok".
+   */
+  static struct {
+    int8_t port;                          // Index of the port that sent the bad line
+    bool waiting;                         // A resend was requested and the line hasn't come yet
+    uint8_t count, next;                  // Lines held, and the next one to queue
+    long first_N, dup_N;                  // N of the first held line, and of the last one to answer as a copy
+    char lines[RESEND_WINDOW_SIZE][MAX_CMD_SIZE];
+    uint16_t held, recovered, overflows;  // Statistics for report_buffer_statistics
+  } resend_window;
+
+  static void resend_window_reset() {
+    resend_window.waiting = false;
+    resend_window.count = resend_window.next = 0;
+    resend_window.dup_N = 0;
+  }
+
+  /**
+   * Ask for a bad line without dropping the lines that follow it.
+   * Return false if a resend is already underway.
+   */
+  static bool resend_window_start(const serial_index_t p) {
+    if (resend_window.waiting) return false;
+    resend_window_reset();
+    resend_window.waiting = true;
+    resend_window.port = p.index;
+    const long last_N = GCodeQueue::serial_state[p.index].last_N;
+    resend_window.first_N = last_N + 2;
+
+    PORT_REDIRECT(SERIAL_PORTMASK(p));
+    SERIAL_ERROR_START();
+    SERIAL_ECHOLNF(F(STR_ERR_CHECKSUM_MISMATCH), last_N);
+    SERIAL_ECHOLNPGM(STR_RESEND, last_N + 1);
+    SERIAL_ECHOLNPGM(STR_OK);
+    return true;
+  }
+
+  /**
+   * Hold a good line that came after the bad one, or answer a copy of a held line.
+   * Return false if the line can't be handled here.
+   */
+  static bool resend_window_take(const serial_index_t p, const long gcode_N, const char * const command, const int8_t checksum) {
+    if (resend_window.port != p.index) return false;
+
+    if (resend_window.dup_N && WITHIN(gcode_N, resend_window.first_N, resend_window.dup_N)) {
+      PORT_REDIRECT(SERIAL_PORTMASK(p));
+      SERIAL_ECHOLNPGM(STR_OK);
+      return true;
+    }
+
+    if (!resend_window.waiting || gcode_N <= GCodeQueue::serial_state[p.index].last_N) return false;
+    if (gcode_N != resend_window.first_N + resend_window.count || resend_window.count >= RESEND_WINDOW_SIZE || checksum != 1) {
+      ++resend_window.overflows;
+      return false;
+    }
+
+    strcpy(resend_window.lines[resend_window.count++], command);
+    ++resend_window.held;
+    return true;
+  }
+
+  // The bad line came again, so the held lines can follow it
+  static void resend_window_resolved(const serial_index_t p) {
+    if (!resend_window.waiting || resend_window.port != p.index) return;
+    resend_window.waiting = false;
+    resend_window.dup_N = resend_window.count ? resend_window.first_N + resend_window.count - 1 : 0;
+  }
+
+  /**
+   * Queue the held lines after the resent line.
+   * Return false while some are still waiting for room.
+   */
+  static bool resend_window_queue(const serial_index_t p) {
+    if (resend_window.waiting || resend_window.port != p.index) return true;
+    while (resend_window.next < resend_window.count) {
+      if (GCodeQueue::ring_buffer.full()) return false;
+      GCodeQueue::ring_buffer.enqueue(resend_window.lines[resend_window.next], false OPTARG(HAS_MULTI_SERIAL, p));
+      GCodeQueue::serial_state[p.index].last_N = resend_window.first_N + resend_window.next;
+      ++resend_window.next;
+      ++resend_window.recovered;
+    }
+    resend_window.count = resend_window.next = 0;
+    return true;
+  }
+
+#endif // RESEND_WINDOW
+
 void GCodeQueue::gcode_line_error(FSTR_P const ferr, const serial_index_t serial_ind) {
+  TERN_(RESEND_WINDOW, resend_window_reset());
   PORT_REDIRECT(SERIAL_PORTMASK(serial_ind)); // Reply to the serial port that sent the command
   SERIAL_ERROR_START();
   SERIAL_ECHOLNF(ferr, serial_state[serial_ind.index].last_N);
@@ -331,6 +703,13 @@ FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", b
   return m29 && !NUMERIC(m29[3]);
 }
 
+#if ENABLED(FLASH_JOB_STORAGE)
+  FORCE_INLINE bool is_M591(const char * const cmd) {  // matches "M591" but not "M5910", etc
+    const char * const m591 = strstr_P(cmd, PSTR("M591"));
+    return m591 && !NUMERIC(m591[4]);
+  }
+#endif
+
 #define PS_NORMAL 0
 #define PS_EOL    1
 #define PS_QUOTED 2
@@ -410,6 +789,10 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
  * left on the serial port.
  */
 void GCodeQueue::get_serial_commands() {
+  #if ENABLED(BINARY_MOTION)
+    if (binary_motion.active) return binary_motion.receive();
+  #endif
+
   #if ENABLED(BINARY_FILE_TRANSFER)
     if (card.flag.binary_mode) {
       /**
@@ -441,6 +824,9 @@ void GCodeQueue::get_serial_commands() {
       // Check if the queue is full and exit if it is.
       if (ring_buffer.full()) return;
 
+      // Lines held after a bad line go ahead of new input
+      TERN_(RESEND_WINDOW, if (!resend_window_queue(p)) return);
+
       // No data for this port ? Skip it
       if (!serial_data_available(p)) continue;
 
@@ -458,16 +844,22 @@ void GCodeQueue::get_serial_commands() {
         continue;
       }
 
+      // Override bytes were already handled by the emergency parser
+      if (TERN0(REALTIME_OVERRIDES, EmergencyParser::is_override(c))) continue;
+
       const char serial_char = (char)c;
       SerialState &serial = serial_state[p];
+      char (&line)[MAX_CMD_SIZE] = TERN(SERIAL_ZERO_COPY, ring_buffer.commands[ring_buffer.index_w].buffer, serial.line_buffer);
 
       if (ISEOL(serial_char)) {
 
         // Reset our state, continue if the line was empty
-        if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
+        if (process_line_done(serial.input_state, line, serial.count))
           continue;
 
-        char* command = serial.line_buffer;
+        TERN_(ADVANCED_OK_CREDITS, ++serial.lines_read);
+
+        char* command = line;
 
         while (*command == ' ') command++;                   // Skip leading spaces
         char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
@@ -482,9 +874,12 @@ void GCodeQueue::get_serial_commands() {
           }
 
           const long gcode_N = strtol(npos + 1, nullptr, 10);
+          const int8_t checksum = serial_checksum(serial, line, command);
 
           // The line number must be in the correct sequence.
           if (gcode_N != serial.last_N + 1 && !M110) {
+            // A line after a bad one, or a copy of one that was held
+            TERN_(RESEND_WINDOW, if (resend_window_take(p, gcode_N, command, checksum)) continue);
             // A request-for-resend line was already in transit so we got two - oops!
             if (WITHIN(gcode_N, serial.last_N - 1, serial.last_N)) continue;
             // A corrupted line or too high, indicating a lost line
@@ -492,21 +887,19 @@ void GCodeQueue::get_serial_commands() {
             break;
           }
 
-          char *apos = strrchr(command, '*');
-          if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum) {
-              gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
-              break;
-            }
-          }
-          else {
+          if (checksum < 0) {
             gcode_line_error(F(STR_ERR_NO_CHECKSUM), p);
             break;
           }
+          if (!checksum) {
+            // Keep reading so the lines after this one can be held
+            TERN_(RESEND_WINDOW, if (!M110 && resend_window_start(p)) continue);
+            gcode_line_error(F(STR_ERR_CHECKSUM_MISMATCH), p);
+            break;
+          }
 
           serial.last_N = gcode_N;
+          TERN_(RESEND_WINDOW, resend_window_resolved(p));
         }
         #if HAS_MEDIA
           // Pronterface "M29" and "M29 " has no line number
@@ -542,17 +935,39 @@ void GCodeQueue::get_serial_commands() {
             case '2': if (command[2] == '1' && command[1] == '1') kill(FPSTR(M112_KILL_STR), nullptr, true); break;
             case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
           }
+
+          #if ENABLED(HOST_PROMPT_SUPPORT)
+            // M876 answers a prompt that a waiting command may be blocked on,
+            // so handle it now instead of when it reaches the front of the queue.
+            const char *mpos = command;
+            if (npos) { do ++mpos; while (NUMERIC(*mpos)); while (*mpos == ' ') ++mpos; }
+            if (mpos[0] == 'M' && mpos[1] == '8' && mpos[2] == '7' && mpos[3] == '6' && !NUMERIC(mpos[4])) {
+              const char * const spos = strchr(mpos + 4, 'S');
+              if (spos) hostui.handle_response(uint8_t(atoi(spos + 1)));
+            }
+          #endif
         #endif
 
         #if NO_TIMEOUTS > 0
           last_command_time = ms;
         #endif
 
+        TERN_(SERIAL_LINK_STATS, link_stats_line(p));
+        TERN_(LINK_BENCHMARK, link_benchmark.line(serial.count));
+
         // Add the command to the queue
-        ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        #if ENABLED(SERIAL_ZERO_COPY)
+          ring_buffer.commit_command(false);  // The line is already in place
+        #else
+          ring_buffer.enqueue(line, false OPTARG(HAS_MULTI_SERIAL, p));
+        #endif
+      }
+      else {
+        TERN_(SERIAL_LINK_STATS, if (!serial.count) link_stats.port[p].line_start_us = micros());
+        const int before = serial.count;
+        process_stream_char(serial_char, serial.input_state, line, serial.count);
+        serial_checksum_add(serial, line, before);
       }
-      else
-        process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
 
     } // NUM_SERIAL loop
   } // queue has space, serial has data
@@ -572,13 +987,30 @@ void GCodeQueue::get_serial_commands() {
     // Get commands if there are more in the file
     if (!IS_SD_FETCHING()) return;
 
+    #if ENABLED(GCODE_REPEAT_CACHE)
+      // Queue the lines of a repeating loop body from RAM
+      while (repeat.is_replaying() && IS_SD_FETCHING() && !ring_buffer.full(1 + ring_buffer.serial_pending())) {
+        CommandLine &command = ring_buffer.commands[ring_buffer.build_index()];
+        const uint32_t pos = repeat.replay_line(command.buffer);
+        TERN(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = pos, UNUSED(pos)); // Where the line is in the file
+        #if DISABLED(PARK_HEAD_ON_PAUSE)
+          if (command.buffer[0] == 'M' && command.buffer[1] == '2' && command.buffer[2] == '5' && !NUMERIC(command.buffer[3]))
+            card.pauseSDPrint();
+        #endif
+        ring_buffer.commit_command(true);
+        // After the last pass the card carries on from the closing M808
+        TERN_(POWER_LOSS_RECOVERY, if (!repeat.is_replaying()) recovery.cmd_sdpos = card.getIndex());
+      }
+      if (repeat.is_replaying()) return;
+    #endif
+
     int sd_count = 0;
-    while (!ring_buffer.full() && !card.eof()) {
+    while (!ring_buffer.full(1 + ring_buffer.serial_pending()) && !card.eof()) {
       const int16_t n = card.get();
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
 
-      CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
+      CommandLine &command = ring_buffer.commands[ring_buffer.build_index()];
       const char sd_char = (char)n;
       const bool is_eol = ISEOL(sd_char);
       if (is_eol || card_eof) {
@@ -597,11 +1029,38 @@ void GCodeQueue::get_serial_commands() {
               card.pauseSDPrint();
           #endif
 
+          #if ENABLED(CANCEL_OBJECTS_PRESCAN)
+            // M486 S for a canceled object can seek past the object's whole section,
+            // and a line in a section whose object was just canceled past the rest.
+            // Leave room for the M486 itself plus the G92 and feedrate that follow.
+            CancelPrescan::section_t skip;
+            const bool seek_past = !ring_buffer.full(3 + ring_buffer.serial_pending())
+                               && cancel_prescan.take_canceled(command.buffer, card.getIndex(), skip);
+          #endif
+
           // Put the new command into the buffer (no "ok" sent)
           ring_buffer.commit_command(true);
 
           // Prime Power-Loss Recovery for the NEXT commit_command
           TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+
+          #if ENABLED(CANCEL_OBJECTS_PRESCAN)
+            if (seek_past) {
+              card.setIndex(skip.end);
+              TERN_(GCODE_REPEAT_CACHE, repeat.uncache()); // The body as read is no longer the file
+              TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = skip.end);
+              // Leave E and F where the skipped moves would have left them
+              char cmd[32], num[16];
+              if (skip.e_seen) {
+                sprintf_P(cmd, PSTR("G92 E%s"), dtostrf(skip.e, 1, 5, num));
+                ring_buffer.enqueue(cmd);
+              }
+              if (skip.f_seen) {
+                sprintf_P(cmd, PSTR("G%c F%s"), skip.f_g0 ? '0' : '1', dtostrf(skip.f, 1, 1, num));
+                ring_buffer.enqueue(cmd);
+              }
+            }
+          #endif
         }
 
         if (card.eof()) card.fileHasFinished();         // Handle end of file reached
@@ -613,11 +1072,38 @@ void GCodeQueue::get_serial_commands() {
 
 #endif // HAS_MEDIA
 
+#if ENABLED(FLASH_JOB_STORAGE)
+
+  /**
+   * Get lines from the flash job until the command buffer is full
+   * or until the end of the job is reached
+   */
+  inline void GCodeQueue::get_flash_job_commands() {
+    static uint8_t flash_input_state = PS_NORMAL;
+
+    if (!flash_job.printing) return;
+
+    int flash_count = 0;
+    while (flash_job.printing && !ring_buffer.full(1 + ring_buffer.serial_pending())) {
+      const char flash_char = (char)flash_job.get();
+      CommandLine &command = ring_buffer.commands[ring_buffer.build_index()];
+      if (ISEOL(flash_char)) {
+        if (!process_line_done(flash_input_state, command.buffer, flash_count))
+          ring_buffer.commit_command(true);
+      }
+      else
+        process_stream_char(flash_char, flash_input_state, command.buffer, flash_count);
+    }
+  }
+
+#endif // FLASH_JOB_STORAGE
+
 /**
  * Add to the circular command queue the next command from:
  *  - The command-injection queues (injected_commands_P, injected_commands)
  *  - The active serial input (usually USB)
  *  - The SD card file being actively printed
+ *  - The flash job being printed
  */
 void GCodeQueue::get_available_commands() {
   if (ring_buffer.full()) return;
@@ -625,6 +1111,8 @@ void GCodeQueue::get_available_commands() {
   get_serial_commands();
 
   TERN_(HAS_MEDIA, get_sdcard_commands());
+
+  TERN_(FLASH_JOB_STORAGE, get_flash_job_commands());
 }
 
 /**
@@ -640,9 +1128,16 @@ void GCodeQueue::exhaust() {
  */
 void GCodeQueue::advance() {
 
+  // Hold all commands until a filament change is done
+  #if ENABLED(ADVANCED_PAUSE_NONBLOCKING)
+    if (filament_change.active()) return;
+  #endif
+
   // Process immediate commands
   if (process_injected_command_P() || process_injected_command()) return;
 
+  TERN_(SERIAL_LINK_STATS, link_stats_starved(ring_buffer.empty() && planner.has_blocks_queued() && !planner.is_full()));
+
   // Return if the G-code buffer is empty
   if (ring_buffer.empty()) {
     #if ENABLED(BUFFER_MONITORING)
@@ -663,6 +1158,31 @@ void GCodeQueue::advance() {
     }
   #endif
 
+  // Run parsed moves queued ahead of the next command
+  #if ENABLED(PREPARSED_MOVES)
+    if (ring_buffer.move_is_next()) {
+      TERN_(SERIAL_LINK_STATS, link_stats_run(ring_buffer.peek_next_move()));
+      gcode.process_next_move();
+      ring_buffer.discard_move();
+      return;
+    }
+  #endif
+
+  TERN_(SERIAL_LINK_STATS, link_stats_run(ring_buffer.peek_next_command()));
+
+  #if ENABLED(FLASH_JOB_STORAGE)
+    if (flash_job.saving) {
+      char * const cmd = ring_buffer.peek_next_command_string();
+      if (is_M591(cmd))
+        flash_job.end_write();                // M591 finishes the job
+      else
+        flash_job.write_line(cmd);
+      ok_to_send();
+      ring_buffer.advance_pos(ring_buffer.index_r, -1);
+      return;
+    }
+  #endif
+
   #if HAS_MEDIA
 
     if (card.flag.saving) {
@@ -708,12 +1228,16 @@ void GCodeQueue::advance() {
 #if ENABLED(BUFFER_MONITORING)
 
   void GCodeQueue::report_buffer_statistics() {
-    SERIAL_ECHOLNPGM("D576"
+    SERIAL_ECHOPGM("D576"
       " P:", planner.moves_free(),         " ", planner_buffer_underruns, " (", max_planner_buffer_empty_duration, ")"
       " B:", BUFSIZE - ring_buffer.length, " ", command_buffer_underruns, " (", max_command_buffer_empty_duration, ")"
     );
+    // Lines held after bad lines, queued from the window, and (lost to a full window)
+    TERN_(RESEND_WINDOW, SERIAL_ECHOPGM(" R:", resend_window.held, " ", resend_window.recovered, " (", resend_window.overflows, ")"));
+    SERIAL_EOL();
     command_buffer_underruns = planner_buffer_underruns = 0;
     max_command_buffer_empty_duration = max_planner_buffer_empty_duration = 0;
+    TERN_(RESEND_WINDOW, resend_window.held = resend_window.recovered = resend_window.overflows = 0);
   }
 
   void GCodeQueue::auto_report_buffer_statistics() {
@@ -735,10 +1259,87 @@ void GCodeQueue::advance() {
 
     if (auto_buffer_report_interval && ELAPSED(ms, next_buffer_report_ms)) {
       next_buffer_report_ms = ms + 1000UL * auto_buffer_report_interval;
-      PORT_REDIRECT(SerialMask::All);
+      PORT_REDIRECT(SERIAL_NOTICE_PORTS);
       report_buffer_statistics();
       PORT_RESTORE();
     }
   }
 
 #endif // BUFFER_MONITORING
+
+#if ENABLED(SERIAL_LINK_STATS)
+
+  template<typename S>
+  static void report_link_port(S &serial, const uint8_t p, const millis_t interval_ms) {
+    auto &ps = link_stats.port[p];
+    const uint32_t rx = CALL_IF_EXISTS(uint32_t, &serial, rxBytes),
+                   tx = CALL_IF_EXISTS(uint32_t, &serial, txBytes);
+    const float per_s = interval_ms ? 1000.0f / interval_ms : 0.0f;
+    SERIAL_ECHOLNPGM("LINK P", p,
+      " RX", uint32_t((rx - ps.rx_mark) * per_s),
+      " TX", uint32_t((tx - ps.tx_mark) * per_s),
+      " RXMAX", CALL_IF_EXISTS(uint16_t, &serial, rxMaxEnqueued),
+      " LINE", ps.lines ? ps.line_us_sum / ps.lines : 0UL, "/", ps.line_us_max,
+      " WAIT", ps.waits ? ps.wait_ms_sum / ps.waits : 0UL, "/", ps.wait_ms_max
+    );
+    CALL_IF_EXISTS(void, &serial, resetRxMaxEnqueued);
+    const uint32_t line_start_us = ps.line_start_us;
+    ps = {};
+    ps.line_start_us = line_start_us;
+    ps.rx_mark = rx;
+    ps.tx_mark = tx;
+  }
+
+  void GCodeQueue::report_link_stats() {
+    const millis_t ms = millis(), interval_ms = ms - link_stats.mark_ms;
+    report_link_port(MYSERIAL1, 0, interval_ms);
+    #if HAS_MULTI_SERIAL
+      report_link_port(MYSERIAL2, 1, interval_ms);
+    #endif
+    #if NUM_SERIAL >= 3
+      report_link_port(MYSERIAL3, 2, interval_ms);
+    #endif
+
+    // Close off a stretch of starving at the end of the interval
+    if (link_stats.starved) {
+      link_stats.starved_ms += ms - link_stats.starved_at;
+      link_stats.starved_at = ms;
+    }
+    SERIAL_ECHOLNPGM("LINK STARVED", link_stats.starved_ms, "/", interval_ms);
+    link_stats.starved_ms = 0;
+    link_stats.mark_ms = ms;
+  }
+
+#endif // SERIAL_LINK_STATS
+
+#if ENABLED(BUFFER_OCCUPANCY_REPORT)
+
+  void GCodeQueue::auto_report_occupancy() {
+    const millis_t ms = millis();
+    if (ms != occupancy.sample_ms) {
+      const uint8_t planned = planner.movesplanned(), queued = ring_buffer.length;
+      // Nothing to plan from and nothing to step. A waiting command stays in the queue.
+      if (!planned && !queued && printingIsActive()) occupancy.dry_ms += ms - occupancy.sample_ms;
+      occupancy.sample_ms = ms;
+      occupancy.samples++;
+      occupancy.planned_sum += planned;
+      occupancy.queued_sum += queued;
+      NOMORE(occupancy.planned_min, planned);
+      NOLESS(occupancy.planned_max, planned);
+      NOLESS(occupancy.queued_max, queued);
+    }
+    occupancy_auto_reporter.tick();
+  }
+
+  void GCodeQueue::report_occupancy() {
+    const millis_t ms = millis();
+    const float per_sample = occupancy.samples ? 1.0f / occupancy.samples : 0.0f;
+    SERIAL_ECHOLNPGM("BUFFERS"
+      " PL", occupancy.samples ? occupancy.planned_min : 0, "/", occupancy.planned_sum * per_sample, "/", occupancy.planned_max,
+      " CQ", occupancy.queued_sum * per_sample, "/", occupancy.queued_max,
+      " DRY", occupancy.dry_ms, "/", ms - occupancy.mark_ms
+    );
+    occupancy = { ms, occupancy.sample_ms, 0, 0, 0, 0, 0xFF, 0, 0 };
+  }
+
+#endif // BUFFER_OCCUPANCY_REPORT
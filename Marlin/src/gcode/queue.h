@@ -28,6 +28,10 @@
 
 #include "../inc/MarlinConfig.h"
 
+#if ANY(SERIAL_LINK_STATS, BUFFER_OCCUPANCY_REPORT)
+  #include "../libs/autoreport.h"
+#endif
+
 class GCodeQueue {
 public:
   /**
@@ -41,8 +45,21 @@ public:
      */
     long last_N;
     int count;                      //!< Number of characters read in the current line of serial input
-    char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
+    #if DISABLED(SERIAL_ZERO_COPY)
+      char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
+    #endif
     uint8_t input_state;            //!< The input state
+    /**
+     * The line checksum is computed as characters arrive, so a numbered
+     * line is checked at EOL without another pass over the buffer.
+     */
+    uint8_t cs_xor,                 //!< XOR of the line's characters so far, after leading spaces
+            cs_star_xor,            //!< XOR up to the last '*'
+            cs_lead;                //!< Number of leading spaces
+    int cs_pos;                     //!< Index after the last '*', 0 if none, -1 to check the line at EOL
+    #if ENABLED(ADVANCED_OK_CREDITS)
+      uint16_t lines_read;          //!< Lines taken from the serial buffer, reported with each "ok"
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -62,8 +79,35 @@ public:
     #if HAS_MULTI_SERIAL
       serial_index_t port;          //!< Serial port the command was received on
     #endif
+    #if ENABLED(PREPARSED_MOVES)
+      uint8_t moves_before;         //!< Parsed moves to run before this command
+    #endif
+    #if ENABLED(SERIAL_LINK_STATS)
+      uint16_t queued_ms;           //!< When the command was queued (low bits of millis)
+    #endif
   };
 
+  #if ENABLED(PREPARSED_MOVES)
+    /**
+     * A plain G0/G1 parsed once when it is queued, so it needs no command
+     * slot and no parsing when it runs. Values are as written in the line,
+     * with units and relative modes applied when the move runs.
+     */
+    struct MoveRecord {
+      static constexpr uint8_t E_BIT = NUM_AXES, F_BIT = NUM_AXES + 1;
+      uint8_t codenum;              //!< 0 or 1
+      uint16_t seen;                //!< Bits for the axes, E and F given in the line
+      float value[NUM_AXES + 2];    //!< Values indexed by seen bit
+      bool skip_ok;                 //!< Skip sending ok when the move is processed?
+      #if HAS_MULTI_SERIAL
+        serial_index_t port;        //!< Serial port the move was received on
+      #endif
+      #if ENABLED(SERIAL_LINK_STATS)
+        uint16_t queued_ms;         //!< When the move was queued (low bits of millis)
+      #endif
+    };
+  #endif
+
   /**
    * A handy ring buffer type
    */
@@ -73,9 +117,53 @@ public:
             index_w;                //!< Ring buffer's write position
     CommandLine commands[BUFSIZE];  //!< The ring buffer of commands
 
+    #if ENABLED(PREPARSED_MOVES)
+      struct {
+        uint8_t length, index_r, index_w;
+        MoveRecord records[PREPARSED_MOVES_SIZE];
+      } moves;                      //!< Parsed moves, each run ahead of the command slot it was queued at
+      bool hold_moves;              //!< An M28 or M928 is queued, so lines stay as text for the file
+
+      bool add_move(const char * const cmd, const bool skip_ok
+        OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind)
+      );
+      MoveRecord* move_slot();
+      void commit_move(const bool skip_ok
+        OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind)
+      );
+      void discard_moves();
+      inline bool move_is_next() const { return commands[index_r].moves_before; }
+      inline MoveRecord& peek_next_move() { return moves.records[moves.index_r]; }
+      void ok_to_send(const MoveRecord &move);
+      void discard_move() {
+        if (!commands[index_r].moves_before) return;  // The queue was cleared
+        --commands[index_r].moves_before;
+        if (++moves.index_r >= PREPARSED_MOVES_SIZE) moves.index_r = 0;
+        --moves.length;
+      }
+    #endif
+
     inline serial_index_t command_port() const { return TERN0(HAS_MULTI_SERIAL, commands[index_r].port); }
 
-    inline void clear() { length = index_r = index_w = 0; }
+    #if ENABLED(SERIAL_ZERO_COPY)
+      /**
+       * Serial input is received in place, in the slot at index_w.
+       * While a line is partly received other sources build their command
+       * in the next slot, and commit_command swaps the two.
+       */
+      static bool serial_pending() { return serial_state[0].count != 0; }
+      uint8_t build_index() const { return serial_pending() ? (index_w + 1 < BUFSIZE ? index_w + 1 : 0) : index_w; }
+    #else
+      static constexpr bool serial_pending() { return false; }
+      uint8_t build_index() const { return index_w; }
+    #endif
+
+    inline void clear() {
+      // Keep a partly received serial line
+      TERN_(SERIAL_ZERO_COPY, if (serial_pending()) memmove(commands[0].buffer, commands[index_w].buffer, serial_state[0].count));
+      TERN_(PREPARSED_MOVES, discard_moves());
+      length = index_r = index_w = 0;
+    }
 
     void advance_pos(uint8_t &p, const int inc) { if (++p >= BUFSIZE) p = 0; length += inc; }
 
@@ -89,9 +177,21 @@ public:
 
     void ok_to_send();
 
+    #if ENABLED(ADVANCED_OK_CREDITS)
+      /**
+       * Lines of any kind that are sure to fit, given the slots and
+       * move records that processing the current command frees.
+       */
+      uint8_t credits(const uint8_t freed_slots, const uint8_t freed_moves) const {
+        const uint8_t slots = BUFSIZE - length + freed_slots;
+        return TERN(PREPARSED_MOVES, _MIN(slots, uint8_t(PREPARSED_MOVES_SIZE - moves.length + freed_moves)), slots);
+      }
+      void report_credits(const serial_index_t serial_ind, const uint8_t freed_slots, const uint8_t freed_moves) const;
+    #endif
+
     inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
 
-    inline bool occupied() const { return length != 0; }
+    inline bool occupied() const { return length != 0 || TERN0(PREPARSED_MOVES, moves.length != 0); }
 
     inline bool empty() const { return !occupied(); }
 
@@ -164,7 +264,7 @@ public:
   /**
    * Check whether there are any commands yet to be executed
    */
-  static bool has_commands_queued() { return ring_buffer.length || injected_commands_P || injected_commands[0]; }
+  static bool has_commands_queued() { return ring_buffer.occupied() || injected_commands_P || injected_commands[0]; }
 
   /**
    * Get the next command in the queue, optionally log it to SD, then dispatch it
@@ -192,6 +292,13 @@ public:
    *   N<int>  Line number of the command, if any
    *   P<int>  Planner space remaining
    *   B<int>  Block queue space remaining
+   *
+   * If ADVANCED_OK_CREDITS is enabled also include:
+   *   S<int>  Lines read from this port so far (mod 65536)
+   *   C<int>  Lines the queue will take once this command is done
+   *
+   * Lines sent minus S are still in the serial buffer, so the host
+   * can send up to C minus that many lines without waiting.
    */
   static void ok_to_send() { ring_buffer.ok_to_send(); }
 
@@ -252,6 +359,40 @@ public:
 
   #endif // BUFFER_MONITORING
 
+  #if ENABLED(SERIAL_LINK_STATS)
+    /**
+     * Report serial link statistics and start a new interval
+     *
+     * Returns for each port "LINK P<port>" followed by:
+     *  RX<uint>        Bytes per second received (AVR serial only)
+     *  TX<uint>        Bytes per second sent (AVR serial only)
+     *  RXMAX<uint>     RX buffer high-water mark
+     *  LINE<avg>/<max> Time in µs from the first to the last character of a line
+     *  WAIT<avg>/<max> Time in ms from queueing a line to running it
+     * Then "LINK STARVED<ms>/<ms>", the time the queue was empty while moving
+     * with room in the planner, out of the length of the interval.
+     */
+    static void report_link_stats();
+    struct LinkStatsReport { static void report() { report_link_stats(); } };
+    static AutoReporter<LinkStatsReport> link_auto_reporter;
+  #endif
+
+  #if ENABLED(BUFFER_OCCUPANCY_REPORT)
+    /**
+     * Report planner and command queue occupancy and start a new interval
+     *
+     * Returns "BUFFERS" followed by:
+     *  PL<min>/<avg>/<max> Blocks in the planner, sampled each ms
+     *  CQ<avg>/<max>       Commands in the queue
+     *  DRY<ms>/<ms>        Time the planner and queue were both empty while
+     *                      printing, out of the length of the interval
+     */
+    static void report_occupancy();
+    static void auto_report_occupancy();  // Sample, then report when due
+    struct OccupancyReport { static void report() { report_occupancy(); } };
+    static AutoReporter<OccupancyReport> occupancy_auto_reporter;
+  #endif
+
 private:
 
   static void get_serial_commands();
@@ -260,6 +401,10 @@ private:
     static void get_sdcard_commands();
   #endif
 
+  #if ENABLED(FLASH_JOB_STORAGE)
+    static void get_flash_job_commands();
+  #endif
+
   // Process the next "immediate" command (PROGMEM)
   static bool process_injected_command_P();
 
@@ -86,7 +86,7 @@ void GcodeSuite::M1001() {
 
   // Announce SD file completion
   {
-    PORT_REDIRECT(SerialMask::All);
+    PORT_REDIRECT(SERIAL_NOTICE_PORTS);
     SERIAL_ECHOLNPGM(STR_FILE_PRINTED);
   }
 
@@ -27,6 +27,10 @@
 #include "../gcode.h"
 #include "../../sd/cardreader.h"
 
+#if ENABLED(ESTIMATE_REMAINING_TIME)
+  #include "../../feature/print_estimator.h"
+#endif
+
 /**
  * M27: Get SD Card status
  *      OR, with 'S<seconds>' set the SD status auto-report interval. (Requires AUTO_REPORT_SD_STATUS)
@@ -47,6 +51,9 @@ void GcodeSuite::M27() {
   #endif
 
   card.report_status();
+  TERN_(ESTIMATE_REMAINING_TIME, print_estimator.report());
+  TERN_(SD_READ_AHEAD, SERIAL_ECHOLNPGM("SD read-ahead stalls:", card.read_ahead_stalls));
+  TERN_(SD_QUIET_WRITES, card.report_deferred());
 }
 
 #endif // HAS_MEDIA
@@ -29,9 +29,17 @@
 
 /**
  * M155: Set temperature auto-report interval. M155 S<seconds>
+ *
+ * With AUTO_REPORT_TEMP_CHANGES:
+ *   D<degrees> Skip reports until a value moves by this much. D0 to report every interval.
  */
 void GcodeSuite::M155() {
 
+  #if ENABLED(AUTO_REPORT_TEMP_CHANGES)
+    if (parser.seenval('D'))
+      Temperature::AutoReportTemp::delta = _MAX(parser.value_float(), 0.0f);
+  #endif
+
   if (parser.seenval('S'))
     thermalManager.auto_reporter.set_interval(parser.value_byte());
 
@@ -0,0 +1,146 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * M194.cpp - Heat the hotend and bed together
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if ENABLED(PARALLEL_PREHEAT)
+
+#include "../gcode.h"
+#include "../../module/temperature.h"
+#include "../../lcd/marlinui.h"
+#include "../../MarlinCore.h" // for wait_for_heatup
+
+#if ENABLED(PRINTJOB_TIMER_AUTOSTART)
+  #include "../../module/printcounter.h"
+#endif
+
+// Seconds for a heater at 'now' to reach 'target' at 'rate' °C/s
+static float preheat_eta(const celsius_t target, const_celsius_float_t now, const float rate) {
+  return target > now ? (target - now) / rate : 0;
+}
+
+#if ENABLED(MPCTEMP)
+
+  // Seconds for the hotend to reach 'target' at full power, from the MPC model
+  static float hotend_model_eta(const uint8_t e, const celsius_t target) {
+    const MPCHeaterInfo &hotend = thermalManager.temp_hotend[e];
+    const MPC_t &mpc = hotend.mpc;
+    const float ambient = hotend.modeled_ambient_temp,
+                x = mpc.ambient_xfer_coeff_fan0,
+                from = mpc.heater_power - x * (hotend.celsius - ambient),
+                to = mpc.heater_power - x * (target - ambient);
+    if (hotend.celsius >= target) return 0;
+    if (to <= 0) return 9999;  // Not reachable by the model
+    return mpc.block_heat_capacity / x * logf(from / to);
+  }
+
+#endif
+
+/**
+ * M194: Heat the hotend and bed together and wait for both to reach their targets
+ *
+ *  S<temp> : Hotend target temperature in current units
+ *  B<temp> : Bed target temperature in current units
+ *  T<tool> : Hotend index. Default is the active extruder.
+ *
+ * The heater with the longer predicted time-to-target starts first. The other
+ * heater is held back until its own prediction matches the time the first one
+ * still needs, so both arrive together and neither idles hot. The bed rate and
+ * (without MPCTEMP) the hotend rate start at the configured values and follow
+ * the measured heating rate once the heater is on. The ETA of each heater goes
+ * to the host and the status line once per second.
+ */
+void GcodeSuite::M194() {
+  if (DEBUGGING(DRYRUN)) return;
+
+  const int8_t e = get_target_extruder_from_command();
+  if (e < 0) return;
+
+  const bool got_hotend = parser.seenval('S');
+  const celsius_t hotend_target = got_hotend ? parser.value_celsius() : 0;
+  const bool got_bed = parser.seenval('B');
+  const celsius_t bed_target = got_bed ? parser.value_celsius() : 0;
+  if (!got_hotend && !got_bed) return;
+
+  TERN_(PRINTJOB_TIMER_AUTOSTART, thermalManager.auto_job_check_timer(true, false));
+
+  #if DISABLED(BUSY_WHILE_HEATING) && ENABLED(HOST_KEEPALIVE_FEATURE)
+    KEEPALIVE_STATE(NOT_BUSY);
+  #endif
+
+  // A heater that isn't part of the command counts as already started
+  bool hotend_on = !got_hotend, bed_on = !got_bed;
+  float hotend_rate = PREHEAT_HOTEND_RATE, bed_rate = PREHEAT_BED_RATE;
+  celsius_float_t hotend_last = thermalManager.degHotend(e), bed_last = thermalManager.degBed();
+  millis_t next_ms = millis();
+
+  wait_for_heatup = true;
+  while (wait_for_heatup) {
+    const millis_t ms = millis();
+    if (ELAPSED(ms, next_ms)) {
+      next_ms = ms + 1000UL;
+
+      // Follow the measured rate of each heater once it's on
+      const celsius_float_t hotend_now = thermalManager.degHotend(e), bed_now = thermalManager.degBed();
+      if (got_hotend && hotend_on && hotend_now > hotend_last && hotend_now < hotend_target)
+        hotend_rate = hotend_rate * 0.75f + (hotend_now - hotend_last) * 0.25f;
+      if (got_bed && bed_on && bed_now > bed_last && bed_now < bed_target)
+        bed_rate = bed_rate * 0.75f + (bed_now - bed_last) * 0.25f;
+      hotend_last = hotend_now;
+      bed_last = bed_now;
+
+      const float hotend_eta = got_hotend ? TERN(MPCTEMP, hotend_model_eta(e, hotend_target), preheat_eta(hotend_target, hotend_now, hotend_rate)) : 0,
+                  bed_eta = got_bed ? preheat_eta(bed_target, bed_now, bed_rate) : 0;
+
+      // Start each heater once it needs at least as long as the other.
+      // A heater already at its target is held there right away.
+      if (!hotend_on && (hotend_eta >= bed_eta || !hotend_eta)) {
+        thermalManager.setTargetHotend(hotend_target, e);
+        thermalManager.set_heating_message(e);
+        hotend_on = true;
+      }
+      if (!bed_on && (bed_eta >= hotend_eta || !bed_eta)) {
+        thermalManager.setTargetBed(bed_target);
+        bed_on = true;
+      }
+
+      const int hotend_s = int(hotend_eta + 0.5f), bed_s = int(bed_eta + 0.5f);
+      SERIAL_ECHO_MSG("Preheat ETA T:", hotend_s, " B:", bed_s);
+      ui.status_printf(0, F("ETA E %is B %is"), hotend_s, bed_s);
+
+      if (hotend_on && bed_on) break;
+    }
+    idle();
+  }
+
+  if (!wait_for_heatup) return;   // Canceled with M108 or from the LCD
+
+  // Both heaters are on. Wait for them as M109 and M190 would.
+  if (got_hotend) thermalManager.wait_for_hotend(e);
+  if (got_bed) thermalManager.wait_for_bed(true);
+}
+
+#endif // PARALLEL_PREHEAT
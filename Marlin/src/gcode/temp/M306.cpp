@@ -31,7 +31,7 @@
 /**
  * M306: MPC settings and autotune
  *
- *  T                         Autotune the active extruder.
+ *  T                         Autotune the active extruder. (Requires MPC_AUTOTUNE)
  *
  *  A<watts/kelvin>           Ambient heat transfer coefficient (no fan).
  *  C<joules/kelvin>          Block heat capacity.
@@ -43,12 +43,14 @@
  */
 
 void GcodeSuite::M306() {
-  if (parser.seen_test('T')) {
-    LCD_MESSAGE(MSG_MPC_AUTOTUNE);
-    thermalManager.MPC_autotune();
-    ui.reset_status();
-    return;
-  }
+  #if ENABLED(MPC_AUTOTUNE)
+    if (parser.seen_test('T')) {
+      LCD_MESSAGE(MSG_MPC_AUTOTUNE);
+      thermalManager.MPC_autotune();
+      ui.reset_status();
+      return;
+    }
+  #endif
 
   if (parser.seen("ACFPRH")) {
     const heater_id_t hid = (heater_id_t)parser.intval('E', 0);
@@ -276,6 +276,7 @@
                 #undef PID_PARAMS_PER_HOTEND
                 #undef PIDTEMP
                 #undef MPCTEMP
+                #undef MPC_AUTOTUNE
                 #undef PREVENT_COLD_EXTRUSION
                 #undef THERMAL_PROTECTION_HOTENDS
                 #undef THERMAL_PROTECTION_PERIOD
@@ -858,6 +859,10 @@
   #define HAS_MEDIA_SUBCALLS 1
 #endif
 
+#if HAS_MEDIA && ANY(POWER_LOSS_JOURNAL, SDCARD_EEPROM_EXTENSION)
+  #define HAS_RAW_BLOCK_FILE 1
+#endif
+
 #if HAS_PRINT_PROGRESS && ANY(PRINT_PROGRESS_SHOW_DECIMALS, SHOW_REMAINING_TIME)
   #define HAS_PRINT_PROGRESS_PERMYRIAD 1
 #endif
@@ -906,6 +911,7 @@
   #ifdef Z_STEPPER_ALIGN_STEPPER_XY
     #define HAS_Z_STEPPER_ALIGN_STEPPER_XY 1
     #undef Z_STEPPER_ALIGN_AMP
+    #undef Z_STEPPER_ALIGN_LEARN_AMP
   #endif
   #ifndef Z_STEPPER_ALIGN_AMP
     #define Z_STEPPER_ALIGN_AMP 1.0
@@ -968,10 +974,6 @@
   #undef SERIAL_XON_XOFF
 #endif
 
-#if ENABLED(HOST_PROMPT_SUPPORT) && DISABLED(EMERGENCY_PARSER)
-  #define HAS_GCODE_M876 1
-#endif
-
 #if ENABLED(HOST_ACTION_COMMANDS)
   #ifndef ACTION_ON_PAUSE
     #define ACTION_ON_PAUSE   "pause"
@@ -1236,7 +1238,7 @@
 #endif
 
 // Flag whether least_squares_fit.cpp is used
-#if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_LINEAR, HAS_Z_STEPPER_ALIGN_STEPPER_XY)
+#if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_LINEAR, HAS_Z_STEPPER_ALIGN_STEPPER_XY, ABL_PARTIAL_PROBING, MESH_STATISTICS)
   #define NEED_LSF 1
 #endif
 
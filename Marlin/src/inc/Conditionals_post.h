@@ -1817,6 +1817,98 @@
   #endif
 #endif // HAS_TRINAMIC_CONFIG
 
+// Software UART drivers run on the timer-driven serial port
+#if ENABLED(TMC_TIMER_SERIAL)
+  #if AXIS_HAS_SW_SERIAL(X)
+    #define X_HARDWARE_SERIAL tmcTimerSerialX
+    #define X_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(X2)
+    #define X2_HARDWARE_SERIAL tmcTimerSerialX2
+    #define X2_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(Y)
+    #define Y_HARDWARE_SERIAL tmcTimerSerialY
+    #define Y_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(Y2)
+    #define Y2_HARDWARE_SERIAL tmcTimerSerialY2
+    #define Y2_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(Z)
+    #define Z_HARDWARE_SERIAL tmcTimerSerialZ
+    #define Z_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(Z2)
+    #define Z2_HARDWARE_SERIAL tmcTimerSerialZ2
+    #define Z2_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(Z3)
+    #define Z3_HARDWARE_SERIAL tmcTimerSerialZ3
+    #define Z3_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(Z4)
+    #define Z4_HARDWARE_SERIAL tmcTimerSerialZ4
+    #define Z4_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(I)
+    #define I_HARDWARE_SERIAL tmcTimerSerialI
+    #define I_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(J)
+    #define J_HARDWARE_SERIAL tmcTimerSerialJ
+    #define J_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(K)
+    #define K_HARDWARE_SERIAL tmcTimerSerialK
+    #define K_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(U)
+    #define U_HARDWARE_SERIAL tmcTimerSerialU
+    #define U_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(V)
+    #define V_HARDWARE_SERIAL tmcTimerSerialV
+    #define V_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(W)
+    #define W_HARDWARE_SERIAL tmcTimerSerialW
+    #define W_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(E0)
+    #define E0_HARDWARE_SERIAL tmcTimerSerialE0
+    #define E0_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(E1)
+    #define E1_HARDWARE_SERIAL tmcTimerSerialE1
+    #define E1_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(E2)
+    #define E2_HARDWARE_SERIAL tmcTimerSerialE2
+    #define E2_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(E3)
+    #define E3_HARDWARE_SERIAL tmcTimerSerialE3
+    #define E3_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(E4)
+    #define E4_HARDWARE_SERIAL tmcTimerSerialE4
+    #define E4_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(E5)
+    #define E5_HARDWARE_SERIAL tmcTimerSerialE5
+    #define E5_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(E6)
+    #define E6_HARDWARE_SERIAL tmcTimerSerialE6
+    #define E6_HAS_TIMER_SERIAL 1
+  #endif
+  #if AXIS_HAS_SW_SERIAL(E7)
+    #define E7_HARDWARE_SERIAL tmcTimerSerialE7
+    #define E7_HAS_TIMER_SERIAL 1
+  #endif
+#endif
+
 #if ANY_AXIS_HAS(HW_SERIAL)
   #define HAS_TMC_HW_SERIAL 1
 #endif
@@ -2233,6 +2325,14 @@
   #define HAS_TEMP_ADC_REDUNDANT 1
 #endif
 
+// Channels in the auto-triggered ADC sequence, in the order Temperature reads them
+#if ENABLED(ADC_AUTO_SEQUENCE)
+  #define ADC_SEQUENCE_LENGTH ( ENABLED(HAS_TEMP_ADC_0) + ENABLED(HAS_TEMP_ADC_1) + ENABLED(HAS_TEMP_ADC_2) + ENABLED(HAS_TEMP_ADC_3) \
+                              + ENABLED(HAS_TEMP_ADC_4) + ENABLED(HAS_TEMP_ADC_5) + ENABLED(HAS_TEMP_ADC_6) + ENABLED(HAS_TEMP_ADC_7) \
+                              + ENABLED(HAS_TEMP_ADC_BED) + ENABLED(HAS_TEMP_ADC_CHAMBER) + ENABLED(HAS_TEMP_ADC_PROBE) \
+                              + ENABLED(HAS_TEMP_ADC_COOLER) + ENABLED(HAS_TEMP_ADC_BOARD) + ENABLED(HAS_TEMP_ADC_REDUNDANT) )
+#endif
+
 #define HAS_TEMP(N) (TEMP_SENSOR_IS_MAX_TC(N) || HAS_TEMP_ADC_##N || TEMP_SENSOR_##N##_IS_DUMMY)
 #if HAS_HOTEND && HAS_TEMP(0)
   #define HAS_TEMP_HOTEND 1
@@ -2459,7 +2559,7 @@
 #if !HAS_TEMP_SENSOR
   #undef AUTO_REPORT_TEMPERATURES
 #endif
-#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS)
+#if ANY(AUTO_REPORT_TEMPERATURES, AUTO_REPORT_SD_STATUS, AUTO_REPORT_POSITION, AUTO_REPORT_FANS, SERIAL_LINK_STATS, IDLE_PROFILER, BUFFER_OCCUPANCY_REPORT, FLEET_TELEMETRY)
   #define HAS_AUTO_REPORTING 1
 #endif
 
@@ -254,6 +254,17 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
 #elif ANY(SERIAL_XON_XOFF, SERIAL_STATS_MAX_RX_QUEUED, SERIAL_STATS_DROPPED_RX)
   #error "SERIAL_XON_XOFF and SERIAL_STATS_* features not supported on USB-native AVR devices."
 #endif
+#ifdef LCD_SERIAL_TX_BUFFER_SIZE
+  #ifndef LCD_SERIAL_PORT
+    #error "LCD_SERIAL_TX_BUFFER_SIZE requires LCD_SERIAL_PORT."
+  #elif HAS_DGUS_LCD
+    #error "LCD_SERIAL_TX_BUFFER_SIZE is not used with DGUS displays. Set DGUS_TX_BUFFER_SIZE instead."
+  #elif LCD_SERIAL_TX_BUFFER_SIZE < 2 || LCD_SERIAL_TX_BUFFER_SIZE > 256 || !IS_POWER_OF_2(LCD_SERIAL_TX_BUFFER_SIZE)
+    #error "LCD_SERIAL_TX_BUFFER_SIZE must be a power of 2 between 2 and 256."
+  #elif LCD_SERIAL_TX_LOW_WATER >= LCD_SERIAL_TX_BUFFER_SIZE
+    #error "LCD_SERIAL_TX_LOW_WATER must be less than LCD_SERIAL_TX_BUFFER_SIZE."
+  #endif
+#endif
 
 /**
  * Multiple Stepper Drivers Per Axis
@@ -412,6 +423,21 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "LIGHTWEIGHT_UI requires a U8GLIB_ST7920-based display."
 #endif
 
+#if defined(LCD_PAGE_DEFER_BLOCKS) && !WITHIN(LCD_PAGE_DEFER_BLOCKS, 1, BLOCK_BUFFER_SIZE - 1)
+  #error "LCD_PAGE_DEFER_BLOCKS must be from 1 to BLOCK_BUFFER_SIZE - 1."
+#endif
+
+/**
+ * Status Screen Dirty Pages
+ */
+#if ENABLED(STATUS_DIRTY_PAGES)
+  #if !HAS_MARLINUI_U8GLIB
+    #error "STATUS_DIRTY_PAGES requires a U8GLIB-based (DOGM) display."
+  #elif TFT_SCALED_DOGLCD
+    #error "STATUS_DIRTY_PAGES is not compatible with TFT_CLASSIC_UI."
+  #endif
+#endif
+
 /**
  * SD Card Settings
  */
@@ -541,6 +567,8 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "You can't enable FIL_RUNOUT8_PULLUP and FIL_RUNOUT8_PULLDOWN at the same time."
   #elif FILAMENT_RUNOUT_DISTANCE_MM < 0
     #error "FILAMENT_RUNOUT_DISTANCE_MM must be greater than or equal to zero."
+  #elif ENABLED(FILAMENT_RUNOUT_STEP_TRACKING) && !HAS_FILAMENT_RUNOUT_DISTANCE
+    #error "FILAMENT_RUNOUT_STEP_TRACKING requires FILAMENT_RUNOUT_DISTANCE_MM."
   #elif DISABLED(ADVANCED_PAUSE_FEATURE) && defined(FILAMENT_RUNOUT_SCRIPT)
     static_assert(nullptr == strstr(FILAMENT_RUNOUT_SCRIPT, "M600"), "ADVANCED_PAUSE_FEATURE is required to use M600 with FILAMENT_RUNOUT_SENSOR.");
   #endif
@@ -568,6 +596,8 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "FILAMENT_CHANGE_SLOW_LOAD_LENGTH must be less than or equal to EXTRUDE_MAXLENGTH."
   #elif ENABLED(PREVENT_LENGTHY_EXTRUDE) && FILAMENT_CHANGE_FAST_LOAD_LENGTH > EXTRUDE_MAXLENGTH
     #error "FILAMENT_CHANGE_FAST_LOAD_LENGTH must be less than or equal to EXTRUDE_MAXLENGTH."
+  #elif ENABLED(ADVANCED_PAUSE_NONBLOCKING) && (HAS_MULTI_EXTRUDER || ANY(MIXING_EXTRUDER, DUAL_X_CARRIAGE))
+    #error "ADVANCED_PAUSE_NONBLOCKING requires a single extruder, without MIXING_EXTRUDER or DUAL_X_CARRIAGE."
   #endif
 #endif
 
@@ -680,6 +710,18 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "TOOLCHANGE_ZRAISE required for EXTRUDERS > 1."
   #endif
 
+  #if ENABLED(TOOLCHANGE_PIPELINE)
+    #if IS_KINEMATIC
+      #error "TOOLCHANGE_PIPELINE requires a Cartesian-style machine."
+    #elif ANY(DUAL_X_CARRIAGE, PARKING_EXTRUDER, MAGNETIC_PARKING_EXTRUDER, SWITCHING_TOOLHEAD, MAGNETIC_SWITCHING_TOOLHEAD, ELECTROMAGNETIC_SWITCHING_TOOLHEAD, SWITCHING_NOZZLE, EXT_SOLENOID)
+      #error "TOOLCHANGE_PIPELINE is only for extruders that change without a mechanism."
+    #elif DO_SWITCH_EXTRUDER || HAS_PRUSA_MMU1
+      #error "TOOLCHANGE_PIPELINE is incompatible with SWITCHING_EXTRUDER and MMU1."
+    #elif ANY(SINGLENOZZLE_STANDBY_TEMP, SINGLENOZZLE_STANDBY_FAN, TOOL_SENSOR)
+      #error "TOOLCHANGE_PIPELINE is incompatible with SINGLENOZZLE_STANDBY_TEMP / _FAN and TOOL_SENSOR."
+    #endif
+  #endif
+
 #elif HAS_PRUSA_MMU1 || HAS_EXTENDABLE_MMU
 
   #error "Multi-Material-Unit requires 2 or more EXTRUDERS."
@@ -789,6 +831,8 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "MIXING_EXTRUDER is incompatible with DISABLE_OTHER_EXTRUDERS."
   #elif HAS_FILAMENT_RUNOUT_DISTANCE
     #error "MIXING_EXTRUDER is incompatible with FILAMENT_RUNOUT_DISTANCE_MM."
+  #elif defined(MIXER_STEP_PATTERN) && !WITHIN(MIXER_STEP_PATTERN, MIXING_STEPPERS, 255)
+    #error "MIXER_STEP_PATTERN must be from MIXING_STEPPERS to 255."
   #endif
 #endif
 
@@ -826,6 +870,112 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+/**
+ * Step Rate Table requirements
+ */
+#if ENABLED(STEP_RATE_TABLE)
+  #if DISABLED(S_CURVE_ACCELERATION)
+    #error "STEP_RATE_TABLE requires S_CURVE_ACCELERATION."
+  #elif !WITHIN(STEP_RATE_TABLE_SIZE, 2, 32)
+    #error "STEP_RATE_TABLE_SIZE must be from 2 to 32."
+  #endif
+#endif
+
+/**
+ * Adaptive Multistepping requirements
+ */
+#if ALL(ADAPTIVE_MULTISTEPPING, DISABLE_MULTI_STEPPING)
+  #error "ADAPTIVE_MULTISTEPPING is incompatible with DISABLE_MULTI_STEPPING."
+#endif
+
+/**
+ * Fused Step Ports requirements
+ */
+#if ENABLED(FUSED_STEP_PORTS)
+  #ifndef __AVR__
+    #error "FUSED_STEP_PORTS is only supported on AVR."
+  #elif NUM_AXES != 3
+    #error "FUSED_STEP_PORTS requires exactly three linear axes (XYZ)."
+  #elif HAS_DUAL_X_STEPPERS || HAS_DUAL_Y_STEPPERS || ENABLED(DUAL_X_CARRIAGE)
+    #error "FUSED_STEP_PORTS doesn't support dual X or Y steppers."
+  #elif NUM_Z_STEPPERS > 2
+    #error "FUSED_STEP_PORTS supports at most two Z steppers."
+  #elif E_STEPPERS > 1 || ANY(MIXING_EXTRUDER, E_DUAL_STEPPER_DRIVERS)
+    #error "FUSED_STEP_PORTS requires a single E stepper."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "FUSED_STEP_PORTS is incompatible with I2S_STEPPER_STREAM."
+  #endif
+#endif
+
+/**
+ * ISR Profiler requirements
+ */
+#if ENABLED(ISR_PROFILER)
+  #ifndef __AVR__
+    #error "ISR_PROFILER is only supported on AVR."
+  #elif !defined(ISR_PROFILER_TIMER)
+    #error "ISR_PROFILER requires ISR_PROFILER_TIMER."
+  #elif ISR_PROFILER_TIMER != 1 && ISR_PROFILER_TIMER != 3 && ISR_PROFILER_TIMER != 4 && ISR_PROFILER_TIMER != 5
+    #error "ISR_PROFILER_TIMER must be a 16-bit timer (1, 3, 4, or 5)."
+  #elif ISR_PROFILER_TIMER == MF_TIMER_STEP
+    #error "ISR_PROFILER_TIMER can't be the Stepper timer."
+  #endif
+#endif
+
+/**
+ * Stack Monitor requirements
+ */
+#if ENABLED(STACK_MONITOR)
+  #ifndef __AVR__
+    #error "STACK_MONITOR is only supported on AVR."
+  #elif ENABLED(M100_FREE_MEMORY_WATCHER)
+    #error "STACK_MONITOR is incompatible with M100_FREE_MEMORY_WATCHER."
+  #endif
+#endif
+
+/**
+ * Crash Trace requirements
+ */
+#if ENABLED(CRASH_TRACE)
+  #ifndef __AVR__
+    #error "CRASH_TRACE is only supported on AVR."
+  #elif ENABLED(M100_FREE_MEMORY_WATCHER)
+    #error "CRASH_TRACE is incompatible with M100_FREE_MEMORY_WATCHER."
+  #elif !WITHIN(CRASH_TRACE_SIZE, 2, 128) || (CRASH_TRACE_SIZE & (CRASH_TRACE_SIZE - 1))
+    #error "CRASH_TRACE_SIZE must be a power of 2 from 2 to 128."
+  #endif
+#endif
+
+/**
+ * Step Capture requirements
+ */
+#if ENABLED(STEP_CAPTURE)
+  #ifndef __AVR__
+    #error "STEP_CAPTURE is only supported on AVR."
+  #elif STEP_CAPTURE_TIMER != 4 && STEP_CAPTURE_TIMER != 5
+    #error "STEP_CAPTURE_TIMER must be 4 or 5, the timers with a usable ICP pin."
+  #elif ENABLED(ISR_PROFILER) && STEP_CAPTURE_TIMER == ISR_PROFILER_TIMER
+    #error "STEP_CAPTURE_TIMER can't be the ISR_PROFILER_TIMER."
+  #elif STEP_CAPTURE_TIMER == 4 && HAS_SERVOS
+    #error "STEP_CAPTURE_TIMER 4 is used by servos. Use Timer 5."
+  #elif STEP_CAPTURE_TIMER == 5 && HAS_MOTOR_CURRENT_PWM
+    #error "STEP_CAPTURE_TIMER 5 is used for motor current PWM. Use Timer 4."
+  #elif !WITHIN(STEP_CAPTURE_SIZE, 2, 1024)
+    #error "STEP_CAPTURE_SIZE must be from 2 to 1024."
+  #endif
+#endif
+
+/**
+ * Planner Benchmark requirements
+ */
+#if ENABLED(PLANNER_BENCHMARK)
+  #if DISABLED(MARLIN_TEST_BUILD)
+    #error "PLANNER_BENCHMARK requires MARLIN_TEST_BUILD."
+  #elif !defined(PLANNER_BENCHMARK_TIME_SCALE) || PLANNER_BENCHMARK_TIME_SCALE < 1
+    #error "PLANNER_BENCHMARK_TIME_SCALE must be 1 or more."
+  #endif
+#endif
+
 /**
  * Special tool-changing options
  */
@@ -933,6 +1083,15 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "PID_FAN_SCALING needs at least one fan enabled."
 #endif
 
+// PID Flow Feed-forward adds to the hotend PID output
+#if ENABLED(PID_FLOW_FEEDFORWARD)
+  #if DISABLED(PIDTEMP)
+    #error "PID_FLOW_FEEDFORWARD requires PIDTEMP."
+  #elif !(PID_FLOW_HEATER_WATTS > 0)
+    #error "PID_FLOW_HEATER_WATTS must be greater than 0."
+  #endif
+#endif
+
 /**
  * Limited user-controlled fans
  */
@@ -968,9 +1127,14 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "Only enable PIDTEMP or MPCTEMP, but not both."
   #undef MPCTEMP
   #undef MPC_EDIT_MENU
+  #undef MPC_AUTOTUNE
   #undef MPC_AUTOTUNE_MENU
 #endif
 
+#if ENABLED(MPC_AUTOTUNE_MENU) && DISABLED(MPC_AUTOTUNE)
+  #error "MPC_AUTOTUNE_MENU requires MPC_AUTOTUNE."
+#endif
+
 #if ENABLED(MPC_INCLUDE_FAN)
   #if !HAS_FAN
     #error "MPC_INCLUDE_FAN requires at least one fan."
@@ -1004,8 +1168,13 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "FAN_KICKSTART_TIME must be 0 with LASER_SYNCHRONOUS_M106_M107 (because the laser will always come on at FULL power)."
   #elif FAN_MIN_PWM
     #error "FAN_MIN_PWM must be 0 with LASER_SYNCHRONOUS_M106_M107 (otherwise the laser will never turn OFF)."
+  #elif ENABLED(FAN_SPEED_AT_BLOCK_START)
+    #error "FAN_SPEED_AT_BLOCK_START is incompatible with LASER_SYNCHRONOUS_M106_M107."
   #endif
 #endif
+#if ENABLED(FAN_SPEED_AT_BLOCK_START) && !HAS_FAN
+  #error "FAN_SPEED_AT_BLOCK_START requires a part cooling fan."
+#endif
 
 /**
  * Chamber Heating Options - PID vs Limit Switching
@@ -1023,6 +1192,8 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "CNC_WORKSPACE_PLANES currently requires a Z axis"
 #elif ENABLED(DIRECT_STEPPING) && NUM_AXES > XYZ
   #error "DIRECT_STEPPING does not currently support more than 3 axes (i.e., XYZ)."
+#elif ENABLED(DIRECT_STEPPING) && (STEPPER_PAGES % 4 || !WITHIN(STEPPER_PAGES, 4, 256))
+  #error "STEPPER_PAGES must be a multiple of 4 from 4 to 256."
 #elif ENABLED(FOAMCUTTER_XYUV) && !(HAS_I_AXIS && HAS_J_AXIS)
   #error "FOAMCUTTER_XYUV requires I and J steppers to be enabled."
 #elif ENABLED(LINEAR_ADVANCE) && HAS_I_AXIS
@@ -1142,6 +1313,10 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "DELTA_AUTO_CALIBRATION requires a probe or LCD Controller."
   #elif ENABLED(DELTA_CALIBRATION_MENU) && !HAS_MARLINUI_MENU
     #error "DELTA_CALIBRATION_MENU requires an LCD Controller."
+  #elif ENABLED(DELTA_IK_INTERPOLATION) && !(defined(DELTA_IK_SPAN_SEGMENTS) && defined(DELTA_IK_MAX_DEVIATION))
+    #error "DELTA_IK_INTERPOLATION requires DELTA_IK_SPAN_SEGMENTS and DELTA_IK_MAX_DEVIATION."
+  #elif ENABLED(DELTA_IK_INTERPOLATION) && DELTA_IK_SPAN_SEGMENTS < 2
+    #error "DELTA_IK_SPAN_SEGMENTS must be 2 or more."
   #elif ABL_USES_GRID
     #if ((GRID_MAX_POINTS_X) & 1) == 0 || ((GRID_MAX_POINTS_Y) & 1) == 0
       #error "DELTA requires GRID_MAX_POINTS_X and GRID_MAX_POINTS_Y to be odd numbers."
@@ -1254,6 +1429,13 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #if BLTOUCH_DELAY < 200
       #error "BLTOUCH_DELAY less than 200 is unsafe and is not supported."
     #endif
+    #if ENABLED(BLTOUCH_ASYNC_RESET)
+      #ifndef BLTOUCH_HS_MODE
+        #error "BLTOUCH_ASYNC_RESET requires BLTOUCH_HS_MODE."
+      #elif ENABLED(PROBE_TRAVEL_OVERLAP)
+        #error "BLTOUCH_ASYNC_RESET is not compatible with PROBE_TRAVEL_OVERLAP."
+      #endif
+    #endif
 
     #ifdef DEACTIVATE_SERVOS_AFTER_MOVE
       #error "BLTOUCH requires DEACTIVATE_SERVOS_AFTER_MOVE to be to disabled. Please update your Configuration.h file."
@@ -2354,6 +2536,19 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #error "An encoder button is required or SOFT_RESET_ON_KILL will reset the printer without notice!"
 #endif
 
+/**
+ * Realtime Overrides
+ */
+#if ENABLED(REALTIME_OVERRIDES)
+  #if DISABLED(EMERGENCY_PARSER)
+    #error "EMERGENCY_PARSER is required for REALTIME_OVERRIDES."
+  #elif ENABLED(BINARY_FILE_TRANSFER)
+    #error "REALTIME_OVERRIDES is incompatible with BINARY_FILE_TRANSFER."
+  #elif !(1 <= REALTIME_OVERRIDE_MIN && REALTIME_OVERRIDE_MIN <= 100 && 100 <= REALTIME_OVERRIDE_MAX && REALTIME_OVERRIDE_MAX <= 999)
+    #error "REALTIME_OVERRIDE_MIN must be 1...100 and REALTIME_OVERRIDE_MAX must be 100...999."
+  #endif
+#endif
+
 // Reset reason for AVR
 #if ENABLED(OPTIBOOT_RESET_REASON) && !defined(__AVR__)
   #error "OPTIBOOT_RESET_REASON only applies to AVR."
@@ -2474,6 +2669,97 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
   #endif
 #endif
 
+/**
+ * Sanity Check for EEPROM_WEAR_LEVELING
+ */
+#if ENABLED(EEPROM_WEAR_LEVELING)
+  #if DISABLED(EEPROM_SETTINGS)
+    #error "EEPROM_WEAR_LEVELING requires EEPROM_SETTINGS."
+  #elif ENABLED(FLASH_EEPROM_EMULATION)
+    #error "EEPROM_WEAR_LEVELING is not needed with FLASH_EEPROM_EMULATION. Use FLASH_EEPROM_LEVELING instead."
+  #elif !WITHIN(EEPROM_WEAR_SLOTS, 2, 8)
+    #error "EEPROM_WEAR_SLOTS must be from 2 to 8."
+  #endif
+#endif
+
+#if ENABLED(EEPROM_IMAGE) && DISABLED(EEPROM_SETTINGS)
+  #error "EEPROM_IMAGE requires EEPROM_SETTINGS."
+#endif
+
+/**
+ * Sanity Check for EEPROM_PAGE_WRITE
+ */
+#if ENABLED(EEPROM_PAGE_WRITE)
+  #if NONE(I2C_EEPROM, SPI_EEPROM) || DISABLED(USE_SHARED_EEPROM)
+    #error "EEPROM_PAGE_WRITE requires an I2C_EEPROM or SPI_EEPROM using the shared EEPROM driver."
+  #elif !WITHIN(EEPROM_PAGE_SIZE, 2, 16) || (EEPROM_PAGE_SIZE & (EEPROM_PAGE_SIZE - 1))
+    #error "EEPROM_PAGE_SIZE must be a power of 2 from 2 to 16."
+  #endif
+#endif
+
+/**
+ * Sanity Check for SDCARD_EEPROM_EXTENSION
+ */
+#if ENABLED(SDCARD_EEPROM_EXTENSION)
+  #ifndef __AVR__
+    #error "SDCARD_EEPROM_EXTENSION is only for AVR. Use SDCARD_EEPROM_EMULATION instead."
+  #elif !HAS_MEDIA
+    #error "SDCARD_EEPROM_EXTENSION requires SDSUPPORT."
+  #elif !WITHIN(SDCARD_EEPROM_EXTENSION_BLOCKS, 1, (32767L - (E2END) - 1) / 512)
+    #error "SDCARD_EEPROM_EXTENSION_BLOCKS must be at least 1 and keep the total size within 32K."
+  #endif
+#endif
+
+/**
+ * Sanity Check for SETTINGS_PROFILES
+ */
+#if ENABLED(SETTINGS_PROFILES) && !WITHIN(SETTINGS_PROFILE_COUNT, 1, 8)
+  #error "SETTINGS_PROFILE_COUNT must be from 1 to 8."
+#endif
+
+/**
+ * Sanity Check for USB_READ_AHEAD_BLOCKS
+ */
+#if defined(USB_READ_AHEAD_BLOCKS) && !WITHIN(USB_READ_AHEAD_BLOCKS, 2, 64)
+  #error "USB_READ_AHEAD_BLOCKS must be from 2 to 64."
+#endif
+
+/**
+ * Sanity Check for ESTIMATE_REMAINING_TIME
+ */
+#if ENABLED(ESTIMATE_REMAINING_TIME) && !HAS_MEDIA
+  #error "ESTIMATE_REMAINING_TIME requires SDSUPPORT."
+#endif
+
+/**
+ * Sanity Check for ETHERNET_RX_BUFFER_SIZE
+ */
+#if defined(ETHERNET_RX_BUFFER_SIZE) && !WITHIN(ETHERNET_RX_BUFFER_SIZE, 64, 4096)
+  #error "ETHERNET_RX_BUFFER_SIZE must be from 64 to 4096."
+#endif
+
+/**
+ * Sanity Check for FLASH_JOB_STORAGE
+ */
+#if ENABLED(FLASH_JOB_STORAGE)
+  #if DISABLED(SPI_FLASH)
+    #error "FLASH_JOB_STORAGE requires SPI_FLASH."
+  #elif (FLASH_JOB_START) % 4096 || (FLASH_JOB_SIZE) % 4096
+    #error "FLASH_JOB_START and FLASH_JOB_SIZE must be multiples of 4096."
+  #elif (FLASH_JOB_SIZE) < 2 * 4096
+    #error "FLASH_JOB_SIZE must be at least 8192."
+  #elif defined(SPI_FLASH_SIZE) && (FLASH_JOB_START) + (FLASH_JOB_SIZE) > (SPI_FLASH_SIZE)
+    #error "FLASH_JOB_START + FLASH_JOB_SIZE must fit within SPI_FLASH_SIZE."
+  #endif
+#endif
+
+/**
+ * Sanity Check for POWER_LOSS_JOURNAL
+ */
+#if ENABLED(POWER_LOSS_JOURNAL) && !WITHIN(POWER_LOSS_JOURNAL_SLOTS, 2, 64)
+  #error "POWER_LOSS_JOURNAL_SLOTS must be from 2 to 64."
+#endif
+
 /**
  * Make sure features that need to write to the SD card can
  */
@@ -2484,6 +2770,10 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "Either disable SDCARD_READONLY or disable BINARY_FILE_TRANSFER."
   #elif ENABLED(SDCARD_EEPROM_EMULATION)
     #error "Either disable SDCARD_READONLY or disable SDCARD_EEPROM_EMULATION."
+  #elif ENABLED(POWER_LOSS_JOURNAL)
+    #error "Either disable SDCARD_READONLY or disable POWER_LOSS_JOURNAL."
+  #elif ENABLED(SDCARD_EEPROM_EXTENSION)
+    #error "Either disable SDCARD_READONLY or disable SDCARD_EEPROM_EXTENSION."
   #endif
 #endif
 
@@ -2492,6 +2782,8 @@ static_assert(COUNT(arm) == LOGICAL_AXES, "AXIS_RELATIVE_MODES must contain " _L
     #error "SD_IGNORE_AT_STARTUP is incompatible with POWER_LOSS_RECOVERY."
   #elif ENABLED(SDCARD_EEPROM_EMULATION)
     #error "SD_IGNORE_AT_STARTUP is incompatible with SDCARD_EEPROM_EMULATION."
+  #elif ENABLED(SDCARD_EEPROM_EXTENSION)
+    #error "SD_IGNORE_AT_STARTUP is incompatible with SDCARD_EEPROM_EXTENSION."
   #endif
 #endif
 
@@ -3551,6 +3843,9 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
         #error "LASER_POWER_TRAP requires SPINDLE_LASER_USE_PWM to function."
       #endif
     #endif
+    #if ALL(LASER_POWER_INLINE_M3, LASER_POWER_SYNC)
+      #error "LASER_POWER_INLINE_M3 and LASER_POWER_SYNC are incompatible."
+    #endif
   #else
     #if SPINDLE_LASER_POWERUP_DELAY < 1
       #error "SPINDLE_LASER_POWERUP_DELAY must be greater than 0."
@@ -3655,6 +3950,28 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
   #error "MONITOR_DRIVER_STATUS and SDSUPPORT cannot be used together on boards with shared SPI."
 #endif
 
+#if ENABLED(HYBRID_THRESHOLD_AUTO)
+  #if DISABLED(HYBRID_THRESHOLD)
+    #error "HYBRID_THRESHOLD_AUTO requires HYBRID_THRESHOLD."
+  #elif DISABLED(MONITOR_DRIVER_STATUS)
+    #error "HYBRID_THRESHOLD_AUTO requires MONITOR_DRIVER_STATUS."
+  #elif !HAS_TMC220x
+    #error "HYBRID_THRESHOLD_AUTO requires TMC2208 or TMC2209 drivers."
+  #elif HAS_DRIVER(TMC2660)
+    #error "HYBRID_THRESHOLD_AUTO is not compatible with TMC2660 drivers."
+  #elif !WITHIN(HYBRID_AUTO_PWM_SCALE, 128, 255)
+    #error "HYBRID_AUTO_PWM_SCALE must be from 128 to 255."
+  #endif
+#endif
+
+#if ENABLED(TMC_TIMER_SERIAL) && !defined(__AVR__)
+  #error "TMC_TIMER_SERIAL is only supported on AVR."
+#endif
+
+#if ENABLED(SERVO_SHARED_TIMER) && !defined(__AVR__)
+  #error "SERVO_SHARED_TIMER is only supported on AVR."
+#endif
+
 // G60/G61 Position Save
 #if SAVED_POSITIONS > 256
   #error "SAVED_POSITIONS must be an integer from 0 to 256."
@@ -3704,6 +4021,401 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
 #if ALL(HAS_MEATPACK, BINARY_FILE_TRANSFER)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
+#if ENABLED(MEATPACK_DICTIONARY)
+  #if !HAS_MEATPACK
+    #error "MEATPACK_DICTIONARY requires MEATPACK_ON_SERIAL_PORT_*."
+  #elif !WITHIN(MEATPACK_DICT_BYTES, 64, 255)
+    #error "MEATPACK_DICT_BYTES must be from 64 to 255."
+  #endif
+#endif
+
+/**
+ * Sanity Check for PREPARSED_MOVES
+ */
+#if ENABLED(PREPARSED_MOVES)
+  #if !defined(PREPARSED_MOVES_SIZE) || PREPARSED_MOVES_SIZE < 2 || PREPARSED_MOVES_SIZE > 255
+    #error "PREPARSED_MOVES_SIZE must be from 2 to 255."
+  #elif ANY(POWER_LOSS_RECOVERY, LASER_FEATURE, DIRECT_MIXING_IN_G1, NO_MOTION_BEFORE_HOMING, NANODLP_Z_SYNC, FULL_REPORT_TO_HOST_FEATURE, PASSWORD_FEATURE, FLOWMETER_SAFETY)
+    #error "PREPARSED_MOVES is incompatible with POWER_LOSS_RECOVERY, LASER_FEATURE, DIRECT_MIXING_IN_G1, NO_MOTION_BEFORE_HOMING, NANODLP_Z_SYNC, FULL_REPORT_TO_HOST_FEATURE, PASSWORD_FEATURE, and FLOWMETER_SAFETY."
+  #elif ALL(FWRETRACT, FWRETRACT_AUTORETRACT)
+    #error "PREPARSED_MOVES is incompatible with FWRETRACT_AUTORETRACT."
+  #elif IS_SCARA || defined(G0_FEEDRATE)
+    #error "PREPARSED_MOVES is incompatible with SCARA and G0_FEEDRATE."
+  #endif
+#endif
+
+/**
+ * Sanity Check for BINARY_MOTION
+ */
+#if ENABLED(BINARY_MOTION)
+  #if DISABLED(PREPARSED_MOVES)
+    #error "BINARY_MOTION requires PREPARSED_MOVES."
+  #elif ENABLED(SERIAL_ZERO_COPY)
+    #error "BINARY_MOTION is incompatible with SERIAL_ZERO_COPY."
+  #elif !defined(BINARY_MOTION_WINDOW) || BINARY_MOTION_WINDOW < MAX_CMD_SIZE + 5
+    #error "BINARY_MOTION_WINDOW must fit the largest frame (MAX_CMD_SIZE + 5 bytes)."
+  #elif RX_BUFFER_SIZE && BINARY_MOTION_WINDOW > RX_BUFFER_SIZE
+    #error "BINARY_MOTION_WINDOW can't be more than RX_BUFFER_SIZE."
+  #elif !WITHIN(BINARY_MOTION_ACK_FRAMES, 1, 127)
+    #error "BINARY_MOTION_ACK_FRAMES must be from 1 to 127."
+  #endif
+#endif
+
+/**
+ * Sanity Check for RESEND_WINDOW
+ */
+#if ENABLED(RESEND_WINDOW) && !WITHIN(RESEND_WINDOW_SIZE, 1, 8)
+  #error "RESEND_WINDOW_SIZE must be from 1 to 8."
+#endif
+
+/**
+ * Sanity Check for HOST_ACTION_PORTS / NOTICE_PORTS
+ */
+#if defined(HOST_ACTION_PORTS) && !WITHIN(HOST_ACTION_PORTS, 1, _BV(NUM_SERIAL) - 1)
+  #error "HOST_ACTION_PORTS must name at least one serial port, and only ports that exist."
+#endif
+#if defined(NOTICE_PORTS) && !WITHIN(NOTICE_PORTS, 1, _BV(NUM_SERIAL) - 1)
+  #error "NOTICE_PORTS must name at least one serial port, and only ports that exist."
+#endif
+
+/**
+ * Sanity Check for SD_EXTENT_CACHE
+ */
+#if ENABLED(SD_EXTENT_CACHE)
+  #if !HAS_MEDIA
+    #error "SD_EXTENT_CACHE requires SDSUPPORT."
+  #elif !WITHIN(SD_EXTENT_CACHE_SIZE, 1, 255)
+    #error "SD_EXTENT_CACHE_SIZE must be from 1 to 255."
+  #elif ENABLED(SD_EXTENT_PREFETCH) && DISABLED(BACKGROUND_TASKS)
+    #error "SD_EXTENT_PREFETCH requires BACKGROUND_TASKS."
+  #endif
+#endif
+
+/**
+ * Sanity Check for SD_DIR_INDEX
+ */
+#if ENABLED(SD_DIR_INDEX)
+  #if !HAS_MEDIA
+    #error "SD_DIR_INDEX requires SDSUPPORT."
+  #elif !WITHIN(SD_DIR_INDEX_SIZE, 1, 1000)
+    #error "SD_DIR_INDEX_SIZE must be from 1 to 1000."
+  #endif
+#endif
+
+/**
+ * Sanity Check for SD_SPI_AUTOTUNE
+ */
+#if ENABLED(SD_SPI_AUTOTUNE) && !WITHIN(SD_SPI_AUTOTUNE_READS, 1, 255)
+  #error "SD_SPI_AUTOTUNE_READS must be from 1 to 255."
+#endif
+
+/**
+ * Sanity Check for THERMISTOR_DIRECT_TABLES
+ */
+#if ENABLED(THERMISTOR_DIRECT_TABLES) && !WITHIN(THERMISTOR_DIRECT_TABLE_BITS, 6, 10)
+  #error "THERMISTOR_DIRECT_TABLE_BITS must be from 6 to 10."
+#endif
+
+/**
+ * Sanity Check for TEMP_ADC_FILTER
+ */
+#if ENABLED(TEMP_ADC_FILTER)
+  #define _BAD_TAPS(N) ((N) != 1 && (N) != 3 && (N) != 5)
+  #if ENABLED(HAL_ADC_FILTERED)
+    #error "TEMP_ADC_FILTER is not supported on a HAL that filters the ADC itself."
+  #elif _BAD_TAPS(TEMP_ADC_MEDIAN_HOTEND) || _BAD_TAPS(TEMP_ADC_MEDIAN_BED) || _BAD_TAPS(TEMP_ADC_MEDIAN_OTHER)
+    #error "TEMP_ADC_MEDIAN_(HOTEND|BED|OTHER) must be 1, 3, or 5."
+  #elif TEMP_ADC_DECIMATE != 1 && TEMP_ADC_DECIMATE != 2 && TEMP_ADC_DECIMATE != 4
+    #error "TEMP_ADC_DECIMATE must be 1, 2, or 4."
+  #endif
+  #undef _BAD_TAPS
+#endif
+
+/**
+ * Sanity Check for ADC_AUTO_SEQUENCE
+ */
+#if ENABLED(ADC_AUTO_SEQUENCE)
+  #ifndef __AVR__
+    #error "ADC_AUTO_SEQUENCE is only supported on AVR."
+  #elif ENABLED(TEMP_ADC_FILTER)
+    #error "ADC_AUTO_SEQUENCE is not compatible with TEMP_ADC_FILTER."
+  #elif ANY(FILAMENT_WIDTH_SENSOR, POWER_MONITOR_CURRENT, POWER_MONITOR_VOLTAGE, HAS_JOY_ADC_X, HAS_JOY_ADC_Y, HAS_JOY_ADC_Z, HAS_ADC_BUTTONS)
+    #error "ADC_AUTO_SEQUENCE only samples temperature sensors. Disable other ADC inputs (filament width, power monitor, joystick, ADC keypad)."
+  #elif ADC_SEQUENCE_LENGTH == 0
+    #error "ADC_AUTO_SEQUENCE requires at least one ADC temperature sensor."
+  #endif
+#endif
+
+/**
+ * Sanity Check for AUTO_REPORT_TEMP_CHANGES
+ */
+#if ENABLED(AUTO_REPORT_TEMP_CHANGES)
+  #if DISABLED(AUTO_REPORT_TEMPERATURES)
+    #error "AUTO_REPORT_TEMP_CHANGES requires AUTO_REPORT_TEMPERATURES."
+  #elif !WITHIN(AUTO_REPORT_TEMP_MAX_INTERVAL, 1, 255)
+    #error "AUTO_REPORT_TEMP_MAX_INTERVAL must be from 1 to 255."
+  #endif
+#endif
+
+/**
+ * Sanity Check for THERMAL_PROTECTION_MODEL
+ */
+#if ENABLED(THERMAL_PROTECTION_MODEL)
+  #if DISABLED(THERMAL_PROTECTION_HOTENDS)
+    #error "THERMAL_PROTECTION_MODEL requires THERMAL_PROTECTION_HOTENDS."
+  #elif TP_MODEL_WINDOW < 1
+    #error "TP_MODEL_WINDOW must be at least 1 second."
+  #elif !WITHIN(TP_MODEL_STRIKES, 1, 255)
+    #error "TP_MODEL_STRIKES must be from 1 to 255."
+  #endif
+#endif
+
+/**
+ * Sanity Check for HEATER_PWM_INTERLEAVE, HEATER_HW_PWM, and HEATER_POWER_BUDGET
+ */
+#if ENABLED(HEATER_PWM_INTERLEAVE)
+  #if !HAS_HEATED_BED
+    #error "HEATER_PWM_INTERLEAVE requires a heated bed."
+  #elif ENABLED(SLOW_PWM_HEATERS)
+    #error "HEATER_PWM_INTERLEAVE is not compatible with SLOW_PWM_HEATERS."
+  #endif
+#endif
+#if ENABLED(HEATER_HW_PWM)
+  #if NONE(HW_PWM_HOTEND, HW_PWM_BED)
+    #error "HEATER_HW_PWM requires HW_PWM_HOTEND and/or HW_PWM_BED."
+  #elif ENABLED(SLOW_PWM_HEATERS)
+    #error "HEATER_HW_PWM is not compatible with SLOW_PWM_HEATERS."
+  #elif ENABLED(HW_PWM_HOTEND) && !HAS_HOTEND
+    #error "HW_PWM_HOTEND requires a hotend."
+  #elif ENABLED(HW_PWM_HOTEND) && ENABLED(HEATERS_PARALLEL)
+    #error "HW_PWM_HOTEND is not compatible with HEATERS_PARALLEL."
+  #elif ENABLED(HW_PWM_BED) && !HAS_HEATED_BED
+    #error "HW_PWM_BED requires a heated bed."
+  #elif ALL(HW_PWM_BED, HEATER_PWM_INTERLEAVE)
+    #error "HW_PWM_BED is not compatible with HEATER_PWM_INTERLEAVE."
+  #elif !(HEATER_HW_PWM_FREQUENCY > 0)
+    #error "HEATER_HW_PWM_FREQUENCY must be greater than 0."
+  #endif
+#endif
+#if ENABLED(HEATER_POWER_BUDGET)
+  #if !(HAS_HOTEND && HAS_HEATED_BED)
+    #error "HEATER_POWER_BUDGET requires a hotend and a heated bed."
+  #elif !(HEATER_BUDGET_WATTS > 0 && HEATER_BUDGET_BED_WATTS > 0)
+    #error "HEATER_BUDGET_WATTS and HEATER_BUDGET_BED_WATTS must be greater than 0."
+  #endif
+#endif
+
+/**
+ * Sanity Check for PARALLEL_PREHEAT
+ */
+#if ENABLED(PARALLEL_PREHEAT)
+  #if !(HAS_HOTEND && HAS_HEATED_BED)
+    #error "PARALLEL_PREHEAT requires a hotend and a heated bed."
+  #endif
+  static_assert(PREHEAT_HOTEND_RATE > 0 && PREHEAT_BED_RATE > 0, "PREHEAT_HOTEND_RATE and PREHEAT_BED_RATE must be greater than 0.");
+#endif
+
+/**
+ * Sanity Check for TEMP_HISTORY
+ */
+#if ENABLED(TEMP_HISTORY)
+  #if !WITHIN(TEMP_HISTORY_SIZE, 1, 255)
+    #error "TEMP_HISTORY_SIZE must be from 1 to 255."
+  #elif TEMP_HISTORY_INTERVAL < 100
+    #error "TEMP_HISTORY_INTERVAL must be at least 100ms."
+  #elif !HAS_HOTEND
+    #error "TEMP_HISTORY requires a hotend."
+  #endif
+#endif
+
+/**
+ * Sanity Check for CANCEL_OBJECTS_PRESCAN
+ */
+#if ENABLED(CANCEL_OBJECTS_PRESCAN)
+  #if DISABLED(CANCEL_OBJECTS)
+    #error "CANCEL_OBJECTS_PRESCAN requires CANCEL_OBJECTS."
+  #elif !HAS_MEDIA
+    #error "CANCEL_OBJECTS_PRESCAN requires SDSUPPORT."
+  #elif !WITHIN(CANCEL_OBJECTS_PRESCAN_SIZE, 1, 64)
+    #error "CANCEL_OBJECTS_PRESCAN_SIZE must be from 1 to 64."
+  #endif
+#endif
+
+/**
+ * Sanity Check for ABL_PARTIAL_PROBING
+ */
+#if ENABLED(ABL_PARTIAL_PROBING)
+  #if !BOTH(AUTO_BED_LEVELING_BILINEAR, HAS_BED_PROBE)
+    #error "ABL_PARTIAL_PROBING requires AUTO_BED_LEVELING_BILINEAR and a bed probe."
+  #endif
+#endif
+
+/**
+ * Sanity Check for BILINEAR_MESH_SLOTS
+ */
+#ifdef BILINEAR_MESH_SLOTS
+  #if !BOTH(AUTO_BED_LEVELING_BILINEAR, EEPROM_SETTINGS)
+    #error "BILINEAR_MESH_SLOTS requires AUTO_BED_LEVELING_BILINEAR and EEPROM_SETTINGS."
+  #elif !WITHIN(BILINEAR_MESH_SLOTS, 1, 16)
+    #error "BILINEAR_MESH_SLOTS must be from 1 to 16."
+  #elif ENABLED(BILINEAR_MESH_TEMP_BLEND) && !HAS_HEATED_BED
+    #error "BILINEAR_MESH_TEMP_BLEND requires a heated bed."
+  #elif ENABLED(BILINEAR_MESH_TEMP_BLEND) && !(MESH_BLEND_TEMP_STEP > 0)
+    #error "MESH_BLEND_TEMP_STEP must be greater than 0."
+  #endif
+#endif
+
+/**
+ * Sanity Check for ADAPTIVE_PROBING
+ */
+#if ENABLED(ADAPTIVE_PROBING)
+  #if !HAS_BED_PROBE
+    #error "ADAPTIVE_PROBING requires a bed probe."
+  #elif DISABLED(AUTO_BED_LEVELING_BILINEAR)
+    #error "ADAPTIVE_PROBING requires AUTO_BED_LEVELING_BILINEAR."
+  #elif defined(MULTIPLE_PROBING)
+    #error "ADAPTIVE_PROBING can't be used with MULTIPLE_PROBING."
+  #elif ANY(BD_SENSOR, HAS_DELTA_SENSORLESS_PROBING)
+    #error "ADAPTIVE_PROBING is not compatible with BD_SENSOR or sensorless probing on DELTA."
+  #endif
+  static_assert(ADAPTIVE_PROBING_TOLERANCE > 0, "ADAPTIVE_PROBING_TOLERANCE must be greater than 0.");
+  static_assert(ADAPTIVE_PROBING_RETAP > 0, "ADAPTIVE_PROBING_RETAP must be greater than 0.");
+#endif
+
+/**
+ * Sanity Check for PROBE_TRAVEL_OVERLAP
+ */
+#if ENABLED(PROBE_TRAVEL_OVERLAP) && !HAS_BED_PROBE
+  #error "PROBE_TRAVEL_OVERLAP requires a bed probe."
+#endif
+
+/**
+ * Sanity Check for BACKGROUND_TASKS
+ */
+#if ENABLED(BACKGROUND_TASKS)
+  #if !WITHIN(BACKGROUND_TASKS_MAX, 1, 16)
+    #error "BACKGROUND_TASKS_MAX must be from 1 to 16."
+  #elif !WITHIN(BACKGROUND_TASKS_SLICE_US, 100, 20000)
+    #error "BACKGROUND_TASKS_SLICE_US must be from 100 to 20000."
+  #elif BACKGROUND_TASKS_MIN_MOVES >= BLOCK_BUFFER_SIZE
+    #error "BACKGROUND_TASKS_MIN_MOVES must be less than BLOCK_BUFFER_SIZE."
+  #endif
+#endif
+
+#if ENABLED(IDLE_SCHEDULER) && NONE(HOST_KEEPALIVE_FEATURE, I2C_POSITION_ENCODERS, HAS_AUTO_REPORTING, PRINTCOUNTER)
+  #error "IDLE_SCHEDULER requires HOST_KEEPALIVE_FEATURE, I2C_POSITION_ENCODERS, PRINTCOUNTER, or an auto-report."
+#endif
+
+/**
+ * Sanity Check for SD_NAME_CACHE
+ */
+#if ENABLED(SD_NAME_CACHE)
+  #if !HAS_MEDIA
+    #error "SD_NAME_CACHE requires SDSUPPORT."
+  #elif !WITHIN(SD_NAME_CACHE_SIZE, 1, 32)
+    #error "SD_NAME_CACHE_SIZE must be from 1 to 32."
+  #endif
+#endif
+
+/**
+ * Sanity Check for SD_QUIET_WRITES
+ */
+#if ENABLED(SD_QUIET_WRITES)
+  #if !HAS_MEDIA
+    #error "SD_QUIET_WRITES requires SDSUPPORT."
+  #elif !WITHIN(SD_QUIET_MAX_WAIT, 1, 60000)
+    #error "SD_QUIET_MAX_WAIT must be from 1 to 60000 ms."
+  #endif
+#endif
+
+/**
+ * Sanity Check for SDSORT_ON_MEDIA
+ */
+#if ENABLED(SDSORT_ON_MEDIA)
+  #if DISABLED(SDCARD_SORT_ALPHA)
+    #error "SDSORT_ON_MEDIA requires SDCARD_SORT_ALPHA."
+  #elif !WITHIN(SDSORT_MEDIA_BATCH, 2, 255)
+    #error "SDSORT_MEDIA_BATCH must be from 2 to 255."
+  #endif
+#endif
+
+/**
+ * Sanity Check for SERIAL_ZERO_COPY
+ */
+#if ENABLED(SERIAL_ZERO_COPY)
+  #if HAS_MULTI_SERIAL
+    #error "SERIAL_ZERO_COPY requires a single serial port."
+  #elif ENABLED(BINARY_FILE_TRANSFER)
+    #error "SERIAL_ZERO_COPY is incompatible with BINARY_FILE_TRANSFER."
+  #endif
+#endif
+
+/**
+ * Sanity Check for ARC_CHORD_TOLERANCE
+ */
+#ifdef ARC_CHORD_TOLERANCE
+  #if ARC_SEGMENTS_PER_SEC
+    #error "ARC_CHORD_TOLERANCE and ARC_SEGMENTS_PER_SEC can't be used together."
+  #endif
+  static_assert(ARC_CHORD_TOLERANCE > 0, "ARC_CHORD_TOLERANCE must be greater than 0.");
+#endif
+
+/**
+ * Sanity Check for PARALLEL_XY_HOMING
+ */
+#if ENABLED(PARALLEL_XY_HOMING)
+  #if !IS_FULL_CARTESIAN
+    #error "PARALLEL_XY_HOMING requires a Cartesian machine."
+  #elif ANY(QUICK_HOME, CODEPENDENT_XY_HOMING)
+    #error "PARALLEL_XY_HOMING is incompatible with QUICK_HOME and CODEPENDENT_XY_HOMING."
+  #elif HAS_DUAL_X_STEPPERS || HAS_DUAL_Y_STEPPERS || ENABLED(DUAL_X_CARRIAGE)
+    #error "PARALLEL_XY_HOMING requires a single X and a single Y stepper."
+  #elif ANY(X_SENSORLESS, Y_SENSORLESS)
+    #error "PARALLEL_XY_HOMING requires X and Y endstop switches (not SENSORLESS_HOMING)."
+  #endif
+#endif
+
+/**
+ * Sanity Check for Z_HOMING_FAST_DESCENT
+ */
+#if ENABLED(Z_HOMING_FAST_DESCENT)
+  #if !IS_CARTESIAN || Z_HOME_TO_MAX
+    #error "Z_HOMING_FAST_DESCENT requires a Cartesian machine that homes Z to MIN."
+  #elif Z_HOMING_FAST_MARGIN < 1
+    #error "Z_HOMING_FAST_MARGIN must be at least 1mm."
+  #endif
+#endif
+
+/**
+ * Sanity Check for JD_CURVE_WINDOW
+ */
+#ifdef JD_CURVE_WINDOW
+  #if DISABLED(JD_HANDLE_SMALL_SEGMENTS)
+    #error "JD_CURVE_WINDOW requires JD_HANDLE_SMALL_SEGMENTS."
+  #elif !WITHIN(JD_CURVE_WINDOW, 2, 16)
+    #error "JD_CURVE_WINDOW must be from 2 to 16."
+  #endif
+#endif
+
+/**
+ * Sanity Check for BACKLASH_TAKEUP_MOVE
+ */
+#if ENABLED(BACKLASH_TAKEUP_MOVE)
+  #if DISABLED(BACKLASH_COMPENSATION)
+    #error "BACKLASH_TAKEUP_MOVE requires BACKLASH_COMPENSATION."
+  #elif !IS_FULL_CARTESIAN
+    #error "BACKLASH_TAKEUP_MOVE requires a Cartesian machine."
+  #elif defined(BACKLASH_SMOOTHING_MM)
+    #error "BACKLASH_TAKEUP_MOVE is incompatible with BACKLASH_SMOOTHING_MM."
+  #endif
+#endif
+
+/**
+ * Sanity Check for BABYSTEP_SMOOTHING
+ */
+#if ENABLED(BABYSTEP_SMOOTHING) && !WITHIN(BABYSTEP_RAMP_TICKS, 1, 256)
+  #error "BABYSTEP_RAMP_TICKS must be from 1 to 256."
+#endif
 
 /**
  * Sanity Check for Slim LCD Menus and Probe Offset Wizard
@@ -3806,6 +4518,34 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
 #endif
 #undef _BAD_DRIVER
 
+/**
+ * Sanity Check for EXTUI_IDLE_THROTTLE
+ */
+#if ENABLED(EXTUI_IDLE_THROTTLE)
+  #if DISABLED(EXTENSIBLE_UI)
+    #error "EXTUI_IDLE_THROTTLE requires an EXTENSIBLE_UI display."
+  #elif !WITHIN(EXTUI_IDLE_MIN_MOVES, 1, BLOCK_BUFFER_SIZE)
+    #error "EXTUI_IDLE_MIN_MOVES must be from 1 to BLOCK_BUFFER_SIZE."
+  #elif !WITHIN(EXTUI_IDLE_BUDGET_MS, 1, 1000)
+    #error "EXTUI_IDLE_BUDGET_MS must be from 1 to 1000."
+  #elif !WITHIN(EXTUI_IDLE_MAX_INTERVAL, 1, 1000)
+    #error "EXTUI_IDLE_MAX_INTERVAL must be from 1 to 1000."
+  #endif
+#endif
+
+/**
+ * Sanity Check for DGUS_WRITE_BATCHING
+ */
+#if ENABLED(DGUS_WRITE_BATCHING)
+  #if !HAS_DGUS_LCD_CLASSIC
+    #error "DGUS_WRITE_BATCHING requires DGUS_LCD_UI_ORIGIN, FYSETC, HIPRECY, or MKS."
+  #elif !WITHIN(DGUS_BATCH_BYTES, 2, 240)
+    #error "DGUS_BATCH_BYTES must be from 2 to 240."
+  #elif !WITHIN(DGUS_SENT_CACHE_SIZE, 1, 255)
+    #error "DGUS_SENT_CACHE_SIZE must be from 1 to 255."
+  #endif
+#endif
+
 /**
  * Require certain features for DGUS_LCD_UI_RELOADED.
  */
@@ -3876,6 +4616,10 @@ static_assert(_PLUS_TEST(3), "DEFAULT_MAX_ACCELERATION values must be positive."
     #endif
   #endif
 
+  #ifdef SHAPING_QUEUE_DEPTH
+    static_assert(WITHIN(SHAPING_QUEUE_DEPTH, 16, 0xFFFF), "SHAPING_QUEUE_DEPTH must be from 16 to 65535.");
+  #endif
+
   #ifdef SHAPING_MIN_FREQ
     static_assert((SHAPING_MIN_FREQ) > 0, "SHAPING_MIN_FREQ must be > 0.");
   #else
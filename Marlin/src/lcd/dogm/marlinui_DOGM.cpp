@@ -303,6 +303,7 @@ void MarlinUI::init_lcd() {
   #endif
 
   update_language_font();
+  TERN_(STATUS_DIRTY_PAGES, invalidate_pages());
 }
 
 void MarlinUI::update_language_font() {
@@ -340,10 +341,58 @@ void MarlinUI::draw_kill_screen() {
   } while (u8g.nextPage());
 }
 
-void MarlinUI::clear_lcd() { } // Automatically cleared by Picture Loop
+void MarlinUI::clear_lcd() { TERN_(STATUS_DIRTY_PAGES, invalidate_pages()); } // Automatically cleared by Picture Loop
 
 #if HAS_DISPLAY_SLEEP
-  void MarlinUI::sleep_display(const bool sleep)  { sleep ? u8g.sleepOn() : u8g.sleepOff(); }
+  void MarlinUI::sleep_display(const bool sleep) {
+    sleep ? u8g.sleepOn() : u8g.sleepOff();
+    TERN_(STATUS_DIRTY_PAGES, invalidate_pages());
+  }
+#endif
+
+#if ENABLED(STATUS_DIRTY_PAGES)
+
+  #include "../../libs/crc16.h"
+
+  // Checksums of the Status Screen pages last sent to the display
+  static uint16_t page_crc[8];
+  static uint8_t page_sent; // Pages with a valid checksum
+
+  void MarlinUI::invalidate_pages() { page_sent = 0; }
+
+  /**
+   * Finish the current page and set up the next one. On the Status Screen a page
+   * that renders the same as the last one sent is not sent again, since the display
+   * still shows it. Any other screen draws full frames and invalidates the pages.
+   */
+  bool MarlinUI::next_page() {
+    if (!on_status_screen()) {
+      page_sent = 0;
+      return u8g.nextPage();
+    }
+
+    u8g_t * const pu8g = u8g.getU8g();
+    u8g_pb_t * const pb = (u8g_pb_t *)pu8g->dev->dev_mem;
+    const uint8_t p = pb->p.page;
+    const uint16_t size = pb->width * pb->p.page_height / 8;
+    uint16_t crc = 0;
+    crc16(&crc, pb->buf, size);
+
+    if (p < COUNT(page_crc)) {
+      if (TEST(page_sent, p) && crc == page_crc[p]) {
+        // Unchanged. Advance the page buffer without a transfer.
+        if (!u8g_page_Next(&pb->p)) return false;
+        memset(pb->buf, 0, size);
+        u8g_GetPageBox(pu8g, &pu8g->current_page);
+        return true;
+      }
+      page_crc[p] = crc;
+      SBI(page_sent, p);
+    }
+
+    return u8g.nextPage();
+  }
+
 #endif
 
 #if HAS_LCD_BRIGHTNESS
@@ -60,17 +60,22 @@ static int fontgroup_init(font_group_t * root, const uxg_fontinfo_t * fntinfo, i
   return 0;
 }
 
+// The font range of the last glyph found. Text in one script mostly stays in one range.
+static uxg_fontinfo_t last_found = { 0, 0, 0, 0, nullptr };
+
 static const font_t* fontgroup_find(font_group_t * root, const lchar_t &val) {
   if (val <= 0xFF) return nullptr;
 
   uxg_fontinfo_t vcmp = { uint16_t(val >> 7), uint8_t((val & 0x7F) + 0x80), uint8_t((val & 0x7F) + 0x80), 0, 0 };
+  if (last_found.fntdata && fontinfo_compare(&last_found, &vcmp) == 0) return last_found.fntdata;
+
   size_t idx = 0;
 
   if (pf_bsearch_r((void*)root->m_fntifo, root->m_fntinfo_num, pf_bsearch_cb_comp_fntifo_pgm, (void*)&vcmp, &idx) < 0)
     return nullptr;
 
-  memcpy_P(&vcmp, root->m_fntifo + idx, sizeof(vcmp));
-  return vcmp.fntdata;
+  memcpy_P(&last_found, root->m_fntifo + idx, sizeof(last_found));
+  return last_found.fntdata;
 }
 
 static void fontgroup_drawwchar(font_group_t *group, const font_t *fnt_default, const lchar_t &val, void * userdata, fontgroup_cb_draw_t cb_draw_ram) {
@@ -123,6 +128,7 @@ static inline bool uxg_Utf8FontIsInited() { return flag_fontgroup_was_inited; }
 
 int uxg_SetUtf8Fonts(const uxg_fontinfo_t *fntinfo, int number) {
   flag_fontgroup_was_inited = true;
+  last_found.fntdata = nullptr;
   return fontgroup_init(&g_fontgroup_root, fntinfo, number);
 }
 
@@ -52,6 +52,13 @@
 #include "FileNavigator.h"
 #include "chiron_tft.h"
 
+#if ENABLED(SD_NAME_CACHE)
+  #include "../../../sd/cardreader.h"
+  #if ENABLED(BACKGROUND_TASKS)
+    #include "../../../feature/bg_tasks.h"
+  #endif
+#endif
+
 using namespace ExtUI;
 
 #define DEBUG_OUT ACDEBUG(AC_FILE)
@@ -67,6 +74,47 @@ uint8_t   FileNavigator::currentfolderdepth;
 uint16_t  FileNavigator::currentfolderindex[MAX_FOLDER_DEPTH];   // track folder pos for iteration
 char      FileNavigator::currentfoldername[MAX_PATH_LEN + 1];   // Current folder path
 
+#if ENABLED(SD_NAME_CACHE)
+
+  constexpr uint8_t prefetch_page = 4;  // Files requested per page by the panel
+
+  #if ENABLED(BACKGROUND_TASKS)
+
+    static int16_t prefetch_first;
+    static uint8_t prefetch_step;
+
+    // Read the next page, then the previous page, one per step
+    static bool prefetch_neighbours() {
+      if (!card.isMounted()) return true;
+      if (prefetch_step++ == 0) {
+        card.prefetchSorted(prefetch_first + prefetch_page, prefetch_page);
+        return false;
+      }
+      if (prefetch_first) card.prefetchSorted(_MAX(prefetch_first - prefetch_page, 0), prefetch_page);
+      return true;
+    }
+
+  #endif
+
+  // Read the names of a page of the current folder in one pass, before the seeks
+  static void prefetch_files(const int16_t first) {
+    #if ENABLED(BACKGROUND_TASKS)
+      // Read this page now and leave the pages around it to idle time
+      card.prefetchSorted(first, prefetch_page);
+      if (SD_NAME_CACHE_SIZE >= 3 * prefetch_page) {
+        prefetch_first = first;
+        prefetch_step = 0;
+        bg_tasks.add(prefetch_neighbours);
+      }
+    #else
+      // Read this page, and the pages around it when they fit
+      constexpr uint8_t page = prefetch_page, around = SD_NAME_CACHE_SIZE >= 3 * page ? page : 0;
+      card.prefetchSorted(_MAX(first - around, 0), page + 2 * around);
+    #endif
+  }
+
+#endif
+
 FileNavigator::FileNavigator() { reset(); }
 
 void FileNavigator::reset() {
@@ -166,6 +214,8 @@ void FileNavigator::skiptofileindex(uint16_t skip) {
       filesneeded--;
     }
 
+    TERN_(SD_NAME_CACHE, prefetch_files(currentindex));
+
     for (uint16_t seek = currentindex; seek < currentindex + filesneeded; seek++) {
       if (filelist.seek(seek)) {
         sendFile(paneltype);
@@ -220,6 +270,8 @@ void FileNavigator::skiptofileindex(uint16_t skip) {
     }
     lastpanelindex = index;
 
+    TERN_(SD_NAME_CACHE, prefetch_files(currentindex));
+
     while (filesneeded > 0) {
       if (filelist.seek(currentindex)) {
         if (!filelist.isDir()) {
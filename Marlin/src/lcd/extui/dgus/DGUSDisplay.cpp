@@ -76,7 +76,91 @@ void DGUSDisplay::InitDisplay() {
   RequestScreen(TERN(SHOW_BOOTSCREEN, DGUSLCD_SCREEN_BOOT, DGUSLCD_SCREEN_MAIN));
 }
 
+#if ENABLED(DGUS_WRITE_BATCHING)
+
+  bool DGUSDisplay::batching; // = false
+  uint16_t DGUSDisplay::batch_vp;
+  uint8_t DGUSDisplay::batch_len, DGUSDisplay::batch[DGUS_BATCH_BYTES];
+  DGUSDisplay::SentValue DGUSDisplay::sent[DGUS_SENT_CACHE_SIZE];
+  uint8_t DGUSDisplay::sent_next;
+
+  void DGUSDisplay::ForgetSentValues() {
+    for (auto &v : sent) v.vp = 0;
+  }
+
+  void DGUSDisplay::ForgetSentValue(uint16_t adr) {
+    for (auto &v : sent) if (v.vp == adr) v.vp = 0;
+  }
+
+  // Remember what goes to each VP. Return true if the display already has it.
+  bool DGUSDisplay::AlreadySent(uint16_t adr, const uint8_t *data, uint8_t len) {
+    uint32_t value = 0;
+    if (len <= 4)
+      for (uint8_t i = 0; i < len; i++) value = value << 8 | data[i];
+    else {
+      value = 2166136261UL;  // FNV-1a
+      for (uint8_t i = 0; i < len; i++) value = (value ^ data[i]) * 16777619UL;
+    }
+
+    SentValue *slot = nullptr;
+    for (auto &v : sent) if (v.vp == adr) { slot = &v; break; }
+    if (slot) {
+      if (slot->len == len && slot->value == value) return true;
+    }
+    else {
+      slot = &sent[sent_next];
+      if (++sent_next >= COUNT(sent)) sent_next = 0;
+    }
+    slot->vp = adr;
+    slot->len = len;
+    slot->value = value;
+    return false;
+  }
+
+  void DGUSDisplay::FlushBatch() {
+    if (!batch_len) return;
+    WriteHeader(batch_vp, DGUS_CMD_WRITEVAR, batch_len);
+    for (uint8_t i = 0; i < batch_len; i++) LCD_SERIAL.write(batch[i]);
+    batch_len = 0;
+  }
+
+  // Add a write to the batch, padding strings with spaces as the direct writes do.
+  // Return false if it's too big to batch.
+  bool DGUSDisplay::QueueVariable(uint16_t adr, const void *values, uint8_t valueslen, bool isstr, bool pgm) {
+    if (valueslen > DGUS_BATCH_BYTES) { FlushBatch(); return false; }
+
+    uint8_t data[DGUS_BATCH_BYTES];
+    const char *myvalues = static_cast<const char*>(values);
+    bool strend = !myvalues;
+    for (uint8_t i = 0; i < valueslen; i++) {
+      char x;
+      if (!strend) x = pgm ? pgm_read_byte(myvalues++) : *myvalues++;
+      if ((isstr && !x) || strend) {
+        strend = true;
+        x = ' ';
+      }
+      data[i] = x;
+    }
+
+    if (AlreadySent(adr, data, valueslen)) return true;
+
+    // VPs address 16-bit words, so only whole words can be followed by the next VP
+    if ((batch_len & 1) || (valueslen & 1) || adr != batch_vp + batch_len / 2 || batch_len + valueslen > DGUS_BATCH_BYTES) {
+      FlushBatch();
+      batch_vp = adr;
+    }
+    memcpy(&batch[batch_len], data, valueslen);
+    batch_len += valueslen;
+    return true;
+  }
+
+#endif // DGUS_WRITE_BATCHING
+
 void DGUSDisplay::WriteVariable(uint16_t adr, const void *values, uint8_t valueslen, bool isstr) {
+  #if ENABLED(DGUS_WRITE_BATCHING)
+    if (batching && QueueVariable(adr, values, valueslen, isstr, false)) return;
+    ForgetSentValue(adr);  // Sent directly, so the next batch can't assume it
+  #endif
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
   WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
@@ -121,6 +205,10 @@ void DGUSDisplay::WriteVariable(uint16_t adr, long value) {
 }
 
 void DGUSDisplay::WriteVariablePGM(uint16_t adr, const void *values, uint8_t valueslen, bool isstr) {
+  #if ENABLED(DGUS_WRITE_BATCHING)
+    if (batching && QueueVariable(adr, values, valueslen, isstr, true)) return;
+    ForgetSentValue(adr);  // Sent directly, so the next batch can't assume it
+  #endif
   const char* myvalues = static_cast<const char*>(values);
   bool strend = !myvalues;
   WriteHeader(adr, DGUS_CMD_WRITEVAR, valueslen);
@@ -227,7 +315,15 @@ void DGUSDisplay::ProcessRx() {
   }
 }
 
-size_t DGUSDisplay::GetFreeTxBuffer() { return LCD_SERIAL_TX_BUFFER_FREE(); }
+size_t DGUSDisplay::GetFreeTxBuffer() {
+  #if ENABLED(DGUS_WRITE_BATCHING)
+    // The pending batch still has to go out, with its header
+    const size_t free = LCD_SERIAL_TX_BUFFER_FREE(), held = batch_len ? batch_len + 6 : 0;
+    return free > held ? free - held : 0;
+  #else
+    return LCD_SERIAL_TX_BUFFER_FREE();
+  #endif
+}
 
 void DGUSDisplay::WriteHeader(uint16_t adr, uint8_t cmd, uint8_t payloadlen) {
   LCD_SERIAL.write(DGUS_HEADER1);
@@ -91,6 +91,14 @@ public:
   // Periodic tasks, eg. Rx-Queue handling.
   static void loop();
 
+  #if ENABLED(DGUS_WRITE_BATCHING)
+    // Between BeginBatch() and EndBatch() writes to consecutive VPs are merged into
+    // one frame, and values the display was already sent are skipped.
+    static void BeginBatch() { batching = true; }
+    static void EndBatch() { FlushBatch(); batching = false; }
+    static void ForgetSentValues();
+  #endif
+
 public:
   // Helper for users of this class to estimate if an interaction would be blocking.
   static size_t GetFreeTxBuffer();
@@ -104,6 +112,25 @@ private:
   static void WritePGM(const char str[], uint8_t len);
   static void ProcessRx();
 
+  #if ENABLED(DGUS_WRITE_BATCHING)
+    static bool QueueVariable(uint16_t adr, const void *values, uint8_t valueslen, bool isstr, bool pgm);
+    static bool AlreadySent(uint16_t adr, const uint8_t *data, uint8_t len);
+    static void ForgetSentValue(uint16_t adr);
+    static void FlushBatch();
+
+    static bool batching;
+    static uint16_t batch_vp;   //< VP of the first word in batch[]
+    static uint8_t batch_len, batch[DGUS_BATCH_BYTES];
+
+    struct SentValue {
+      uint16_t vp;              //< 0 if unused
+      uint8_t len;
+      uint32_t value;           //< The bytes themselves up to 4 bytes, else a hash
+    };
+    static SentValue sent[DGUS_SENT_CACHE_SIZE];
+    static uint8_t sent_next;
+  #endif
+
   static rx_datagram_state_t rx_datagram_state;
   static uint8_t rx_datagram_len;
   static bool Initialized, no_reentrance;
@@ -674,6 +674,14 @@ void DGUSScreenHandler::PopToOldScreen() {
 void DGUSScreenHandler::UpdateScreenVPData() {
   DEBUG_ECHOPGM(" UpdateScreenVPData Screen: ", current_screen);
 
+  #if ENABLED(DGUS_WRITE_BATCHING)
+    // Send what was merged on every way out
+    struct BatchScope {
+      BatchScope() { dgusdisplay.BeginBatch(); }
+      ~BatchScope() { dgusdisplay.EndBatch(); }
+    } batch_scope;
+  #endif
+
   const uint16_t *VPList = DGUSLCD_FindScreenVPMapList(current_screen);
   if (!VPList) {
     DEBUG_ECHOLNPGM(" NO SCREEN FOR: ", current_screen);
@@ -726,6 +734,7 @@ void DGUSScreenHandler::GotoScreen(DGUSLCD_Screens screen, bool ispopup) {
 
 void DGUSDisplay::RequestScreen(DGUSLCD_Screens screen) {
   DEBUG_ECHOLNPGM("GotoScreen ", screen);
+  TERN_(DGUS_WRITE_BATCHING, ForgetSentValues());  // Send every VP of the new screen at least once
   const unsigned char gotoscreen[] = { 0x5A, 0x01, (unsigned char) (screen >> 8U), (unsigned char) (screen & 0xFFU) };
   WriteVariable(0x84, gotoscreen, sizeof(gotoscreen));
 }
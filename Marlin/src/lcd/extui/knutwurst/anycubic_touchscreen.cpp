@@ -25,10 +25,15 @@
 
 #include "../../../gcode/queue.h"
 #include "../../../libs/buzzer.h"
+#include "../../../libs/decimal.h"
 #include "../../../libs/numtostr.h"
 #include "../../../module/motion.h"
 #include "../../../module/stepper.h"
 #include "../../../module/temperature.h"
+#include "../../../sd/cardreader.h"
+#if ENABLED(BACKGROUND_TASKS)
+  #include "../../../feature/bg_tasks.h"
+#endif
 #include "../ui_api.h"
 
 #ifdef ANYCUBIC_TOUCHSCREEN
@@ -61,11 +66,18 @@ static void sendNewLine() {
   LCD_SERIAL.write('\r');
   LCD_SERIAL.write('\n');
 }
-static void send(const char* str) { LCD_SERIAL.print(str); }
+static void sendBlock(const uint8_t* buf, const size_t len) {
+  if (!LCD_SERIAL.writeBlock(buf, len))
+    for (size_t i = 0; i < len; i++) LCD_SERIAL.write(buf[i]);
+}
+static void send(const char* str) { sendBlock((const uint8_t*)str, strlen(str)); }
 static void send_P(PGM_P str) {
-  while (const char c = pgm_read_byte(str++)) {
-    LCD_SERIAL.write(c);
-  }
+  // Copy out of flash in chunks so each chunk goes into the TX ring at once
+  uint8_t buf[16], len;
+  do {
+    for (len = 0; len < sizeof(buf) && (buf[len] = pgm_read_byte(str++)); len++) { /* nada */ }
+    sendBlock(buf, len);
+  } while (len == sizeof(buf));
 }
 static void sendLine(const char* str) {
   send(str);
@@ -76,6 +88,15 @@ static void sendLine_P(PGM_P str) {
   sendNewLine();
 }
 
+// Status replies are polled again soon, so skip them rather than wait for room
+static bool txRoomForStatus() {
+  #ifdef LCD_SERIAL_TX_LOW_WATER
+    return LCD_SERIAL.get_tx_buffer_free() >= LCD_SERIAL_TX_LOW_WATER;
+  #else
+    return true;
+  #endif
+}
+
 AnycubicMediaPrintState AnycubicTouchscreenClass::mediaPrintingState = AMPRINTSTATE_NOT_PRINTING;
 AnycubicMediaPauseState AnycubicTouchscreenClass::mediaPauseState    = AMPAUSESTATE_NOT_PAUSED;
 
@@ -286,18 +307,57 @@ void AnycubicTouchscreenClass::ResumePrint() {
 }
 
 int AnycubicTouchscreenClass::CodeValueInt() {
-  return (atoi(&TFTcmdbuffer[TFTbufindr][TFTstrchr_pointer - TFTcmdbuffer[TFTbufindr] + 1]));
+  return atoi(TFTstrchr_pointer + 1);
 }
 
 float AnycubicTouchscreenClass::CodeValue() {
-  return (strtod(&TFTcmdbuffer[TFTbufindr][TFTstrchr_pointer - TFTcmdbuffer[TFTbufindr] + 1], NULL));
+  return decimal_to_float(TFTstrchr_pointer + 1);
+}
+
+// Note where each letter first appears so CodeSeen() doesn't have to scan the line again
+void AnycubicTouchscreenClass::IndexCommand(char* line) {
+  memset(TFTparamPos, 0, sizeof(TFTparamPos));
+  for (uint8_t i = 0; line[i]; i++) {
+    const char c = line[i];
+    if (WITHIN(c, 'A', 'Z') && !TFTparamPos[c - 'A']) TFTparamPos[c - 'A'] = i + 1;
+  }
+  TFTparamLine = line;
 }
 
 bool AnycubicTouchscreenClass::CodeSeen(char code) {
-  TFTstrchr_pointer = strchr(TFTcmdbuffer[TFTbufindr], code);
+  if (WITHIN(code, 'A', 'Z')) {
+    const uint8_t pos = TFTparamPos[code - 'A'];
+    TFTstrchr_pointer = pos ? TFTparamLine + pos - 1 : NULL;
+  } else
+    TFTstrchr_pointer = strchr(TFTparamLine, code);
   return (TFTstrchr_pointer != NULL); // Return True if a character was found
 }
 
+// Format the polled values at most once per TFT_STATUS_REFRESH_MS
+void AnycubicTouchscreenClass::RefreshStatus() {
+  const millis_t ms = millis();
+  if (PENDING(ms, status.next_ms)) return;
+  status.next_ms = ms + TFT_STATUS_REFRESH_MS;
+
+  status.hotend(int(getActualTemp_celsius(E0) + 0.5));
+  status.hotendTarget(int(getTargetTemp_celsius(E0) + 0.5));
+  status.bed(int(getActualTemp_celsius(BED) + 0.5));
+  status.bedTarget(int(getTargetTemp_celsius(BED) + 0.5));
+  status.fan(int(getActualFan_percent(FAN0)));
+
+  // The float formatting is the slow part, so skip it while stationary
+  if (current_position.x == status.last_pos.x && current_position.y == status.last_pos.y && current_position.z == status.last_pos.z) return;
+  status.last_pos = current_position;
+
+  char* p = status.position;
+  strcpy_P(p, PSTR("A5V X: "));
+  dtostrf(current_position.x, 1, 2, p += strlen(p));
+  strcpy_P(p += strlen(p), PSTR(" Y: "));
+  dtostrf(current_position.y, 1, 2, p += strlen(p));
+  strcpy_P(p += strlen(p), PSTR(" Z: "));
+  dtostrf(current_position.z, 1, 2, p += strlen(p));
+}
+
 void AnycubicTouchscreenClass::HandleSpecialMenu() {
   #if ENABLED(KNUTWURST_SPECIAL_MENU)
     #ifdef ANYCUBIC_TFT_DEBUG
@@ -456,6 +516,22 @@ void AnycubicTouchscreenClass::HandleSpecialMenu() {
     injectCommands(F("M412 H0 S1\nM500"));
     BUZZ(105, 1108);
     BUZZ(210, 1661);
+  #if ENABLED(SETTINGS_PROFILES)
+  } else if ((strcasestr_P(currentTouchscreenSelection, PSTR(SM_PROFILE_0_L)) != NULL) ||
+             (strcasestr_P(currentTouchscreenSelection, PSTR(SM_PROFILE_0_S)) != NULL)) {
+    SERIAL_ECHOLNPGM("Special Menu: Apply Profile 0");
+    injectCommands(F("M824 S0"));
+    BUZZ(105, 1108);
+    BUZZ(210, 1661);
+    #if SETTINGS_PROFILE_COUNT > 1
+  } else if ((strcasestr_P(currentTouchscreenSelection, PSTR(SM_PROFILE_1_L)) != NULL) ||
+             (strcasestr_P(currentTouchscreenSelection, PSTR(SM_PROFILE_1_S)) != NULL)) {
+    SERIAL_ECHOLNPGM("Special Menu: Apply Profile 1");
+    injectCommands(F("M824 S1"));
+    BUZZ(105, 1108);
+    BUZZ(210, 1661);
+    #endif
+  #endif
   } else if ((strcasestr_P(currentTouchscreenSelection, PSTR(SM_EXIT_L)) != NULL) ||
              (strcasestr_P(currentTouchscreenSelection, PSTR(SM_EXIT_S)) != NULL)) {
     SpecialMenu = false;
@@ -816,6 +892,14 @@ void AnycubicTouchscreenClass::RenderSpecialMenu(uint16_t selectedNumber) {
         break;
 
       case 12: // Page 3
+      #if ENABLED(SETTINGS_PROFILES)
+        SENDLINE_PGM(SM_PROFILE_0_S);
+        SENDLINE_PGM(SM_PROFILE_0_L);
+        #if SETTINGS_PROFILE_COUNT > 1
+          SENDLINE_PGM(SM_PROFILE_1_S);
+          SENDLINE_PGM(SM_PROFILE_1_L);
+        #endif
+      #endif
         SENDLINE_PGM(SM_EXIT_S);
         SENDLINE_PGM(SM_EXIT_L);
         break;
@@ -827,6 +911,30 @@ void AnycubicTouchscreenClass::RenderSpecialMenu(uint16_t selectedNumber) {
   #endif // if ENABLED(KNUTWURST_SPECIAL_MENU)
 }
 
+#if ENABLED(SD_NAME_CACHE)
+
+  constexpr uint8_t prefetch_page = 4;  // Files shown per page by the TFT
+
+  #if ENABLED(BACKGROUND_TASKS)
+
+    static int16_t prefetch_first;
+    static uint8_t prefetch_step;
+
+    // Read the next page, then the previous page, one per step
+    static bool prefetch_neighbours() {
+      if (!card.isMounted()) return true;
+      if (prefetch_step++ == 0) {
+        card.prefetchSorted(prefetch_first + prefetch_page, prefetch_page);
+        return false;
+      }
+      if (prefetch_first) card.prefetchSorted(_MAX(prefetch_first - prefetch_page, 0), prefetch_page);
+      return true;
+    }
+
+  #endif
+
+#endif
+
 void AnycubicTouchscreenClass::RenderCurrentFolder(uint16_t selectedNumber) {
   FileList currentFileList;
   uint16_t max_files;
@@ -848,6 +956,23 @@ void AnycubicTouchscreenClass::RenderCurrentFolder(uint16_t selectedNumber) {
     selectedNumber = 0;
   }
 
+  #if ENABLED(SD_NAME_CACHE)
+    const int16_t first = selectedNumber ? selectedNumber - 1 : 0;
+    #if ENABLED(BACKGROUND_TASKS)
+      // Read this page now and leave the pages around it to idle time
+      card.prefetchSorted(first, prefetch_page);
+      if (SD_NAME_CACHE_SIZE >= 3 * prefetch_page) {
+        prefetch_first = first;
+        prefetch_step = 0;
+        bg_tasks.add(prefetch_neighbours);
+      }
+    #else
+      // Read this page, and the pages around it when they fit, in one pass over the folder
+      constexpr uint8_t page = prefetch_page, around = SD_NAME_CACHE_SIZE >= 3 * page ? page : 0;
+      card.prefetchSorted(_MAX(first - around, 0), page + 2 * around);
+    #endif
+  #endif
+
   for (uint16_t count = selectedNumber; count <= max_files; count++) {
     if (count == 0) { // Special Entry
       if (currentFileList.isAtRootDir()) {
@@ -965,11 +1090,7 @@ void AnycubicTouchscreenClass::RenderCurrentFolder(uint16_t selectedNumber) {
 
 void AnycubicTouchscreenClass::SDCardStateChange(bool isInserted) {
   #if BOTH(SDSUPPORT, HAS_SD_DETECT)
-  if (isInserted) {
-    SENDLINE_DBG_PGM("J00", "TFT Serial Debug: SD card state changed... card inserted");
-  } else {
-    SENDLINE_DBG_PGM("J01", "TFT Serial Debug: SD card state changed... card removed");
-  }
+  Notify(isInserted ? AMNOTIFY_MEDIA_INSERTED : AMNOTIFY_MEDIA_REMOVED);
   #endif
 }
 
@@ -977,7 +1098,7 @@ void AnycubicTouchscreenClass::SDCardError() {
   #if ENABLED(ANYCUBIC_TFT_DEBUG)
   SERIAL_ECHOLNPGM("TFT Serial Debug: SDCardError event triggered...");
   #endif
-  SENDLINE_DBG_PGM("J21", "TFT Serial Debug: SD Card Error ... J21");
+  Notify(AMNOTIFY_MEDIA_ERROR);
 }
 
 void AnycubicTouchscreenClass::CheckHeaterError() {
@@ -1014,9 +1135,9 @@ void AnycubicTouchscreenClass::DoFilamentRunoutCheck() {
                        "S1567\nM300 P200 S1174\nM300 P2000 S1567"));
 
       // tell the user that the filament has run out and wait
-      SENDLINE_DBG_PGM("J23", "TFT Serial Debug: Blocking filament prompt... J23");
+      Notify(AMNOTIFY_RUNOUT_PROMPT);
     } else {
-      SENDLINE_DBG_PGM("J15", "TFT Serial Debug: Non blocking filament runout... J15");
+      Notify(AMNOTIFY_RUNOUT);
     }
   }
   #endif // FILAMENT_RUNOUT_SENSOR
@@ -1085,39 +1206,54 @@ void AnycubicTouchscreenClass::GetCommandFromTFT() {
       TFTcmdbuffer[TFTbufindw][serial3_count] = 0; // terminate string
 
       if (!TFTcomment_mode) {
-        if ((strchr(TFTcmdbuffer[TFTbufindw], 'A') != NULL)) {
-          TFTstrchr_pointer = strchr(TFTcmdbuffer[TFTbufindw], 'A');
-          switch ((int)((strtod(&TFTcmdbuffer[TFTbufindw][TFTstrchr_pointer - TFTcmdbuffer[TFTbufindw] + 1], NULL)))) {
+        IndexCommand(TFTcmdbuffer[TFTbufindw]);
+        if (CodeSeen('A')) {
+          // The TFT only sends plain integer opcodes
+          uint16_t opcode = 0;
+          for (const char* p = TFTstrchr_pointer + 1; NUMERIC(*p); p++) opcode = opcode * 10 + (*p - '0');
+          switch (opcode) {
             case 0: // A0 GET HOTEND TEMP
-              SEND_PGM_VAL("A0V ", int(getActualTemp_celsius(E0) + 0.5));
+              if (!txRoomForStatus()) break;
+              RefreshStatus();
+              SEND_PGM("A0V ");
+              SENDLINE(status.hotend);
               break;
 
             case 1: // A1  GET HOTEND TARGET TEMP
-              SEND_PGM_VAL("A1V ", int(getTargetTemp_celsius(E0) + 0.5));
+              if (!txRoomForStatus()) break;
+              RefreshStatus();
+              SEND_PGM("A1V ");
+              SENDLINE(status.hotendTarget);
               break;
 
             case 2: // A2 GET HOTBED TEMP
-              SEND_PGM_VAL("A2V ", int(getActualTemp_celsius(BED) + 0.5));
+              if (!txRoomForStatus()) break;
+              RefreshStatus();
+              SEND_PGM("A2V ");
+              SENDLINE(status.bed);
               break;
 
             case 3: // A3 GET HOTBED TARGET TEMP
-              SEND_PGM_VAL("A3V ", int(getTargetTemp_celsius(BED) + 0.5));
+              if (!txRoomForStatus()) break;
+              RefreshStatus();
+              SEND_PGM("A3V ");
+              SENDLINE(status.bedTarget);
               break;
 
             case 4: // A4 GET FAN SPEED
-              SEND_PGM_VAL("A4V ", int(getActualFan_percent(FAN0)));
+              if (!txRoomForStatus()) break;
+              RefreshStatus();
+              SEND_PGM("A4V ");
+              SENDLINE(status.fan);
               break;
             case 5: // A5 GET CURRENT COORDINATE
-              SEND_PGM("A5V X: ");
-              LCD_SERIAL.print(current_position[X_AXIS]);
-              SEND_PGM(" Y: ");
-              LCD_SERIAL.print(current_position[Y_AXIS]);
-              SEND_PGM(" Z: ");
-              LCD_SERIAL.print(current_position[Z_AXIS]);
-              SENDLINE_PGM("");
+              if (!txRoomForStatus()) break;
+              RefreshStatus();
+              SENDLINE(status.position);
               break;
 
             case 6: // A6 GET SD CARD PRINTING STATUS
+              if (!txRoomForStatus()) break;
   #ifdef SDSUPPORT
               if (isPrintingFromMedia()) {
                 SEND_PGM("A6V ");
@@ -1134,6 +1270,7 @@ void AnycubicTouchscreenClass::GetCommandFromTFT() {
               break;
 
             case 7: // A7 GET PRINTING TIME
+              if (!txRoomForStatus()) break;
               {
                 const uint32_t elapsedSeconds = getProgress_seconds_elapsed();
                 SEND_PGM("A7V ");
@@ -2014,6 +2151,43 @@ void AnycubicTouchscreenClass::GetCommandFromTFT() {
   }
   #endif
 
+  void AnycubicTouchscreenClass::Notify(const uint8_t event) {
+    constexpr uint8_t media  = AMNOTIFY_MEDIA_INSERTED | AMNOTIFY_MEDIA_REMOVED,
+                      job    = AMNOTIFY_PRINT_STARTED | AMNOTIFY_PRINT_DONE | AMNOTIFY_PRINT_STOPPED,
+                      runout = AMNOTIFY_RUNOUT | AMNOTIFY_RUNOUT_PROMPT;
+    if (event & media) pendingNotify &= ~media;
+    if (event & job) pendingNotify &= ~job;
+    if (event & runout) pendingNotify &= ~runout;
+    pendingNotify |= event;
+  }
+
+  // Send the pending notifications in a fixed order
+  void AnycubicTouchscreenClass::FlushNotifications(const millis_t ms) {
+    if (!pendingNotify) return;
+    const uint8_t pending = pendingNotify;
+    pendingNotify = 0;
+    if (pending & AMNOTIFY_MEDIA_INSERTED)
+      SENDLINE_DBG_PGM("J00", "TFT Serial Debug: SD card state changed... card inserted");
+    if (pending & AMNOTIFY_MEDIA_REMOVED)
+      SENDLINE_DBG_PGM("J01", "TFT Serial Debug: SD card state changed... card removed");
+    if (pending & AMNOTIFY_MEDIA_ERROR)
+      SENDLINE_DBG_PGM("J21", "TFT Serial Debug: SD Card Error ... J21");
+    if (pending & AMNOTIFY_PRINT_STARTED)
+      SENDLINE_DBG_PGM("J04", "TFT Serial Debug: Starting SD Print... soft endstops disabled J04");
+    if (pending & AMNOTIFY_PRINT_DONE)
+      SENDLINE_DBG_PGM("J14", "TFT Serial Debug: SD Print Completed... soft endstops enabled J14");
+    if (pending & AMNOTIFY_PRINT_STOPPED) {
+      if (PENDING(ms, stopNotify_ms))
+        pendingNotify |= AMNOTIFY_PRINT_STOPPED;
+      else
+        SENDLINE_DBG_PGM("J14", "TFT Serial Debug: SD Print Stopped... J14");
+    }
+    if (pending & AMNOTIFY_RUNOUT)
+      SENDLINE_DBG_PGM("J15", "TFT Serial Debug: Non blocking filament runout... J15");
+    if (pending & AMNOTIFY_RUNOUT_PROMPT)
+      SENDLINE_DBG_PGM("J23", "TFT Serial Debug: Blocking filament prompt... J23");
+  }
+
   #if ENABLED(KNUTWURST_4MAXP2)
   void PowerDown() {
     #if ENABLED(ANYCUBIC_TFT_DEBUG)
@@ -2041,12 +2215,14 @@ void AnycubicTouchscreenClass::GetCommandFromTFT() {
         mediaPrintingState = AMPRINTSTATE_NOT_PRINTING;
         mediaPauseState    = AMPAUSESTATE_NOT_PAUSED;
         injectCommands(F("M84\nM27")); // disable stepper motors and force report of SD status
-        delay_ms(200);
-        // tell printer to release resources of print to indicate it is done
-        SENDLINE_DBG_PGM("J14", "TFT Serial Debug: SD Print Stopped... J14");
+        // tell printer to release resources of print to indicate it is done, once M84 has had time to run
+        stopNotify_ms = ms + 200UL;
+        Notify(AMNOTIFY_PRINT_STOPPED);
       }
     }
 
+    FlushNotifications(ms);
+
   #if ENABLED(KNUTWURST_4MAXP2)
     if (PrintdoneAndPowerOFF && powerOFFflag && (thermalManager.degHotend(0) < 50)) {
       powerOFFflag = 0;
@@ -2067,8 +2243,7 @@ void AnycubicTouchscreenClass::GetCommandFromTFT() {
   void AnycubicTouchscreenClass::OnPrintTimerStarted() {
   #if ENABLED(SDSUPPORT)
     if (mediaPrintingState == AMPRINTSTATE_PRINTING) {
-      SENDLINE_DBG_PGM("J04",
-                       "TFT Serial Debug: Starting SD Print... soft endstops disabled J04"); // J04 Starting Print
+      Notify(AMNOTIFY_PRINT_STARTED); // J04 Starting Print
       setSoftEndstopState(false);
       live_Zoffset = 0.0;
       powerOFFflag = false;
@@ -2092,7 +2267,7 @@ void AnycubicTouchscreenClass::GetCommandFromTFT() {
       mediaPauseState    = AMPAUSESTATE_NOT_PAUSED;
       setSoftEndstopState(true);
       powerOFFflag = true;
-      SENDLINE_DBG_PGM("J14", "TFT Serial Debug: SD Print Completed... soft endstops enabled J14");
+      Notify(AMNOTIFY_PRINT_DONE);
     }
       // otherwise it was stopped by the printer so don't send print completed
       // signal to TFT
@@ -23,11 +23,13 @@
 
 #include "../../../inc/MarlinConfigPre.h"
 #include "../../../module/probe.h"
+#include "../../../libs/numtostr.h"
 
 #define TFTBUFSIZE                 4
 #define TFT_MAX_CMD_SIZE           96
 #define MSG_MY_VERSION             CUSTOM_BUILD_VERSION
 #define MAX_PRINTABLE_FILENAME_LEN 26
+#define TFT_STATUS_REFRESH_MS      250 // Answer repeated status polls from the same snapshot
 
 enum AnycubicMediaPrintState {
   AMPRINTSTATE_NOT_PRINTING,
@@ -50,6 +52,18 @@ enum AnycubicMediaPauseState {
   AMPAUSESTATE_PAUSED
 };
 
+// Notifications waiting to go to the TFT. A new state replaces any pending one of the same group.
+enum AnycubicNotify : uint8_t {
+  AMNOTIFY_MEDIA_INSERTED = _BV(0), // J00
+  AMNOTIFY_MEDIA_REMOVED  = _BV(1), // J01
+  AMNOTIFY_MEDIA_ERROR    = _BV(2), // J21
+  AMNOTIFY_PRINT_STARTED  = _BV(3), // J04
+  AMNOTIFY_PRINT_DONE     = _BV(4), // J14
+  AMNOTIFY_PRINT_STOPPED  = _BV(5), // J14, once the stop has settled
+  AMNOTIFY_RUNOUT         = _BV(6), // J15
+  AMNOTIFY_RUNOUT_PROMPT  = _BV(7)  // J23
+};
+
 
 #define SM_DIR_UP_S        "DIR_UP~1.GCO"
 #define SM_SPECIAL_MENU_S  "<SPECI~1.GCO"
@@ -93,6 +107,8 @@ enum AnycubicMediaPauseState {
 #define SM_BLTZ_EXIT_S     "<EXTABLM.GCO"
 #define SM_HS_DISABLE_S    "<HSDISAB.GCO"
 #define SM_HS_ENABLE_S     "<HSENABL.GCO"
+#define SM_PROFILE_0_S     "<PROFL00.GCO"
+#define SM_PROFILE_1_S     "<PROFL01.GCO"
 
 
 #if DISABLED(KNUTWURST_DGUS2_TFT)
@@ -138,6 +154,8 @@ enum AnycubicMediaPauseState {
   #define SM_BLTZ_EXIT_L     "<SAVE and EXIT>"
   #define SM_HS_DISABLE_L    "<Disable HiSpeed Mode>"
   #define SM_HS_ENABLE_L     "<Enable HiSpeed Mode>"
+  #define SM_PROFILE_0_L     "<Apply Profile 0>"
+  #define SM_PROFILE_1_L     "<Apply Profile 1>"
 #endif // !KNUTWURST_DGUS2_TFT
 
 #if ENABLED(KNUTWURST_DGUS2_TFT)
@@ -183,6 +201,8 @@ enum AnycubicMediaPauseState {
   #define SM_BLTZ_EXIT_L     "<SAVE and EXIT>     .gcode"
   #define SM_HS_DISABLE_L    "<Disable HiSpeed>   .gcode"
   #define SM_HS_ENABLE_L     "<Enable HiSpeed>    .gcode"
+  #define SM_PROFILE_0_L     "<Apply Profile 0>   .gcode"
+  #define SM_PROFILE_1_L     "<Apply Profile 1>   .gcode"
 #endif // KNUTWURST_DGUS2_TFT
 
 class AnycubicTouchscreenClass {
@@ -218,6 +238,8 @@ class AnycubicTouchscreenClass {
     char       serial3_char;
     int        serial3_count = 0;
     char*      TFTstrchr_pointer;
+    char*      TFTparamLine = TFTcmdbuffer[0];
+    uint8_t    TFTparamPos[26] = { 0 }; // 1 + index of the first 'A'-'Z' in TFTparamLine
     char       FlagResumFromOutage  = 0;
     uint16_t   HeaterCheckCount     = 0;
     int        currentFlowRate      = 0;
@@ -226,6 +248,18 @@ class AnycubicTouchscreenClass {
     xy_uint8_t selectedmeshpoint;
     float      live_Zoffset;
 
+    // Pre-formatted replies to the A0-A5 status polls
+    // Each is formatted again only when its value changes
+    struct StatusSnapshot {
+      millis_t next_ms = 0;
+      CachedStr<int16_t, i16tostr3rj, 4> hotend, hotendTarget, bed, bedTarget, fan;
+      xyz_pos_t last_pos = { NAN, NAN, NAN };
+      char     position[48];
+    } status;
+
+    uint8_t  pendingNotify = 0;   // AnycubicNotify bits
+    millis_t stopNotify_ms = 0;   // When AMNOTIFY_PRINT_STOPPED may be sent
+
     static AnycubicMediaPrintState mediaPrintingState;
     static AnycubicMediaPauseState mediaPauseState;
 
@@ -243,6 +277,10 @@ class AnycubicTouchscreenClass {
     int   CodeValueInt();
     float CodeValue();
     bool  CodeSeen(char);
+    void  IndexCommand(char*);
+    void  RefreshStatus();
+    void  Notify(const uint8_t);
+    void  FlushNotifications(const millis_t);
     void  StartPrint();
     void  PausePrint();
     void  ResumePrint();
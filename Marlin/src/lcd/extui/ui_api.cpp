@@ -966,6 +966,7 @@ namespace ExtUI {
         if (WITHIN(pos.x, 0, (GRID_MAX_POINTS_X) - 1) && WITHIN(pos.y, 0, (GRID_MAX_POINTS_Y) - 1)) {
           bedlevel.z_values[pos.x][pos.y] = zoff;
           TERN_(ABL_BILINEAR_SUBDIVISION, bedlevel.refresh_bed_level());
+          TERN_(UBL_MESH_GRADIENTS, bedlevel.refresh_gradients());
         }
       }
 
@@ -1220,7 +1221,32 @@ namespace ExtUI {
 
 void MarlinUI::init_lcd() { ExtUI::onStartup(); }
 
-void MarlinUI::update() { ExtUI::onIdle(); }
+#if ENABLED(EXTUI_IDLE_THROTTLE)
+
+  // Give the UI its turn only when motion can spare it, but never less often than EXTUI_IDLE_MAX_INTERVAL
+  void MarlinUI::update() {
+    static millis_t next_ms, window_ms;
+    static uint32_t used_us;
+
+    const millis_t ms = millis();
+    if (ELAPSED(ms, window_ms)) { window_ms = ms + 1000UL; used_us = 0; }
+
+    if (PENDING(ms, next_ms)) {
+      const bool starving = planner.has_blocks_queued() && planner.movesplanned() < (EXTUI_IDLE_MIN_MOVES);
+      if (starving || used_us >= (EXTUI_IDLE_BUDGET_MS) * 1000UL) return;
+    }
+    next_ms = ms + (EXTUI_IDLE_MAX_INTERVAL);
+
+    const uint32_t start_us = micros();
+    ExtUI::onIdle();
+    used_us += micros() - start_us;
+  }
+
+#else
+
+  void MarlinUI::update() { ExtUI::onIdle(); }
+
+#endif
 
 void MarlinUI::kill_screen(FSTR_P const error, FSTR_P const component) {
   using namespace ExtUI;
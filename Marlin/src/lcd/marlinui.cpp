@@ -1115,7 +1115,15 @@ void MarlinUI::init() {
       // Then we want to use only 50% of the time
       const uint16_t bbr2 = planner.block_buffer_runtime() >> 1;
 
-      if ((should_draw() || drawing_screen) && (!bbr2 || bbr2 > max_display_update_time)) {
+      #ifdef LCD_PAGE_DEFER_BLOCKS
+        // Hold the next page while the planner is short of moves and there are commands to feed it
+        const uint8_t moves = planner.movesplanned();
+        const bool page_ok = !moves || moves >= (LCD_PAGE_DEFER_BLOCKS) || !queue.has_commands_queued();
+      #else
+        constexpr bool page_ok = true;
+      #endif
+
+      if ((should_draw() || drawing_screen) && page_ok && (!bbr2 || bbr2 > max_display_update_time)) {
 
         // Change state of drawing flag between screen updates
         if (!drawing_screen) switch (lcdDrawUpdate) {
@@ -1156,7 +1164,7 @@ void MarlinUI::init() {
             // The screen handler can clear drawing_screen for an action that changes the screen.
             // If still drawing and there's another page, update max-time and return now.
             // The nextPage will already be set up on the next call.
-            if (drawing_screen && (drawing_screen = u8g.nextPage())) {
+            if (drawing_screen && (drawing_screen = TERN(STATUS_DIRTY_PAGES, next_page(), u8g.nextPage()))) {
               if (on_status_screen())
                 NOLESS(max_display_update_time, millis() - ms);
               return;
@@ -43,6 +43,10 @@
   #include "../module/printcounter.h"
 #endif
 
+#if ENABLED(ESTIMATE_REMAINING_TIME)
+  #include "../feature/print_estimator.h"
+#endif
+
 #if ENABLED(ADVANCED_PAUSE_FEATURE)
   #include "../feature/pause.h"
 #endif
@@ -316,6 +320,10 @@ public:
     #endif
     #if ANY(SHOW_REMAINING_TIME, SET_PROGRESS_MANUALLY)
       static uint32_t _calculated_remaining_time() {
+        #if ENABLED(ESTIMATE_REMAINING_TIME)
+          const uint32_t est = print_estimator.remaining();
+          if (est) return est;
+        #endif
         const duration_t elapsed = print_job_timer.duration();
         const progress_t progress = _get_progress();
         return progress ? elapsed.value * (100 * (PROGRESS_SCALE) - progress) / progress : 0;
@@ -501,6 +509,10 @@ public:
 
     #if HAS_MARLINUI_U8GLIB
       static bool drawing_screen, first_page;
+      #if ENABLED(STATUS_DIRTY_PAGES)
+        static bool next_page();
+        static void invalidate_pages();
+      #endif
     #else
       static constexpr bool drawing_screen = false, first_page = true;
     #endif
@@ -34,7 +34,21 @@ uint8_t *TFT_Queue::current_task = nullptr;
 uint8_t *TFT_Queue::last_task = nullptr;
 uint8_t *TFT_Queue::last_parameter = nullptr;
 
+#if ENABLED(TFT_CANVAS_CACHE)
+  canvasCacheEntry_t TFT_Queue::cache[TFT_CANVAS_CACHE_SIZE];
+  uint8_t TFT_Queue::cache_next; // = 0
+  uint32_t TFT_Queue::sketch_hash;
+#endif
+
 void TFT_Queue::reset() {
+  // Aborted transfers may leave cached areas out of date
+  #if ENABLED(TFT_CANVAS_CACHE)
+    for (auto &entry : cache) entry.width = 0;
+  #endif
+  finish();
+}
+
+void TFT_Queue::finish() {
   tft.abort();
 
   end_of_queue = queue;
@@ -58,7 +72,7 @@ void TFT_Queue::async() {
   finish_sketch();
 
   switch (task->type) {
-    case TASK_END_OF_QUEUE: reset();      break;
+    case TASK_END_OF_QUEUE: finish();     break;
     case TASK_FILL:         fill(task);   break;
     case TASK_CANVAS:       canvas(task); break;
   }
@@ -69,6 +83,16 @@ void TFT_Queue::finish_sketch() {
   queueTask_t *task = (queueTask_t *)last_task;
 
   if (task->state == TASK_STATE_SKETCH) {
+    #if ENABLED(TFT_CANVAS_CACHE)
+      parametersCanvas_t *task_parameters = (parametersCanvas_t *)(((uint8_t *)task) + sizeof(queueTask_t));
+      if (cache_update(task_parameters->x, task_parameters->y, task_parameters->width, task_parameters->height, true)) {
+        // The area already shows this canvas. Drop the task, leaving the end of the queue in its place.
+        end_of_queue = last_task;
+        task->type = TASK_END_OF_QUEUE;
+        task->state = TASK_STATE_READY;
+        return;
+      }
+    #endif
     *end_of_queue = TASK_END_OF_QUEUE;
     task->nextTask = end_of_queue;
     task->state = TASK_STATE_READY;
@@ -142,8 +166,44 @@ void TFT_Queue::canvas(queueTask_t *task) {
   if (Canvas.ToScreen()) task->state = TASK_STATE_COMPLETED;
 }
 
+#if ENABLED(TFT_CANVAS_CACHE)
+
+  // FNV-1a hash of the canvas content, excluding queue pointers
+  void TFT_Queue::hash_add(const void *data, uint16_t size) {
+    const uint8_t *b = (const uint8_t *)data;
+    while (size--) sketch_hash = (sketch_hash ^ *b++) * 16777619UL;
+  }
+
+  /**
+   * Record a canvas or fill sent to an area. Cached areas it overlaps are forgotten.
+   * Return true if the canvas matches the one last sent to the same area.
+   */
+  bool TFT_Queue::cache_update(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const bool is_canvas) {
+    canvasCacheEntry_t *slot = nullptr;
+    for (auto &entry : cache) {
+      if (!entry.width) continue;
+      if (is_canvas && entry.x == x && entry.y == y && entry.width == width && entry.height == height) {
+        if (entry.hash == sketch_hash) return true;
+        slot = &entry;
+      }
+      else if (entry.x < x + width && x < entry.x + entry.width && entry.y < y + height && y < entry.y + entry.height)
+        entry.width = 0;
+    }
+    if (is_canvas) {
+      if (!slot) {
+        slot = &cache[cache_next];
+        if (++cache_next >= TFT_CANVAS_CACHE_SIZE) cache_next = 0;
+      }
+      *slot = { x, y, width, height, sketch_hash };
+    }
+    return false;
+  }
+
+#endif
+
 void TFT_Queue::fill(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
   finish_sketch();
+  TERN_(TFT_CANVAS_CACHE, cache_update(x, y, width, height, false));
 
   queueTask_t *task = (queueTask_t *)end_of_queue;
   last_task = (uint8_t *)task;
@@ -189,6 +249,8 @@ void TFT_Queue::canvas(uint16_t x, uint16_t y, uint16_t width, uint16_t height)
   task_parameters->height = height;
   task_parameters->count = 0;
 
+  TERN_(TFT_CANVAS_CACHE, sketch_hash = 2166136261UL);
+
   if (!current_task) current_task = (uint8_t *)task;
 }
 
@@ -201,6 +263,10 @@ void TFT_Queue::set_background(uint16_t color) {
   parameters->type = CANVAS_SET_BACKGROUND;
   parameters->color = ENDIAN_COLOR(color);
 
+  #if ENABLED(TFT_CANVAS_CACHE)
+    hash_add(CANVAS_SET_BACKGROUND); hash_add(color);
+  #endif
+
   end_of_queue += sizeof(parametersCanvasBackground_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
@@ -238,6 +304,11 @@ void TFT_Queue::add_text(uint16_t x, uint16_t y, uint16_t color, const uint8_t *
   parameters->nextParameter = end_of_queue;
   parameters->stringLength = pointer - string;
   task_parameters->count++;
+
+  #if ENABLED(TFT_CANVAS_CACHE)
+    hash_add(CANVAS_ADD_TEXT); hash_add(x); hash_add(y); hash_add(color); hash_add(maxWidth);
+    hash_add(string, parameters->stringLength);
+  #endif
 }
 
 void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *colors) {
@@ -255,6 +326,10 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
 
+  #if ENABLED(TFT_CANVAS_CACHE)
+    hash_add(CANVAS_ADD_IMAGE); hash_add(x); hash_add(y); hash_add(image);
+  #endif
+
   colorMode_t color_mode = Images[image].colorMode;
 
   if (color_mode == HIGHCOLOR) return;
@@ -269,6 +344,8 @@ void TFT_Queue::add_image(int16_t x, int16_t y, MarlinImage image, uint16_t *col
     default: break;
   }
 
+  TERN_(TFT_CANVAS_CACHE, hash_add(colors, color_count * sizeof(uint16_t)));
+
   uint16_t tmp;
   while (color_count--) {
     tmp = *colors++;
@@ -331,6 +408,10 @@ void TFT_Queue::add_bar(uint16_t x, uint16_t y, uint16_t width, uint16_t height,
   end_of_queue += sizeof(parametersCanvasBar_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+
+  #if ENABLED(TFT_CANVAS_CACHE)
+    hash_add(CANVAS_ADD_BAR); hash_add(x); hash_add(y); hash_add(width); hash_add(height); hash_add(color);
+  #endif
 }
 
 void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t height, uint16_t color) {
@@ -349,6 +430,10 @@ void TFT_Queue::add_rectangle(uint16_t x, uint16_t y, uint16_t width, uint16_t h
   end_of_queue += sizeof(parametersCanvasRectangle_t);
   task_parameters->count++;
   parameters->nextParameter = end_of_queue;
+
+  #if ENABLED(TFT_CANVAS_CACHE)
+    hash_add(CANVAS_ADD_RECTANGLE); hash_add(x); hash_add(y); hash_add(width); hash_add(height); hash_add(color);
+  #endif
 }
 
 #endif // HAS_GRAPHICAL_TFT
@@ -29,6 +29,10 @@
   #define TFT_QUEUE_SIZE              8192
 #endif
 
+#if ENABLED(TFT_CANVAS_CACHE) && !defined(TFT_CANVAS_CACHE_SIZE)
+  #define TFT_CANVAS_CACHE_SIZE         32
+#endif
+
 enum QueueTaskType : uint8_t {
   TASK_END_OF_QUEUE = 0x00,
   TASK_FILL,
@@ -118,6 +122,14 @@ typedef struct __attribute__((__packed__)) {
   uint16_t color;
 } parametersCanvasRectangle_t;
 
+#if ENABLED(TFT_CANVAS_CACHE)
+  // A screen area with the hash of the canvas last sent to it
+  typedef struct {
+    uint16_t x, y, width, height;
+    uint32_t hash;
+  } canvasCacheEntry_t;
+#endif
+
 class TFT_Queue {
   private:
     static uint8_t queue[TFT_QUEUE_SIZE];
@@ -127,10 +139,20 @@ class TFT_Queue {
     static uint8_t *last_parameter;
 
     static void finish_sketch();
+    static void finish();
     static void fill(queueTask_t *task);
     static void canvas(queueTask_t *task);
     static void handle_queue_overflow(uint16_t sizeNeeded);
 
+    #if ENABLED(TFT_CANVAS_CACHE)
+      static canvasCacheEntry_t cache[TFT_CANVAS_CACHE_SIZE];
+      static uint8_t cache_next;
+      static uint32_t sketch_hash;
+      static void hash_add(const void *data, uint16_t size);
+      static void hash_add(const uint16_t value) { hash_add(&value, sizeof(value)); }
+      static bool cache_update(uint16_t x, uint16_t y, uint16_t width, uint16_t height, const bool is_canvas);
+    #endif
+
   public:
     static void reset();
     static void async();
@@ -21,15 +21,29 @@
  */
 #pragma once
 
-#include <stdint.h>
+#include "../core/types.h"
+
+#ifdef __AVR__
+  #include <avr/io.h>
+  #include <avr/interrupt.h>
+#endif
 
 /**
  * @brief   Circular Queue class
- * @details Implementation of the classic ring buffer data structure
+ * @details Implementation of the classic ring buffer data structure, safe for
+ *          one producer and one consumer, either of which may be an ISR.
+ *          The head and tail are free-running counters, masked on access, so
+ *          each side writes only its own index and no shared count is needed.
+ *          N must be a power of 2.
  */
-template<typename T, uint8_t N>
+template<typename T, uint16_t N>
 class CircularQueue {
+  static_assert(N && !(N & (N - 1)), "CircularQueue size must be a power of 2.");
+  static_assert(N <= 0x8000, "CircularQueue size must be 32768 or less.");
+
   private:
+    // Index type holding 0 .. 2N-1, so full and empty can be told apart
+    typedef typename IF<(N <= 0x80), uint8_t, uint16_t>::type idx_t;
 
     /**
      * @brief   Buffer structure
@@ -37,13 +51,31 @@ class CircularQueue {
      *          a circular queue such as the pointers and the buffer vector.
      */
     struct buffer_t {
-      uint8_t head;
-      uint8_t tail;
-      uint8_t count;
-      uint8_t size;
+      volatile idx_t head;  // Written only by the consumer
+      volatile idx_t tail;  // Written only by the producer
       T queue[N];
     } buffer;
 
+    /**
+     * @brief   Reads an index written by the other side
+     * @details A 16-bit index takes two loads on AVR, so an ISR could change it
+     *          in between. Read it with interrupts off.
+     */
+    static idx_t load(const volatile idx_t &i) {
+      #ifdef __AVR__
+        if (sizeof(idx_t) > 1) {
+          const uint8_t sreg = SREG;
+          cli();
+          const idx_t v = i;
+          SREG = sreg;
+          return v;
+        }
+      #endif
+      return i;
+    }
+
+    static uint16_t slot(const idx_t i) { return i & (N - 1); }
+
   public:
     /**
      * @brief   Class constructor
@@ -51,10 +83,7 @@ class CircularQueue {
      *          of item this queue will handle and N defines the maximum number of
      *          items that can be stored on the queue.
      */
-    CircularQueue<T, N>() {
-      buffer.size = N;
-      buffer.count = buffer.head = buffer.tail = 0;
-    }
+    CircularQueue<T, N>() { buffer.head = buffer.tail = 0; }
 
     /**
      * @brief   Removes and returns a item from the queue
@@ -64,14 +93,10 @@ class CircularQueue {
      */
     T dequeue() {
       if (isEmpty()) return T();
-
-      uint8_t index = buffer.head;
-
-      --buffer.count;
-      if (++buffer.head == buffer.size)
-        buffer.head = 0;
-
-      return buffer.queue[index];
+      const idx_t h = buffer.head;
+      const T item = buffer.queue[slot(h)];
+      buffer.head = idx_t(h + 1);
+      return item;
     }
 
     /**
@@ -83,14 +108,40 @@ class CircularQueue {
      */
     bool enqueue(T const &item) {
       if (isFull()) return false;
+      const idx_t t = buffer.tail;
+      buffer.queue[slot(t)] = item;
+      buffer.tail = idx_t(t + 1);
+      return true;
+    }
 
-      buffer.queue[buffer.tail] = item;
-
-      ++buffer.count;
-      if (++buffer.tail == buffer.size)
-        buffer.tail = 0;
+    /**
+     * @brief   Removes up to n items from the queue
+     * @details Copies the oldest items into dest and releases them with a
+     *          single update of the head.
+     * @return  the number of items removed
+     */
+    uint16_t dequeue(T * const dest, uint16_t n) {
+      const idx_t h = buffer.head;
+      const uint16_t c = idx_t(load(buffer.tail) - h);
+      if (n > c) n = c;
+      for (uint16_t i = 0; i < n; ++i) dest[i] = buffer.queue[slot(h + i)];
+      buffer.head = idx_t(h + n);
+      return n;
+    }
 
-      return true;
+    /**
+     * @brief   Adds up to n items to the queue
+     * @details Copies the items from src and publishes them with a single
+     *          update of the tail.
+     * @return  the number of items added
+     */
+    uint16_t enqueue(const T * const src, uint16_t n) {
+      const idx_t t = buffer.tail;
+      const uint16_t f = N - idx_t(t - load(buffer.head));
+      if (n > f) n = f;
+      for (uint16_t i = 0; i < n; ++i) buffer.queue[slot(t + i)] = src[i];
+      buffer.tail = idx_t(t + n);
+      return n;
     }
 
     /**
@@ -98,21 +149,21 @@ class CircularQueue {
      * @details Returns true if there are no items on the queue, false otherwise.
      * @return  true if queue is empty
      */
-    bool isEmpty() { return buffer.count == 0; }
+    bool isEmpty() { return count() == 0; }
 
     /**
      * @brief   Checks if the queue is full
      * @details Returns true if the queue is full, false otherwise.
      * @return  true if queue is full
      */
-    bool isFull() { return buffer.count == buffer.size; }
+    bool isFull() { return count() == N; }
 
     /**
      * @brief   Gets the queue size
      * @details Returns the maximum number of items a queue can have.
      * @return  the queue size
      */
-    uint8_t size() { return buffer.size; }
+    uint16_t size() { return N; }
 
     /**
      * @brief   Gets the next item from the queue without removing it
@@ -120,12 +171,12 @@ class CircularQueue {
      *          or updating the pointers.
      * @return  first item in the queue
      */
-    T peek() { return buffer.queue[buffer.head]; }
+    T peek() { return buffer.queue[slot(buffer.head)]; }
 
     /**
      * @brief Gets the number of items on the queue
      * @details Returns the current number of items stored on the queue.
      * @return number of items in the queue
      */
-    uint8_t count() { return buffer.count; }
+    uint16_t count() { return idx_t(load(buffer.tail) - load(buffer.head)); }
 };
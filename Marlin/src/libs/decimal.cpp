@@ -0,0 +1,104 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "decimal.h"
+
+#include "../inc/MarlinConfig.h"
+
+static const float pow10_table[] PROGMEM = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+
+// Largest value that can take one more digit in a uint32_t
+#define DECIMAL_MANTISSA_MAX 429496728UL
+
+/**
+ * Scan the sign and digits of a number into an integer mantissa and a power of ten.
+ * Digits past the capacity of the mantissa are counted in the exponent or dropped.
+ * Return a pointer past the number, or nullptr if there were no digits.
+ */
+static const char* scan_decimal(const char *p, bool &neg, uint32_t &mantissa, int16_t &exp10, uint8_t *next_digit=nullptr) {
+  while (*p == ' ') ++p;
+  neg = (*p == '-');
+  if (neg || *p == '+') ++p;
+
+  uint32_t m = 0;
+  int16_t e = 0;
+  bool digits = false;
+  uint8_t dropped = 0;
+
+  for (; NUMERIC(*p); ++p) {
+    digits = true;
+    if (m <= DECIMAL_MANTISSA_MAX) m = m * 10 + (*p - '0'); else ++e;
+  }
+  if (*p == '.') {
+    for (++p; NUMERIC(*p); ++p) {
+      digits = true;
+      if (m <= DECIMAL_MANTISSA_MAX) { m = m * 10 + (*p - '0'); --e; }
+      else if (!dropped) dropped = *p - '0' + 1;
+    }
+  }
+  if (next_digit) *next_digit = dropped;
+
+  mantissa = m;
+  exp10 = e;
+  return digits ? p : nullptr;
+}
+
+float decimal_to_float(const char *str, char **end/*=nullptr*/) {
+  bool neg;
+  uint32_t m;
+  int16_t e;
+  const char * const p = scan_decimal(str, neg, m, e);
+  if (end) *end = const_cast<char*>(p ? p : str);
+  if (!p || !m) return neg ? -0.0f : 0.0f;
+
+  float f = float(m);
+  for (; e > 10; e -= 10) f *= 1e10f;
+  for (; e < -10; e += 10) f /= 1e10f;
+  if (e > 0)
+    f *= pgm_read_float(&pow10_table[e]);
+  else if (e < 0)
+    f /= pgm_read_float(&pow10_table[-e]);
+  return neg ? -f : f;
+}
+
+int32_t decimal_to_fixed(const char *str, const uint8_t places, char **end/*=nullptr*/) {
+  bool neg;
+  uint32_t m;
+  int16_t e;
+  uint8_t next;
+  const char * const p = scan_decimal(str, neg, m, e, &next);
+  if (end) *end = const_cast<char*>(p ? p : str);
+  if (!p) return 0;
+
+  // Shift the mantissa to 'places' decimals, rounding half away from zero
+  e += places;
+  if (e >= 0) {
+    while (e--) m *= 10;
+  }
+  else {
+    for (; e < -1; ++e) m /= 10;
+    next = m % 10 + 1;
+    m /= 10;
+  }
+  if (next > 5) ++m;
+  return neg ? -int32_t(m) : int32_t(m);
+}
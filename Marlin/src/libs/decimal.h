@@ -0,0 +1,39 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * decimal.h - Decimal number scanner for G-code values
+ *
+ * G-code numbers are only [+|-]digits[.digits], so a dedicated scanner
+ * can skip the locale, exponent, hex, inf/nan and rounding handling of
+ * strtod, which is slow on AVR. Up to 9 significant digits are used and
+ * the result is within one float ULP of strtof.
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+// Scan a float. Like strtof, 'end' is set past the number, or to 'str' if there are no digits.
+float decimal_to_float(const char *str, char **end=nullptr);
+
+// Scan a fixed-point value with 'places' decimals, i.e., the value * 10^places, rounded.
+int32_t decimal_to_fixed(const char *str, const uint8_t places, char **end=nullptr);
@@ -0,0 +1,86 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * fixed_point.h - Small fixed-point helpers for 8-bit MCUs
+ *
+ * On AVR a float divide or square root costs several hundred cycles,
+ * while a 32x32 multiply is a fraction of that. These helpers let hot
+ * paths trade divides for multiplies by a precomputed reciprocal.
+ *
+ *   ufix16_t : Unsigned Q16.16 (range 0 ... 65535.99998)
+ *   ufix8_t  : Unsigned Q24.8  (range 0 ... 16777215.996)
+ */
+
+#include "../core/macros.h"
+
+typedef uint32_t ufix16_t;
+typedef uint32_t ufix8_t;
+
+#define UFIX16_ONE  0x10000UL
+#define UFIX8_ONE   0x100UL
+
+// Convert a non-negative float to fixed point, saturating at the top of the range
+constexpr ufix16_t ufix16_from_float(const float f) {
+  return f <= 0 ? 0 : f >= 65535.99998f ? 0xFFFFFFFFUL : ufix16_t(f * float(UFIX16_ONE) + 0.5f);
+}
+constexpr ufix8_t ufix8_from_float(const float f) {
+  return f <= 0 ? 0 : f >= 16777215.5f ? 0xFFFFFFFFUL : ufix8_t(f * float(UFIX8_ONE) + 0.5f);
+}
+constexpr float ufix16_to_float(const ufix16_t q) { return float(q) * (1.0f / float(UFIX16_ONE)); }
+constexpr float ufix8_to_float(const ufix8_t q) { return float(q) * (1.0f / float(UFIX8_ONE)); }
+
+// Multiply an integer by a Q16.16 factor, rounding down or up
+FORCE_INLINE uint32_t ufix16_mul(const uint32_t v, const ufix16_t q) { return uint32_t((uint64_t(v) * q) >> 16); }
+FORCE_INLINE uint32_t ufix16_mul_ceil(const uint32_t v, const ufix16_t q) { return uint32_t((uint64_t(v) * q + 0xFFFFUL) >> 16); }
+
+// Multiply by a Q0.32 reciprocal, i.e., divide by the value the reciprocal was taken from
+FORCE_INLINE uint32_t mul_reciprocal_q32(const uint32_t v, const uint32_t r) { return uint32_t((uint64_t(v) * r) >> 32); }
+
+// Q0.32 reciprocal of d, saturated so that d == 1 still fits
+FORCE_INLINE uint32_t reciprocal_q32(const uint32_t d) { return d > 1 ? uint32_t(0x100000000ULL / d) : 0xFFFFFFFFUL; }
+
+/**
+ * Integer square root, rounded down.
+ * Bit-by-bit method: 16 iterations of shift, compare and subtract.
+ */
+inline uint16_t isqrt32(uint32_t v) {
+  uint32_t res = 0, bit = 1UL << 30;
+  while (bit > v) bit >>= 2;
+  while (bit) {
+    if (v >= res + bit) {
+      v -= res + bit;
+      res = (res >> 1) + bit;
+    }
+    else
+      res >>= 1;
+    bit >>= 2;
+  }
+  return uint16_t(res);
+}
+
+// Square root of a Q16.16 value, also in Q16.16
+inline ufix16_t ufix16_sqrt(const ufix16_t q) {
+  // sqrt(q / 2^16) * 2^16 == sqrt(q) * 2^8, so pre-shift by as much as fits
+  return q < _BV32(16) ? ufix16_t(isqrt32(q << 16)) : ufix16_t(isqrt32(q)) << 8;
+}
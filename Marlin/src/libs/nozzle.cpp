@@ -30,6 +30,7 @@ Nozzle nozzle;
 
 #include "../MarlinCore.h"
 #include "../module/motion.h"
+#include "../module/planner.h"
 
 #if NOZZLE_CLEAN_MIN_TEMP > 20
   #include "../module/temperature.h"
@@ -53,26 +54,27 @@ Nozzle nozzle;
     // Move to the starting point
     #if ENABLED(NOZZLE_CLEAN_NO_Z)
       #if ENABLED(NOZZLE_CLEAN_NO_Y)
-        do_blocking_move_to_x(start.x);
+        do_move_to(xy_pos_t({ start.x, current_position.y }));
       #else
-        do_blocking_move_to_xy(start);
+        do_move_to(xy_pos_t(start));
       #endif
     #else
-      do_blocking_move_to(start);
+      do_move_to(start);
     #endif
 
     // Start the stroke pattern
     for (uint8_t i = 0; i < strokes >> 1; ++i) {
       #if ENABLED(NOZZLE_CLEAN_NO_Y)
-        do_blocking_move_to_x(end.x);
-        do_blocking_move_to_x(start.x);
+        do_move_to(xy_pos_t({ end.x, current_position.y }));
+        do_move_to(xy_pos_t({ start.x, current_position.y }));
       #else
-        do_blocking_move_to_xy(end);
-        do_blocking_move_to_xy(start);
+        do_move_to(xy_pos_t(end));
+        do_move_to(xy_pos_t(start));
       #endif
     }
 
-    TERN_(NOZZLE_CLEAN_GOBACK, do_blocking_move_to(oldpos));
+    TERN_(NOZZLE_CLEAN_GOBACK, do_move_to(oldpos));
+    planner.synchronize();
   }
 
   /**
@@ -93,9 +95,9 @@ Nozzle nozzle;
     #endif
 
     #if ENABLED(NOZZLE_CLEAN_NO_Z)
-      do_blocking_move_to_xy(start);
+      do_move_to(xy_pos_t(start));
     #else
-      do_blocking_move_to(start);
+      do_move_to(start);
     #endif
 
     const uint8_t zigs = objects << 1;
@@ -106,20 +108,21 @@ Nozzle nozzle;
       for (int8_t i = 0; i < zigs; i++) {
         side = (i & 1) ? &end : &start;
         if (horiz)
-          do_blocking_move_to_xy(start.x + i * P, side->y);
+          do_move_to(xy_pos_t({ start.x + i * P, side->y }));
         else
-          do_blocking_move_to_xy(side->x, start.y + i * P);
+          do_move_to(xy_pos_t({ side->x, start.y + i * P }));
       }
       for (int8_t i = zigs; i >= 0; i--) {
         side = (i & 1) ? &end : &start;
         if (horiz)
-          do_blocking_move_to_xy(start.x + i * P, side->y);
+          do_move_to(xy_pos_t({ start.x + i * P, side->y }));
         else
-          do_blocking_move_to_xy(side->x, start.y + i * P);
+          do_move_to(xy_pos_t({ side->x, start.y + i * P }));
       }
     }
 
-    TERN_(NOZZLE_CLEAN_GOBACK, do_blocking_move_to(back));
+    TERN_(NOZZLE_CLEAN_GOBACK, do_move_to(back));
+    planner.synchronize();
   }
 
   /**
@@ -136,19 +139,20 @@ Nozzle nozzle;
     #if ENABLED(NOZZLE_CLEAN_GOBACK)
       const xyz_pos_t back = current_position;
     #endif
-    TERN(NOZZLE_CLEAN_NO_Z, do_blocking_move_to_xy, do_blocking_move_to)(start);
+    do_move_to(TERN(NOZZLE_CLEAN_NO_Z, xy_pos_t(start), start));
 
     for (uint8_t s = 0; s < strokes; ++s)
       for (uint8_t i = 0; i < NOZZLE_CLEAN_CIRCLE_FN; ++i)
-        do_blocking_move_to_xy(
+        do_move_to(xy_pos_t({
           middle.x + sin((RADIANS(360) / NOZZLE_CLEAN_CIRCLE_FN) * i) * radius,
           middle.y + cos((RADIANS(360) / NOZZLE_CLEAN_CIRCLE_FN) * i) * radius
-        );
+        }));
 
     // Let's be safe
-    do_blocking_move_to_xy(start);
+    do_move_to(xy_pos_t(start));
 
-    TERN_(NOZZLE_CLEAN_GOBACK, do_blocking_move_to(back));
+    TERN_(NOZZLE_CLEAN_GOBACK, do_move_to(back));
+    planner.synchronize();
   }
 
   /**
@@ -240,32 +244,36 @@ Nozzle nozzle;
   void Nozzle::park(const uint8_t z_action, const xyz_pos_t &park/*=NOZZLE_PARK_POINT*/) {
     constexpr feedRate_t fr_xy = NOZZLE_PARK_XY_FEEDRATE, fr_z = NOZZLE_PARK_Z_FEEDRATE;
 
+    xyz_pos_t park_z = current_position;
     switch (z_action) {
       case 1: // Go to Z-park height
-        do_blocking_move_to_z(park.z, fr_z);
+        park_z.z = park.z;
         break;
 
       case 2: // Raise by Z-park height
-        do_blocking_move_to_z(_MIN(current_position.z + park.z, Z_MAX_POS), fr_z);
+        park_z.z = _MIN(current_position.z + park.z, Z_MAX_POS);
         break;
 
       default: // Raise by NOZZLE_PARK_Z_RAISE_MIN, use park.z as a minimum height
-        do_blocking_move_to_z(park_mode_0_height(park.z), fr_z);
+        park_z.z = park_mode_0_height(park.z);
         break;
     }
+    do_move_to(park_z, fr_z);
 
     #ifndef NOZZLE_PARK_MOVE
       #define NOZZLE_PARK_MOVE 0
     #endif
+    const xy_pos_t park_x = { park.x, current_position.y }, park_y = { current_position.x, park.y };
     switch (NOZZLE_PARK_MOVE) {
-      case 0: do_blocking_move_to_xy(park, fr_xy); break;
-      case 1: do_blocking_move_to_x(park.x, fr_xy); break;
-      case 2: do_blocking_move_to_y(park.y, fr_xy); break;
-      case 3: do_blocking_move_to_x(park.x, fr_xy);
-              do_blocking_move_to_y(park.y, fr_xy); break;
-      case 4: do_blocking_move_to_y(park.y, fr_xy);
-              do_blocking_move_to_x(park.x, fr_xy); break;
+      case 0: do_move_to(xy_pos_t(park), fr_xy); break;
+      case 1: do_move_to(park_x, fr_xy); break;
+      case 2: do_move_to(park_y, fr_xy); break;
+      case 3: do_move_to(park_x, fr_xy);
+              do_move_to(xy_pos_t(park), fr_xy); break;
+      case 4: do_move_to(park_y, fr_xy);
+              do_move_to(xy_pos_t(park), fr_xy); break;
     }
+    planner.synchronize();
 
     report_current_position();
   }
@@ -129,3 +129,33 @@ FORCE_INLINE const char* ftostr3rj(const_float_t x) { return i16tostr3rj(int16_t
   // Convert signed float to rj string with 1234, _123, -123, __12, _-12, ___1, or __-1 format
   FORCE_INLINE const char* ftostr4sign(const_float_t x) { return i16tostr4signrj(int16_t(x + (x < 0 ? -0.5f : 0.5f))); }
 #endif
+
+/**
+ * A value kept in its formatted form, converted again only when the value changes.
+ * For values that are formatted for every status report or screen refresh.
+ *
+ *   CachedStr<int16_t, i16tostr3rj, 4> temp;
+ *   send(temp(thermalManager.wholeDegHotend(0)));
+ */
+template <typename T, const char* (*FMT)(T), uint8_t N>
+class CachedStr {
+  private:
+    T raw;
+    bool valid = false;
+    char str[N];
+
+  public:
+    const char* operator()(const T v) {
+      if (!valid || v != raw) {
+        raw = v;
+        valid = true;
+        const char *s = FMT(v);
+        uint8_t i = 0;
+        while (i < N - 1 && (str[i] = s[i])) ++i;
+        str[i] = '\0';
+      }
+      return str;
+    }
+    operator const char*() const { return str; }
+    void invalidate() { valid = false; }
+};
@@ -47,6 +47,13 @@
 
 #include <math.h>
 
+// 3-term dot product. Use fused multiply-add on FPUs that have it (e.g., Cortex-M4F / M7).
+#ifdef __ARM_FEATURE_FMA
+  #define DOT3(A0,B0,A1,B1,A2,B2) fmaf(A0, B0, fmaf(A1, B1, (A2) * (B2)))
+#else
+  #define DOT3(A0,B0,A1,B1,A2,B2) ((A0) * (B0) + (A1) * (B1) + (A2) * (B2))
+#endif
+
 /**
  *  vector_3
  */
@@ -68,12 +75,7 @@ float vector_3::magnitude() const { return SQRT(sq(x) + sq(y) + sq(z)); }
 void vector_3::normalize() { *this *= RSQRT(sq(x) + sq(y) + sq(z)); }
 
 // Apply a rotation to the matrix
-void vector_3::apply_rotation(const matrix_3x3 &matrix) {
-  const float _x = x, _y = y, _z = z;
-  *this = { matrix.vectors[0].x * _x + matrix.vectors[1].x * _y + matrix.vectors[2].x * _z,
-            matrix.vectors[0].y * _x + matrix.vectors[1].y * _y + matrix.vectors[2].y * _z,
-            matrix.vectors[0].z * _x + matrix.vectors[1].z * _y + matrix.vectors[2].z * _z };
-}
+void vector_3::apply_rotation(const matrix_3x3 &matrix) { matrix.apply_rotation_xyz(x, y, z); }
 
 void vector_3::debug(FSTR_P const title) {
   SERIAL_ECHOF(title);
@@ -86,9 +88,21 @@ void vector_3::debug(FSTR_P const title) {
  *  matrix_3x3
  */
 
-void matrix_3x3::apply_rotation_xyz(float &_x, float &_y, float &_z) {
-  vector_3 vec = vector_3(_x, _y, _z); vec.apply_rotation(*this);
-  _x = vec.x; _y = vec.y; _z = vec.z;
+void matrix_3x3::apply_rotation_xyz(float &_x, float &_y, float &_z) const {
+  const float x = _x, y = _y, z = _z;
+  const vector_3 &r0 = vectors[0], &r1 = vectors[1], &r2 = vectors[2];
+  _x = DOT3(r0.x, x, r1.x, y, r2.x, z);
+  _y = DOT3(r0.y, x, r1.y, y, r2.y, z);
+  _z = DOT3(r0.z, x, r1.z, y, r2.z, z);
+}
+
+// Same as transpose() followed by apply_rotation_xyz, without the copy
+void matrix_3x3::unapply_rotation_xyz(float &_x, float &_y, float &_z) const {
+  const float x = _x, y = _y, z = _z;
+  const vector_3 &r0 = vectors[0], &r1 = vectors[1], &r2 = vectors[2];
+  _x = DOT3(r0.x, x, r0.y, y, r0.z, z);
+  _y = DOT3(r1.x, x, r1.y, y, r1.z, z);
+  _z = DOT3(r2.x, x, r2.y, y, r2.z, z);
 }
 
 // Reset to identity. No rotate or translate.
@@ -93,5 +93,6 @@ struct matrix_3x3 {
 
   void debug(FSTR_P const title);
 
-  void apply_rotation_xyz(float &x, float &y, float &z);
+  void apply_rotation_xyz(float &x, float &y, float &z) const;
+  void unapply_rotation_xyz(float &x, float &y, float &z) const;  // Apply the transpose (inverse) rotation
 };
@@ -428,7 +428,11 @@ void Endstops::poll() {
   TERN_(PINS_DEBUGGING, run_monitor()); // Report changes in endstop status
 
   #if DISABLED(ENDSTOP_INTERRUPTS_FEATURE)
-    update();
+    #if ENDSTOP_NOISE_THRESHOLD
+      update();
+    #else
+      if (abort_enabled()) update();  // The test update() makes first, without the call
+    #endif
   #elif ENDSTOP_NOISE_THRESHOLD
     if (endstop_poll_count) update();
   #endif
@@ -1083,14 +1087,30 @@ void Endstops::update() {
     } \
   }while(0)
 
+  #if ENABLED(PARALLEL_XY_HOMING)
+    // Homing X and Y together: each axis stops at its own endstop and the move ends once both are stopped
+    #define XY_HOME_ES(A) TERN(A##_HOME_TO_MIN, A##_MIN, A##_MAX)
+    #define PROCESS_PARALLEL_ENDSTOP(A, MINMAX, B) do { \
+      if (TEST_ENDSTOP(_ENDSTOP(A, MINMAX))) { \
+        _ENDSTOP_HIT(A, MINMAX); \
+        if (!stepper.separate_xy_axes || !stepper.axis_is_moving(_AXIS(B)) || TEST_ENDSTOP(XY_HOME_ES(B))) \
+          planner.endstop_triggered(_AXIS(A)); \
+      } \
+    }while(0)
+  #endif
+
   #if ENABLED(X_DUAL_ENDSTOPS)
     #define PROCESS_ENDSTOP_X(MINMAX) PROCESS_DUAL_ENDSTOP(X, MINMAX)
+  #elif ENABLED(PARALLEL_XY_HOMING)
+    #define PROCESS_ENDSTOP_X(MINMAX) if (X_##MINMAX##_TEST()) PROCESS_PARALLEL_ENDSTOP(X, MINMAX, Y)
   #else
     #define PROCESS_ENDSTOP_X(MINMAX) if (X_##MINMAX##_TEST()) PROCESS_ENDSTOP(X, MINMAX)
   #endif
 
   #if ENABLED(Y_DUAL_ENDSTOPS)
     #define PROCESS_ENDSTOP_Y(MINMAX) PROCESS_DUAL_ENDSTOP(Y, MINMAX)
+  #elif ENABLED(PARALLEL_XY_HOMING)
+    #define PROCESS_ENDSTOP_Y(MINMAX) PROCESS_PARALLEL_ENDSTOP(Y, MINMAX, X)
   #else
     #define PROCESS_ENDSTOP_Y(MINMAX) PROCESS_ENDSTOP(Y, MINMAX)
   #endif
@@ -432,16 +432,11 @@ void get_cartesian_from_steppers() {
     );
     cartes.z = planner.get_axis_position_mm(Z_AXIS);
   #else
+    const abce_pos_t pos = planner.get_axis_positions_mm();
     NUM_AXIS_CODE(
-      cartes.x = planner.get_axis_position_mm(X_AXIS),
-      cartes.y = planner.get_axis_position_mm(Y_AXIS),
-      cartes.z = planner.get_axis_position_mm(Z_AXIS),
-      cartes.i = planner.get_axis_position_mm(I_AXIS),
-      cartes.j = planner.get_axis_position_mm(J_AXIS),
-      cartes.k = planner.get_axis_position_mm(K_AXIS),
-      cartes.u = planner.get_axis_position_mm(U_AXIS),
-      cartes.v = planner.get_axis_position_mm(V_AXIS),
-      cartes.w = planner.get_axis_position_mm(W_AXIS)
+      cartes.x = pos.x, cartes.y = pos.y, cartes.z = pos.z,
+      cartes.i = pos.i, cartes.j = pos.j, cartes.k = pos.k,
+      cartes.u = pos.u, cartes.v = pos.v, cartes.w = pos.w
     );
   #endif
 }
@@ -553,8 +548,13 @@ void _internal_move_to_destination(const_feedRate_t fr_mm_s/*=0.0f*/
  * - Delta may lower Z first to get into the free motion zone.
  * - Before returning, wait for the planner buffer to empty.
  */
-void do_blocking_move_to(NUM_AXIS_ARGS_(const_float_t) const_feedRate_t fr_mm_s/*=0.0f*/) {
-  DEBUG_SECTION(log_move, "do_blocking_move_to", DEBUGGING(LEVELING));
+/**
+ * Plan a move to (X, Y, Z, [I, [J, [K...]]]) without waiting for it to finish.
+ *  - Raise Z before the XY move, lower it after.
+ *  - Follow with planner.synchronize() or use do_blocking_move_to.
+ */
+void do_move_to(NUM_AXIS_ARGS_(const_float_t) const_feedRate_t fr_mm_s/*=0.0f*/) {
+  DEBUG_SECTION(log_move, "do_move_to", DEBUGGING(LEVELING));
   #if NUM_AXES
     if (DEBUGGING(LEVELING)) DEBUG_XYZ("> ", NUM_AXIS_ARGS());
   #endif
@@ -642,7 +642,21 @@ void do_blocking_move_to(NUM_AXIS_ARGS_(const_float_t) const_feedRate_t fr_mm_s/
     #endif
 
   #endif
+}
 
+void do_move_to(const xy_pos_t &raw, const_feedRate_t fr_mm_s/*=0.0f*/) {
+  do_move_to(NUM_AXIS_LIST_(raw.x, raw.y, current_position.z, current_position.i, current_position.j, current_position.k,
+                           current_position.u, current_position.v, current_position.w) fr_mm_s);
+}
+void do_move_to(const xyz_pos_t &raw, const_feedRate_t fr_mm_s/*=0.0f*/) {
+  do_move_to(NUM_AXIS_ELEM_(raw) fr_mm_s);
+}
+
+/**
+ * Plan a move to (X, Y, Z, [I, [J, [K...]]]) and wait for it to finish
+ */
+void do_blocking_move_to(NUM_AXIS_ARGS_(const_float_t) const_feedRate_t fr_mm_s/*=0.0f*/) {
+  do_move_to(NUM_AXIS_LIST_(x, y, z, i, j, k, u, v, w) fr_mm_s);
   planner.synchronize();
 }
 
@@ -1143,12 +1157,69 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
 
     // Calculate and execute the segments
     millis_t next_idle_ms = millis() + 200UL;
-    while (--segments) {
-      segment_idle(next_idle_ms);
-      raw += segment_distance;
-      if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
-        break;
-    }
+
+    #if ENABLED(DELTA_IK_INTERPOLATION)
+
+      // Get the tower positions for a Cartesian position, with modifiers applied
+      auto tower_ik = [](const xyze_pos_t &pos) {
+        xyze_pos_t machine = pos;
+        TERN_(HAS_POSITION_MODIFIERS, planner.apply_modifiers(machine));
+        inverse_kinematics(machine);
+        TERN_(HAS_EXTRUDERS, delta.e = machine.e);
+        return delta;
+      };
+
+      abce_pos_t t0 = tower_ik(raw);
+      uint16_t done = 0;
+      while (done < segments - 1) {
+        const uint16_t span = _MIN(uint16_t(segments - done), uint16_t(DELTA_IK_SPAN_SEGMENTS));
+        const xyze_pos_t end = done + span < segments ? raw + segment_distance * float(span) : destination,
+                         mid = (raw + end) * 0.5f;
+
+        // Fit t(u) = t0 + u * (b + u * c) through the span's start, middle, and end
+        const abce_pos_t t1 = tower_ik(end),
+                         b = tower_ik(mid) * 4.0f - t0 * 3.0f - t1,
+                         c = t1 - t0 - b;
+
+        // The middle strays from the straight line by c / 4
+        constexpr float max_c = (DELTA_IK_MAX_DEVIATION) * 4;
+        const bool fit = ABS(c.a) < max_c && ABS(c.b) < max_c && ABS(c.c) < max_c;
+
+        const float inv_span = 1.0f / float(span);
+        for (uint16_t s = 1; s <= span; ++s) {
+          if (++done == segments) break; // The last segment goes to the destination
+          segment_idle(next_idle_ms);
+          if (s == span) {
+            raw = end;
+            delta = t1;
+          }
+          else {
+            raw += segment_distance;
+            if (fit) {
+              const float u = float(s) * inv_span;
+              delta = t0 + (b + c * u) * u;
+            }
+            else
+              tower_ik(raw);
+          }
+          if (!planner.buffer_kinematic_line(raw, scaled_fr_mm_s, active_extruder, hints)) {
+            done = segments;
+            break;
+          }
+        }
+        t0 = t1;
+      }
+
+    #else
+
+      while (--segments) {
+        segment_idle(next_idle_ms);
+        raw += segment_distance;
+        if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, hints))
+          break;
+      }
+
+    #endif
 
     // Ensure last segment arrives at target location.
     planner.buffer_line(destination, scaled_fr_mm_s, active_extruder, hints);
@@ -2028,6 +2099,24 @@ void prepare_line_to_destination() {
       use_probe_bump ? _MAX(TERN0(HOMING_Z_WITH_PROBE, Z_CLEARANCE_BETWEEN_PROBES), home_bump_mm(axis)) : home_bump_mm(axis)
     );
 
+    #if ENABLED(Z_HOMING_FAST_DESCENT)
+      //
+      // Drop quickly to just above the last known Z position. Endstops stay on,
+      // so a wrong guess only means an early trigger, which the approach below repeats.
+      //
+      if (axis == Z_AXIS && axis_was_homed(Z_AXIS)) {
+        const float drop = current_position.z - (Z_HOME_POS) - (Z_HOMING_FAST_MARGIN);
+        if (drop > 0) {
+          if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Fast Z Drop: ", drop, "mm");
+          abce_pos_t target = planner.get_axis_positions_mm();
+          target.z -= drop;
+          planner.buffer_segment(target OPTARG(HAS_DIST_MM_ARG, xyze_float_t{0}), MMM_TO_MMS(Z_HOMING_FAST_FEEDRATE), active_extruder);
+          planner.synchronize();
+          endstops.hit_on_purpose();
+        }
+      }
+    #endif
+
     //
     // Fast move towards endstop until triggered
     //
@@ -2274,6 +2363,85 @@ void prepare_line_to_destination() {
 
   } // homeaxis()
 
+  #if ENABLED(PARALLEL_XY_HOMING)
+
+    /**
+     * Move X and Y together in one block, neither one faster than its given feedrate.
+     * Toward the endstops each axis stops at its own endstop and the move ends when both have.
+     */
+    static void do_homing_move_xy(const xy_float_t &distance, const xy_feedrate_t &fr_mm_s, const bool is_home_dir) {
+      DEBUG_SECTION(log_move, "do_homing_move_xy", DEBUGGING(LEVELING));
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("...(", distance.x, ", ", distance.y, ")");
+
+      abce_pos_t target = planner.get_axis_positions_mm();
+      target[X_AXIS] = target[Y_AXIS] = 0;
+      planner.set_machine_position_mm(target);
+
+      // The block takes as long as the slower axis needs
+      const float duration = _MAX(ABS(distance.x) / fr_mm_s.x, ABS(distance.y) / fr_mm_s.y);
+      if (!duration) return;
+
+      #if HAS_DIST_MM_ARG
+        const xyze_float_t cart_dist_mm{0};
+      #endif
+
+      target[X_AXIS] = distance.x;
+      target[Y_AXIS] = distance.y;
+      stepper.set_separate_xy_axes(is_home_dir);
+      planner.buffer_segment(target OPTARG(HAS_DIST_MM_ARG, cart_dist_mm), HYPOT(distance.x, distance.y) / duration, active_extruder);
+      planner.synchronize();
+      stepper.set_separate_xy_axes(false);
+
+      if (is_home_dir) endstops.validate_homing_move();
+    }
+
+    /**
+     * Home X and Y at the same time, with a fast approach, a shared
+     * back-off and a slow bump. Takes about as long as the longer axis alone.
+     */
+    void homeaxis_xy() {
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM(">>> homeaxis_xy()");
+
+      const xy_float_t dir = { float(home_dir(X_AXIS)), float(home_dir(Y_AXIS)) },
+                       bump = { home_bump_mm(X_AXIS) * dir.x, home_bump_mm(Y_AXIS) * dir.y };
+
+      // Fast move towards both endstops until triggered
+      const xy_float_t move_length = { 1.5f * max_length(X_AXIS) * dir.x, 1.5f * max_length(Y_AXIS) * dir.y };
+      do_homing_move_xy(move_length, { homing_feedrate(X_AXIS), homing_feedrate(Y_AXIS) }, true);
+
+      // If a second homing move is configured, back off both axes and bump them slowly
+      if (bump.x || bump.y) {
+        do_homing_move_xy(-bump, { homing_feedrate(X_AXIS), homing_feedrate(Y_AXIS) }, false);
+        do_homing_move_xy(bump * 2.0f, { get_homing_bump_feedrate(X_AXIS), get_homing_bump_feedrate(Y_AXIS) }, true);
+      }
+
+      #ifdef TMC_HOME_PHASE
+        backout_to_tmc_homing_phase(X_AXIS);
+        backout_to_tmc_homing_phase(Y_AXIS);
+      #endif
+
+      set_axis_is_at_home(X_AXIS);
+      set_axis_is_at_home(Y_AXIS);
+      sync_plan_position();
+      destination.x = current_position.x;
+      destination.y = current_position.y;
+
+      if (DEBUGGING(LEVELING)) DEBUG_POS("> AFTER set_axis_is_at_home", current_position);
+
+      #ifdef HOMING_BACKOFF_POST_MM
+        const xyz_float_t endstop_backoff = HOMING_BACKOFF_POST_MM;
+        if (endstop_backoff.x || endstop_backoff.y) {
+          current_position.x -= ABS(endstop_backoff.x) * dir.x;
+          current_position.y -= ABS(endstop_backoff.y) * dir.y;
+          line_to_current_position(_MIN(homing_feedrate(X_AXIS), homing_feedrate(Y_AXIS)));
+        }
+      #endif
+
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("<<< homeaxis_xy()");
+    }
+
+  #endif // PARALLEL_XY_HOMING
+
 #endif // HAS_ENDSTOPS
 
 /**
@@ -344,8 +344,12 @@ inline void prepare_internal_move_to_destination(const_feedRate_t fr_mm_s=0.0f)
 #endif
 
 /**
- * Blocking movement and shorthand functions
+ * Planned and blocking movement and shorthand functions
  */
+void do_move_to(NUM_AXIS_ARGS_(const_float_t) const_feedRate_t fr_mm_s=0.0f);
+void do_move_to(const xy_pos_t &raw, const_feedRate_t fr_mm_s=0.0f);
+void do_move_to(const xyz_pos_t &raw, const_feedRate_t fr_mm_s=0.0f);
+
 void do_blocking_move_to(NUM_AXIS_ARGS_(const_float_t) const_feedRate_t fr_mm_s=0.0f);
 void do_blocking_move_to(const xy_pos_t &raw, const_feedRate_t fr_mm_s=0.0f);
 void do_blocking_move_to(const xyz_pos_t &raw, const_feedRate_t fr_mm_s=0.0f);
@@ -430,6 +434,9 @@ void set_axis_is_at_home(const AxisEnum axis);
    */
   extern main_axes_bits_t axes_homed, axes_trusted;
   void homeaxis(const AxisEnum axis);
+  #if ENABLED(PARALLEL_XY_HOMING)
+    void homeaxis_xy();
+  #endif
   void set_axis_never_homed(const AxisEnum axis);
   main_axes_bits_t axes_should_home(main_axes_bits_t axes_mask=main_axes_mask);
   bool homing_needed_error(main_axes_bits_t axes_mask=main_axes_mask);
@@ -102,6 +102,14 @@
   #include "../feature/cancel_object.h"
 #endif
 
+#if ENABLED(SEGMENT_COALESCING)
+  #include "../feature/coalesce.h"
+#endif
+
+#if ENABLED(PLANNER_TELEMETRY)
+  #include "../gcode/queue.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
@@ -110,6 +118,14 @@
   #include "../feature/spindle_laser.h"
 #endif
 
+#if ENABLED(MARLIN_TEST_BUILD)
+  #include "../tests/marlin_tests.h"
+#endif
+
+#if ENABLED(VIRTUAL_STEPPING)
+  #include "../feature/virtual_stepper.h"
+#endif
+
 // Delay for delivery of first block to the stepper ISR, if the queue contains 2 or
 // fewer movements. The delay is measured in milliseconds, and must be less than 250ms
 #define BLOCK_DELAY_FOR_1ST_MOVE 100U
@@ -126,6 +142,7 @@ volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be
                  Planner::block_buffer_nonbusy, // Index of the first non-busy block
                  Planner::block_buffer_planned, // Index of the optimally planned block
                  Planner::block_buffer_tail;    // Index of the busy block, if any
+uint8_t Planner::block_buffer_dirty;            // Index of the first block changed by the last reverse pass
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // Delay block delivery so initial blocks in an empty queue may merge
 
@@ -244,6 +261,10 @@ float Planner::previous_nominal_speed;
   volatile uint32_t Planner::block_buffer_runtime_us = 0;
 #endif
 
+#if ENABLED(PLANNER_TELEMETRY)
+  planner_telemetry_t Planner::telemetry; // = { 0 }
+#endif
+
 /**
  * Class and Instance Methods
  */
@@ -753,7 +774,10 @@ block_t* Planner::get_current_block() {
     block_t * const block = &block_buffer[block_buffer_tail];
 
     // No trapezoid calculated? Don't execute yet.
-    if (block->flag.recalculate) return nullptr;
+    if (block->flag.recalculate) {
+      TERN_(PLANNER_TELEMETRY, ++telemetry.not_ready);
+      return nullptr;
+    }
 
     // We can't be sure how long an active block will take, so don't count it.
     TERN_(HAS_WIRED_LCD, block_buffer_runtime_us -= block->segment_time_us);
@@ -765,6 +789,14 @@ block_t* Planner::get_current_block() {
     if (block_buffer_tail == block_buffer_planned)
       block_buffer_planned = block_buffer_nonbusy;
 
+    #if ENABLED(PLANNER_TELEMETRY)
+      if (block->is_move()) {
+        block_telemetry_t &bt = telemetry.ring[block->telemetry_index];
+        bt.wait_us = _MAX(micros() - bt.queued_us, 1UL);
+      }
+      telemetry.stepper_busy = true;
+    #endif
+
     // Return the block
     return block;
   }
@@ -772,9 +804,32 @@ block_t* Planner::get_current_block() {
   // The queue became empty
   TERN_(HAS_WIRED_LCD, clear_block_buffer_runtime()); // paranoia. Buffer is empty now - so reset accumulated time to zero.
 
+  #if ENABLED(PLANNER_TELEMETRY)
+    if (telemetry.stepper_busy) {
+      telemetry.stepper_busy = false;
+      ++telemetry.underruns;
+    }
+  #endif
+
   return nullptr;
 }
 
+#if ENABLED(STEP_RATE_TABLE)
+
+  // The Bézier speed curve 6u^5 - 15u^4 + 10u^3 in the middle of each table slice, as Q0.16
+  struct RateTableWeights {
+    uint16_t w[STEP_RATE_TABLE_SIZE];
+    constexpr RateTableWeights() : w() {
+      for (uint8_t i = 0; i < STEP_RATE_TABLE_SIZE; ++i) {
+        const float u = (i + 0.5f) / (STEP_RATE_TABLE_SIZE);
+        w[i] = uint16_t(u * u * u * (10.0f + u * (6.0f * u - 15.0f)) * 65535.0f + 0.5f);
+      }
+    }
+  };
+  static constexpr RateTableWeights rate_table_weights;
+
+#endif
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors.
@@ -785,10 +840,15 @@ block_t* Planner::get_current_block() {
  * is not and will not use the block while we modify it, so it is safe to
  * alter its values.
  */
-void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor) {
+void Planner::calculate_trapezoid_for_block(block_t * const block, const trap_factor_t entry_factor, const trap_factor_t exit_factor) {
 
-  uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
-           final_rate = CEIL(block->nominal_rate * exit_factor); // (steps per second)
+  #if ENABLED(PLANNER_FIXED_POINT)
+    uint32_t initial_rate = ufix16_mul_ceil(block->nominal_rate, entry_factor),
+             final_rate = ufix16_mul_ceil(block->nominal_rate, exit_factor); // (steps per second)
+  #else
+    uint32_t initial_rate = CEIL(block->nominal_rate * entry_factor),
+             final_rate = CEIL(block->nominal_rate * exit_factor); // (steps per second)
+  #endif
 
   // Limit minimal step rate (Otherwise the timer will overflow.)
   NOLESS(initial_rate, uint32_t(MINIMAL_STEP_RATE));
@@ -807,39 +867,86 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   const int32_t accel = block->acceleration_steps_per_s2;
   float inverse_accel = 0.0f;
   if (accel != 0) {
-    inverse_accel = 1.0f / accel;
-    const float half_inverse_accel = 0.5f * inverse_accel,
-                nominal_rate_sq = sq(float(block->nominal_rate)),
-                // Steps required for acceleration, deceleration to/from nominal rate
-                decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(final_rate)));
-          float accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(initial_rate)));
-    accelerate_steps = CEIL(accelerate_steps_float);
-    decelerate_steps = FLOOR(decelerate_steps_float);
-
-    // Steps between acceleration and deceleration, if any
-    plateau_steps -= accelerate_steps + decelerate_steps;
-
-    // Does accelerate_steps + decelerate_steps exceed step_event_count?
-    // Then we can't possibly reach the nominal rate, there will be no cruising.
-    // Calculate accel / braking time in order to reach the final_rate exactly
-    // at the end of this block.
-    if (plateau_steps < 0) {
-      accelerate_steps_float = CEIL((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
-      accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
-      decelerate_steps = block->step_event_count - accelerate_steps;
-
-      #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
-        // We won't reach the cruising rate. Let's calculate the speed we will reach
-        cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
-      #endif
+
+    #if ENABLED(PLANNER_FIXED_POINT)
+      /**
+       * Integer trapezoid for rates that fit in 16 bits, so the squares fit in 32.
+       * Divisions by 2*accel are multiplications by the block's Q0.32 reciprocal.
+       */
+      if (block->nominal_rate <= 0xFFFF) {
+        const uint32_t nominal_rate_sq = sq(block->nominal_rate),
+                       initial_rate_sq = sq(_MIN(initial_rate, block->nominal_rate)),
+                       final_rate_sq = sq(_MIN(final_rate, block->nominal_rate)),
+                       recip = block->accel_reciprocal;
+
+        // Steps required for acceleration, deceleration to/from nominal rate
+        accelerate_steps = uint32_t((uint64_t(nominal_rate_sq - initial_rate_sq) * recip + 0xFFFFFFFFUL) >> 32);
+        decelerate_steps = mul_reciprocal_q32(nominal_rate_sq - final_rate_sq, recip);
+
+        // Steps between acceleration and deceleration, if any
+        plateau_steps -= accelerate_steps + decelerate_steps;
+
+        // No cruising. Meet in the middle so the final_rate is reached at the end of the block.
+        if (plateau_steps < 0) {
+          // The unrounded difference between accelerate and decelerate steps
+          const int32_t accel_decel_diff = final_rate_sq >= initial_rate_sq
+                                           ?  int32_t(mul_reciprocal_q32(final_rate_sq - initial_rate_sq, recip))
+                                           : -int32_t(mul_reciprocal_q32(initial_rate_sq - final_rate_sq, recip));
+          const int32_t twice_accel_steps = int32_t(block->step_event_count) + accel_decel_diff;
+          accelerate_steps = twice_accel_steps > 0 ? _MIN(uint32_t(twice_accel_steps + 1) >> 1, block->step_event_count) : 0;
+          decelerate_steps = block->step_event_count - accelerate_steps;
+
+          #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+            // We won't reach the cruising rate. Get the rate we will reach.
+            const uint64_t cruise_rate_sq = uint64_t(initial_rate_sq) + uint64_t(uint32_t(accel) << 1) * accelerate_steps;
+            cruise_rate = isqrt32(uint32_t(_MIN(cruise_rate_sq, uint64_t(nominal_rate_sq))));
+          #endif
+        }
+      }
+      else
+    #endif
+    {
+      inverse_accel = 1.0f / accel;
+      const float half_inverse_accel = 0.5f * inverse_accel,
+                  nominal_rate_sq = sq(float(block->nominal_rate)),
+                  // Steps required for acceleration, deceleration to/from nominal rate
+                  decelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(final_rate)));
+            float accelerate_steps_float = half_inverse_accel * (nominal_rate_sq - sq(float(initial_rate)));
+      accelerate_steps = CEIL(accelerate_steps_float);
+      decelerate_steps = FLOOR(decelerate_steps_float);
+
+      // Steps between acceleration and deceleration, if any
+      plateau_steps -= accelerate_steps + decelerate_steps;
+
+      // Does accelerate_steps + decelerate_steps exceed step_event_count?
+      // Then we can't possibly reach the nominal rate, there will be no cruising.
+      // Calculate accel / braking time in order to reach the final_rate exactly
+      // at the end of this block.
+      if (plateau_steps < 0) {
+        accelerate_steps_float = CEIL((block->step_event_count + accelerate_steps_float - decelerate_steps_float) * 0.5f);
+        accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
+        decelerate_steps = block->step_event_count - accelerate_steps;
+
+        #if ANY(S_CURVE_ACCELERATION, LIN_ADVANCE)
+          // We won't reach the cruising rate. Let's calculate the speed we will reach
+          cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+        #endif
+      }
     }
   }
 
   #if ENABLED(S_CURVE_ACCELERATION)
-    const float rate_factor = inverse_accel * (STEPPER_TIMER_RATE);
-    // Jerk controlled speed requires to express speed versus time, NOT steps
-    uint32_t acceleration_time = rate_factor * float(cruise_rate - initial_rate),
-             deceleration_time = rate_factor * float(cruise_rate - final_rate),
+    #if ENABLED(PLANNER_FIXED_POINT)
+      // STEPPER_TIMER_RATE / accel as Q16.16, derived from the reciprocal of 2 * accel
+      const uint32_t rate_factor = _MIN((uint64_t(block->accel_reciprocal) * (2UL * (STEPPER_TIMER_RATE))) >> 16, uint64_t(0xFFFFFFFFUL));
+      uint32_t acceleration_time = (uint64_t(cruise_rate - initial_rate) * rate_factor) >> 16,
+               deceleration_time = (uint64_t(cruise_rate - final_rate) * rate_factor) >> 16,
+    #else
+      const float rate_factor = inverse_accel * (STEPPER_TIMER_RATE);
+      // Jerk controlled speed requires to express speed versus time, NOT steps
+      uint32_t acceleration_time = rate_factor * float(cruise_rate - initial_rate),
+               deceleration_time = rate_factor * float(cruise_rate - final_rate),
+    #endif
     // And to offload calculations from the ISR, we also calculate the inverse of those times here
              acceleration_time_inverse = get_period_inverse(acceleration_time),
              deceleration_time_inverse = get_period_inverse(deceleration_time);
@@ -855,6 +962,21 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
     block->acceleration_time_inverse = acceleration_time_inverse;
     block->deceleration_time_inverse = deceleration_time_inverse;
     block->cruise_rate = cruise_rate;
+    #if ENABLED(STEP_RATE_TABLE)
+      // Sample the Bézier curve for the Stepper ISR. Rates must fit in 16 bits and slices can't be empty.
+      const bool use_table = cruise_rate <= 0xFFFF;
+      block->accel_slice_time = use_table ? acceleration_time / (STEP_RATE_TABLE_SIZE) : 0;
+      block->decel_slice_time = use_table ? deceleration_time / (STEP_RATE_TABLE_SIZE) : 0;
+      if (use_table) {
+        const uint16_t accel_delta = cruise_rate - _MIN(initial_rate, cruise_rate),
+                       decel_delta = cruise_rate - _MIN(final_rate, cruise_rate);
+        for (uint8_t i = 0; i < STEP_RATE_TABLE_SIZE; ++i) {
+          const uint16_t w = rate_table_weights.w[i];
+          block->accel_rates[i] = cruise_rate - accel_delta + uint16_t((uint32_t(accel_delta) * w) >> 16);
+          block->decel_rates[i] = cruise_rate - uint16_t((uint32_t(decel_delta) * w) >> 16);
+        }
+      }
+    #endif
   #endif
   block->final_rate = final_rate;
 
@@ -916,6 +1038,24 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   #endif // LASER_POWER_TRAP
 }
 
+/**
+ * Calculate the trapezoid for a block from its entry and exit speeds.
+ * With PLANNER_FIXED_POINT the speeds are squared, so the factors can be
+ * found with one multiply each and an integer square root.
+ */
+void Planner::calculate_trapezoid_for_speeds(block_t * const block, const_float_t entry_speed, const_float_t exit_speed) {
+  #if ENABLED(PLANNER_FIXED_POINT)
+    const float inom_sq = block->inverse_nominal_speed_sqr;
+    calculate_trapezoid_for_block(block,
+      ufix16_sqrt(ufix16_from_float(_MIN(entry_speed * inom_sq, 1.0f))),
+      ufix16_sqrt(ufix16_from_float(_MIN(exit_speed * inom_sq, 1.0f)))
+    );
+  #else
+    const float nomr = 1.0f / block->nominal_speed;
+    calculate_trapezoid_for_block(block, entry_speed * nomr, exit_speed * nomr);
+  #endif
+}
+
 /**
  *                              PLANNER SPEED DEFINITION
  *                                     +--------+   <- current->nominal_speed
@@ -1050,6 +1190,9 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
   // The ISR may change it so get a stable local copy.
   uint8_t planned_block_index = block_buffer_planned;
 
+  // Unless the pass stops early, all blocks from the planned pointer onward are dirty
+  block_buffer_dirty = planned_block_index;
+
   // If there was a race condition and block_buffer_planned was incremented
   //  or was pointing at the head (queue empty) break loop now and avoid
   //  planning already consumed blocks
@@ -1066,7 +1209,17 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
 
     // Only process movement blocks
     if (current->is_move()) {
+      const float old_entry_speed_sqr = current->entry_speed_sqr;
       reverse_pass_kernel(current, next OPTARG(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
+
+      // The entry speed of a block only depends on the entry speed of the next block,
+      // so once an entry speed is unchanged the earlier blocks are unchanged too.
+      // This block still needs a new trapezoid for its new exit speed.
+      if (next && current->entry_speed_sqr == old_entry_speed_sqr) {
+        block_buffer_dirty = block_index;
+        return;
+      }
+
       next = current;
     }
 
@@ -1079,7 +1232,10 @@ void Planner::reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_
     while (planned_block_index != block_buffer_planned) {
 
       // If we reached the busy block or an already processed block, break the loop now
-      if (block_index == planned_block_index) return;
+      if (block_index == planned_block_index) {
+        block_buffer_dirty = planned_block_index;
+        return;
+      }
 
       // Advance the pointer, following the busy block
       planned_block_index = next_block_index(planned_block_index);
@@ -1145,11 +1301,12 @@ void Planner::forward_pass() {
   // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
   // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
 
-  // Begin at buffer planned pointer. Note that block_buffer_planned can be modified
-  //  by the stepper ISR,  so read it ONCE. It it guaranteed that block_buffer_planned
-  //  will never lead head, so the loop is safe to execute. Also note that the forward
-  //  pass will never modify the values at the tail.
-  uint8_t block_index = block_buffer_planned;
+  // Begin at the first block changed by the reverse pass, since nothing before it can change.
+  //  Note that block_buffer_planned can be modified by the stepper ISR, so read it ONCE
+  //  and never start behind it. It it guaranteed that block_buffer_planned will never lead
+  //  head, so the loop is safe to execute. Also note that the forward pass will never
+  //  modify the values at the tail.
+  uint8_t block_index = later_block_index(block_buffer_dirty, block_buffer_planned, block_buffer_head);
 
   block_t *block;
   const block_t * previous = nullptr;
@@ -1180,9 +1337,10 @@ void Planner::forward_pass() {
  * recalculate() after updating the blocks.
  */
 void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
-  // The tail may be changed by the ISR so get a local copy.
-  uint8_t block_index = block_buffer_tail,
-          head_block_index = block_buffer_head;
+  // Start at the first block changed by the reverse pass, as the trapezoids before
+  // it are unchanged. The tail may be changed by the ISR so get a local copy.
+  uint8_t head_block_index = block_buffer_head,
+          block_index = later_block_index(block_buffer_dirty, block_buffer_tail, head_block_index);
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
   // specially handled), scan backwards to the first non-SYNC block.
@@ -1201,7 +1359,8 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
     head_block_index = prev_index;
   }
 
-  // Go from the tail (currently executed block) to the first block, without including it)
+  // Go from the first dirty block to the last block, without including it
+  // With PLANNER_FIXED_POINT the entry speeds are kept squared to skip the SQRT.
   block_t *block = nullptr, *next = nullptr;
   float current_entry_speed = 0.0f, next_entry_speed = 0.0f;
   while (block_index != head_block_index) {
@@ -1210,7 +1369,7 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
 
     // Only process movement blocks
     if (next->is_move()) {
-      next_entry_speed = SQRT(next->entry_speed_sqr);
+      next_entry_speed = TERN(PLANNER_FIXED_POINT, next->entry_speed_sqr, SQRT(next->entry_speed_sqr));
 
       if (block) {
 
@@ -1227,8 +1386,7 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
             // Block is not BUSY, we won the race against the Stepper ISR:
 
             // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-            const float nomr = 1.0f / block->nominal_speed;
-            calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
+            calculate_trapezoid_for_speeds(block, current_entry_speed, next_entry_speed);
           }
 
           // Reset current only to ensure next trapezoid is computed - The
@@ -1247,7 +1405,11 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
   // Last/newest block in buffer. Always recalculated.
   if (block) {
     // Exit speed is set with MINIMUM_PLANNER_SPEED unless some code higher up knows better.
-    next_entry_speed = _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, SQRT(safe_exit_speed_sqr)), float(MINIMUM_PLANNER_SPEED));
+    #if ENABLED(PLANNER_FIXED_POINT)
+      next_entry_speed = _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr), sq(float(MINIMUM_PLANNER_SPEED)));
+    #else
+      next_entry_speed = _MAX(TERN0(HINTS_SAFE_EXIT_SPEED, SQRT(safe_exit_speed_sqr)), float(MINIMUM_PLANNER_SPEED));
+    #endif
 
     // Mark the next(last) block as RECALCULATE, to prevent the Stepper ISR running it.
     // As the last block is always recalculated here, there is a chance the block isn't
@@ -1259,9 +1421,7 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
     // if that is the case!
     if (!stepper.is_block_busy(block)) {
       // Block is not BUSY, we won the race against the Stepper ISR:
-
-      const float nomr = 1.0f / block->nominal_speed;
-      calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
+      calculate_trapezoid_for_speeds(block, current_entry_speed, next_entry_speed);
     }
 
     // Reset block to ensure its trapezoid is computed - The stepper is free to use
@@ -1273,8 +1433,10 @@ void Planner::recalculate_trapezoids(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t
 void Planner::recalculate(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_speed_sqr)) {
   // Initialize block index to the last block in the planner buffer.
   const uint8_t block_index = prev_block_index(block_buffer_head);
+  // The reverse pass narrows down the range of blocks to update
+  block_buffer_dirty = block_buffer_planned;
   // If there is just one block, no planning can be done. Avoid it!
-  if (block_index != block_buffer_planned) {
+  if (block_index != block_buffer_dirty) {
     reverse_pass(TERN_(HINTS_SAFE_EXIT_SPEED, safe_exit_speed_sqr));
     forward_pass();
   }
@@ -1320,6 +1482,28 @@ void Planner::recalculate(TERN_(HINTS_SAFE_EXIT_SPEED, const_float_t safe_exit_s
 
   #endif
 
+  #if ENABLED(FAN_SPEED_AT_BLOCK_START)
+
+    /**
+     * Apply fan speeds that differ from the last ones applied.
+     * Called by the stepper ISR as each block starts and by
+     * check_axes_activity() while the planner is empty.
+     */
+    void Planner::apply_fan_speeds(const uint8_t (&fan_speed)[FAN_COUNT]) {
+      static uint8_t applied_fan_speed[FAN_COUNT] = ARRAY_N_1(FAN_COUNT, 13);
+      bool changed = false;
+      FANS_LOOP(i) {
+        const uint8_t spd = thermalManager.scaledFanSpeed(i, fan_speed[i]);
+        if (applied_fan_speed[i] != spd) {
+          applied_fan_speed[i] = spd;
+          changed = true;
+        }
+      }
+      if (changed) sync_fan_speeds(applied_fan_speed);
+    }
+
+  #endif
+
 #endif // HAS_FAN
 
 /**
@@ -1331,7 +1515,7 @@ void Planner::check_axes_activity() {
     xyze_bool_t axis_active = { false };
   #endif
 
-  #if HAS_FAN && DISABLED(LASER_SYNCHRONOUS_M106_M107)
+  #if HAS_FAN && NONE(LASER_SYNCHRONOUS_M106_M107, FAN_SPEED_AT_BLOCK_START)
     #define HAS_TAIL_FAN_SPEED 1
     static uint8_t tail_fan_speed[FAN_COUNT] = ARRAY_N_1(FAN_COUNT, 13);
     bool fans_need_update = false;
@@ -1389,6 +1573,8 @@ void Planner::check_axes_activity() {
 
     TERN_(HAS_CUTTER, if (cutter.cutter_mode == CUTTER_MODE_STANDARD) cutter.refresh());
 
+    TERN_(FAN_SPEED_AT_BLOCK_START, apply_fan_speeds(thermalManager.fan_speed));
+
     #if HAS_TAIL_FAN_SPEED
       FANS_LOOP(i) {
         const uint8_t spd = thermalManager.scaledFanSpeed(i);
@@ -1425,7 +1611,7 @@ void Planner::check_axes_activity() {
 
   //
   // Update Fan speeds
-  // Only if synchronous M106/M107 is disabled
+  // Only if synchronous M106/M107 and FAN_SPEED_AT_BLOCK_START are disabled
   //
   TERN_(HAS_TAIL_FAN_SPEED, if (fans_need_update) sync_fan_speeds(tail_fan_speed));
 
@@ -1545,6 +1731,30 @@ void Planner::check_axes_activity() {
 
 #endif
 
+#if ENABLED(PID_FLOW_FEEDFORWARD)
+
+  /**
+   * Average the filament flow of the queued moves, weighting each move
+   * by its duration at nominal speed. Travel and retraction count as time
+   * with no flow. Blocks may be consumed by the Stepper ISR meanwhile, but
+   * their contents stay valid, so the worst case is a slightly stale rate.
+   */
+  float Planner::queued_flow_rate(const uint8_t hotend) {
+    UNUSED(hotend);
+    float e_mm = 0, secs = 0;
+    const uint8_t head = block_buffer_head;
+    for (uint8_t b = block_buffer_tail; b != head; b = next_block_index(b)) {
+      block_t * const block = &block_buffer[b];
+      if (!block->is_move() || block->nominal_speed <= 0) continue;
+      secs += block->millimeters / block->nominal_speed;
+      if (TERN1(HAS_MULTI_HOTEND, block->extruder == hotend) && block->steps.e && !TEST(block->direction_bits, E_AXIS))
+        e_mm += block->steps.e * mm_per_step[E_AXIS_N(block->extruder)];
+    }
+    return secs > 0 ? e_mm * CIRCLE_AREA(float(DEFAULT_NOMINAL_FILAMENT_DIA) * 0.5f) / secs : 0;
+  }
+
+#endif
+
 #if ENABLED(FILAMENT_WIDTH_SENSOR)
   /**
    * Convert the ratio value given by the filament width sensor
@@ -1631,10 +1841,8 @@ void Planner::check_axes_activity() {
 
     #if ABL_PLANAR
 
-      matrix_3x3 inverse = matrix_3x3::transpose(bed_level_matrix);
-
       xy_pos_t d = raw - level_fulcrum;
-      inverse.apply_rotation_xyz(d.x, d.y, raw.z);
+      bed_level_matrix.unapply_rotation_xyz(d.x, d.y, raw.z);
       raw = d + level_fulcrum;
 
     #elif HAS_MESH
@@ -1686,6 +1894,7 @@ void Planner::quick_stop() {
   const bool was_enabled = stepper.suspend();
 
   // Drop all queue entries
+  TERN_(SEGMENT_COALESCING, coalescer.discard());
   block_buffer_nonbusy = block_buffer_planned = block_buffer_head = block_buffer_tail;
 
   // Restart the block delay for the first movement - As the queue was
@@ -1797,10 +2006,38 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
   return axis_steps * mm_per_step[axis];
 }
 
+/**
+ * Get the stepper positions of all axes in mm.
+ * Without core or markforged mixing the axes are taken from one
+ * stepper snapshot, so a report during a move is self-consistent.
+ */
+abce_pos_t Planner::get_axis_positions_mm() {
+  #if IS_CORE || ANY(MARKFORGED_XY, MARKFORGED_YX)
+    const abce_pos_t out = LOGICAL_AXIS_ARRAY(
+      get_axis_position_mm(E_AXIS),
+      get_axis_position_mm(A_AXIS), get_axis_position_mm(B_AXIS), get_axis_position_mm(C_AXIS),
+      get_axis_position_mm(I_AXIS), get_axis_position_mm(J_AXIS), get_axis_position_mm(K_AXIS),
+      get_axis_position_mm(U_AXIS), get_axis_position_mm(V_AXIS), get_axis_position_mm(W_AXIS)
+    );
+  #else
+    const xyze_long_t spos = stepper.positions();
+    abce_pos_t out;
+    LOOP_LOGICAL_AXES(i) {
+      float axis_steps = spos[i];
+      TERN_(BACKLASH_COMPENSATION, axis_steps -= backlash.get_applied_steps((AxisEnum)i));
+      out[i] = axis_steps * mm_per_step[i];
+    }
+  #endif
+  return out;
+}
+
 /**
  * Block until the planner is finished processing
  */
-void Planner::synchronize() { while (busy()) idle(); }
+void Planner::synchronize() {
+  TERN_(VIRTUAL_STEPPING, virtual_stepper.finish());
+  while (busy()) idle();
+}
 
 /**
  * @brief Add a new linear movement to the planner queue (in terms of steps).
@@ -1820,6 +2057,36 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   , feedRate_t fr_mm_s, const uint8_t extruder, const PlannerHints &hints
 ) {
 
+  #if ENABLED(BACKLASH_TAKEUP_MOVE)
+    // Take up the backlash of reversing axes with a short move of its own,
+    // so this move keeps its own length and speed profile. Only a move that
+    // won't be dropped as zero-length may take up backlash.
+    xyz_long_t dist;
+    bool will_move = false;
+    LOOP_NUM_AXES(i) {
+      dist[i] = target[i] - position[i];
+      if (ABS(dist[i]) >= MIN_STEPS_PER_SEGMENT) will_move = true;
+    }
+    xyz_long_t takeup;
+    if (will_move && backlash.get_takeup_steps(dist, takeup)) {
+      const xyze_long_t start = position;
+      xyze_long_t takeup_target = position;
+      #if HAS_POSITION_FLOAT
+        const xyze_pos_t start_float = position_float;
+        xyze_pos_t takeup_float = position_float;
+      #endif
+      LOOP_NUM_AXES(i) {
+        takeup_target[i] += takeup[i];
+        TERN_(HAS_POSITION_FLOAT, takeup_float[i] += takeup[i] * mm_per_step[i]);
+      }
+      if (!_buffer_steps(takeup_target OPTARG(HAS_POSITION_FLOAT, takeup_float), fr_mm_s, extruder, PlannerHints()))
+        return false;
+      // The take-up only moves through the backlash, so the move starts from the same position
+      position = start;
+      TERN_(HAS_POSITION_FLOAT, position_float = start_float);
+    }
+  #endif
+
   // Wait for the next available block
   uint8_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
@@ -1851,12 +2118,28 @@ bool Planner::_buffer_steps(const xyze_long_t &target
     delay_before_delivering = BLOCK_DELAY_FOR_1ST_MOVE;
   }
 
+  #if ENABLED(PLANNER_TELEMETRY)
+    // Claim a ring entry before the Stepper ISR can see the block
+    block_telemetry_t &bt = telemetry.ring[telemetry.index];
+    block->telemetry_index = telemetry.index;
+    telemetry.index = next_block_index(telemetry.index);
+    bt.wait_us = 0;
+    bt.queued_us = micros();
+  #endif
+
   // Move buffer head
   block_buffer_head = next_buffer_head;
 
   // Recalculate and optimize trapezoidal speed profiles
   recalculate(TERN_(HINTS_SAFE_EXIT_SPEED, hints.safe_exit_speed_sqr));
 
+  #if ENABLED(PLANNER_TELEMETRY)
+    bt.recalc_us = _MIN(micros() - bt.queued_us, 0xFFFFUL);
+    NOLESS(telemetry.max_recalc_us, bt.recalc_us);
+    bt.moves_planned = movesplanned();
+    bt.commands_queued = queue.ring_buffer.length;
+  #endif
+
   // Movement successfully queued!
   return true;
 }
@@ -2247,7 +2530,10 @@ bool Planner::_populate_block(
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
-  TERN_(MIXING_EXTRUDER, mixer.populate_block(block->b_color));
+  // Travel moves don't step the mixer, so the color can be left as is
+  #if ENABLED(MIXING_EXTRUDER)
+    if (esteps) mixer.populate_block(block->b_color);
+  #endif
 
   #if HAS_FAN
     FANS_LOOP(i) block->fan_speed[i] = thermalManager.fan_speed[i];
@@ -2404,7 +2690,7 @@ bool Planner::_populate_block(
   block->nominal_rate = CEIL(block->step_event_count * inverse_secs); // (step/sec) Always > 0
 
   #if ENABLED(FILAMENT_WIDTH_SENSOR)
-    if (extruder == FILAMENT_SENSOR_EXTRUDER_NUM)   // Only for extruder with filament sensor
+    if (esteps && extruder == FILAMENT_SENSOR_EXTRUDER_NUM) // Only for extruder with filament sensor
       filwidth.advance_e(steps_dist_mm.e);
   #endif
 
@@ -2421,9 +2707,11 @@ bool Planner::_populate_block(
     if (cs > max_fr) NOMORE(speed_factor, max_fr / cs);
   }
 
-  // Limit speed on extruders, if any
+  // Limit speed on extruders, if any. Travel moves have no E speed to check.
   #if HAS_EXTRUDERS
-    {
+    if (!esteps)
+      current_speed.e = 0;
+    else {
       current_speed.e = steps_dist_mm.e * inverse_secs;
       #if HAS_MIXER_SYNC_CHANNEL
         // Move all mixing extruders at the specified rate
@@ -2588,6 +2876,7 @@ bool Planner::_populate_block(
   }
   block->acceleration_steps_per_s2 = accel;
   block->acceleration = accel / steps_per_mm;
+  TERN_(PLANNER_FIXED_POINT, prepare_fixed_point(block));
   #if DISABLED(S_CURVE_ACCELERATION)
     block->acceleration_rate = (uint32_t)(accel * (float(1UL << 24) / (STEPPER_TIMER_RATE)));
   #endif
@@ -2674,6 +2963,13 @@ bool Planner::_populate_block(
     else
       unit_vec *= inverse_millimeters;      // Use pre-calculated (1 / SQRT(x^2 + y^2 + z^2))
 
+    #if JD_CURVE_WINDOW > 1
+      // Lengths and turn angles of the last few short segments on a curve
+      static float curve_mm[JD_CURVE_WINDOW], curve_theta[JD_CURVE_WINDOW];
+      static uint8_t curve_count, curve_index;
+      bool on_curve = false;
+    #endif
+
     // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
     if (moves_queued && !UNEAR_ZERO(previous_nominal_speed)) {
       // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
@@ -2795,7 +3091,20 @@ bool Planner::_populate_block(
 
               #endif
 
-              const float limit_sqr = (block->millimeters * junction_acceleration) / junction_theta;
+              #if JD_CURVE_WINDOW > 1
+                // Take the radius over the last few segments, so uneven
+                // tessellation doesn't slow down every other junction.
+                curve_mm[curve_index] = block->millimeters;
+                curve_theta[curve_index] = junction_theta;
+                if (++curve_index >= JD_CURVE_WINDOW) curve_index = 0;
+                if (curve_count < JD_CURVE_WINDOW) curve_count++;
+                on_curve = true;
+                float sum_mm = 0, sum_theta = 0;
+                for (uint8_t i = 0; i < curve_count; ++i) { sum_mm += curve_mm[i]; sum_theta += curve_theta[i]; }
+                const float limit_sqr = (sum_mm * junction_acceleration) / sum_theta;
+              #else
+                const float limit_sqr = (block->millimeters * junction_acceleration) / junction_theta;
+              #endif
               NOMORE(vmax_junction_sqr, limit_sqr);
             }
 
@@ -2811,6 +3120,10 @@ bool Planner::_populate_block(
 
     prev_unit_vec = unit_vec;
 
+    #if JD_CURVE_WINDOW > 1
+      if (!on_curve) curve_count = curve_index = 0;
+    #endif
+
   #endif
 
   #if HAS_CLASSIC_JERK
@@ -3141,7 +3454,21 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
   TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
 
   #if IS_KINEMATIC
+    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
+    inverse_kinematics(machine);
+    TERN_(HAS_EXTRUDERS, delta.e = machine.e);
+    return buffer_kinematic_line(cart, fr_mm_s, extruder, hints);
+  #else
+    return buffer_segment(machine, fr_mm_s, extruder, hints);
+  #endif
+} // buffer_line()
+
+#if IS_KINEMATIC
 
+  bool Planner::buffer_kinematic_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
+    , const uint8_t extruder/*=active_extruder*/
+    , const PlannerHints &hints/*=PlannerHints()*/
+  ) {
     #if HAS_JUNCTION_DEVIATION
       const xyze_pos_t cart_dist_mm = LOGICAL_AXIS_ARRAY(
         cart.e - position_cart.e,
@@ -3157,9 +3484,6 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
       );
     #endif
 
-    // Cartesian XYZ to kinematic ABC, stored in global 'delta'
-    inverse_kinematics(machine);
-
     PlannerHints ph = hints;
     if (!hints.millimeters)
       ph.millimeters = (cart_dist_mm.x || cart_dist_mm.y)
@@ -3175,16 +3499,14 @@ bool Planner::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
     #else
       const feedRate_t feedrate = fr_mm_s;
     #endif
-    TERN_(HAS_EXTRUDERS, delta.e = machine.e);
     if (buffer_segment(delta OPTARG(HAS_DIST_MM_ARG, cart_dist_mm), feedrate, extruder, ph)) {
       position_cart = cart;
       return true;
     }
     return false;
-  #else
-    return buffer_segment(machine, fr_mm_s, extruder, hints);
-  #endif
-} // buffer_line()
+  }
+
+#endif // IS_KINEMATIC
 
 #if ENABLED(DIRECT_STEPPING)
 
@@ -3464,3 +3786,160 @@ void Planner::set_max_feedrate(const AxisEnum axis, float inMaxFeedrateMMS) {
   }
 
 #endif
+
+#if ENABLED(PLANNER_TELEMETRY)
+
+  /**
+   * Report the underrun counters, then one line per recorded block, oldest first:
+   *  Q<us>  micros() when the block was queued
+   *  W<us>  Time until the Stepper ISR took the block (0 = still waiting)
+   *  R<us>  Time spent in recalculate() after queueing the block
+   *  P<n>   Blocks in the planner after queueing the block
+   *  C<n>   Commands waiting in the G-code queue
+   */
+  void Planner::report_telemetry() {
+    SERIAL_ECHOLNPGM("Planner underruns:", telemetry.underruns, " not ready:", telemetry.not_ready, " max recalc:", telemetry.max_recalc_us, "us");
+    uint8_t n = telemetry.index;
+    for (uint8_t i = 0; i < BLOCK_BUFFER_SIZE; ++i, n = next_block_index(n)) {
+      const block_telemetry_t &bt = telemetry.ring[n];
+      if (!bt.queued_us) continue; // Not used yet
+      SERIAL_ECHOLNPGM(" Q", bt.queued_us, " W", bt.wait_us, " R", bt.recalc_us, " P", bt.moves_planned, " C", bt.commands_queued);
+    }
+  }
+
+#endif
+
+#if ENABLED(MARLIN_TEST_BUILD)
+
+  /**
+   * Check the trapezoids over a spread of rates, lengths, accelerations and
+   * entry / exit speeds. The phases must be in order and within the block, and
+   * each ramp must reach the rate at its far end to within 2 steps + 1%.
+   */
+  void Planner::test_trapezoids() {
+    static const uint32_t rates[] PROGMEM = { 800, 2400, 8000, 16000, 40000 },
+                          counts[] PROGMEM = { 6, 40, 250, 1600, 12000 },
+                          accels[] PROGMEM = { 1000, 8000, 40000, 200000 };
+    static const float factors[] PROGMEM = { 0.0f, 0.1f, 0.33f, 0.7f, 1.0f };
+
+    uint16_t cases = 0, fails = 0;
+    uint32_t us = 0;
+
+    for (uint8_t r = 0; r < COUNT(rates); ++r)
+    for (uint8_t c = 0; c < COUNT(counts); ++c)
+    for (uint8_t a = 0; a < COUNT(accels); ++a)
+    for (uint8_t f = 0; f < COUNT(factors); ++f) {
+      const uint32_t rate = pgm_read_dword(&rates[r]), count = pgm_read_dword(&counts[c]), accel = pgm_read_dword(&accels[a]);
+      const float fin = pgm_read_float(&factors[f]), fout = pgm_read_float(&factors[COUNT(factors) - 1 - f]);
+
+      block_t blk;
+      blk.reset();
+      blk.nominal_rate = rate;
+      blk.step_event_count = count;
+      blk.acceleration_steps_per_s2 = accel;
+      blk.nominal_speed = 100.0f;
+      TERN_(PLANNER_FIXED_POINT, prepare_fixed_point(&blk));
+
+      const uint32_t start_us = micros();
+      calculate_trapezoid_for_block(&blk,
+        TERN(PLANNER_FIXED_POINT, ufix16_from_float(fin), fin),
+        TERN(PLANNER_FIXED_POINT, ufix16_from_float(fout), fout)
+      );
+      us += micros() - start_us;
+
+      // The squared rate at the end of the accel ramp and at the start of the decel ramp
+      const float up = sq(float(blk.initial_rate)) + 2.0f * accel * blk.accelerate_until,
+                  down = sq(float(blk.final_rate)) + 2.0f * accel * (count - blk.decelerate_after),
+                  nom = sq(float(rate)),
+                  tol = 4.0f * accel + 0.02f * nom;
+
+      bool ok = blk.accelerate_until <= blk.decelerate_after && blk.decelerate_after <= count
+             && blk.initial_rate <= rate && blk.final_rate <= rate;
+      if (ok) {
+        if (blk.decelerate_after > blk.accelerate_until)  // Both ramps reach the cruise rate
+          ok = ABS(up - nom) <= tol && ABS(down - nom) <= tol;
+        else                                              // The ramps meet at the peak rate
+          ok = ABS(up - down) <= tol && up <= nom + tol;
+      }
+
+      ++cases;
+      if (!ok) {
+        ++fails;
+        SERIAL_ECHOLNPGM("FAIL rate:", rate, " steps:", count, " accel:", accel, " in:", fin, " out:", fout,
+          " initial:", blk.initial_rate, " final:", blk.final_rate,
+          " accel_until:", blk.accelerate_until, " decel_after:", blk.decelerate_after);
+      }
+    }
+
+    SERIAL_ECHOLNPGM("Planner trapezoids: ", cases - fails, "/", cases, " consistent");
+    test_timing(F("Planner trapezoid"), us, cases, TERN(__AVR__, 400, 40));
+  }
+
+#endif
+
+#if ALL(MARLIN_TEST_BUILD, PLANNER_FIXED_POINT)
+
+  /**
+   * Compare the fixed-point trapezoid generator against the float math
+   * it replaces, over a spread of rates, lengths and accelerations.
+   * Step counts must agree within 1 step + 0.5% and rates within 1 + 0.1%.
+   */
+  void Planner::test_fixed_point_trapezoids() {
+    static const uint32_t rates[] PROGMEM = { 150, 800, 2400, 8000, 16000, 40000, 65535 },
+                          counts[] PROGMEM = { 6, 40, 250, 1600, 12000 },
+                          accels[] PROGMEM = { 1000, 8000, 40000, 200000 };
+    static const float factors[] PROGMEM = { 0.0f, 0.1f, 0.33f, 0.7f, 1.0f };
+
+    uint16_t cases = 0, fails = 0;
+
+    auto within = [](const uint32_t a, const uint32_t b, const uint32_t pct10) {
+      const uint32_t d = a > b ? a - b : b - a;
+      return d <= 1 + (_MAX(a, b) * pct10) / 1000;
+    };
+
+    for (uint8_t r = 0; r < COUNT(rates); ++r)
+    for (uint8_t c = 0; c < COUNT(counts); ++c)
+    for (uint8_t a = 0; a < COUNT(accels); ++a)
+    for (uint8_t f = 0; f < COUNT(factors); ++f) {
+      const uint32_t rate = pgm_read_dword(&rates[r]), count = pgm_read_dword(&counts[c]), accel = pgm_read_dword(&accels[a]);
+      const float fin = pgm_read_float(&factors[f]), fout = pgm_read_float(&factors[COUNT(factors) - 1 - f]);
+
+      block_t blk;
+      blk.reset();
+      blk.nominal_rate = rate;
+      blk.step_event_count = count;
+      blk.acceleration_steps_per_s2 = accel;
+      blk.nominal_speed = 100.0f;
+      prepare_fixed_point(&blk);
+      calculate_trapezoid_for_speeds(&blk, sq(fin * blk.nominal_speed), sq(fout * blk.nominal_speed));
+
+      // The float reference, as computed without PLANNER_FIXED_POINT
+      uint32_t initial_rate = _MAX(uint32_t(CEIL(rate * fin)), uint32_t(MINIMAL_STEP_RATE)),
+               final_rate = _MAX(uint32_t(CEIL(rate * fout)), uint32_t(MINIMAL_STEP_RATE));
+      const float half_inverse_accel = 0.5f / accel,
+                  nominal_rate_sq = sq(float(rate)),
+                  decel_f = half_inverse_accel * (nominal_rate_sq - sq(float(final_rate))),
+                  accel_f = half_inverse_accel * (nominal_rate_sq - sq(float(initial_rate)));
+      uint32_t accelerate_steps = CEIL(accel_f), decelerate_steps = FLOOR(decel_f);
+      if (int32_t(count) - int32_t(accelerate_steps + decelerate_steps) < 0) {
+        accelerate_steps = _MIN(uint32_t(_MAX(CEIL((count + accel_f - decel_f) * 0.5f), 0)), count);
+        decelerate_steps = count - accelerate_steps;
+      }
+
+      ++cases;
+      const uint32_t tol = 5;
+      if ( !within(blk.initial_rate, initial_rate, 1) || !within(blk.final_rate, final_rate, 1)
+        || !within(blk.accelerate_until, accelerate_steps, tol)
+        || !within(blk.decelerate_after, count - decelerate_steps, tol)
+      ) {
+        ++fails;
+        SERIAL_ECHOLNPGM("FAIL rate:", rate, " steps:", count, " accel:", accel, " in:", fin, " out:", fout,
+          " accel_until:", blk.accelerate_until, "/", accelerate_steps,
+          " decel_after:", blk.decelerate_after, "/", count - decelerate_steps);
+      }
+    }
+
+    SERIAL_ECHOLNPGM("Planner fixed-point trapezoids: ", cases - fails, "/", cases, " within tolerance");
+  }
+
+#endif // MARLIN_TEST_BUILD && PLANNER_FIXED_POINT
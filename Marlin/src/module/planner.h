@@ -76,6 +76,13 @@
   #include "../feature/closedloop.h"
 #endif
 
+#if ENABLED(PLANNER_FIXED_POINT)
+  #include "../libs/fixed_point.h"
+  typedef ufix16_t trap_factor_t;           // Entry / exit factor as Q16.16
+#else
+  typedef float trap_factor_t;
+#endif
+
 // Feedrate for manual moves
 #ifdef MANUAL_FEEDRATE
   constexpr xyze_feedrate_t _mf = MANUAL_FEEDRATE,
@@ -197,18 +204,12 @@ typedef struct PlannerBlock {
   bool is_page() { return TERN0(DIRECT_STEPPING, flag.page); }
   bool is_move() { return !(is_sync() || is_page()); }
 
-  // Fields used by the motion planner to manage acceleration
-  float nominal_speed,                      // The nominal speed for this block in (mm/sec)
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
-        millimeters,                        // The total travel of this block in mm
-        acceleration;                       // acceleration mm/sec^2
-
-  union {
-    abce_ulong_t steps;                     // Step count along each axis
-    abce_long_t position;                   // New position to force when this sync block is executed
-  };
-  uint32_t step_event_count;                // The number of step events required to complete this block
+  /**
+   * Fields read by the Stepper ISR come first, with the narrow ones packed
+   * together ahead of the 32-bit ones so 32-bit MCUs add no padding between
+   * them. Fields only the planner uses follow at the end.
+   */
+  axis_bits_t direction_bits;               // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
 
   #if HAS_MULTI_EXTRUDER
     uint8_t extruder;                       // The extruder to move (if E move)
@@ -216,10 +217,45 @@ typedef struct PlannerBlock {
     static constexpr uint8_t extruder = 0;
   #endif
 
+  #if ENABLED(LIN_ADVANCE)
+    uint8_t  la_scaling;                    // Scale ISR frequency down and step frequency up by 2 ^ la_scaling
+  #endif
+
+  #if HAS_FAN
+    uint8_t fan_speed[FAN_COUNT];
+  #endif
+
+  #if ENABLED(BARICUDA)
+    uint8_t valve_pressure, e_to_p_pressure;
+  #endif
+
+  #if ENABLED(PLANNER_TELEMETRY)
+    uint8_t telemetry_index;                // Entry in Planner::telemetry.ring for this block
+  #endif
+
+  #if ENABLED(DIRECT_STEPPING)
+    page_idx_t page_idx;                    // Page index used for direct stepping
+  #endif
+
+  #if HAS_CUTTER
+    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
+  #endif
+
   #if ENABLED(MIXING_EXTRUDER)
     mixer_comp_t b_color[MIXING_STEPPERS];  // Normalized color for the mixing steppers
   #endif
 
+  #if ENABLED(LIN_ADVANCE)
+    uint16_t max_adv_steps,                 // Max advance steps to get cruising speed pressure
+             final_adv_steps;               // Advance steps for exit speed pressure
+  #endif
+
+  union {
+    abce_ulong_t steps;                     // Step count along each axis
+    abce_long_t position;                   // New position to force when this sync block is executed
+  };
+  uint32_t step_event_count;                // The number of step events required to complete this block
+
   // Settings for the trapezoid generator
   uint32_t accelerate_until,                // The index of the step event on which to stop acceleration
            decelerate_after;                // The index of the step event on which to start decelerating
@@ -230,58 +266,79 @@ typedef struct PlannerBlock {
              deceleration_time,
              acceleration_time_inverse,     // Inverse of acceleration and deceleration periods, expressed as integer. Scale depends on CPU being used
              deceleration_time_inverse;
+    #if ENABLED(STEP_RATE_TABLE)
+      uint32_t accel_slice_time,            // Time of one table slice in STEP timer counts (0 = use the Bézier curve)
+               decel_slice_time;
+      uint16_t accel_rates[STEP_RATE_TABLE_SIZE], // Step rates in the middle of each slice of the acceleration and deceleration time
+               decel_rates[STEP_RATE_TABLE_SIZE];
+    #endif
   #else
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
-  axis_bits_t direction_bits;               // The direction bit set for this block (refers to *_DIRECTION_BIT in config.h)
-
   // Advance extrusion
   #if ENABLED(LIN_ADVANCE)
     uint32_t la_advance_rate;               // The rate at which steps are added whilst accelerating
-    uint8_t  la_scaling;                    // Scale ISR frequency down and step frequency up by 2 ^ la_scaling
-    uint16_t max_adv_steps,                 // Max advance steps to get cruising speed pressure
-             final_adv_steps;               // Advance steps for exit speed pressure
   #endif
 
   uint32_t nominal_rate,                    // The nominal step rate for this block in step_events/sec
            initial_rate,                    // The jerk-adjusted step rate at start of block
-           final_rate,                      // The minimal rate at exit
-           acceleration_steps_per_s2;       // acceleration steps/sec^2
+           final_rate;                      // The minimal rate at exit
 
-  #if ENABLED(DIRECT_STEPPING)
-    page_idx_t page_idx;                    // Page index used for direct stepping
+  #if ENABLED(POWER_LOSS_RECOVERY)
+    uint32_t sdpos;
+    xyze_pos_t start_position;
   #endif
 
-  #if HAS_CUTTER
-    cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
+  #if ENABLED(LASER_FEATURE)
+    block_laser_t laser;
   #endif
 
-  #if HAS_FAN
-    uint8_t fan_speed[FAN_COUNT];
-  #endif
+  // Fields used by the motion planner to manage acceleration
+  float nominal_speed,                      // The nominal speed for this block in (mm/sec)
+        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
+        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
+        millimeters,                        // The total travel of this block in mm
+        acceleration;                       // acceleration mm/sec^2
 
-  #if ENABLED(BARICUDA)
-    uint8_t valve_pressure, e_to_p_pressure;
+  uint32_t acceleration_steps_per_s2;       // acceleration steps/sec^2
+
+  #if ENABLED(PLANNER_FIXED_POINT)
+    uint32_t accel_reciprocal;              // Q0.32 reciprocal of (2 * acceleration_steps_per_s2)
+    float inverse_nominal_speed_sqr;        // 1 / nominal_speed^2, to get entry / exit factors without sqrt or divide
   #endif
 
   #if HAS_WIRED_LCD
     uint32_t segment_time_us;
   #endif
 
-  #if ENABLED(POWER_LOSS_RECOVERY)
-    uint32_t sdpos;
-    xyze_pos_t start_position;
-  #endif
-
-  #if ENABLED(LASER_FEATURE)
-    block_laser_t laser;
-  #endif
-
   void reset() { memset((char*)this, 0, sizeof(*this)); }
 
 } block_t;
 
+#if ENABLED(PLANNER_TELEMETRY)
+
+  // Timing of one planner block, from being queued until the Stepper ISR takes it
+  typedef struct {
+    uint32_t queued_us,                     // micros() when the block was queued
+             wait_us;                       // Time until the Stepper ISR took the block (0 = still waiting)
+    uint16_t recalc_us;                     // Time spent in recalculate() after queueing the block
+    uint8_t moves_planned,                  // movesplanned() after queueing the block
+            commands_queued;                // Commands waiting in the G-code queue at that time
+  } block_telemetry_t;
+
+  typedef struct {
+    block_telemetry_t ring[BLOCK_BUFFER_SIZE]; // The most recently queued blocks
+    uint8_t index;                          // The next ring entry to fill
+    bool stepper_busy;                      // The Stepper ISR took a block since the planner was last empty
+    uint32_t underruns,                     // Times the planner ran empty after a block
+             not_ready;                     // Stepper ISR polls that found the next block still being planned
+    uint16_t max_recalc_us;                 // Longest recalculate() seen
+    void reset() { memset((char*)this, 0, sizeof(*this)); }
+  } planner_telemetry_t;
+
+#endif
+
 #if ANY(LIN_ADVANCE, SCARA_FEEDRATE_SCALING, GRADIENT_MIX, LCD_SHOW_E_TOTAL, POWER_LOSS_RECOVERY)
   #define HAS_POSITION_FLOAT 1
 #endif
@@ -361,8 +418,10 @@ typedef struct {
   typedef uvalue_t((BLOCK_BUFFER_SIZE) * 2) last_move_t;
 #endif
 
-#if ENABLED(ARC_SUPPORT)
+#if EITHER(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
   #define HINTS_CURVE_RADIUS
+#endif
+#if ENABLED(ARC_SUPPORT)
   #define HINTS_SAFE_EXIT_SPEED
 #endif
 
@@ -406,6 +465,7 @@ class Planner {
                             block_buffer_nonbusy,   // Index of the first non busy block
                             block_buffer_planned,   // Index of the optimally planned block
                             block_buffer_tail;      // Index of the busy block, if any
+    static uint8_t block_buffer_dirty;              // Index of the first block changed by the last reverse pass
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
@@ -543,6 +603,18 @@ class Planner {
 
   public:
 
+    #if ENABLED(PLANNER_TELEMETRY)
+      static planner_telemetry_t telemetry;
+      static void report_telemetry();
+    #endif
+
+    #if ENABLED(MARLIN_TEST_BUILD)
+      static void test_trapezoids();
+    #endif
+    #if ALL(MARLIN_TEST_BUILD, PLANNER_FIXED_POINT)
+      static void test_fixed_point_trapezoids();
+    #endif
+
     /**
      * Instance Methods
      */
@@ -595,6 +667,9 @@ class Planner {
     // Apply fan speeds
     #if HAS_FAN
       static void sync_fan_speeds(uint8_t (&fan_speed)[FAN_COUNT]);
+      #if ENABLED(FAN_SPEED_AT_BLOCK_START)
+        static void apply_fan_speeds(const uint8_t (&fan_speed)[FAN_COUNT]);
+      #endif
       #if FAN_KICKSTART_TIME
         static void kickstart_fan(uint8_t (&fan_speed)[FAN_COUNT], const millis_t &ms, const uint8_t f);
       #else
@@ -872,6 +947,17 @@ class Planner {
       , const PlannerHints &hints=PlannerHints()
     );
 
+    #if IS_KINEMATIC
+      /**
+       * Add a new linear movement to the buffer, as with buffer_line,
+       * with the kinematic target (including E) already in 'delta'.
+       */
+      static bool buffer_kinematic_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s
+        , const uint8_t extruder=active_extruder
+        , const PlannerHints &hints=PlannerHints()
+      );
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -909,15 +995,7 @@ class Planner {
      */
     static float get_axis_position_mm(const AxisEnum axis);
 
-    static abce_pos_t get_axis_positions_mm() {
-      const abce_pos_t out = LOGICAL_AXIS_ARRAY(
-        get_axis_position_mm(E_AXIS),
-        get_axis_position_mm(A_AXIS), get_axis_position_mm(B_AXIS), get_axis_position_mm(C_AXIS),
-        get_axis_position_mm(I_AXIS), get_axis_position_mm(J_AXIS), get_axis_position_mm(K_AXIS),
-        get_axis_position_mm(U_AXIS), get_axis_position_mm(V_AXIS), get_axis_position_mm(W_AXIS)
-      );
-      return out;
-    }
+    static abce_pos_t get_axis_positions_mm();
 
     // SCARA AB axes are in degrees, not mm
     #if IS_SCARA
@@ -959,6 +1037,11 @@ class Planner {
      */
     FORCE_INLINE static bool has_blocks_queued() { return (block_buffer_head != block_buffer_tail); }
 
+    #if ENABLED(PID_FLOW_FEEDFORWARD)
+      // Average volumetric flow (mm³/s) of the moves queued for a hotend
+      static float queued_flow_rate(const uint8_t hotend);
+    #endif
+
     /**
      * Get the current block for processing
      * and mark the block as busy.
@@ -1016,6 +1099,13 @@ class Planner {
     static constexpr uint8_t next_block_index(const uint8_t block_index) { return block_inc_mod(block_index, 1); }
     static constexpr uint8_t prev_block_index(const uint8_t block_index) { return block_dec_mod(block_index, 1); }
 
+    /**
+     * Get whichever of two buffer indexes comes later, i.e., closer to the head
+     */
+    static uint8_t later_block_index(const uint8_t a, const uint8_t b, const uint8_t head) {
+      return block_dec_mod(head, a) <= block_dec_mod(head, b) ? a : b;
+    }
+
     /**
      * Calculate the maximum allowable speed squared at this point, in order
      * to reach 'target_velocity_sqr' using 'acceleration' within a given
@@ -1034,7 +1124,19 @@ class Planner {
       }
     #endif
 
-    static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
+    static void calculate_trapezoid_for_block(block_t * const block, const trap_factor_t entry_factor, const trap_factor_t exit_factor);
+
+    // Get the entry / exit factors for a block and calculate its trapezoid.
+    // With PLANNER_FIXED_POINT the speeds are given as squares. (See recalculate_trapezoids.)
+    static void calculate_trapezoid_for_speeds(block_t * const block, const_float_t entry_speed, const_float_t exit_speed);
+
+    #if ENABLED(PLANNER_FIXED_POINT)
+      // Precompute the per-block values used by the fixed-point trapezoid generator
+      static void prepare_fixed_point(block_t * const block) {
+        block->accel_reciprocal = reciprocal_q32(block->acceleration_steps_per_s2 << 1);
+        block->inverse_nominal_speed_sqr = 1.0f / sq(block->nominal_speed);
+      }
+    #endif
 
     static void reverse_pass_kernel(block_t * const current, const block_t * const next OPTARG(ARC_SUPPORT, const_float_t safe_exit_speed_sqr));
     static void forward_pass_kernel(const block_t * const previous, block_t * const current, uint8_t block_index);
@@ -37,73 +37,31 @@
 #include "../MarlinCore.h"
 #include "../gcode/queue.h"
 
-// See the meaning in the documentation of cubic_b_spline().
+// Bounds for the step of the curve parameter. See cubic_b_spline().
 #define MIN_STEP 0.002f
 #define MAX_STEP 0.1f
-#define SIGMA 0.1f
+#ifndef BEZIER_CHORD_TOLERANCE
+  #define BEZIER_CHORD_TOLERANCE 0.1f
+#endif
 
 // Compute the linear interpolation between two real numbers.
 static inline float interp(const_float_t a, const_float_t b, const_float_t t) { return (1 - t) * a + t * b; }
 
 /**
- * Compute a Bézier curve using the De Casteljau's algorithm (see
- * https://en.wikipedia.org/wiki/De_Casteljau%27s_algorithm), which is
- * easy to code and has good numerical stability (very important,
- * since Arudino works with limited precision real numbers).
- */
-static inline float eval_bezier(const_float_t a, const_float_t b, const_float_t c, const_float_t d, const_float_t t) {
-  const float iab = interp(a, b, t),
-              ibc = interp(b, c, t),
-              icd = interp(c, d, t),
-              iabc = interp(iab, ibc, t),
-              ibcd = interp(ibc, icd, t);
-  return interp(iabc, ibcd, t);
-}
-
-/**
- * We approximate Euclidean distance with the sum of the coordinates
- * offset (so-called "norm 1"), which is quicker to compute.
- */
-static inline float dist1(const_float_t x1, const_float_t y1, const_float_t x2, const_float_t y2) { return ABS(x1 - x2) + ABS(y1 - y2); }
-
-/**
- * The algorithm for computing the step is loosely based on the one in Kig
- * (See https://sources.debian.net/src/kig/4:15.08.3-1/misc/kigpainter.cpp/#L759)
- * However, we do not use the stack.
+ * The curve is evaluated in its power form, with Horner's rule:
  *
- * The algorithm goes as it follows: the parameters t runs from 0.0 to
- * 1.0 describing the curve, which is evaluated by eval_bezier(). At
- * each iteration we have to choose a step, i.e., the increment of the
- * t variable. By default the step of the previous iteration is taken,
- * and then it is enlarged or reduced depending on how straight the
- * curve locally is. The step is always clamped between MIN_STEP/2 and
- * 2*MAX_STEP. MAX_STEP is taken at the first iteration.
+ *   B(t) = ((a t + b) t + c) t + P0,  B'(t) = (3a t + 2b) t + c,  B''(t) = 6a t + 2b
  *
- * For some t, the step value is considered acceptable if the curve in
- * the interval [t, t+step] is sufficiently straight, i.e.,
- * sufficiently close to linear interpolation. In practice the
- * following test is performed: the distance between eval_bezier(...,
- * t+step/2) is evaluated and compared with 0.5*(eval_bezier(...,
- * t)+eval_bezier(..., t+step)). If it is smaller than SIGMA, then the
- * step value is considered acceptable, otherwise it is not. The code
- * seeks to find the larger step value which is considered acceptable.
+ * The chord from B(t) to B(t+h) never strays more than h^2/8 * max|B''| from
+ * the curve. B'' is linear in t, so that maximum is found at one end of the
+ * step. The step is sized from both ends to keep each chord within
+ * BEZIER_CHORD_TOLERANCE: long where the curve is flat and short in tight
+ * bends. This costs a few multiplies per axis, with no trial-and-halve search.
  *
- * At every iteration the recorded step value is considered and then
- * iteratively halved until it becomes acceptable. If it was already
- * acceptable in the beginning (i.e., no halving were done), then
- * maybe it was necessary to enlarge it; then it is iteratively
- * doubled while it remains acceptable. The last acceptable value
- * found is taken, provided that it is between MIN_STEP and MAX_STEP
- * and does not bring t over 1.0.
- *
- * Caveat: this algorithm is not perfect, since it can happen that a
- * step is considered acceptable even when the curve is not linear at
- * all in the interval [t, t+step] (but its mid point coincides "by
- * chance" with the midpoint according to the parametrization). This
- * kind of glitches can be eliminated with proper first derivative
- * estimates; however, given the improbability of such configurations,
- * the mitigation offered by MIN_STEP and the small computational
- * power available on Arduino, I think it is not wise to implement it.
+ * The step is clamped between MIN_STEP and MAX_STEP, so every curve gets at
+ * least 10 segments for the linear Z and E interpolation. The planner gets the
+ * length of each segment, and the radius of curvature where each segment after
+ * the first one starts. Junction speeds then follow the curve, not the chord angles.
  */
 void cubic_b_spline(
   const xyze_pos_t &position,       // current position
@@ -115,9 +73,18 @@ void cubic_b_spline(
   // Absolute first and second control points are recovered.
   const xy_pos_t first = position + offsets[0], second = target + offsets[1];
 
+  // Power form coefficients
+  const xy_pos_t p0 = { position.x, position.y }, p3 = { target.x, target.y },
+                 c = (first - p0) * 3.0f,
+                 b = (second - first) * 3.0f - c,
+                 a = p3 - p0 - c - b;
+
+  auto curve_point = [&](const_float_t t) { return ((a * t + b) * t + c) * t + p0; };
+  auto curve_d2 = [&](const_float_t t) { return a * (6 * t) + b * 2.0f; };
+
   xyze_pos_t bez_target;
   bez_target.set(position.x, position.y);
-  float step = MAX_STEP;
+  TERN_(HAS_Z_AXIS, const float travel_z = target.z - position.z);
 
   millis_t next_idle_ms = millis() + 200UL;
 
@@ -133,61 +100,42 @@ void cubic_b_spline(
       idle();
     }
 
-    // First try to reduce the step in order to make it sufficiently
-    // close to a linear interpolation.
-    bool did_reduce = false;
-    float new_t = t + step;
-    NOMORE(new_t, 1);
-    float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
-          new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
-    for (;;) {
-      if (new_t - t < (MIN_STEP)) break;
-      const float candidate_t = 0.5f * (t + new_t),
-                  candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + new_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + new_pos1);
-      if (dist1(candidate_pos0, candidate_pos1, interp_pos0, interp_pos1) <= (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
-      did_reduce = true;
-    }
-
-    // If we did not reduce the step, maybe we should enlarge it.
-    if (!did_reduce) for (;;) {
-      if (new_t - t > MAX_STEP) break;
-      const float candidate_t = t + 2 * (new_t - t);
-      if (candidate_t >= 1) break;
-      const float candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
-                  candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
-                  interp_pos0 = 0.5f * (bez_target.x + candidate_pos0),
-                  interp_pos1 = 0.5f * (bez_target.y + candidate_pos1);
-      if (dist1(new_pos0, new_pos1, interp_pos0, interp_pos1) > (SIGMA)) break;
-      new_t = candidate_t;
-      new_pos0 = candidate_pos0;
-      new_pos1 = candidate_pos1;
+    // Size the step for the chord tolerance from |B''| at both ends
+    const xy_pos_t d2 = curve_d2(t);
+    const float m0 = d2.magnitude();
+    float step = m0 > 0 ? SQRT(8 * (BEZIER_CHORD_TOLERANCE) / m0) : MAX_STEP;
+    LIMIT(step, MIN_STEP, MAX_STEP);
+    const float m1 = curve_d2(_MIN(t + step, 1.0f)).magnitude();
+    if (m1 > m0) {
+      step = SQRT(8 * (BEZIER_CHORD_TOLERANCE) / m1);
+      NOLESS(step, MIN_STEP);
     }
 
-    // Check some postcondition; they are disabled in the actual
-    // Marlin build, but if you test the same code on a computer you
-    // may want to check they are respect.
-    /*
-      assert(new_t <= 1.0);
-      if (new_t < 1.0) {
-        assert(new_t - t >= (MIN_STEP) / 2.0);
-        assert(new_t - t <= (MAX_STEP) * 2.0);
+    // Don't leave a sliver at the end of the curve
+    float new_t = t + step;
+    if (new_t > 1 - 0.5f * (MIN_STEP)) new_t = 1;
+
+    #if ENABLED(HINTS_CURVE_RADIUS)
+      // Radius of curvature at the start of the segment, |B'|^3 / |B' x B''|
+      if (t > 0) {
+        const xy_pos_t d1 = (a * (3 * t) + b * 2.0f) * t + c;
+        const float cross = ABS(d1.x * d2.y - d1.y * d2.x), speed = d1.magnitude();
+        hints.curve_radius = cross > 0 ? speed * speed * speed / cross : 0;
       }
-    */
+    #endif
 
-    hints.millimeters = new_t - t;
+    const xy_pos_t new_pos = new_t < 1 ? curve_point(new_t) : p3;
+
+    #if !HAS_I_AXIS
+      hints.millimeters = SQRT(sq(new_pos.x - bez_target.x) + sq(new_pos.y - bez_target.y) TERN_(HAS_Z_AXIS, + sq(travel_z * (new_t - t))));
+    #endif
     t = new_t;
 
     // Compute and send new position
     xyze_pos_t new_bez = LOGICAL_AXIS_ARRAY(
       interp(position.e, target.e, t),  // FIXME. Wrong, since t is not linear in the distance.
-      new_pos0,
-      new_pos1,
+      new_pos.x,
+      new_pos.y,
       interp(position.z, target.z, t),  // FIXME. Wrong, since t is not linear in the distance.
       interp(position.i, target.i, t),  // FIXME. Wrong, since t is not linear in the distance.
       interp(position.j, target.j, t),  // FIXME. Wrong, since t is not linear in the distance.
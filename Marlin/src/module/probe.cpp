@@ -115,6 +115,11 @@ xyz_pos_t Probe::offset; // Initialized by settings.load()
   Probe::sense_bool_t Probe::test_sensitivity = { true, true, true };
 #endif
 
+#if ENABLED(ADAPTIVE_PROBING)
+  float Probe::predicted_z = NAN,
+        Probe::fast_tap_bias; // = 0
+#endif
+
 #if ENABLED(Z_PROBE_SLED)
 
   #ifndef SLED_DOCKING_OFFSET
@@ -596,6 +601,7 @@ bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
   #endif
 
   #if ENABLED(BLTOUCH)
+    TERN_(BLTOUCH_ASYNC_RESET, bltouch.wait_ready()); // A reset sent before the travel must be done
     if (!bltouch.high_speed_mode && bltouch.deploy())
       return true; // Deploy in LOW SPEED MODE on every probe action
   #endif
@@ -704,9 +710,12 @@ bool Probe::probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s) {
  * @details Used by probe_at_point to get the bed Z height at the current XY.
  *          Leaves current_position.z at the height where the probe triggered.
  *
+ * @param  z_expect  With ADAPTIVE_PROBING, the trigger Z predicted from nearby points.
+ *                   A fast tap that lands within the tolerance is taken as it is.
+ *
  * @return The Z position of the bed at the current XY or NAN on error.
  */
-float Probe::run_z_probe(const bool sanity_check/*=true*/) {
+float Probe::run_z_probe(const bool sanity_check/*=true*/ OPTARG(ADAPTIVE_PROBING, const_float_t z_expect/*=NAN*/)) {
   DEBUG_SECTION(log_probe, "Probe::run_z_probe", DEBUGGING(LEVELING));
 
   auto try_to_probe = [&](PGM_P const plbl, const_float_t z_probe_low_point, const feedRate_t fr_mm_s, const bool scheck, const float clearance) -> bool {
@@ -750,6 +759,23 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
     // Raise to give the probe clearance
     do_blocking_move_to_z(current_position.z + Z_CLEARANCE_MULTI_PROBE, z_probe_fast_mm_s);
 
+  #elif ENABLED(ADAPTIVE_PROBING)
+
+    // Tap once at the fast speed
+    if (try_to_probe(PSTR("FAST"), z_probe_low_point, z_probe_fast_mm_s,
+                     sanity_check, Z_CLEARANCE_BETWEEN_PROBES) ) return NAN;
+
+    const float z_fast = current_position.z;
+    if (isnan(z_expect))
+      fast_tap_bias = 0;  // A new series. Learn the bias over again.
+    else if (ABS(z_fast + fast_tap_bias - z_expect) <= (ADAPTIVE_PROBING_TOLERANCE)) {
+      if (DEBUGGING(LEVELING)) DEBUG_ECHOLNPGM("Fast Probe Z:", z_fast, " Expected:", z_expect);
+      return z_fast + fast_tap_bias;
+    }
+
+    // Off the prediction. Back off a little and confirm with a slow tap.
+    do_blocking_move_to_z(z_fast + (ADAPTIVE_PROBING_RETAP), z_probe_fast_mm_s);
+
   #elif Z_PROBE_FEEDRATE_FAST != Z_PROBE_FEEDRATE_SLOW
 
     // If the nozzle is well over the travel height then
@@ -849,6 +875,12 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
     // Return the single probe result
     const float measured_z = current_position.z;
 
+    #if ENABLED(ADAPTIVE_PROBING)
+      // Follow the gap between fast and slow taps
+      const float gap = measured_z - z_fast;
+      fast_tap_bias = isnan(z_expect) ? gap : (fast_tap_bias + gap) * 0.5f;
+    #endif
+
   #endif
 
   return measured_z;
@@ -876,9 +908,10 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
     DEBUG_POS("", current_position);
   }
 
-  #if ENABLED(BLTOUCH)
+  // With BLTOUCH_ASYNC_RESET the reset settles during the travel move
+  #if ENABLED(BLTOUCH) && DISABLED(PROBE_TRAVEL_OVERLAP)
     if (bltouch.high_speed_mode && bltouch.triggered())
-      bltouch._reset();
+      TERN(BLTOUCH_ASYNC_RESET, bltouch._reset_async(), bltouch._reset());
   #endif
 
   // On delta keep Z below clip height or do_blocking_move_to will abort
@@ -896,19 +929,37 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
   // Move the probe to the starting XYZ
   do_blocking_move_to(npos, feedRate_t(XY_PROBE_FEEDRATE_MM_S));
 
+  // The raise may have still been running before the travel, so reset here instead
+  #if BOTH(BLTOUCH, PROBE_TRAVEL_OVERLAP)
+    if (bltouch.high_speed_mode && bltouch.triggered())
+      bltouch._reset();
+  #endif
+
   #if ENABLED(BD_SENSOR)
     return current_position.z - bdl.read(); // Difference between Z-home-relative Z and sensor reading
   #endif
 
+  #if ENABLED(ADAPTIVE_PROBING)
+    const float z_expect = predicted_z - offset.z;
+    predicted_z = NAN;  // Only good for this point
+  #endif
+
   float measured_z = NAN;
   if (!deploy()) {
-    measured_z = run_z_probe(sanity_check) + offset.z;
+    measured_z = run_z_probe(sanity_check OPTARG(ADAPTIVE_PROBING, z_expect)) + offset.z;
     TERN_(HAS_PTC, ptc.apply_compensation(measured_z));
     TERN_(X_AXIS_TWIST_COMPENSATION, measured_z += xatc.compensation(npos + offset_xy));
   }
   if (!isnan(measured_z)) {
-    if (raise_after == PROBE_PT_RAISE)
-      do_blocking_move_to_z(current_position.z + Z_CLEARANCE_BETWEEN_PROBES, z_probe_fast_mm_s);
+    if (raise_after == PROBE_PT_RAISE) {
+      #if ENABLED(PROBE_TRAVEL_OVERLAP)
+        // Leave the raise in the planner for the next travel to follow
+        current_position.z += Z_CLEARANCE_BETWEEN_PROBES;
+        line_to_current_position(z_probe_fast_mm_s);
+      #else
+        do_blocking_move_to_z(current_position.z + Z_CLEARANCE_BETWEEN_PROBES, z_probe_fast_mm_s);
+      #endif
+    }
     else if (raise_after == PROBE_PT_STOW || raise_after == PROBE_PT_LAST_STOW)
       if (stow()) measured_z = NAN;   // Error on stow?
 
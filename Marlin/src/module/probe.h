@@ -146,6 +146,10 @@ public:
         do_z_clearance(Z_AFTER_PROBING, true); // Move down still permitted
       #endif
     }
+    #if ENABLED(ADAPTIVE_PROBING)
+      static float predicted_z;   // Z the next probe_at_point should measure, or NAN to always slow-tap
+    #endif
+
     static float probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRaise raise_after=PROBE_PT_NONE, const uint8_t verbose_level=0, const bool probe_relative=true, const bool sanity_check=true);
     static float probe_at_point(const xy_pos_t &pos, const ProbePtRaise raise_after=PROBE_PT_NONE, const uint8_t verbose_level=0, const bool probe_relative=true, const bool sanity_check=true) {
       return probe_at_point(pos.x, pos.y, raise_after, verbose_level, probe_relative, sanity_check);
@@ -318,7 +322,11 @@ public:
 private:
   static bool probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s);
   static void do_z_raise(const float z_raise);
-  static float run_z_probe(const bool sanity_check=true);
+  static float run_z_probe(const bool sanity_check=true OPTARG(ADAPTIVE_PROBING, const_float_t z_expect=NAN));
+
+  #if ENABLED(ADAPTIVE_PROBING)
+    static float fast_tap_bias;   // How much lower fast taps trigger than slow taps
+  #endif
 };
 
 extern Probe probe;
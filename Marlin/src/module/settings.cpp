@@ -37,7 +37,6 @@
 
 // Change EEPROM version if the structure changes
 #define EEPROM_VERSION "V88"
-#define EEPROM_OFFSET 100
 
 // Check the integrity of data offsets.
 // Can be disabled for production build.
@@ -161,6 +160,10 @@
   #include "../feature/fancheck.h"
 #endif
 
+#if ENABLED(SETTINGS_PROFILES)
+  #include "../feature/settings_profiles.h"
+#endif
+
 #if ENABLED(DGUS_LCD_UI_MKS)
   #include "../lcd/extui/dgus/DGUSScreenHandler.h"
   #include "../lcd/extui/dgus/DGUSDisplayDef.h"
@@ -204,6 +207,9 @@ typedef struct SettingsDataStruct {
   #endif
   uint16_t  crc;                                        // Data Checksum for validation
   uint16_t  data_size;                                  // Data Size for validation
+  #if ENABLED(EEPROM_WEAR_LEVELING)
+    uint32_t sequence;                                  // Save count. The highest valid copy is current.
+  #endif
 
   //
   // DISTINCT_E_FACTORS
@@ -586,6 +592,13 @@ typedef struct SettingsDataStruct {
     MPC_t mpc_constants[HOTENDS];                       // M306
   #endif
 
+  //
+  // PID flow feed-forward
+  //
+  #if ENABLED(PID_FLOW_FEEDFORWARD)
+    float flow_ff[HOTENDS];                             // M301 En V
+  #endif
+
   //
   // Input Shaping
   //
@@ -598,6 +611,13 @@ typedef struct SettingsDataStruct {
           shaping_y_zeta;                               // M593 Y D
   #endif
 
+  //
+  // Settings profiles
+  //
+  #if ENABLED(SETTINGS_PROFILES)
+    settings_profile_t settings_profiles[SETTINGS_PROFILE_COUNT]; // M824 W
+  #endif
+
 } SettingsData;
 
 //static_assert(sizeof(SettingsData) <= MARLIN_EEPROM_SIZE, "EEPROM too small to contain SettingsData!");
@@ -606,6 +626,19 @@ MarlinSettings settings;
 
 uint16_t MarlinSettings::datasize() { return sizeof(SettingsData); }
 
+//
+// With EEPROM_WEAR_LEVELING each save goes to the next of several copies
+//
+#if ENABLED(EEPROM_WEAR_LEVELING)
+  #define EEPROM_SLOT_SIZE ((sizeof(SettingsData) + 7) & ~size_t(7))
+  #define EEPROM_SLOT_OFFSET(S) (EEPROM_OFFSET + (S) * int(EEPROM_SLOT_SIZE))
+  #define EEPROM_BASE EEPROM_SLOT_OFFSET(settings_slot)
+  #define EEPROM_SETTINGS_END (EEPROM_SLOT_OFFSET(EEPROM_WEAR_SLOTS - 1) + sizeof(SettingsData))
+#else
+  #define EEPROM_BASE EEPROM_OFFSET
+  #define EEPROM_SETTINGS_END (EEPROM_OFFSET + sizeof(SettingsData))
+#endif
+
 /**
  * Post-process after Retrieve or Reset
  */
@@ -671,8 +704,8 @@ void MarlinSettings::postprocess() {
 #if ALL(PRINTCOUNTER, EEPROM_SETTINGS)
   #include "printcounter.h"
   static_assert(
-    !WITHIN(STATS_EEPROM_ADDRESS, EEPROM_OFFSET, EEPROM_OFFSET + sizeof(SettingsData)) &&
-    !WITHIN(STATS_EEPROM_ADDRESS + sizeof(printStatistics), EEPROM_OFFSET, EEPROM_OFFSET + sizeof(SettingsData)),
+    !WITHIN(STATS_EEPROM_ADDRESS, EEPROM_OFFSET, EEPROM_SETTINGS_END) &&
+    !WITHIN(STATS_EEPROM_ADDRESS + sizeof(printStatistics), EEPROM_OFFSET, EEPROM_SETTINGS_END),
     "STATS_EEPROM_ADDRESS collides with EEPROM settings storage."
   );
 #endif
@@ -681,7 +714,7 @@ void MarlinSettings::postprocess() {
 
   #if ENABLED(EEPROM_SETTINGS)
     static_assert(
-      !WITHIN(SD_FIRMWARE_UPDATE_EEPROM_ADDR, EEPROM_OFFSET, EEPROM_OFFSET + sizeof(SettingsData)),
+      !WITHIN(SD_FIRMWARE_UPDATE_EEPROM_ADDR, EEPROM_OFFSET, EEPROM_SETTINGS_END),
       "SD_FIRMWARE_UPDATE_EEPROM_ADDR collides with EEPROM settings storage."
     );
   #endif
@@ -704,8 +737,12 @@ void MarlinSettings::postprocess() {
 
 #endif // SD_FIRMWARE_UPDATE
 
+#if ENABLED(SDCARD_EEPROM_EXTENSION)
+  static_assert(EEPROM_SETTINGS_END <= E2END + 1, "SDCARD_EEPROM_EXTENSION requires the settings to fit in the EEPROM.");
+#endif
+
 #ifdef ARCHIM2_SPI_FLASH_EEPROM_BACKUP_SIZE
-  static_assert(EEPROM_OFFSET + sizeof(SettingsData) < ARCHIM2_SPI_FLASH_EEPROM_BACKUP_SIZE,
+  static_assert(EEPROM_SETTINGS_END < ARCHIM2_SPI_FLASH_EEPROM_BACKUP_SIZE,
                 "ARCHIM2_SPI_FLASH_EEPROM_BACKUP_SIZE is insufficient to capture all EEPROM data.");
 #endif
 
@@ -730,7 +767,7 @@ void MarlinSettings::postprocess() {
     #define _FIELD_TEST(FIELD) \
       SERIAL_ECHOLNPGM("Field: " STRINGIFY(FIELD)); \
       EEPROM_ASSERT( \
-        eeprom_error || eeprom_index == offsetof(SettingsData, FIELD) + EEPROM_OFFSET, \
+        eeprom_error || eeprom_index == offsetof(SettingsData, FIELD) + EEPROM_BASE, \
         "Field " STRINGIFY(FIELD) " mismatch." \
       )
   #else
@@ -755,6 +792,13 @@ void MarlinSettings::postprocess() {
   #endif
 
   bool MarlinSettings::validating;
+  #if ENABLED(EEPROM_DIFF_SAVE)
+    bool MarlinSettings::comparing, MarlinSettings::differs;
+  #endif
+  #if ENABLED(EEPROM_WEAR_LEVELING)
+    uint8_t MarlinSettings::settings_slot;
+    uint32_t MarlinSettings::settings_sequence;
+  #endif
   int MarlinSettings::eeprom_index;
   uint16_t MarlinSettings::working_crc;
 
@@ -777,12 +821,39 @@ void MarlinSettings::postprocess() {
     float dummyf = 0;
     char ver[4] = "ERR";
 
-    if (!EEPROM_START(EEPROM_OFFSET)) return false;
+    #if ENABLED(EEPROM_DIFF_SAVE)
+      // Run the whole save as a compare first. Only a changed image gets written,
+      // so storage isn't invalidated, erased, or rewritten when nothing changed.
+      if (!comparing) {
+        comparing = true;
+        differs = false;
+        const bool compared = save();
+        comparing = false;
+        if (compared && !differs) {
+          DEBUG_ECHO_MSG("Settings Unchanged");
+          LCD_MESSAGE(MSG_SETTINGS_STORED);
+          TERN_(EXTENSIBLE_UI, ExtUI::onSettingsStored(true));
+          return true;
+        }
+      }
+    #endif
+
+    #if ENABLED(EEPROM_WEAR_LEVELING)
+      // Save to the copy after the current one. The current copy stays valid until the new one is complete.
+      if (TERN1(EEPROM_DIFF_SAVE, !comparing)) {
+        settings_slot = (settings_slot + 1) % (EEPROM_WEAR_SLOTS);
+        settings_sequence++;
+      }
+    #endif
+
+    if (!EEPROM_START(EEPROM_BASE)) return false;
 
     EEPROM_Error eeprom_error = ERR_EEPROM_NOERR;
 
     // Write or Skip version. (Flash doesn't allow rewrite without erase.)
-    TERN(FLASH_EEPROM_EMULATION, EEPROM_SKIP, EEPROM_WRITE)(ver);
+    // The compare pass checks the real version with the header at the end.
+    if (TERN0(EEPROM_DIFF_SAVE, comparing)) EEPROM_SKIP(ver);
+    else TERN(FLASH_EEPROM_EMULATION, EEPROM_SKIP, EEPROM_WRITE)(ver);
 
     #if ENABLED(EEPROM_INIT_NOW)
       EEPROM_SKIP(build_hash);  // Skip the hash slot which will be written later
@@ -799,6 +870,8 @@ void MarlinSettings::postprocess() {
     const uint16_t data_size = datasize();
     EEPROM_WRITE(data_size);
 
+    TERN_(EEPROM_WEAR_LEVELING, EEPROM_WRITE(settings_sequence));
+
     const uint8_t e_factors = DISTINCT_AXES - (NUM_AXES);
     _FIELD_TEST(e_factors);
     EEPROM_WRITE(e_factors);
@@ -1654,6 +1727,14 @@ void MarlinSettings::postprocess() {
         EEPROM_WRITE(thermalManager.temp_hotend[e].mpc);
     #endif
 
+    //
+    // PID flow feed-forward
+    //
+    #if ENABLED(PID_FLOW_FEEDFORWARD)
+      _FIELD_TEST(flow_ff);
+      EEPROM_WRITE(thermalManager.flow_ff);
+    #endif
+
     //
     // Input Shaping
     //
@@ -1668,15 +1749,23 @@ void MarlinSettings::postprocess() {
       #endif
     #endif
 
+    //
+    // Settings profiles
+    //
+    #if ENABLED(SETTINGS_PROFILES)
+      _FIELD_TEST(settings_profiles);
+      EEPROM_WRITE(settings_profiles.profile);
+    #endif
+
     //
     // Report final CRC and Data Size
     //
     if (eeprom_error == ERR_EEPROM_NOERR) {
-      const uint16_t eeprom_size = eeprom_index - (EEPROM_OFFSET),
+      const uint16_t eeprom_size = eeprom_index - (EEPROM_BASE),
                      final_crc = working_crc;
 
       // Write the EEPROM header
-      eeprom_index = EEPROM_OFFSET;
+      eeprom_index = EEPROM_BASE;
 
       EEPROM_WRITE(version);
       #if ENABLED(EEPROM_INIT_NOW)
@@ -1685,12 +1774,15 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(final_crc);
 
       // Report storage size
-      DEBUG_ECHO_MSG("Settings Stored (", eeprom_size, " bytes; crc ", (uint32_t)final_crc, ")");
+      if (TERN1(EEPROM_DIFF_SAVE, !comparing))
+        DEBUG_ECHO_MSG("Settings Stored (", eeprom_size, " bytes; crc ", (uint32_t)final_crc, ")");
 
       eeprom_error = size_error(eeprom_size);
     }
     EEPROM_FINISH();
 
+    if (TERN0(EEPROM_DIFF_SAVE, comparing)) return eeprom_error == ERR_EEPROM_NOERR;
+
     //
     // UBL Mesh
     //
@@ -1716,7 +1808,7 @@ void MarlinSettings::postprocess() {
   EEPROM_Error MarlinSettings::_load() {
     EEPROM_Error eeprom_error = ERR_EEPROM_NOERR;
 
-    if (!EEPROM_START(EEPROM_OFFSET)) return eeprom_error;
+    if (!EEPROM_START(EEPROM_BASE)) return eeprom_error;
 
     char stored_ver[4];
     EEPROM_READ_ALWAYS(stored_ver);
@@ -1770,6 +1862,11 @@ void MarlinSettings::postprocess() {
       EEPROM_READ_ALWAYS(stored_size);
       if ((eeprom_error = size_error(stored_size))) break;
 
+      #if ENABLED(EEPROM_WEAR_LEVELING)
+        uint32_t stored_sequence;
+        EEPROM_READ_ALWAYS(stored_sequence);
+      #endif
+
       //
       // Extruder Parameter Count
       // Number of e_factors may change
@@ -2702,6 +2799,14 @@ void MarlinSettings::postprocess() {
       }
       #endif
 
+      //
+      // PID flow feed-forward
+      //
+      #if ENABLED(PID_FLOW_FEEDFORWARD)
+        _FIELD_TEST(flow_ff);
+        EEPROM_READ(thermalManager.flow_ff);
+      #endif
+
       //
       // Input Shaping
       //
@@ -2723,10 +2828,25 @@ void MarlinSettings::postprocess() {
       }
       #endif
 
+      //
+      // Settings profiles
+      //
+      #if ENABLED(SETTINGS_PROFILES)
+      {
+        settings_profile_t profile[SETTINGS_PROFILE_COUNT];
+        _FIELD_TEST(settings_profiles);
+        EEPROM_READ(profile);
+        if (!validating) {
+          COPY(settings_profiles.profile, profile);
+          settings_profiles.active = -1;
+        }
+      }
+      #endif
+
       //
       // Validate Final Size and CRC
       //
-      const uint16_t eeprom_total = eeprom_index - (EEPROM_OFFSET);
+      const uint16_t eeprom_total = eeprom_index - (EEPROM_BASE);
       if ((eeprom_error = size_error(eeprom_total))) {
         // Handle below and on return
         break;
@@ -2735,7 +2855,9 @@ void MarlinSettings::postprocess() {
         eeprom_error = ERR_EEPROM_CRC;
         break;
       }
-      else if (!validating) {
+      TERN_(EEPROM_WEAR_LEVELING, settings_sequence = stored_sequence);
+
+      if (!validating) {
         DEBUG_ECHO_START();
         DEBUG_ECHO(version);
         DEBUG_ECHOLNPGM(" stored settings retrieved (", eeprom_total, " bytes; crc ", working_crc, ")");
@@ -2782,7 +2904,7 @@ void MarlinSettings::postprocess() {
         if (!validating) postprocess();
         break;
       case ERR_EEPROM_SIZE:
-        DEBUG_ECHO_MSG("Index: ", eeprom_index - (EEPROM_OFFSET), " Size: ", datasize());
+        DEBUG_ECHO_MSG("Index: ", eeprom_index - (EEPROM_BASE), " Size: ", datasize());
         break;
       case ERR_EEPROM_CORRUPT:
         DEBUG_ERROR_MSG(STR_ERR_EEPROM_CORRUPT);
@@ -2806,16 +2928,121 @@ void MarlinSettings::postprocess() {
     extern bool restoreEEPROM();
   #endif
 
+  #if ENABLED(EEPROM_FAST_VALIDATE)
+
+    /**
+     * Check the stored version, size and CRC with one raw read of the image
+     * instead of running the whole loader without applying anything.
+     * Problems only the loader can see (e.g., a mismatched mesh) fall back
+     * to defaults in load().
+     */
+    EEPROM_Error MarlinSettings::check_image() {
+      if (!EEPROM_START(EEPROM_BASE)) return ERR_EEPROM_NOERR;
+
+      EEPROM_Error eeprom_error = ERR_EEPROM_NOERR;
+
+      char stored_ver[4];
+      EEPROM_READ_ALWAYS(stored_ver);
+      uint16_t stored_crc = 0;
+
+      do {
+        if (strncmp(version, stored_ver, 3) != 0) {
+          DEBUG_ECHO_MSG("EEPROM version mismatch (Marlin=" EEPROM_VERSION ")");
+          eeprom_error = ERR_EEPROM_VERSION;
+          break;
+        }
+
+        #if ENABLED(EEPROM_INIT_NOW)
+          uint32_t stored_hash;
+          EEPROM_READ_ALWAYS(stored_hash);
+          if (stored_hash != build_hash) { eeprom_error = ERR_EEPROM_CORRUPT; break; }
+        #endif
+
+        EEPROM_READ_ALWAYS(stored_crc);
+        working_crc = 0;
+
+        uint16_t stored_size;
+        EEPROM_READ_ALWAYS(stored_size);
+        if ((eeprom_error = size_error(stored_size))) break;
+
+        #if ENABLED(EEPROM_WEAR_LEVELING)
+          uint32_t stored_sequence;
+          EEPROM_READ_ALWAYS(stored_sequence);
+        #endif
+
+        // CRC the rest of the image in small chunks
+        uint8_t chunk[16];
+        for (int left = stored_size - (eeprom_index - (EEPROM_BASE)); left > 0; left -= sizeof(chunk))
+          persistentStore.read_data(eeprom_index, chunk, _MIN(left, int(sizeof(chunk))), &working_crc);
+
+        if (working_crc != stored_crc) {
+          DEBUG_ERROR_MSG("EEPROM CRC mismatch - (stored) ", stored_crc, " != ", working_crc, " (calculated)!");
+          TERN_(HOST_EEPROM_CHITCHAT, hostui.notify(GET_TEXT_F(MSG_ERR_EEPROM_CRC)));
+          eeprom_error = ERR_EEPROM_CRC;
+          break;
+        }
+
+        TERN_(EEPROM_WEAR_LEVELING, settings_sequence = stored_sequence);
+
+      } while (0);
+
+      EEPROM_FINISH();
+      return eeprom_error;
+    }
+
+  #endif
+
+  #if ENABLED(EEPROM_WEAR_LEVELING)
+
+    /**
+     * Load the newest copy of the settings that passes validation.
+     * A copy with a bad CRC (e.g., from a save cut short) falls back to the one before it.
+     */
+    EEPROM_Error MarlinSettings::load_newest() {
+      int32_t seq[EEPROM_WEAR_SLOTS];
+      for (uint8_t s = 0; s < EEPROM_WEAR_SLOTS; ++s) {
+        int pos = EEPROM_SLOT_OFFSET(s);
+        char stored_ver[4];
+        uint32_t stored_sequence;
+        uint16_t dummy_crc = 0;
+        persistentStore.access_start();
+        persistentStore.read_data(pos, (uint8_t*)stored_ver, sizeof(stored_ver), &dummy_crc);
+        pos = EEPROM_SLOT_OFFSET(s) + offsetof(SettingsData, sequence);
+        persistentStore.read_data(pos, (uint8_t*)&stored_sequence, sizeof(stored_sequence), &dummy_crc);
+        persistentStore.access_finish();
+        seq[s] = strncmp(version, stored_ver, 3) ? -1 : int32_t(stored_sequence & 0x7FFFFFFF);
+      }
+
+      EEPROM_Error err = ERR_EEPROM_VERSION;
+      for (;;) {
+        int8_t newest = -1;
+        for (uint8_t s = 0; s < EEPROM_WEAR_SLOTS; ++s)
+          if (seq[s] >= 0 && (newest < 0 || seq[s] > seq[newest])) newest = s;
+        if (newest < 0) break;
+        settings_slot = newest;
+        if (!(err = _validate())) break;
+        seq[newest] = -1;
+      }
+
+      // With nothing valid the next save goes to the first copy
+      if (err) { settings_slot = EEPROM_WEAR_SLOTS - 1; settings_sequence = 0; }
+      return err;
+    }
+
+  #endif
+
   bool MarlinSettings::validate() {
     validating = true;
-    #ifdef ARCHIM2_SPI_FLASH_EEPROM_BACKUP_SIZE
-      EEPROM_Error err = _load();
+    #if ENABLED(EEPROM_WEAR_LEVELING)
+      const EEPROM_Error err = load_newest();
+    #elif defined(ARCHIM2_SPI_FLASH_EEPROM_BACKUP_SIZE)
+      EEPROM_Error err = _validate();
       if (err != ERR_EEPROM_NOERR && restoreEEPROM()) {
         SERIAL_ECHOLNPGM("Recovered backup EEPROM settings from SPI Flash");
-        err = _load();
+        err = _validate();
       }
     #else
-      const EEPROM_Error err = _load();
+      const EEPROM_Error err = _validate();
     #endif
     validating = false;
 
@@ -2828,6 +3055,10 @@ void MarlinSettings::postprocess() {
     if (validate()) {
       const EEPROM_Error err = _load();
       const bool success = (err == ERR_EEPROM_NOERR);
+      #if ENABLED(EEPROM_FAST_VALIDATE)
+        // A good CRC with data the loader can't use. Don't keep a partial load.
+        if (!success) { ui.eeprom_alert(err); reset(); }
+      #endif
       TERN_(EXTENSIBLE_UI, ExtUI::onSettingsLoaded(success));
       return success;
     }
@@ -2839,7 +3070,7 @@ void MarlinSettings::postprocess() {
     return false;
   }
 
-  #if ENABLED(AUTO_BED_LEVELING_UBL)
+  #if ENABLED(AUTO_BED_LEVELING_UBL) || defined(BILINEAR_MESH_SLOTS)
 
     inline void ubl_invalid_slot(const int s) {
       DEBUG_ECHOLNPGM("?Invalid slot.\n", s, " mesh slots available.");
@@ -2854,13 +3085,53 @@ void MarlinSettings::postprocess() {
     uint16_t MarlinSettings::meshes_start_index() {
       // Pad the end of configuration data so it can float up
       // or down a little bit without disrupting the mesh data
-      return (datasize() + EEPROM_OFFSET + 32) & 0xFFF8;
+      return (EEPROM_SETTINGS_END + 32) & 0xFFF8;
     }
 
-    #define MESH_STORE_SIZE sizeof(TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, bedlevel.z_values))
+    #ifdef BILINEAR_MESH_SLOTS
+
+      // A bilinear mesh slot. Z is kept in µm from the midpoint of the mesh.
+      typedef struct {
+        xy_pos_t grid_spacing, grid_start;                        // G29 grid
+        celsius_t bed_temp;                                       // Bed temperature when saved
+        float z_base;                                             // Midpoint of the Z values
+        int16_t z_steps[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];    // (µm) Z - z_base. INT16_MAX for NAN.
+      } bilinear_store_t;
+
+      constexpr float bilinear_store_scaling = 1000;
+      constexpr int16_t BILINEAR_STORE_NAN = INT16_MAX;
+
+      #define MESH_STORE_SIZE (sizeof(bilinear_store_t) + sizeof(uint16_t)) // with CRC
+
+      // Read a slot and check its CRC. Return 'true' if it's good.
+      static bool read_bilinear_store(const int8_t slot, bilinear_store_t &store) {
+        int pos = settings.mesh_slot_offset(slot);
+        uint16_t crc = 0, stored_crc = 0, dummy = 0;
+        persistentStore.access_start();
+        const bool status = persistentStore.read_data(pos, (uint8_t*)&store, sizeof(store), &crc)
+                         || persistentStore.read_data(pos, (uint8_t*)&stored_crc, sizeof(stored_crc), &dummy);
+        persistentStore.access_finish();
+        return !status && crc == stored_crc;
+      }
+
+      static float bilinear_store_z(const bilinear_store_t &store, const uint8_t x, const uint8_t y) {
+        const int16_t zs = store.z_steps[x][y];
+        return zs == BILINEAR_STORE_NAN ? NAN : store.z_base + zs / bilinear_store_scaling;
+      }
+
+    #else
+
+      #define MESH_STORE_SIZE sizeof(TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, bedlevel.z_values))
+
+    #endif
 
     uint16_t MarlinSettings::calc_num_meshes() {
-      return (meshes_end - meshes_start_index()) / MESH_STORE_SIZE;
+      const uint16_t n = (meshes_end - meshes_start_index()) / MESH_STORE_SIZE;
+      #ifdef BILINEAR_MESH_SLOTS
+        return _MIN(n, uint16_t(BILINEAR_MESH_SLOTS));
+      #else
+        return n;
+      #endif
     }
 
     int MarlinSettings::mesh_slot_offset(const int8_t slot) {
@@ -2897,6 +3168,50 @@ void MarlinSettings::postprocess() {
         if (status) SERIAL_ECHOLNPGM("?Unable to save mesh data.");
         else        DEBUG_ECHOLNPGM("Mesh saved in slot ", slot);
 
+      #elif defined(BILINEAR_MESH_SLOTS)
+
+        const int16_t a = calc_num_meshes();
+        if (!WITHIN(slot, 0, a - 1)) { ubl_invalid_slot(a); return; }
+
+        bilinear_store_t store;
+        store.grid_spacing = bedlevel.grid_spacing;
+        store.grid_start = bedlevel.grid_start;
+        store.bed_temp = TERN(HAS_HEATED_BED, LROUND(thermalManager.degBed()), 0);
+
+        // Center the values so the µm steps have the most room
+        float lo = 1e6, hi = -1e6;
+        GRID_LOOP(x, y) {
+          const float z = bedlevel.z_values[x][y];
+          if (!isnan(z)) { NOMORE(lo, z); NOLESS(hi, z); }
+        }
+        store.z_base = lo <= hi ? (lo + hi) * 0.5f : 0;
+
+        GRID_LOOP(x, y) {
+          const float z = bedlevel.z_values[x][y];
+          int32_t zs = BILINEAR_STORE_NAN;
+          if (!isnan(z)) {
+            zs = LROUND((z - store.z_base) * bilinear_store_scaling);
+            if (!WITHIN(zs, INT16_MIN, INT16_MAX - 1)) {
+              SERIAL_ECHOLNPGM("?Mesh range too large to save.");
+              return;
+            }
+          }
+          store.z_steps[x][y] = int16_t(zs);
+        }
+
+        int pos = mesh_slot_offset(slot);
+        uint16_t crc = 0;
+        persistentStore.access_start();
+        bool status = persistentStore.write_data(pos, (uint8_t*)&store, sizeof(store), &crc);
+        if (!status) {
+          uint16_t dummy = 0;
+          status = persistentStore.write_data(pos, (uint8_t*)&crc, sizeof(crc), &dummy);
+        }
+        persistentStore.access_finish();
+
+        if (status) SERIAL_ECHOLNPGM("?Unable to save mesh data.");
+        else        SERIAL_ECHOLNPGM("Mesh saved in slot ", slot);
+
       #else
 
         // Other mesh types
@@ -2938,6 +3253,10 @@ void MarlinSettings::postprocess() {
             bedlevel.set_mesh_from_store(z_mesh_store, bedlevel.z_values);
         #endif
 
+        #if ENABLED(UBL_MESH_GRADIENTS)
+          if (!into) bedlevel.refresh_gradients();
+        #endif
+
         #if ENABLED(DWIN_LCD_PROUI)
           status = !bedLevelTools.meshvalidate();
           if (status) {
@@ -2953,6 +3272,28 @@ void MarlinSettings::postprocess() {
 
         EEPROM_FINISH();
 
+      #elif defined(BILINEAR_MESH_SLOTS)
+
+        UNUSED(into);
+
+        const int16_t a = calc_num_meshes();
+        if (!WITHIN(slot, 0, a - 1)) { ubl_invalid_slot(a); return; }
+
+        bilinear_store_t store;
+        if (!read_bilinear_store(slot, store)) {
+          SERIAL_ECHOLNPGM("?Unable to load mesh data.");
+          return;
+        }
+
+        bedlevel.set_grid(store.grid_spacing, store.grid_start);
+        GRID_LOOP(x, y) {
+          bedlevel.z_values[x][y] = bilinear_store_z(store, x, y);
+          TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(x, y, bedlevel.z_values[x][y]));
+        }
+        bedlevel.refresh_bed_level();
+
+        SERIAL_ECHOLNPGM("Mesh loaded from slot ", slot, " (", store.bed_temp, "C)");
+
       #else
 
         // Other mesh types
@@ -2960,10 +3301,46 @@ void MarlinSettings::postprocess() {
       #endif
     }
 
+    #if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+
+      /**
+       * Set the active mesh to a blend of the slots saved at the nearest bed
+       * temperatures below and above 't'. Only slots on the active grid are used.
+       * Return 'false' if there's no usable slot.
+       */
+      bool MarlinSettings::blend_meshes(const_celsius_float_t t) {
+        bilinear_store_t store;
+        int8_t lo = -1, hi = -1;
+        celsius_t t_lo = 0, t_hi = 0;
+        for (int8_t slot = 0; slot < int8_t(calc_num_meshes()); ++slot) {
+          if (!read_bilinear_store(slot, store)) continue;
+          if (bedlevel.has_mesh() && (store.grid_spacing != bedlevel.grid_spacing || store.grid_start != bedlevel.grid_start)) continue;
+          if (store.bed_temp <= t && (lo < 0 || store.bed_temp > t_lo)) { lo = slot; t_lo = store.bed_temp; }
+          if (store.bed_temp >= t && (hi < 0 || store.bed_temp < t_hi)) { hi = slot; t_hi = store.bed_temp; }
+        }
+        // Outside the saved range use the nearest slot as it is
+        if (lo < 0) { lo = hi; t_lo = t_hi; }
+        if (hi < 0) { hi = lo; t_hi = t_lo; }
+        if (lo < 0 || !read_bilinear_store(lo, store)) return false;
+
+        bedlevel.set_grid(store.grid_spacing, store.grid_start);
+        GRID_LOOP(x, y) bedlevel.z_values[x][y] = bilinear_store_z(store, x, y);
+
+        if (t_hi > t_lo && read_bilinear_store(hi, store)) {
+          const float f = (t - t_lo) / float(t_hi - t_lo);
+          GRID_LOOP(x, y) bedlevel.z_values[x][y] += (bilinear_store_z(store, x, y) - bedlevel.z_values[x][y]) * f;
+        }
+
+        bedlevel.refresh_bed_level();
+        return true;
+      }
+
+    #endif
+
     //void MarlinSettings::delete_mesh() { return; }
     //void MarlinSettings::defrag_meshes() { return; }
 
-  #endif // AUTO_BED_LEVELING_UBL
+  #endif // AUTO_BED_LEVELING_UBL || BILINEAR_MESH_SLOTS
 
 #else // !EEPROM_SETTINGS
 
@@ -3304,6 +3681,13 @@ void MarlinSettings::reset() {
   //
   TERN_(PID_EXTRUSION_SCALING, thermalManager.lpq_len = 20); // Default last-position-queue size
 
+  //
+  // PID Flow Feed-forward
+  //
+  #if ENABLED(PID_FLOW_FEEDFORWARD)
+    HOTEND_LOOP() thermalManager.flow_ff[e] = DEFAULT_Kv;
+  #endif
+
   //
   // Heated Bed PID
   //
@@ -3515,6 +3899,11 @@ void MarlinSettings::reset() {
     #endif
   #endif
 
+  //
+  // Settings profiles start out as copies of the defaults
+  //
+  TERN_(SETTINGS_PROFILES, settings_profiles.reset());
+
   postprocess();
 
   #if ANY(EEPROM_CHITCHAT, DEBUG_LEVELING_FEATURE)
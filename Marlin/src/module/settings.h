@@ -27,6 +27,9 @@
 
 #include "../inc/MarlinConfig.h"
 
+// Settings start here. The print counter and other small items use the space below.
+#define EEPROM_OFFSET 100
+
 #if ENABLED(EEPROM_SETTINGS)
   #include "../HAL/shared/eeprom_api.h"
   enum EEPROM_Error : uint8_t {
@@ -81,14 +84,17 @@ class MarlinSettings {
         if (!loaded && load()) loaded = true;
       }
 
-      #if ENABLED(AUTO_BED_LEVELING_UBL) // Eventually make these available if any leveling system
-                                         // That can store is enabled
+      #if ENABLED(AUTO_BED_LEVELING_UBL) || defined(BILINEAR_MESH_SLOTS) // Eventually make these available if any leveling system
+                                                                        // That can store is enabled
         static uint16_t meshes_start_index();
         FORCE_INLINE static uint16_t meshes_end_index() { return meshes_end; }
         static uint16_t calc_num_meshes();
         static int mesh_slot_offset(const int8_t slot);
         static void store_mesh(const int8_t slot);
         static void load_mesh(const int8_t slot, void * const into=nullptr);
+        #if ENABLED(BILINEAR_MESH_TEMP_BLEND)
+          static bool blend_meshes(const_celsius_float_t t);
+        #endif
 
         //static void delete_mesh();    // necessary if we have a MAT
         //static void defrag_meshes();  // "
@@ -116,14 +122,26 @@ class MarlinSettings {
     #if ENABLED(EEPROM_SETTINGS)
 
       static bool validating;
+      #if ENABLED(EEPROM_DIFF_SAVE)
+        static bool comparing, differs;   // Dry-run save that only compares the stored image
+      #endif
+      #if ENABLED(EEPROM_WEAR_LEVELING)
+        static uint8_t settings_slot;     // Copy of the settings last loaded or saved
+        static uint32_t settings_sequence;
+        static EEPROM_Error load_newest();
+      #endif
 
-      #if ENABLED(AUTO_BED_LEVELING_UBL)  // Eventually make these available if any leveling system
-                                          // That can store is enabled
+      #if ENABLED(AUTO_BED_LEVELING_UBL) || defined(BILINEAR_MESH_SLOTS) // Eventually make these available if any leveling system
+                                                                        // That can store is enabled
         static const uint16_t meshes_end; // 128 is a placeholder for the size of the MAT; the MAT will always
                                           // live at the very end of the eeprom
       #endif
 
       static EEPROM_Error _load();
+      #if ENABLED(EEPROM_FAST_VALIDATE)
+        static EEPROM_Error check_image();
+      #endif
+      static EEPROM_Error _validate() { return TERN(EEPROM_FAST_VALIDATE, check_image(), _load()); }
       static EEPROM_Error size_error(const uint16_t size);
 
       static int eeprom_index;
@@ -143,6 +161,17 @@ class MarlinSettings {
 
       template<typename T>
       static void EEPROM_WRITE(const T &VAR) {
+        #if ENABLED(EEPROM_DIFF_SAVE)
+          if (comparing) {
+            const uint8_t *v = (const uint8_t *) &VAR;
+            for (size_t i = sizeof(VAR); i--; ++v) {
+              uint8_t c; uint16_t dummy_crc = 0;
+              persistentStore.read_data(eeprom_index, &c, 1, &dummy_crc);
+              if (c != *v) differs = true;
+            }
+            return;
+          }
+        #endif
         persistentStore.write_data(eeprom_index, (const uint8_t *) &VAR, sizeof(VAR), &working_crc);
       }
 
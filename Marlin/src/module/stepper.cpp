@@ -141,6 +141,26 @@ Stepper stepper; // Singleton
   #include "../HAL/ESP32/i2s.h"
 #endif
 
+#if ENABLED(ISR_PROFILER)
+  #include "../feature/isr_profiler.h"
+#endif
+
+#if ENABLED(STACK_MONITOR)
+  #include "../feature/stack_monitor.h"
+#endif
+
+#if ENABLED(PLANNER_BENCHMARK)
+  #include "../tests/planner_benchmark.h"
+#endif
+
+#if ENABLED(LINK_BENCHMARK)
+  #include "../feature/link_benchmark.h"
+#endif
+
+#if ENABLED(VIRTUAL_STEPPING)
+  #include "../feature/virtual_stepper.h"
+#endif
+
 // public:
 
 #if ANY(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
@@ -170,6 +190,10 @@ bool Stepper::abort_current_block;
   uint8_t Stepper::last_moved_extruder = 0xFF;
 #endif
 
+#if ENABLED(PARALLEL_XY_HOMING)
+  bool Stepper::separate_xy_axes = false;
+#endif
+
 #if ENABLED(X_DUAL_ENDSTOPS)
   bool Stepper::locked_X_motor = false, Stepper::locked_X2_motor = false;
 #endif
@@ -191,6 +215,15 @@ bool Stepper::abort_current_block;
 uint32_t Stepper::acceleration_time, Stepper::deceleration_time;
 uint8_t Stepper::steps_per_isr;
 
+#if ENABLED(ADAPTIVE_MULTISTEPPING)
+  uint8_t Stepper::multistep_idx; // = 0
+  bool Stepper::multistep_used; // = false
+  uint16_t Stepper::multistep_scale = 256;
+  uint32_t Stepper::multistep_limit[8],
+           Stepper::multistep_busy_ticks, Stepper::multistep_period_ticks,
+           Stepper::multistep_events[8];
+#endif
+
 #if ENABLED(FREEZE_FEATURE)
   bool Stepper::frozen; // = false
 #endif
@@ -222,11 +255,16 @@ uint32_t Stepper::advance_divisor = 0,
     bool __attribute__((used)) Stepper::A_negative __asm__("A_negative"); // If A coefficient was negative
   #endif
   bool Stepper::bezier_2nd_half;    // =false If Bézier curve has been initialized or not
+  #if ENABLED(STEP_RATE_TABLE)
+    uint8_t Stepper::rate_slice;
+    uint32_t Stepper::next_slice_time, Stepper::slice_rate, Stepper::slice_interval;
+  #endif
 #endif
 
 #if ENABLED(LIN_ADVANCE)
   uint32_t Stepper::nextAdvanceISR = LA_ADV_NEVER,
-           Stepper::la_interval = LA_ADV_NEVER;
+           Stepper::la_interval = LA_ADV_NEVER,
+           Stepper::la_rate = 0;
   int32_t  Stepper::la_delta_error = 0,
            Stepper::la_dividend = 0,
            Stepper::la_advance_steps = 0;
@@ -234,8 +272,14 @@ uint32_t Stepper::advance_divisor = 0,
 
 #if HAS_ZV_SHAPING
   shaping_time_t      ShapingQueue::now = 0;
-  shaping_time_t      ShapingQueue::times[shaping_echoes];
-  shaping_echo_axis_t ShapingQueue::echo_axes[shaping_echoes];
+  #if ENABLED(SHAPING_COMPACT_QUEUE)
+    uint8_t           ShapingQueue::deltas[shaping_echoes];
+    uint8_t           ShapingQueue::echo_bits[(shaping_echoes + 1) / 2];
+    shaping_time_t    ShapingQueue::last_time = 0;
+  #else
+    shaping_time_t      ShapingQueue::times[shaping_echoes];
+    shaping_echo_axis_t ShapingQueue::echo_axes[shaping_echoes];
+  #endif
   uint16_t            ShapingQueue::tail = 0;
 
   #if ENABLED(INPUT_SHAPING_X)
@@ -243,6 +287,7 @@ uint32_t Stepper::advance_divisor = 0,
     shaping_time_t  ShapingQueue::peek_x_val = shaping_time_t(-1);
     uint16_t        ShapingQueue::head_x = 0;
     uint16_t        ShapingQueue::_free_count_x = shaping_echoes - 1;
+    TERN_(SHAPING_COMPACT_QUEUE, shaping_time_t ShapingQueue::head_x_time = 0);
     ShapeParams     Stepper::shaping_x;
   #endif
   #if ENABLED(INPUT_SHAPING_Y)
@@ -250,6 +295,7 @@ uint32_t Stepper::advance_divisor = 0,
     shaping_time_t  ShapingQueue::peek_y_val = shaping_time_t(-1);
     uint16_t        ShapingQueue::head_y = 0;
     uint16_t        ShapingQueue::_free_count_y = shaping_echoes - 1;
+    TERN_(SHAPING_COMPACT_QUEUE, shaping_time_t ShapingQueue::head_y_time = 0);
     ShapeParams     Stepper::shaping_y;
   #endif
 #endif
@@ -369,6 +415,11 @@ xyze_int8_t Stepper::count_direction{0};
     A##4_STEP_WRITE(V);                           \
   }
 
+#if ENABLED(PARALLEL_XY_HOMING)
+  // When homing X and Y together an axis stops stepping at its own endstop
+  #define XY_HOME_STOP(A) (separate_xy_axes && TEST(endstops.state(), TERN(A##_HOME_TO_MIN, A##_MIN, A##_MAX)))
+#endif
+
 #if HAS_DUAL_X_STEPPERS
   #define X_APPLY_DIR(v,Q) do{ X_DIR_WRITE(v); X2_DIR_WRITE((v) ^ ENABLED(INVERT_X2_VS_X_DIR)); }while(0)
   #if ENABLED(X_DUAL_ENDSTOPS)
@@ -387,7 +438,11 @@ xyze_int8_t Stepper::count_direction{0};
   }while(0)
 #else
   #define X_APPLY_DIR(v,Q) X_DIR_WRITE(v)
-  #define X_APPLY_STEP(v,Q) X_STEP_WRITE(v)
+  #if ENABLED(PARALLEL_XY_HOMING)
+    #define X_APPLY_STEP(v,Q) do{ if (!XY_HOME_STOP(X)) X_STEP_WRITE(v); }while(0)
+  #else
+    #define X_APPLY_STEP(v,Q) X_STEP_WRITE(v)
+  #endif
 #endif
 
 #if HAS_DUAL_Y_STEPPERS
@@ -399,7 +454,11 @@ xyze_int8_t Stepper::count_direction{0};
   #endif
 #elif HAS_Y_AXIS
   #define Y_APPLY_DIR(v,Q) Y_DIR_WRITE(v)
-  #define Y_APPLY_STEP(v,Q) Y_STEP_WRITE(v)
+  #if ENABLED(PARALLEL_XY_HOMING)
+    #define Y_APPLY_STEP(v,Q) do{ if (!XY_HOME_STOP(Y)) Y_STEP_WRITE(v); }while(0)
+  #else
+    #define Y_APPLY_STEP(v,Q) Y_STEP_WRITE(v)
+  #endif
 #endif
 
 #if NUM_Z_STEPPERS == 4
@@ -468,6 +527,63 @@ xyze_int8_t Stepper::count_direction{0};
   #define E_APPLY_STEP(v,Q) E_STEP_WRITE(stepper_extruder, v)
 #endif
 
+#if ENABLED(FUSED_STEP_PORTS)
+
+  /**
+   * Writing a 1 to a bit of an AVR PINx register toggles the PORTx output bit.
+   * Step bits are gathered into one mask per port and each port is written once
+   * to start the pulse, then once more to end it. Each stepper is assigned to the
+   * first stepper (in XYZ order) sharing its port. The port addresses are constant,
+   * so all the comparisons below fold away at compile time.
+   */
+  #define STEP_RPORT(S)       IO_RPORT(S##_STEP_PIN)
+  #define STEP_MASK(S)        IO_MASK(S##_STEP_PIN)
+  #define SAME_STEP_PORT(S,T) (&STEP_RPORT(S) == &STEP_RPORT(T))
+  #if NUM_Z_STEPPERS > 1
+    #define Z2_STEP_PORT(S)   SAME_STEP_PORT(S,Z2)
+  #else
+    #define Z2_STEP_PORT(S)   false
+  #endif
+
+  typedef struct { uint8_t x, y, z, z2, e; } fused_steps_t;
+
+  FORCE_INLINE void add_fused_step(fused_steps_t &f, volatile uint8_t &port, const uint8_t mask) {
+         if (&port == &STEP_RPORT(X)) f.x |= mask;
+    else if (&port == &STEP_RPORT(Y)) f.y |= mask;
+    else if (&port == &STEP_RPORT(Z)) f.z |= mask;
+    #if NUM_Z_STEPPERS > 1
+      else if (&port == &STEP_RPORT(Z2)) f.z2 |= mask;
+    #endif
+    else f.e |= mask;
+  }
+
+  FORCE_INLINE void toggle_fused_steps(const fused_steps_t &f) {
+    STEP_RPORT(X) = f.x;
+    if (!SAME_STEP_PORT(Y,X)) STEP_RPORT(Y) = f.y;
+    if (!SAME_STEP_PORT(Z,X) && !SAME_STEP_PORT(Z,Y)) STEP_RPORT(Z) = f.z;
+    #if NUM_Z_STEPPERS > 1
+      if (!SAME_STEP_PORT(Z2,X) && !SAME_STEP_PORT(Z2,Y) && !SAME_STEP_PORT(Z2,Z)) STEP_RPORT(Z2) = f.z2;
+    #endif
+    #if HAS_E0_STEP
+      if (!SAME_STEP_PORT(E0,X) && !SAME_STEP_PORT(E0,Y) && !SAME_STEP_PORT(E0,Z) && !Z2_STEP_PORT(E0)) STEP_RPORT(E0) = f.e;
+    #endif
+  }
+
+  #define FUSED_STEP_ADD(S) add_fused_step(fused_steps, STEP_RPORT(S), STEP_MASK(S))
+
+  #if NUM_Z_STEPPERS > 1
+    // Z steppers that may step now, honoring Z endstops and locks
+    #if ENABLED(Z_MULTI_ENDSTOPS)
+      #define Z_FUSED_STEP(I) (!separate_multi_axis || (ENABLED(Z_HOME_TO_MIN) ? STEPTEST(Z,MIN,I) : TERN0(Z_HOME_TO_MAX, STEPTEST(Z,MAX,I))))
+    #elif ENABLED(Z_STEPPER_AUTO_ALIGN)
+      #define Z_FUSED_STEP(I) (!separate_multi_axis || !locked_Z##I##_motor)
+    #else
+      #define Z_FUSED_STEP(I) true
+    #endif
+  #endif
+
+#endif // FUSED_STEP_PORTS
+
 #define CYCLES_TO_NS(CYC) (1000UL * (CYC) / ((F_CPU) / 1000000))
 #define NS_PER_PULSE_TIMER_TICK (1000000000UL / (STEPPER_TIMER_RATE))
 
@@ -478,6 +594,9 @@ xyze_int8_t Stepper::count_direction{0};
 
 #define PULSE_HIGH_TICK_COUNT hal_timer_t(NS_TO_PULSE_TIMER_TICKS(_MIN_PULSE_HIGH_NS - _MIN(_MIN_PULSE_HIGH_NS, TIMER_SETUP_NS)))
 #define PULSE_LOW_TICK_COUNT hal_timer_t(NS_TO_PULSE_TIMER_TICKS(_MIN_PULSE_LOW_NS - _MIN(_MIN_PULSE_LOW_NS, TIMER_SETUP_NS)))
+#if HAS_DEDGE_STEPPING
+  #define PULSE_DEDGE_TICK_COUNT hal_timer_t(NS_TO_PULSE_TIMER_TICKS(_MIN_PULSE_DEDGE_NS - _MIN(_MIN_PULSE_DEDGE_NS, TIMER_SETUP_NS)))
+#endif
 
 #define USING_TIMED_PULSE() hal_timer_t start_pulse_count = 0
 #define START_TIMED_PULSE() (start_pulse_count = HAL_timer_get_count(MF_TIMER_PULSE))
@@ -1462,6 +1581,9 @@ HAL_STEP_TIMER_ISR() {
 
 void Stepper::isr() {
 
+  TERN_(ISR_PROFILER, const ISRProfile profile_isr(PROFILE_STEPPER_ISR));
+  TERN_(STACK_MONITOR, const StackMonitorISR stack_isr);
+
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
 
   #ifndef __AVR__
@@ -1489,10 +1611,14 @@ void Stepper::isr() {
 
     TERN_(HAS_ZV_SHAPING, shaping_isr());               // Do Shaper stepping, if needed
 
-    if (!nextMainISR) pulse_phase_isr();                // 0 = Do coordinated axes Stepper pulses
+    if (!nextMainISR) {                                 // 0 = Do coordinated axes Stepper pulses
+      TERN_(ISR_PROFILER, const ISRProfile profile(PROFILE_PULSE_PHASE));
+      pulse_phase_isr();
+    }
 
     #if ENABLED(LIN_ADVANCE)
       if (!nextAdvanceISR) {                            // 0 = Do Linear Advance E Stepper pulses
+        TERN_(ISR_PROFILER, const ISRProfile profile(PROFILE_ADVANCE));
         advance_isr();
         nextAdvanceISR = la_interval;
       }
@@ -1502,12 +1628,18 @@ void Stepper::isr() {
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       const bool is_babystep = (nextBabystepISR == 0);  // 0 = Do Babystepping (XY)Z pulses
-      if (is_babystep) nextBabystepISR = babystepping_isr();
+      if (is_babystep) {
+        TERN_(ISR_PROFILER, const ISRProfile profile(PROFILE_BABYSTEP));
+        nextBabystepISR = babystepping_isr();
+      }
     #endif
 
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-    if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    if (!nextMainISR) {                                 // Manage acc/deceleration, get next block
+      TERN_(ISR_PROFILER, const ISRProfile profile(PROFILE_BLOCK_PHASE));
+      nextMainISR = block_phase_isr();
+    }
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
@@ -1597,6 +1729,12 @@ void Stepper::isr() {
   // Now 'next_isr_ticks' contains the period to the next Stepper ISR - And we are
   // sure that the time has not arrived yet - Warrantied by the scheduler
 
+  #if ENABLED(ADAPTIVE_MULTISTEPPING)
+    // The timer restarts at each compare match, so its count is the time spent in this ISR
+    multistep_busy_ticks += HAL_timer_get_count(MF_TIMER_STEP);
+    multistep_period_ticks += next_isr_ticks;
+  #endif
+
   // Set the next ISR to fire at the proper time
   HAL_timer_set_compare(MF_TIMER_STEP, hal_timer_t(next_isr_ticks));
 
@@ -1652,6 +1790,8 @@ void Stepper::pulse_phase_isr() {
   const uint32_t pending_events = step_event_count - step_events_completed;
   uint8_t events_to_do = _MIN(pending_events, steps_per_isr);
 
+  TERN_(ADAPTIVE_MULTISTEPPING, multistep_events[multistep_idx] += events_to_do);
+
   // Just update the value we will get at the end of the loop
   step_events_completed += events_to_do;
 
@@ -1776,7 +1916,7 @@ void Stepper::pulse_phase_isr() {
 
           page_step_state.segment_steps++;
 
-        #elif STEPPER_PAGE_FORMAT == SP_4x2_256
+        #elif IS_SP_4x2
 
           #define PAGE_SEGMENT_UPDATE(AXIS, VALUE) \
             page_step_state.sd[_AXIS(AXIS)] = VALUE; \
@@ -1900,10 +2040,35 @@ void Stepper::pulse_phase_isr() {
       if (firstStep)
         firstStep = false;
       else
-        AWAIT_LOW_PULSE();
+        #if HAS_DEDGE_STEPPING
+          AWAIT_TIMED_PULSE(DEDGE);
+        #else
+          AWAIT_LOW_PULSE();
+        #endif
     #endif
 
     // Pulse start
+    #if ENABLED(FUSED_STEP_PORTS)
+
+      fused_steps_t fused_steps{0};
+      if (step_needed.x) { count_position.x += count_direction.x; FUSED_STEP_ADD(X); }
+      if (step_needed.y) { count_position.y += count_direction.y; FUSED_STEP_ADD(Y); }
+      if (step_needed.z) {
+        count_position.z += count_direction.z;
+        #if NUM_Z_STEPPERS > 1
+          if (Z_FUSED_STEP( )) FUSED_STEP_ADD(Z);
+          if (Z_FUSED_STEP(2)) FUSED_STEP_ADD(Z2);
+        #else
+          FUSED_STEP_ADD(Z);
+        #endif
+      }
+      #if HAS_E0_STEP
+        if (step_needed.e) { count_position.e += count_direction.e; FUSED_STEP_ADD(E0); }
+      #endif
+      toggle_fused_steps(fused_steps);
+
+    #else // !FUSED_STEP_PORTS
+
     #if HAS_X_STEP
       PULSE_START(X);
     #endif
@@ -1941,15 +2106,27 @@ void Stepper::pulse_phase_isr() {
       PULSE_START(E);
     #endif
 
+    #endif // !FUSED_STEP_PORTS
+
     TERN_(I2S_STEPPER_STREAM, i2s_push_sample());
 
     // TODO: need to deal with MINIMUM_STEPPER_PULSE over i2s
-    #if ISR_MULTI_STEPS
+    #if ISR_MULTI_STEPS && HAS_DEDGE_STEPPING
+      START_TIMED_PULSE();  // The toggle was the whole step, so only wait before the next
+    #elif ISR_MULTI_STEPS
       START_TIMED_PULSE();
       AWAIT_HIGH_PULSE();
     #endif
 
     // Pulse stop
+    #if ENABLED(FUSED_STEP_PORTS)
+
+      #if DISABLED(SQUARE_WAVE_STEPPING)
+        toggle_fused_steps(fused_steps);
+      #endif
+
+    #else // !FUSED_STEP_PORTS
+
     #if HAS_X_STEP
       PULSE_STOP(X);
     #endif
@@ -1984,7 +2161,9 @@ void Stepper::pulse_phase_isr() {
       PULSE_STOP(E);
     #endif
 
-    #if ISR_MULTI_STEPS
+    #endif // !FUSED_STEP_PORTS
+
+    #if ISR_MULTI_STEPS && !HAS_DEDGE_STEPPING
       if (events_to_do) START_TIMED_PULSE();
     #endif
 
@@ -2076,30 +2255,50 @@ uint32_t Stepper::calc_timer_interval(uint32_t step_rate) {
   #endif
 }
 
+#if DISABLED(DISABLE_MULTI_STEPPING)
+  // The stepping frequency limits for each multistepping rate
+  static const uint32_t multistep_rate_limit[] PROGMEM = {
+    (  MAX_STEP_ISR_FREQUENCY_1X     ),
+    (  MAX_STEP_ISR_FREQUENCY_2X >> 1),
+    (  MAX_STEP_ISR_FREQUENCY_4X >> 2),
+    (  MAX_STEP_ISR_FREQUENCY_8X >> 3),
+    ( MAX_STEP_ISR_FREQUENCY_16X >> 4),
+    ( MAX_STEP_ISR_FREQUENCY_32X >> 5),
+    ( MAX_STEP_ISR_FREQUENCY_64X >> 6),
+    (MAX_STEP_ISR_FREQUENCY_128X >> 7)
+  };
+#endif
+
 // Get the timer interval and the number of loops to perform per tick
 uint32_t Stepper::calc_timer_interval(uint32_t step_rate, uint8_t &loops) {
   uint8_t multistep = 1;
   #if DISABLED(DISABLE_MULTI_STEPPING)
 
-    // The stepping frequency limits for each multistepping rate
-    static const uint32_t limit[] PROGMEM = {
-      (  MAX_STEP_ISR_FREQUENCY_1X     ),
-      (  MAX_STEP_ISR_FREQUENCY_2X >> 1),
-      (  MAX_STEP_ISR_FREQUENCY_4X >> 2),
-      (  MAX_STEP_ISR_FREQUENCY_8X >> 3),
-      ( MAX_STEP_ISR_FREQUENCY_16X >> 4),
-      ( MAX_STEP_ISR_FREQUENCY_32X >> 5),
-      ( MAX_STEP_ISR_FREQUENCY_64X >> 6),
-      (MAX_STEP_ISR_FREQUENCY_128X >> 7)
-    };
+    #if ENABLED(ADAPTIVE_MULTISTEPPING)
+      #define MULTISTEP_LIMIT(I) multistep_limit[I]
+    #else
+      #define MULTISTEP_LIMIT(I) (uint32_t)pgm_read_dword(&multistep_rate_limit[I])
+    #endif
 
     // Select the proper multistepping
     uint8_t idx = 0;
-    while (idx < 7 && step_rate > (uint32_t)pgm_read_dword(&limit[idx])) {
+    while (idx < 7 && step_rate > MULTISTEP_LIMIT(idx)) {
       step_rate >>= 1;
       multistep <<= 1;
       ++idx;
     };
+
+    #if ENABLED(ADAPTIVE_MULTISTEPPING)
+      // Keep a higher factor until the rate is 1/8 below the limit, to avoid toggling on every step
+      while (multistep < loops && step_rate > MULTISTEP_LIMIT(idx) - (MULTISTEP_LIMIT(idx) >> 3)) {
+        step_rate >>= 1;
+        multistep <<= 1;
+        ++idx;
+      }
+      multistep_idx = idx;
+      if (idx) multistep_used = true;
+    #endif
+
   #else
     NOMORE(step_rate, uint32_t(MAX_STEP_ISR_FREQUENCY_1X));
   #endif
@@ -2108,6 +2307,61 @@ uint32_t Stepper::calc_timer_interval(uint32_t step_rate, uint8_t &loops) {
   return calc_timer_interval(step_rate);
 }
 
+#if ENABLED(ADAPTIVE_MULTISTEPPING)
+
+  /**
+   * Scale the estimated multistepping limits by the ISR load measured over the
+   * previous block. Lower the limits if the Stepper ISR took more than 3/4 of the
+   * time. Raise them if the block had to multistep with less than 1/2 of the time
+   * taken. The gap between the two thresholds keeps the limits stable.
+   */
+  void Stepper::update_multistep_limits() {
+    const uint16_t old_scale = multistep_scale;
+    if (multistep_period_ticks >= (STEPPER_TIMER_RATE) / 100) { // Only judge blocks of 10ms or more
+      if (multistep_busy_ticks > multistep_period_ticks - (multistep_period_ticks >> 2)) {
+        multistep_scale -= multistep_scale >> 4;
+        NOLESS(multistep_scale, 128U);
+      }
+      else if (multistep_used && multistep_busy_ticks < (multistep_period_ticks >> 1)) {
+        multistep_scale += multistep_scale >> 4;
+        NOMORE(multistep_scale, 512U);
+      }
+    }
+    multistep_busy_ticks = multistep_period_ticks = 0;
+    multistep_used = false;
+
+    if (multistep_scale != old_scale || !multistep_limit[0])
+      for (uint8_t i = 0; i < COUNT(multistep_limit); ++i)
+        multistep_limit[i] = (uint64_t(pgm_read_dword(&multistep_rate_limit[i])) * multistep_scale) >> 8;
+  }
+
+  void Stepper::reset_multistepping() {
+    const bool was_on = hal.isr_state();
+    hal.isr_off();
+    for (uint8_t i = 0; i < COUNT(multistep_events); ++i) multistep_events[i] = 0;
+    multistep_scale = 256;
+    multistep_limit[0] = 0;     // Recalculate the limits on the next block
+    update_multistep_limits();
+    if (was_on) hal.isr_on();
+  }
+
+  void Stepper::report_multistepping() {
+    const bool was_on = hal.isr_state();
+    hal.isr_off();
+    const uint16_t scale = multistep_scale;
+    const uint32_t limit1x = multistep_limit[0];
+    uint32_t events[COUNT(multistep_events)];
+    for (uint8_t i = 0; i < COUNT(events); ++i) events[i] = multistep_events[i];
+    if (was_on) hal.isr_on();
+
+    SERIAL_ECHOLNPGM("Multistepping limits:", uint16_t((uint32_t(scale) * 100) >> 8), "% 1x limit:", limit1x, "Hz");
+    SERIAL_ECHOPGM("Step events");
+    for (uint8_t i = 0; i < COUNT(events); ++i) SERIAL_ECHOPGM(" ", 1 << i, "x:", events[i]);
+    SERIAL_EOL();
+  }
+
+#endif // ADAPTIVE_MULTISTEPPING
+
 // This is the last half of the stepper interrupt: This one processes and
 // properly schedules blocks from the planner. This is executed after creating
 // the step pulses, so it is not time critical, as pulses are already done.
@@ -2126,7 +2380,7 @@ uint32_t Stepper::block_phase_isr() {
         #if STEPPER_PAGE_FORMAT == SP_4x4D_128
           #define PAGE_SEGMENT_UPDATE_POS(AXIS) \
             count_position[_AXIS(AXIS)] += page_step_state.bd[_AXIS(AXIS)] - 128 * 7;
-        #elif STEPPER_PAGE_FORMAT == SP_4x1_512 || STEPPER_PAGE_FORMAT == SP_4x2_256
+        #elif STEPPER_PAGE_FORMAT == SP_4x1_512 || IS_SP_4x2
           #define PAGE_SEGMENT_UPDATE_POS(AXIS) \
             count_position[_AXIS(AXIS)] += page_step_state.bd[_AXIS(AXIS)] * count_direction[_AXIS(AXIS)];
         #endif
@@ -2138,7 +2392,9 @@ uint32_t Stepper::block_phase_isr() {
           PAGE_SEGMENT_UPDATE_POS(E);
         }
       #endif
-      TERN_(HAS_FILAMENT_RUNOUT_DISTANCE, runout.block_completed(current_block));
+      #if HAS_FILAMENT_RUNOUT_DISTANCE && DISABLED(FILAMENT_RUNOUT_STEP_TRACKING)
+        runout.block_completed(current_block);
+      #endif
       discard_current_block();
     }
     else {
@@ -2147,7 +2403,18 @@ uint32_t Stepper::block_phase_isr() {
       // Are we in acceleration phase ?
       if (step_events_completed <= accelerate_until) { // Calculate new timer value
 
-        #if ENABLED(S_CURVE_ACCELERATION)
+        #if ENABLED(STEP_RATE_TABLE)
+          // Step through the planner's table of rates, only getting a new interval for a new slice
+          const bool use_table = current_block->accel_slice_time;
+          if (use_table && next_rate_slice(acceleration_time, current_block->accel_slice_time)) {
+            slice_rate = rate_slice <= STEP_RATE_TABLE_SIZE ? current_block->accel_rates[rate_slice - 1] : current_block->cruise_rate;
+            slice_interval = calc_timer_interval(slice_rate << oversampling_factor, steps_per_isr);
+          }
+          const uint32_t acc_step_rate = use_table ? slice_rate
+                                       : acceleration_time < current_block->acceleration_time
+                                         ? _eval_bezier_curve(acceleration_time)
+                                         : current_block->cruise_rate;
+        #elif ENABLED(S_CURVE_ACCELERATION)
           // Get the next speed to use (Jerk limited!)
           uint32_t acc_step_rate = acceleration_time < current_block->acceleration_time
                                    ? _eval_bezier_curve(acceleration_time)
@@ -2160,13 +2427,19 @@ uint32_t Stepper::block_phase_isr() {
         // acc_step_rate is in steps/second
 
         // step_rate to timer interval and steps per stepper isr
-        interval = calc_timer_interval(acc_step_rate << oversampling_factor, steps_per_isr);
+        interval = TERN0(STEP_RATE_TABLE, use_table) ? TERN0(STEP_RATE_TABLE, slice_interval)
+                 : calc_timer_interval(acc_step_rate << oversampling_factor, steps_per_isr);
         acceleration_time += interval;
 
         #if ENABLED(LIN_ADVANCE)
           if (current_block->la_advance_rate) {
-            const uint32_t la_step_rate = la_advance_steps < current_block->max_adv_steps ? current_block->la_advance_rate : 0;
-            la_interval = calc_timer_interval(acc_step_rate + la_step_rate) << current_block->la_scaling;
+            const uint32_t la_step_rate = la_advance_steps < current_block->max_adv_steps ? current_block->la_advance_rate : 0,
+                           rate = acc_step_rate + la_step_rate;
+            // Only a new rate slice or reaching the advance steps changes the interval
+            if (rate != la_rate) {
+              la_rate = rate;
+              la_interval = calc_timer_interval(rate) << current_block->la_scaling;
+            }
           }
         #endif
 
@@ -2200,8 +2473,27 @@ uint32_t Stepper::block_phase_isr() {
       else if (step_events_completed > decelerate_after) {
         uint32_t step_rate;
 
+        #if ENABLED(STEP_RATE_TABLE)
+          const bool use_table = current_block->decel_slice_time;
+        #endif
+
         #if ENABLED(S_CURVE_ACCELERATION)
 
+          #if ENABLED(STEP_RATE_TABLE)
+            if (use_table) {
+              // Start the deceleration ramp of the table
+              if (!bezier_2nd_half) {
+                reset_rate_slice();
+                bezier_2nd_half = true;
+              }
+              if (next_rate_slice(deceleration_time, current_block->decel_slice_time)) {
+                slice_rate = rate_slice <= STEP_RATE_TABLE_SIZE ? current_block->decel_rates[rate_slice - 1] : current_block->final_rate;
+                slice_interval = calc_timer_interval(slice_rate << oversampling_factor, steps_per_isr);
+              }
+              step_rate = slice_rate;
+            }
+            else
+          #endif
           // If this is the 1st time we process the 2nd half of the trapezoid...
           if (!bezier_2nd_half) {
             // Initialize the Bézier speed curve
@@ -2230,42 +2522,47 @@ uint32_t Stepper::block_phase_isr() {
         #endif
 
         // step_rate to timer interval and steps per stepper isr
-        interval = calc_timer_interval(step_rate << oversampling_factor, steps_per_isr);
+        interval = TERN0(STEP_RATE_TABLE, use_table) ? TERN0(STEP_RATE_TABLE, slice_interval)
+                 : calc_timer_interval(step_rate << oversampling_factor, steps_per_isr);
         deceleration_time += interval;
 
         #if ENABLED(LIN_ADVANCE)
           if (current_block->la_advance_rate) {
-            const uint32_t la_step_rate = la_advance_steps > current_block->final_adv_steps ? current_block->la_advance_rate : 0;
-            if (la_step_rate != step_rate) {
-              bool reverse_e = la_step_rate > step_rate;
-              la_interval = calc_timer_interval(reverse_e ? la_step_rate - step_rate : step_rate - la_step_rate) << current_block->la_scaling;
-
-              if (reverse_e != motor_direction(E_AXIS)) {
-                TBI(last_direction_bits, E_AXIS);
-                count_direction.e = -count_direction.e;
-
-                DIR_WAIT_BEFORE();
-
-                if (reverse_e) {
-                  #if ENABLED(MIXING_EXTRUDER)
-                    MIXER_STEPPER_LOOP(j) REV_E_DIR(j);
-                  #else
-                    REV_E_DIR(stepper_extruder);
-                  #endif
-                }
-                else {
-                  #if ENABLED(MIXING_EXTRUDER)
-                    MIXER_STEPPER_LOOP(j) NORM_E_DIR(j);
-                  #else
-                    NORM_E_DIR(stepper_extruder);
-                  #endif
+            const uint32_t la_step_rate = la_advance_steps > current_block->final_adv_steps ? current_block->la_advance_rate : 0,
+                           rate = step_rate - la_step_rate; // Wraps around when E reverses, never matching an acceleration rate
+            if (rate != la_rate) {
+              la_rate = rate;
+              if (la_step_rate != step_rate) {
+                bool reverse_e = la_step_rate > step_rate;
+                la_interval = calc_timer_interval(reverse_e ? la_step_rate - step_rate : step_rate - la_step_rate) << current_block->la_scaling;
+
+                if (reverse_e != motor_direction(E_AXIS)) {
+                  TBI(last_direction_bits, E_AXIS);
+                  count_direction.e = -count_direction.e;
+
+                  DIR_WAIT_BEFORE();
+
+                  if (reverse_e) {
+                    #if ENABLED(MIXING_EXTRUDER)
+                      MIXER_STEPPER_LOOP(j) REV_E_DIR(j);
+                    #else
+                      REV_E_DIR(stepper_extruder);
+                    #endif
+                  }
+                  else {
+                    #if ENABLED(MIXING_EXTRUDER)
+                      MIXER_STEPPER_LOOP(j) NORM_E_DIR(j);
+                    #else
+                      NORM_E_DIR(stepper_extruder);
+                    #endif
+                  }
+
+                  DIR_WAIT_AFTER();
                 }
-
-                DIR_WAIT_AFTER();
               }
+              else
+                la_interval = LA_ADV_NEVER;
             }
-            else
-              la_interval = LA_ADV_NEVER;
           }
         #endif // LIN_ADVANCE
 
@@ -2296,7 +2593,7 @@ uint32_t Stepper::block_phase_isr() {
 
           #if ENABLED(LIN_ADVANCE)
             if (current_block->la_advance_rate)
-              la_interval = calc_timer_interval(current_block->nominal_rate) << current_block->la_scaling;
+              la_interval = calc_timer_interval(la_rate = current_block->nominal_rate) << current_block->la_scaling;
           #endif
         }
 
@@ -2348,8 +2645,8 @@ uint32_t Stepper::block_phase_isr() {
   }
 
   // If there is no current block at this point, attempt to pop one from the buffer
-  // and prepare its movement
-  if (!current_block) {
+  // and prepare its movement. The planner benchmark takes the blocks itself.
+  if (!current_block && TERN1(PLANNER_BENCHMARK, !PlannerBenchmark::active) && TERN1(LINK_BENCHMARK, !LinkBenchmark::active) && TERN1(VIRTUAL_STEPPING, !VirtualStepper::active)) {
 
     // Anything in the buffer?
     if ((current_block = planner.get_current_block())) {
@@ -2377,6 +2674,8 @@ uint32_t Stepper::block_phase_isr() {
           return interval; // No more queued movements!
       }
 
+      TERN_(FAN_SPEED_AT_BLOCK_START, planner.apply_fan_speeds(current_block->fan_speed));
+
       // For non-inline cutter, grossly apply power
       #if HAS_CUTTER
         if (cutter.cutter_mode == CUTTER_MODE_STANDARD) {
@@ -2493,6 +2792,9 @@ uint32_t Stepper::block_phase_isr() {
       // No acceleration / deceleration time elapsed so far
       acceleration_time = deceleration_time = 0;
 
+      // Adapt the multistepping limits to the ISR load of the last block
+      TERN_(ADAPTIVE_MULTISTEPPING, update_multistep_limits());
+
       #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
         oversampling_factor = 0;                            // Assume no axis smoothing (via oversampling)
         // Decide if axis smoothing is possible
@@ -2588,7 +2890,11 @@ uint32_t Stepper::block_phase_isr() {
       // If the endstop is already pressed, endstop interrupts won't invoke
       // endstop_triggered and the move will grind. So check here for a
       // triggered endstop, which marks the block for discard on the next ISR.
-      endstops.update();
+      #if ENDSTOP_NOISE_THRESHOLD
+        endstops.update();
+      #else
+        if (endstops.abort_enabled()) endstops.update();
+      #endif
 
       #if ENABLED(Z_LATE_ENABLE)
         // If delayed Z enable, enable it now. This option will severely interfere with
@@ -2601,8 +2907,12 @@ uint32_t Stepper::block_phase_isr() {
       ticks_nominal = -1;
 
       #if ENABLED(S_CURVE_ACCELERATION)
-        // Initialize the Bézier speed curve
-        _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse);
+        // Initialize the Bézier speed curve, unless the planner has a table of rates for it
+        #if ENABLED(STEP_RATE_TABLE)
+          reset_rate_slice();
+          if (!current_block->accel_slice_time)
+        #endif
+            _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse);
         // We haven't started the 2nd half of the trapezoid
         bezier_2nd_half = false;
       #else
@@ -2617,7 +2927,8 @@ uint32_t Stepper::block_phase_isr() {
       #if ENABLED(LIN_ADVANCE)
         if (current_block->la_advance_rate) {
           const uint32_t la_step_rate = la_advance_steps < current_block->max_adv_steps ? current_block->la_advance_rate : 0;
-          la_interval = calc_timer_interval(current_block->initial_rate + la_step_rate) << current_block->la_scaling;
+          la_rate = current_block->initial_rate + la_step_rate;
+          la_interval = calc_timer_interval(la_rate) << current_block->la_scaling;
         }
       #endif
     }
@@ -2714,6 +3025,9 @@ void Stepper::init() {
   // Init Microstepping Pins
   TERN_(HAS_MICROSTEPS, microstep_init());
 
+  // Fill the multistepping limits before the first block
+  TERN_(ADAPTIVE_MULTISTEPPING, update_multistep_limits());
+
   // Init Dir Pins
   TERN_(HAS_X_DIR, X_DIR_INIT());
   TERN_(HAS_X2_DIR, X2_DIR_INIT());
@@ -3101,6 +3415,8 @@ void Stepper::init() {
  * derive the current XYZE position later on.
  */
 void Stepper::_set_position(const abce_long_t &spos) {
+  TERN_(FILAMENT_RUNOUT_STEP_TRACKING, e_steps_offset += count_position.e - spos.e);
+
   #if ENABLED(INPUT_SHAPING_X)
     const int32_t x_shaping_delta = count_position.x - shaping_x.last_block_end_pos;
   #endif
@@ -3171,6 +3487,37 @@ int32_t Stepper::position(const AxisEnum axis) {
   return v;
 }
 
+/**
+ * Get all stepper positions in a single critical section (on AVR),
+ * so the axes come from the same step instead of one per call.
+ */
+xyze_long_t Stepper::positions() {
+  #ifdef __AVR__
+    const bool was_enabled = suspend();
+  #endif
+
+  const xyze_long_t v = count_position;
+
+  #ifdef __AVR__
+    if (was_enabled) wake_up();
+  #endif
+  return v;
+}
+
+#if ENABLED(FILAMENT_RUNOUT_STEP_TRACKING)
+
+  int32_t Stepper::e_steps_offset; // = 0
+
+  int32_t Stepper::e_steps_moved() {
+    // A sync block can set the position from the ISR, so read both together
+    const bool was_enabled = suspend();
+    const int32_t v = count_position.e + e_steps_offset;
+    if (was_enabled) wake_up();
+    return v;
+  }
+
+#endif
+
 // Set the current position in steps
 void Stepper::set_position(const xyze_long_t &spos) {
   planner.synchronize();
@@ -3188,6 +3535,7 @@ void Stepper::set_axis_position(const AxisEnum a, const int32_t &v) {
     const bool was_enabled = suspend();
   #endif
 
+  TERN_(FILAMENT_RUNOUT_STEP_TRACKING, if (a == E_AXIS) e_steps_offset += count_position.e - v);
   count_position[a] = v;
   TERN_(INPUT_SHAPING_X, if (a == X_AXIS) shaping_x.last_block_end_pos = v);
   TERN_(INPUT_SHAPING_Y, if (a == Y_AXIS) shaping_y.last_block_end_pos = v);
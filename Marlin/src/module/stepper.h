@@ -85,8 +85,10 @@
     #define ISR_LA_BASE_CYCLES 0UL
   #endif
 
-  // S curve interpolation adds 40 cycles
-  #if ENABLED(S_CURVE_ACCELERATION)
+  // S curve interpolation adds 40 cycles, or 10 to step through a table
+  #if ENABLED(STEP_RATE_TABLE)
+    #define ISR_S_CURVE_CYCLES 10UL
+  #elif ENABLED(S_CURVE_ACCELERATION)
     #ifdef STM32G0B1xx
       #define ISR_S_CURVE_CYCLES 500UL
     #else
@@ -123,8 +125,10 @@
     #define ISR_LA_BASE_CYCLES 0UL
   #endif
 
-  // S curve interpolation adds 160 cycles
-  #if ENABLED(S_CURVE_ACCELERATION)
+  // S curve interpolation adds 160 cycles, or 40 to step through a table
+  #if ENABLED(STEP_RATE_TABLE)
+    #define ISR_S_CURVE_CYCLES 40UL
+  #elif ENABLED(S_CURVE_ACCELERATION)
     #define ISR_S_CURVE_CYCLES 160UL
   #else
     #define ISR_S_CURVE_CYCLES 0UL
@@ -215,6 +219,22 @@
   #error "Expected at least one of MINIMUM_STEPPER_PULSE or MAXIMUM_STEPPER_RATE to be defined"
 #endif
 
+// With every stepper stepping on both edges each step is one toggle. The
+// pulse width and step period both apply to the time between toggles.
+#if ENABLED(SQUARE_WAVE_STEPPING) && !( \
+     HAS_DRIVER(A4988)   || HAS_DRIVER(A5984)  || HAS_DRIVER(DRV8825) || HAS_DRIVER(LV8729) \
+  || HAS_DRIVER(TB6560)  || HAS_DRIVER(TB6600) || HAS_DRIVER(TMC2100) || HAS_DRIVER(TMC26X) \
+  || HAS_TRINAMIC_STANDALONE )
+  #define HAS_DEDGE_STEPPING 1
+  #if MINIMUM_STEPPER_PULSE && MAXIMUM_STEPPER_RATE
+    constexpr uint32_t _MIN_PULSE_DEDGE_NS = _MAX(_MIN_STEP_PERIOD_NS, _MIN_PULSE_HIGH_NS);
+  #elif MINIMUM_STEPPER_PULSE
+    constexpr uint32_t _MIN_PULSE_DEDGE_NS = _MIN_PULSE_HIGH_NS;
+  #else
+    constexpr uint32_t _MIN_PULSE_DEDGE_NS = 1000000000UL / MAXIMUM_STEPPER_RATE;
+  #endif
+#endif
+
 // The loop takes the base time plus the time for all the bresenham logic for R pulses plus the time
 // between pulses for (R-1) pulses. But the user could be enforcing a minimum time so the loop time is:
 #define ISR_LOOP_CYCLES(R) ((ISR_LOOP_BASE_CYCLES + MIN_ISR_LOOP_CYCLES + MIN_STEPPER_PULSE_CYCLES) * (R - 1) + _MAX(MIN_ISR_LOOP_CYCLES, MIN_STEPPER_PULSE_CYCLES))
@@ -369,20 +389,41 @@ constexpr ena_mask_t enable_overlap[] = {
     #define SHAPING_MIN_FREQ _MIN(0x7FFFFFFFL OPTARG(INPUT_SHAPING_X, SHAPING_FREQ_X) OPTARG(INPUT_SHAPING_Y, SHAPING_FREQ_Y))
   #endif
   constexpr uint16_t shaping_min_freq = SHAPING_MIN_FREQ,
-                     shaping_echoes = max_step_rate / shaping_min_freq / 2 + 3;
+                     shaping_echoes =
+                       #ifdef SHAPING_QUEUE_DEPTH
+                         SHAPING_QUEUE_DEPTH
+                       #else
+                         max_step_rate / shaping_min_freq / 2 + 3
+                       #endif
+                     ;
 
   typedef IF<ENABLED(__AVR__), uint16_t, uint32_t>::type shaping_time_t;
   enum shaping_echo_t { ECHO_NONE = 0, ECHO_FWD = 1, ECHO_BWD = 2 };
-  struct shaping_echo_axis_t {
-    TERN_(INPUT_SHAPING_X, shaping_echo_t x:2);
-    TERN_(INPUT_SHAPING_Y, shaping_echo_t y:2);
-  };
+
+  #if ENABLED(SHAPING_COMPACT_QUEUE)
+    // Smallest shift so that 255 time units cover the longest delay at SHAPING_MIN_FREQ
+    constexpr uint8_t shaping_delta_shift(const uint32_t delay, const uint8_t shift=0) {
+      return (255UL << shift) >= delay ? shift : shaping_delta_shift(delay, shift + 1);
+    }
+    constexpr uint8_t shaping_time_shift = shaping_delta_shift(uint32_t(STEPPER_TIMER_RATE) / 2 / shaping_min_freq);
+  #else
+    struct shaping_echo_axis_t {
+      TERN_(INPUT_SHAPING_X, shaping_echo_t x:2);
+      TERN_(INPUT_SHAPING_Y, shaping_echo_t y:2);
+    };
+  #endif
 
   class ShapingQueue {
     private:
       static shaping_time_t       now;
-      static shaping_time_t       times[shaping_echoes];
-      static shaping_echo_axis_t  echo_axes[shaping_echoes];
+      #if ENABLED(SHAPING_COMPACT_QUEUE)
+        static uint8_t            deltas[shaping_echoes];             // Time since the previous entry, in units of (1 << shaping_time_shift) ticks
+        static uint8_t            echo_bits[(shaping_echoes + 1) / 2]; // Two entries per byte, X in bits 0-1 and Y in bits 2-3
+        static shaping_time_t     last_time;                          // Time of the newest entry
+      #else
+        static shaping_time_t       times[shaping_echoes];
+        static shaping_echo_axis_t  echo_axes[shaping_echoes];
+      #endif
       static uint16_t             tail;
 
       #if ENABLED(INPUT_SHAPING_X)
@@ -390,12 +431,29 @@ constexpr ena_mask_t enable_overlap[] = {
         static shaping_time_t peek_x_val;
         static uint16_t head_x;
         static uint16_t _free_count_x;
+        TERN_(SHAPING_COMPACT_QUEUE, static shaping_time_t head_x_time);
       #endif
       #if ENABLED(INPUT_SHAPING_Y)
         static shaping_time_t delay_y;    // = shaping_time_t(-1) to disable queueing
         static shaping_time_t peek_y_val;
         static uint16_t head_y;
         static uint16_t _free_count_y;
+        TERN_(SHAPING_COMPACT_QUEUE, static shaping_time_t head_y_time);
+      #endif
+
+      #if ENABLED(SHAPING_COMPACT_QUEUE)
+        static uint8_t echo_nibble(const uint16_t i) { return (i & 1) ? echo_bits[i >> 1] >> 4 : echo_bits[i >> 1] & 0x0F; }
+        static shaping_echo_t echo_x(const uint16_t i) { return shaping_echo_t(echo_nibble(i) & 0x03); }
+        static shaping_echo_t echo_y(const uint16_t i) { return shaping_echo_t(echo_nibble(i) >> 2); }
+        static void set_echoes(const uint16_t i, const shaping_echo_t x, const shaping_echo_t y) {
+          const uint8_t n = x | (y << 2);
+          uint8_t &b = echo_bits[i >> 1];
+          b = (i & 1) ? (b & 0x0F) | (n << 4) : (b & 0xF0) | n;
+        }
+        static shaping_time_t entry_delta(const uint16_t i) { return shaping_time_t(deltas[i]) << shaping_time_shift; }
+      #else
+        static shaping_echo_t echo_x(const uint16_t i) { return TERN(INPUT_SHAPING_X, echo_axes[i].x, ECHO_NONE); }
+        static shaping_echo_t echo_y(const uint16_t i) { return TERN(INPUT_SHAPING_Y, echo_axes[i].y, ECHO_NONE); }
       #endif
 
     public:
@@ -411,24 +469,45 @@ constexpr ena_mask_t enable_overlap[] = {
       static void enqueue(const bool x_step, const bool x_forward, const bool y_step, const bool y_forward) {
         TERN_(INPUT_SHAPING_X, if (head_x == tail && x_step) peek_x_val = delay_x);
         TERN_(INPUT_SHAPING_Y, if (head_y == tail && y_step) peek_y_val = delay_y);
-        times[tail] = now;
-        TERN_(INPUT_SHAPING_X, echo_axes[tail].x = x_step ? (x_forward ? ECHO_FWD : ECHO_BWD) : ECHO_NONE);
-        TERN_(INPUT_SHAPING_Y, echo_axes[tail].y = y_step ? (y_forward ? ECHO_FWD : ECHO_BWD) : ECHO_NONE);
+        const shaping_echo_t ex = x_step ? (x_forward ? ECHO_FWD : ECHO_BWD) : ECHO_NONE,
+                             ey = y_step ? (y_forward ? ECHO_FWD : ECHO_BWD) : ECHO_NONE;
+        #if ENABLED(SHAPING_COMPACT_QUEUE)
+          if (TERN1(INPUT_SHAPING_X, head_x == tail) && TERN1(INPUT_SHAPING_Y, head_y == tail)) {
+            // Nothing queued, so this entry needs no delta
+            last_time = now;
+            deltas[tail] = 0;
+          }
+          else {
+            // A longer gap than 255 units can only occur below SHAPING_MIN_FREQ. Echo such steps early.
+            const shaping_time_t gap = _MIN(shaping_time_t(now - last_time) >> shaping_time_shift, 255U);
+            deltas[tail] = gap;
+            last_time += gap << shaping_time_shift;
+          }
+          TERN_(INPUT_SHAPING_X, if (head_x == tail) head_x_time = last_time);
+          TERN_(INPUT_SHAPING_Y, if (head_y == tail) head_y_time = last_time);
+          set_echoes(tail, ex, ey);
+        #else
+          times[tail] = now;
+          TERN_(INPUT_SHAPING_X, echo_axes[tail].x = ex);
+          TERN_(INPUT_SHAPING_Y, echo_axes[tail].y = ey);
+        #endif
+        UNUSED(ex); UNUSED(ey);
         if (++tail == shaping_echoes) tail = 0;
         TERN_(INPUT_SHAPING_X, _free_count_x--);
         TERN_(INPUT_SHAPING_Y, _free_count_y--);
-        TERN_(INPUT_SHAPING_X, if (echo_axes[head_x].x == ECHO_NONE) dequeue_x());
-        TERN_(INPUT_SHAPING_Y, if (echo_axes[head_y].y == ECHO_NONE) dequeue_y());
+        TERN_(INPUT_SHAPING_X, if (echo_x(head_x) == ECHO_NONE) dequeue_x());
+        TERN_(INPUT_SHAPING_Y, if (echo_y(head_y) == ECHO_NONE) dequeue_y());
       }
       #if ENABLED(INPUT_SHAPING_X)
         static shaping_time_t peek_x() { return peek_x_val; }
         static bool dequeue_x() {
-          bool forward = echo_axes[head_x].x == ECHO_FWD;
+          bool forward = echo_x(head_x) == ECHO_FWD;
           do {
             _free_count_x++;
             if (++head_x == shaping_echoes) head_x = 0;
-          } while (head_x != tail && echo_axes[head_x].x == ECHO_NONE);
-          peek_x_val = head_x == tail ? shaping_time_t(-1) : times[head_x] + delay_x - now;
+            TERN_(SHAPING_COMPACT_QUEUE, if (head_x != tail) head_x_time += entry_delta(head_x));
+          } while (head_x != tail && echo_x(head_x) == ECHO_NONE);
+          peek_x_val = head_x == tail ? shaping_time_t(-1) : TERN(SHAPING_COMPACT_QUEUE, head_x_time, times[head_x]) + delay_x - now;
           return forward;
         }
         static bool empty_x() { return head_x == tail; }
@@ -437,12 +516,13 @@ constexpr ena_mask_t enable_overlap[] = {
       #if ENABLED(INPUT_SHAPING_Y)
         static shaping_time_t peek_y() { return peek_y_val; }
         static bool dequeue_y() {
-          bool forward = echo_axes[head_y].y == ECHO_FWD;
+          bool forward = echo_y(head_y) == ECHO_FWD;
           do {
             _free_count_y++;
             if (++head_y == shaping_echoes) head_y = 0;
-          } while (head_y != tail && echo_axes[head_y].y == ECHO_NONE);
-          peek_y_val = head_y == tail ? shaping_time_t(-1) : times[head_y] + delay_y - now;
+            TERN_(SHAPING_COMPACT_QUEUE, if (head_y != tail) head_y_time += entry_delta(head_y));
+          } while (head_y != tail && echo_y(head_y) == ECHO_NONE);
+          peek_y_val = head_y == tail ? shaping_time_t(-1) : TERN(SHAPING_COMPACT_QUEUE, head_y_time, times[head_y]) + delay_y - now;
           return forward;
         }
         static bool empty_y() { return head_y == tail; }
@@ -484,6 +564,10 @@ class Stepper {
       static bool separate_multi_axis;
     #endif
 
+    #if ENABLED(PARALLEL_XY_HOMING)
+      static bool separate_xy_axes;         // Homing X and Y together, each stopping at its own endstop
+    #endif
+
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
       #if HAS_MOTOR_CURRENT_PWM
         #ifndef PWM_MOTOR_CURRENT
@@ -541,6 +625,17 @@ class Stepper {
     static uint32_t acceleration_time, deceleration_time; // time measured in Stepper Timer ticks
     static uint8_t steps_per_isr;         // Count of steps to perform per Stepper ISR call
 
+    #if ENABLED(ADAPTIVE_MULTISTEPPING)
+      static uint8_t multistep_idx;               // log2(steps_per_isr)
+      static bool multistep_used;                 // Multistepping was needed during the current block
+      static uint16_t multistep_scale;            // Measured adjustment of the rate limits (256 = 1.0)
+      static uint32_t multistep_limit[8],         // Step rate limits for each multistepping factor
+                      multistep_busy_ticks,       // Time spent in the Stepper ISR during the current block
+                      multistep_period_ticks,     // Elapsed Stepper ISR time during the current block
+                      multistep_events[8];        // Step events done with each multistepping factor
+      static void update_multistep_limits();
+    #endif
+
     #if ENABLED(ADAPTIVE_STEP_SMOOTHING)
       static uint8_t oversampling_factor; // Oversampling factor (log2(multiplier)) to increase temporal resolution of axis
     #else
@@ -572,6 +667,12 @@ class Stepper {
         static bool A_negative;    // If A coefficient was negative
       #endif
       static bool bezier_2nd_half; // If Bézier curve has been initialized or not
+      #if ENABLED(STEP_RATE_TABLE)
+        static uint8_t rate_slice;          // Number of table slices entered in the current ramp
+        static uint32_t next_slice_time,    // Ramp time at which the next slice starts
+                        slice_rate,         // Step rate of the current slice
+                        slice_interval;     // Timer interval for the current slice
+      #endif
     #endif
 
     #if HAS_ZV_SHAPING
@@ -586,7 +687,8 @@ class Stepper {
     #if ENABLED(LIN_ADVANCE)
       static constexpr uint32_t LA_ADV_NEVER = 0xFFFFFFFF;
       static uint32_t nextAdvanceISR,
-                      la_interval;      // Interval between ISR calls for LA
+                      la_interval,      // Interval between ISR calls for LA
+                      la_rate;          // Rate la_interval was computed from, to skip repeating it
       static int32_t  la_delta_error,   // Analogue of delta_error.e for E steps in LA ISR
                       la_dividend,      // Analogue of advance_dividend.e for E steps in LA ISR
                       la_advance_steps; // Count of steps added to increase nozzle pressure
@@ -682,6 +784,14 @@ class Stepper {
     // Get the position of a stepper, in steps
     static int32_t position(const AxisEnum axis);
 
+    // Get the positions of all steppers at the same instant, in steps
+    static xyze_long_t positions();
+
+    #if ENABLED(FILAMENT_RUNOUT_STEP_TRACKING)
+      // E steps taken since startup, not changed by G92
+      static int32_t e_steps_moved();
+    #endif
+
     // Set the current position in steps
     static void set_position(const xyze_long_t &spos);
     static void set_axis_position(const AxisEnum a, const int32_t &v);
@@ -690,6 +800,11 @@ class Stepper {
     static void report_a_position(const xyz_long_t &pos);
     static void report_positions();
 
+    #if ENABLED(ADAPTIVE_MULTISTEPPING)
+      static void report_multistepping();
+      static void reset_multistepping();
+    #endif
+
     // Discard current block and free any resources
     FORCE_INLINE static void discard_current_block() {
       #if ENABLED(DIRECT_STEPPING)
@@ -730,6 +845,9 @@ class Stepper {
     #if ANY(HAS_EXTRA_ENDSTOPS, Z_STEPPER_AUTO_ALIGN)
       FORCE_INLINE static void set_separate_multi_axis(const bool state) { separate_multi_axis = state; }
     #endif
+    #if ENABLED(PARALLEL_XY_HOMING)
+      FORCE_INLINE static void set_separate_xy_axes(const bool state) { separate_xy_axes = state; }
+    #endif
     #if ENABLED(X_DUAL_ENDSTOPS)
       FORCE_INLINE static void set_x_lock(const bool state) { locked_X_motor = state; }
       FORCE_INLINE static void set_x2_lock(const bool state) { locked_X2_motor = state; }
@@ -825,6 +943,10 @@ class Stepper {
     // Set the current position in steps
     static void _set_position(const abce_long_t &spos);
 
+    #if ENABLED(FILAMENT_RUNOUT_STEP_TRACKING)
+      static int32_t e_steps_offset;      // Keeps e_steps_moved() steady when E is set
+    #endif
+
     // Calculate timing interval for the given step rate
     static uint32_t calc_timer_interval(uint32_t step_rate);
     static uint32_t calc_timer_interval(uint32_t step_rate, uint8_t &loops);
@@ -832,6 +954,15 @@ class Stepper {
     #if ENABLED(S_CURVE_ACCELERATION)
       static void _calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av);
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
+      #if ENABLED(STEP_RATE_TABLE)
+        // Enter the table slice that holds the given ramp time. Return true if the slice changed.
+        FORCE_INLINE static bool next_rate_slice(const uint32_t ramp_time, const uint32_t slice_time) {
+          if (ramp_time < next_slice_time || rate_slice > STEP_RATE_TABLE_SIZE) return false;
+          do { ++rate_slice; next_slice_time += slice_time; } while (ramp_time >= next_slice_time && rate_slice <= STEP_RATE_TABLE_SIZE);
+          return true;
+        }
+        FORCE_INLINE static void reset_rate_slice() { rate_slice = 0; next_slice_time = 0; }
+      #endif
     #endif
 
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
@@ -35,6 +35,10 @@
 #include <HardwareSerial.h>
 #include <SPI.h>
 
+#if ENABLED(TMC_TIMER_SERIAL)
+  #include "../../HAL/AVR/TimerSerial.h"
+#endif
+
 enum StealthIndex : uint8_t {
   LOGICAL_AXIS_LIST(STEALTH_AXIS_E, STEALTH_AXIS_X, STEALTH_AXIS_Y, STEALTH_AXIS_Z, STEALTH_AXIS_I, STEALTH_AXIS_J, STEALTH_AXIS_K, STEALTH_AXIS_U, STEALTH_AXIS_V, STEALTH_AXIS_W)
 };
@@ -146,7 +150,12 @@ enum StealthIndex : uint8_t {
   // failing to read status properly. 32-bit platforms typically define an even lower
   // TMC_BAUD_RATE, due to differences in how SoftwareSerial libraries work on different
   // platforms.
-  #define TMC_BAUD_RATE TERN(HAS_TMC_SW_SERIAL, 57600, 115200)
+  // The timer-driven serial samples at 3x the bit rate, so it runs slower still.
+  #if ENABLED(TMC_TIMER_SERIAL)
+    #define TMC_BAUD_RATE 19200
+  #else
+    #define TMC_BAUD_RATE TERN(HAS_TMC_SW_SERIAL, 57600, 115200)
+  #endif
 #endif
 
 #ifndef TMC_X_BAUD_RATE
@@ -153,7 +153,7 @@
   #endif
 #endif
 
-#if ENABLED(MPCTEMP)
+#if ENABLED(MPC_AUTOTUNE)
   #include <math.h>
   #include "probe.h"
 #endif
@@ -182,6 +182,10 @@
   #include "../feature/leds/printer_event_leds.h"
 #endif
 
+#if ENABLED(TEMP_HISTORY)
+  #include "../feature/temp_history.h"
+#endif
+
 #if ENABLED(JOYSTICK)
   #include "../feature/joystick.h"
 #endif
@@ -198,16 +202,35 @@
   #include "servo.h"
 #endif
 
+#if ENABLED(ISR_PROFILER)
+  #include "../feature/isr_profiler.h"
+#endif
+
+#if ENABLED(STACK_MONITOR)
+  #include "../feature/stack_monitor.h"
+#endif
+
+#if ENABLED(THERMISTOR_DIRECT_TABLES)
+  #include "thermistor/direct_table.h"
+#endif
+
 #if ANY(TEMP_SENSOR_0_IS_THERMISTOR, TEMP_SENSOR_1_IS_THERMISTOR, TEMP_SENSOR_2_IS_THERMISTOR, TEMP_SENSOR_3_IS_THERMISTOR, \
         TEMP_SENSOR_4_IS_THERMISTOR, TEMP_SENSOR_5_IS_THERMISTOR, TEMP_SENSOR_6_IS_THERMISTOR, TEMP_SENSOR_7_IS_THERMISTOR )
   #define HAS_HOTEND_THERMISTOR 1
 #endif
 
 #if HAS_HOTEND_THERMISTOR
-  #define NEXT_TEMPTABLE(N) ,TEMPTABLE_##N
-  #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
-  static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
-  static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
+  #if ENABLED(THERMISTOR_DIRECT_TABLES)
+    // Custom thermistors are converted with their user parameters instead
+    #define _DIRECT_TEMPTABLE(N) TERN(TEMP_SENSOR_##N##_IS_CUSTOM, nullptr, TERN(TEMP_SENSOR_##N##_IS_THERMISTOR, &DIRECT_TEMPTABLE(TEMPTABLE_##N), nullptr))
+    #define NEXT_DIRECT_TEMPTABLE(N) ,_DIRECT_TEMPTABLE(N)
+    static constexpr const direct_temptable_t* heater_dtbl_map[HOTENDS] = ARRAY_BY_HOTENDS(_DIRECT_TEMPTABLE(0) REPEAT_S(1, HOTENDS, NEXT_DIRECT_TEMPTABLE));
+  #else
+    #define NEXT_TEMPTABLE(N) ,TEMPTABLE_##N
+    #define NEXT_TEMPTABLE_LEN(N) ,TEMPTABLE_##N##_LEN
+    static const temp_entry_t* heater_ttbl_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0 REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE));
+    static constexpr uint8_t heater_ttbllen_map[HOTENDS] = ARRAY_BY_HOTENDS(TEMPTABLE_0_LEN REPEAT_S(1, HOTENDS, NEXT_TEMPTABLE_LEN));
+  #endif
 #endif
 
 Temperature thermalManager;
@@ -455,7 +478,7 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
      */
     void Temperature::report_fan_speed(const uint8_t fan) {
       if (fan >= FAN_COUNT) return;
-      PORT_REDIRECT(SerialMask::All);
+      PORT_REDIRECT(SERIAL_NOTICE_PORTS);
       SERIAL_ECHOLNPGM("M106 P", fan, " S", fan_speed[fan]);
     }
   #endif
@@ -562,12 +585,28 @@ PGMSTR(str_t_heating_failed, STR_T_HEATING_FAILED);
   int16_t Temperature::lpq_len; // Initialized in settings.cpp
 #endif
 
+#if ENABLED(PID_FLOW_FEEDFORWARD)
+  float Temperature::flow_ff[HOTENDS]; // Initialized in settings.cpp
+#endif
+
 /**
  * private:
  */
 
 volatile bool Temperature::raw_temps_ready = false;
 
+#if ENABLED(ADC_AUTO_SEQUENCE)
+  // Sensors in ADC sequence order. Keep in step with ADC_SEQUENCE_LENGTH.
+  #define ADC_SEQUENCE(F) \
+    TERN_(HAS_TEMP_ADC_0, F(TEMP_0_PIN, temp_hotend[0])) TERN_(HAS_TEMP_ADC_1, F(TEMP_1_PIN, temp_hotend[1])) \
+    TERN_(HAS_TEMP_ADC_2, F(TEMP_2_PIN, temp_hotend[2])) TERN_(HAS_TEMP_ADC_3, F(TEMP_3_PIN, temp_hotend[3])) \
+    TERN_(HAS_TEMP_ADC_4, F(TEMP_4_PIN, temp_hotend[4])) TERN_(HAS_TEMP_ADC_5, F(TEMP_5_PIN, temp_hotend[5])) \
+    TERN_(HAS_TEMP_ADC_6, F(TEMP_6_PIN, temp_hotend[6])) TERN_(HAS_TEMP_ADC_7, F(TEMP_7_PIN, temp_hotend[7])) \
+    TERN_(HAS_TEMP_ADC_BED, F(TEMP_BED_PIN, temp_bed)) TERN_(HAS_TEMP_ADC_CHAMBER, F(TEMP_CHAMBER_PIN, temp_chamber)) \
+    TERN_(HAS_TEMP_ADC_PROBE, F(TEMP_PROBE_PIN, temp_probe)) TERN_(HAS_TEMP_ADC_COOLER, F(TEMP_COOLER_PIN, temp_cooler)) \
+    TERN_(HAS_TEMP_ADC_BOARD, F(TEMP_BOARD_PIN, temp_board)) TERN_(HAS_TEMP_ADC_REDUNDANT, F(TEMP_REDUNDANT_PIN, temp_redundant))
+#endif
+
 #if ENABLED(MPCTEMP)
   int32_t Temperature::mpc_e_position; // = 0
 #endif
@@ -907,7 +946,7 @@ volatile bool Temperature::raw_temps_ready = false;
 
 #endif // HAS_PID_HEATING
 
-#if ENABLED(MPCTEMP)
+#if ENABLED(MPC_AUTOTUNE)
 
   void Temperature::MPC_autotune() {
     auto housekeeping = [] (millis_t& ms, celsius_float_t& current_temp, millis_t& next_report_ms) {
@@ -1128,7 +1167,7 @@ volatile bool Temperature::raw_temps_ready = false;
     TERN_(HAS_FAN, SERIAL_ECHOLNPAIR_F("MPC_AMBIENT_XFER_COEFF_FAN255 ", ambient_xfer_coeff_fan255, 4));
   }
 
-#endif // MPCTEMP
+#endif // MPC_AUTOTUNE
 
 int16_t Temperature::getHeaterPower(const heater_id_t heater_id) {
   switch (heater_id) {
@@ -1437,7 +1476,14 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
         REPEAT(HOTENDS, _HOTENDPID)
       };
 
-      const float pid_output = is_idling ? 0 : hotend_pid[ee].get_pid_output(ee);
+      #if ENABLED(PID_FLOW_FEEDFORWARD)
+        float pid_output = is_idling ? 0 : hotend_pid[ee].get_pid_output(ee);
+        // Add the power the queued extrusion will need before it arrives
+        if (!is_idling && temp_hotend[ee].target && flow_ff[ee])
+          pid_output = _MIN(pid_output + flow_ff[ee] * planner.queued_flow_rate(ee) * (float(PID_MAX) / (PID_FLOW_HEATER_WATTS)), float(PID_MAX));
+      #else
+        const float pid_output = is_idling ? 0 : hotend_pid[ee].get_pid_output(ee);
+      #endif
 
       #if ENABLED(PID_DEBUG)
         if (ee == active_extruder)
@@ -1461,6 +1507,18 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
         const bool this_hotend = (ee == active_extruder);
       #endif
 
+      // Refresh the per-step constants so the loop below needs no divides
+      MPC_step_t &k = hotend.mpc_step;
+      if (k.heater_power != mpc.heater_power || k.block_heat_capacity != mpc.block_heat_capacity || k.sensor_responsiveness != mpc.sensor_responsiveness) {
+        k.heater_power = mpc.heater_power;
+        k.block_heat_capacity = mpc.block_heat_capacity;
+        k.sensor_responsiveness = mpc.sensor_responsiveness;
+        k.xfer_step = MPC_dT / mpc.block_heat_capacity;
+        k.heat_step = mpc.heater_power * (1.0f / 127) * k.xfer_step;
+        k.sensor_step = mpc.sensor_responsiveness * MPC_dT;
+        k.pwm_per_watt = 254.0f / mpc.heater_power;
+      }
+
       float ambient_xfer_coeff = mpc.ambient_xfer_coeff_fan0;
       #if ENABLED(MPC_INCLUDE_FAN)
         const uint8_t fan_index = ANY(MPC_FAN_0_ACTIVE_HOTEND, MPC_FAN_0_ALL_HOTENDS) ? 0 : ee;
@@ -1470,7 +1528,7 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
 
       if (this_hotend) {
         const int32_t e_position = stepper.position(E_AXIS);
-        const float e_speed = (e_position - mpc_e_position) * planner.mm_per_step[E_AXIS] / MPC_dT;
+        const float e_speed = (e_position - mpc_e_position) * planner.mm_per_step[E_AXIS] * (1.0f / MPC_dT);
 
         // The position can appear to make big jumps when, e.g. homing
         if (fabs(e_speed) > planner.settings.max_feedrate_mm_s[E_AXIS])
@@ -1482,11 +1540,11 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
       }
 
       // Update the modeled temperatures
-      float blocktempdelta = hotend.soft_pwm_amount * mpc.heater_power * (MPC_dT / 127) / mpc.block_heat_capacity;
-      blocktempdelta += (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff * MPC_dT / mpc.block_heat_capacity;
+      float blocktempdelta = hotend.soft_pwm_amount * k.heat_step;
+      blocktempdelta += (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff * k.xfer_step;
       hotend.modeled_block_temp += blocktempdelta;
 
-      const float sensortempdelta = (hotend.modeled_block_temp - hotend.modeled_sensor_temp) * (mpc.sensor_responsiveness * MPC_dT);
+      const float sensortempdelta = (hotend.modeled_block_temp - hotend.modeled_sensor_temp) * k.sensor_step;
       hotend.modeled_sensor_temp += sensortempdelta;
 
       // Any delta between hotend.modeled_sensor_temp and hotend.celsius is either model
@@ -1502,11 +1560,11 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
       float power = 0.0;
       if (hotend.target != 0 && !is_idling) {
         // Plan power level to get to target temperature in 2 seconds
-        power = (hotend.target - hotend.modeled_block_temp) * mpc.block_heat_capacity / 2.0f;
+        power = (hotend.target - hotend.modeled_block_temp) * mpc.block_heat_capacity * 0.5f;
         power -= (hotend.modeled_ambient_temp - hotend.modeled_block_temp) * ambient_xfer_coeff;
       }
 
-      float pid_output = power * 254.0f / mpc.heater_power + 1.0f;        // Ensure correct quantization into a range of 0 to 127
+      float pid_output = power * k.pwm_per_watt + 1.0f;                   // Ensure correct quantization into a range of 0 to 127
       pid_output = constrain(pid_output, 0, MPC_MAX);
 
       /* <-- add a slash to enable
@@ -1572,6 +1630,9 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
         tr_state_machine[e].run(temp_hotend[e].celsius, temp_hotend[e].target, (heater_id_t)e, THERMAL_PROTECTION_PERIOD, THERMAL_PROTECTION_HYSTERESIS);
       #endif
 
+      // Compare with the heater model before the heater power changes
+      TERN_(THERMAL_PROTECTION_MODEL, tp_model[e].run(e, ms));
+
       temp_hotend[e].soft_pwm_amount = (temp_hotend[e].celsius > temp_range[e].mintemp || is_preheating(e)) && temp_hotend[e].celsius < temp_range[e].maxtemp ? (int)get_pid_output_hotend(e) >> 1 : 0;
 
       #if WATCH_HOTENDS
@@ -1670,6 +1731,26 @@ void Temperature::mintemp_error(const heater_id_t heater_id) {
     } while (false);
   }
 
+  #if ENABLED(HEATER_POWER_BUDGET)
+
+    /**
+     * Lower the bed PWM so the hotends and bed together stay within
+     * HEATER_BUDGET_WATTS. The hotends always get the power they need.
+     */
+    void Temperature::apply_power_budget() {
+      static constexpr float hotend_watts[] = HEATER_BUDGET_HOTEND_WATTS;
+      static_assert(COUNT(hotend_watts) == HOTENDS, "HEATER_BUDGET_HOTEND_WATTS must have HOTENDS items.");
+
+      // Power in watts * 127, the full soft_pwm_amount
+      float left = float(HEATER_BUDGET_WATTS) * 127;
+      HOTEND_LOOP() left -= hotend_watts[e] * temp_hotend[e].soft_pwm_amount;
+
+      const uint8_t bed_max = left > 0 ? uint8_t(_MIN(left * (1.0f / (HEATER_BUDGET_BED_WATTS)), 127.0f)) : 0;
+      NOMORE(temp_bed.soft_pwm_amount, bed_max);
+    }
+
+  #endif
+
 #endif // HAS_HEATED_BED
 
 #if HAS_HEATED_CHAMBER
@@ -1884,6 +1965,10 @@ void Temperature::task() {
       quickstop_stepper();
     }
 
+    #if ENABLED(REALTIME_OVERRIDES)
+      if (emergency_parser.override_pending) emergency_parser.apply_overrides();
+    #endif
+
     #if HAS_MEDIA
       if (emergency_parser.sd_abort_by_M524) { // abort SD print immediately
         emergency_parser.sd_abort_by_M524 = false;
@@ -1943,12 +2028,18 @@ void Temperature::task() {
   // Handle Bed Temp Errors, Heating Watch, etc.
   TERN_(HAS_HEATED_BED, manage_heated_bed(ms));
 
+  // Give the bed only the power the hotends leave over
+  TERN_(HEATER_POWER_BUDGET, apply_power_budget());
+
   // Handle Heated Chamber Temp Errors, Heating Watch, etc.
   TERN_(HAS_HEATED_CHAMBER, manage_heated_chamber(ms));
 
   // Handle Cooler Temp Errors, Cooling Watch, etc.
   TERN_(HAS_COOLER, manage_cooler(ms));
 
+  // Add this reading to the temperature history
+  TERN_(TEMP_HISTORY, temp_history.record(ms));
+
   #if ENABLED(LASER_COOLANT_FLOW_METER)
     cooler.flowmeter_task(ms);
     #if ENABLED(FLOWMETER_SAFETY)
@@ -1966,6 +2057,16 @@ void Temperature::task() {
 #define TEMP_AD595(RAW)  ((RAW) * 5.0 * 100.0 / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD595_GAIN) + TEMP_SENSOR_AD595_OFFSET)
 #define TEMP_AD8495(RAW) ((RAW) * 6.6 * 100.0 / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD8495_GAIN) + TEMP_SENSOR_AD8495_OFFSET)
 
+#if ENABLED(THERMISTOR_DIRECT_TABLES)
+
+/**
+ * Read the table's uniformly resampled copy at the 'raw' value,
+ * interpolating between neighboring grid points in fixed point.
+ */
+#define SCAN_THERMISTOR_TABLE(TBL,LEN) return direct_temptable_lookup(DIRECT_TEMPTABLE(TBL), raw)
+
+#else
+
 /**
  * Bisect search for the range of the 'raw' value, then interpolate
  * proportionally between the under and over values.
@@ -1988,6 +2089,8 @@ void Temperature::task() {
   }                                                                       \
 }while(0)
 
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
@@ -2229,8 +2332,12 @@ void Temperature::task() {
 
     #if HAS_HOTEND_THERMISTOR
       // Thermistor with conversion table?
-      const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #if ENABLED(THERMISTOR_DIRECT_TABLES)
+        return direct_temptable_lookup(*heater_dtbl_map[e], raw);
+      #else
+        const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
+        SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      #endif
     #endif
 
     return 0;
@@ -2647,6 +2754,14 @@ void Temperature::init() {
     #endif
   #endif
 
+  // Timer outputs start with the pins low and connect on the first duty update
+  #if ENABLED(HW_PWM_HOTEND)
+    hal.set_pwm_frequency(HEATER_0_PIN, HEATER_HW_PWM_FREQUENCY);
+  #endif
+  #if ENABLED(HW_PWM_BED)
+    hal.set_pwm_frequency(HEATER_BED_PIN, HEATER_HW_PWM_FREQUENCY);
+  #endif
+
   #if HAS_HEATED_CHAMBER
     OUT_WRITE(HEATER_CHAMBER_PIN, ENABLED(HEATER_CHAMBER_INVERTING));
   #endif
@@ -2713,6 +2828,13 @@ void Temperature::init() {
     SET_INPUT_PULLUP(JOY_EN_PIN);
   #endif
 
+  #if ENABLED(ADC_AUTO_SEQUENCE)
+    #define _ADC_SEQ_ADD(P,T) hal.adc_sequence_add(P);
+    ADC_SEQUENCE(_ADC_SEQ_ADD)
+    #undef _ADC_SEQ_ADD
+    hal.adc_sequence_start(OVERSAMPLENR);
+  #endif
+
   HAL_timer_start(MF_TIMER_TEMP, TEMP_TIMER_FREQUENCY);
   ENABLE_TEMPERATURE_INTERRUPT();
 
@@ -3003,6 +3125,92 @@ void Temperature::init() {
 
 #endif // HAS_THERMAL_PROTECTION
 
+#if ENABLED(THERMAL_PROTECTION_MODEL)
+
+  Temperature::tp_model_t Temperature::tp_model[HOTENDS];
+
+  /**
+   * Advance the predicted hotend temperature with the heater power applied
+   * since the last call. At the end of each window compare it with the
+   * measured temperature, then start the next window from the measurement
+   * so model errors can't build up. Halt after too many bad windows.
+   */
+  void Temperature::tp_model_t::run(const uint8_t e, const millis_t &ms) {
+    const hotend_info_t &hotend = temp_hotend[e];
+
+    if (!window_ms) {
+      predicted = hotend.celsius;
+      last_ms = ms;
+      window_ms = ms + SEC_TO_MS(TP_MODEL_WINDOW);
+      return;
+    }
+
+    const float dt = (ms - last_ms) * 0.001f;
+    last_ms = ms;
+
+    const float fan = TERN0(HAS_FAN, fan_speed[_MIN(e, FAN_COUNT - 1)] * (1.0f / 255.0f));
+
+    #if ENABLED(MPCTEMP)
+      const MPC_t &mpc = hotend.mpc;
+      const float power = mpc.heater_power,
+                  capacity = mpc.block_heat_capacity,
+                  xfer = mpc.ambient_xfer_coeff_fan0 + TERN0(MPC_INCLUDE_FAN, mpc.fan255_adjustment * fan),
+                  ambient = hotend.modeled_ambient_temp;
+    #else
+      static constexpr float heater_power[] = TP_MODEL_HEATER_POWER,
+                             heat_capacity[] = TP_MODEL_HEAT_CAPACITY,
+                             xfer_fan0[] = TP_MODEL_XFER_FAN0,
+                             xfer_fan255[] = TP_MODEL_XFER_FAN255;
+      static_assert(COUNT(heater_power) == HOTENDS, "TP_MODEL_HEATER_POWER must have HOTENDS items.");
+      static_assert(COUNT(heat_capacity) == HOTENDS, "TP_MODEL_HEAT_CAPACITY must have HOTENDS items.");
+      static_assert(COUNT(xfer_fan0) == HOTENDS, "TP_MODEL_XFER_FAN0 must have HOTENDS items.");
+      static_assert(COUNT(xfer_fan255) == HOTENDS, "TP_MODEL_XFER_FAN255 must have HOTENDS items.");
+      const float power = heater_power[e],
+                  capacity = heat_capacity[e],
+                  xfer = xfer_fan0[e] + (xfer_fan255[e] - xfer_fan0[e]) * fan,
+                  ambient = TP_MODEL_AMBIENT;
+    #endif
+
+    // Heater power in, loss to the room air out
+    predicted += dt * (power * hotend.soft_pwm_amount * (1.0f / 127.0f) - xfer * (predicted - ambient)) / capacity;
+
+    if (PENDING(ms, window_ms)) return;
+
+    if (ABS(hotend.celsius - predicted) > (TP_MODEL_RESIDUAL)) {
+      if (++strikes >= (TP_MODEL_STRIKES)) {
+        TERN_(HAS_DWIN_E3V2_BASIC, DWIN_Popup_Temperature(0));
+        _temp_error((heater_id_t)e, FPSTR(str_t_thermal_runaway), GET_TEXT_F(MSG_THERMAL_RUNAWAY));
+      }
+    }
+    else
+      strikes = 0;
+
+    predicted = hotend.celsius;
+    window_ms = ms + SEC_TO_MS(TP_MODEL_WINDOW);
+  }
+
+#endif // THERMAL_PROTECTION_MODEL
+
+#if ENABLED(HEATER_HW_PWM)
+
+  // Last power sent to each heater timer output
+  #if ENABLED(HW_PWM_HOTEND)
+    static uint8_t hw_pwm_hotend;
+  #endif
+  #if ENABLED(HW_PWM_BED)
+    static uint8_t hw_pwm_bed;
+  #endif
+
+  // Update a heater timer output only when its power changes.
+  // 0 and 127 make set_pwm_duty disconnect the timer and write the pin.
+  static void hw_pwm_update(const pin_t pin, uint8_t &last, const uint8_t amount, const bool invert) {
+    if (amount == last) return;
+    last = amount;
+    hal.set_pwm_duty(pin, amount, 127, invert);
+  }
+
+#endif
+
 void Temperature::disable_all_heaters() {
 
   // Disable autotemp, unpause and reset everything
@@ -3020,11 +3228,19 @@ void Temperature::disable_all_heaters() {
     #define DISABLE_HEATER(N) WRITE_HEATER_##N(LOW);
     REPEAT(HOTENDS, DISABLE_HEATER);
   #endif
+  #if ENABLED(HW_PWM_HOTEND)
+    hw_pwm_hotend = 127;  // Force the timer off right away, the ISR may be stopped next
+    hw_pwm_update(HEATER_0_PIN, hw_pwm_hotend, 0, ENABLED(HEATER_0_INVERTING));
+  #endif
 
   #if HAS_HEATED_BED
     setTargetBed(0);
     temp_bed.soft_pwm_amount = 0;
     WRITE_HEATER_BED(LOW);
+    #if ENABLED(HW_PWM_BED)
+      hw_pwm_bed = 127;
+      hw_pwm_update(HEATER_BED_PIN, hw_pwm_bed, 0, ENABLED(HEATER_BED_INVERTING));
+    #endif
   #endif
 
   #if HAS_HEATED_CHAMBER
@@ -3459,6 +3675,57 @@ void Temperature::readings_ready() {
   TERN_(HAS_JOY_ADC_Z, joystick.z.reset());
 }
 
+#if ENABLED(TEMP_ADC_FILTER)
+
+  /**
+   * Sliding median over the last TAPS raw samples of one ADC channel.
+   * A fixed compare network keeps the ISR time bounded. The first
+   * sample fills the whole window so the first reading is not skewed.
+   */
+  template<uint8_t TAPS> struct ADCMedian;
+
+  template<> struct ADCMedian<1> {
+    FORCE_INLINE raw_adc_t next(const raw_adc_t s) { return s; }
+  };
+
+  template<uint8_t TAPS> struct ADCWindow {
+    raw_adc_t w[TAPS];
+    uint8_t i = 0xFF;   // 0xFF until the first sample
+    void push(const raw_adc_t s) {
+      if (i >= TAPS) { for (uint8_t n = 0; n < TAPS; ++n) w[n] = s; i = 0; }
+      w[i] = s;
+      if (++i >= TAPS) i = 0;
+    }
+    static void swap(raw_adc_t &a, raw_adc_t &b) { const raw_adc_t t = a; a = b; b = t; }
+    static void order(raw_adc_t &a, raw_adc_t &b) { if (a > b) swap(a, b); }
+  };
+
+  template<> struct ADCMedian<3> : ADCWindow<3> {
+    raw_adc_t next(const raw_adc_t s) {
+      push(s);
+      raw_adc_t a = w[0], b = w[1];
+      order(a, b);
+      return _MAX(a, _MIN(b, w[2]));
+    }
+  };
+
+  template<> struct ADCMedian<5> : ADCWindow<5> {
+    raw_adc_t next(const raw_adc_t s) {
+      push(s);
+      // Drop the lowest of the first four, which can't be the median of five,
+      // then add the fifth and take the second lowest of the remaining four.
+      raw_adc_t a = w[0], b = w[1], c = w[2], d = w[3];
+      order(a, b); order(c, d);
+      if (c < a) { swap(a, c); swap(b, d); }
+      a = w[4];
+      order(a, b);
+      if (c < a) { swap(a, c); swap(b, d); }
+      return _MIN(b, c);
+    }
+  };
+
+#endif
+
 /**
  * Timer 0 is shared with millies so don't change the prescaler.
  *
@@ -3519,6 +3786,9 @@ public:
  */
 void Temperature::isr() {
 
+  TERN_(ISR_PROFILER, const ISRProfile profile_isr(PROFILE_TEMPERATURE_ISR));
+  TERN_(STACK_MONITOR, const StackMonitorISR stack_isr);
+
   // Shut down the laser if steppers are inactive for > LASER_SAFETY_TIMEOUT_MS ms
   #if LASER_SAFETY_TIMEOUT_MS > 0
     if (cutter.last_power_applied && ELAPSED(millis(), gcode.previous_move_ms + (LASER_SAFETY_TIMEOUT_MS))) {
@@ -3527,8 +3797,10 @@ void Temperature::isr() {
     }
   #endif
 
-  static int8_t temp_count = -1;
-  static ADCSensorState adc_sensor_state = StartupDelay;
+  #if DISABLED(ADC_AUTO_SEQUENCE)
+    static int8_t temp_count = -1;
+    static ADCSensorState adc_sensor_state = StartupDelay;
+  #endif
 
   #ifndef SOFT_PWM_SCALE
     #define SOFT_PWM_SCALE 0
@@ -3583,11 +3855,26 @@ void Temperature::isr() {
 
       #if HAS_HOTEND
         #define _PWM_MOD_E(N) _PWM_MOD(N,soft_pwm_hotend[N],temp_hotend[N]);
-        REPEAT(HOTENDS, _PWM_MOD_E);
+        #if ENABLED(HW_PWM_HOTEND)
+          hw_pwm_update(HEATER_0_PIN, hw_pwm_hotend, temp_hotend[0].soft_pwm_amount, ENABLED(HEATER_0_INVERTING));
+          #if HAS_MULTI_HOTEND
+            REPEAT_S(1, HOTENDS, _PWM_MOD_E);
+          #endif
+        #else
+          REPEAT(HOTENDS, _PWM_MOD_E);
+        #endif
       #endif
 
       #if HAS_HEATED_BED
-        _PWM_MOD(BED, soft_pwm_bed, temp_bed);
+        #if ENABLED(HW_PWM_BED)
+          hw_pwm_update(HEATER_BED_PIN, hw_pwm_bed, temp_bed.soft_pwm_amount, ENABLED(HEATER_BED_INVERTING));
+        #elif ENABLED(HEATER_PWM_INTERLEAVE)
+          // The bed on-phase ends the cycle, so it's only on here at full power
+          soft_pwm_bed.add(pwm_mask, temp_bed.soft_pwm_amount);
+          WRITE_HEATER_BED(soft_pwm_bed.count + pwm_count_tmp >= 127);
+        #else
+          _PWM_MOD(BED, soft_pwm_bed, temp_bed);
+        #endif
       #endif
 
       #if HAS_HEATED_CHAMBER
@@ -3640,11 +3927,23 @@ void Temperature::isr() {
       #define _PWM_LOW(N,S) do{ if (S.count <= pwm_count_tmp) WRITE_HEATER_##N(LOW); }while(0)
       #if HAS_HOTEND
         #define _PWM_LOW_E(N) _PWM_LOW(N, soft_pwm_hotend[N]);
-        REPEAT(HOTENDS, _PWM_LOW_E);
+        #if ENABLED(HW_PWM_HOTEND)
+          #if HAS_MULTI_HOTEND
+            REPEAT_S(1, HOTENDS, _PWM_LOW_E);
+          #endif
+        #else
+          REPEAT(HOTENDS, _PWM_LOW_E);
+        #endif
       #endif
 
       #if HAS_HEATED_BED
-        _PWM_LOW(BED, soft_pwm_bed);
+        #if ENABLED(HW_PWM_BED)
+          // The timer drives the bed
+        #elif ENABLED(HEATER_PWM_INTERLEAVE)
+          if (soft_pwm_bed.count + pwm_count_tmp >= 127) WRITE_HEATER_BED(HIGH);
+        #else
+          _PWM_LOW(BED, soft_pwm_bed);
+        #endif
       #endif
 
       #if HAS_HEATED_CHAMBER
@@ -3837,207 +4136,249 @@ void Temperature::isr() {
   static bool do_buttons;
   if ((do_buttons ^= true)) ui.update_buttons();
 
-  /**
-   * One sensor is sampled on every other call of the ISR.
-   * Each sensor is read 16 (OVERSAMPLENR) times, taking the average.
-   *
-   * On each Prepare pass, ADC is started for a sensor pin.
-   * On the next pass, the ADC value is read and accumulated.
-   *
-   * This gives each ADC 0.9765ms to charge up.
-   */
-  #define ACCUMULATE_ADC(obj) do{ \
-    if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; \
-    else obj.sample(hal.adc_value()); \
-  }while(0)
+  #if ENABLED(ADC_AUTO_SEQUENCE)
 
-  ADCSensorState next_sensor_state = adc_sensor_state < SensorsReady ? (ADCSensorState)(int(adc_sensor_state) + 1) : StartSampling;
+    /**
+     * The ADC interrupt samples each channel in turn and sums OVERSAMPLENR
+     * samples of each. Take every finished round as soon as it comes.
+     */
+    if (hal.adc_sequence_ready()) {
+      uint8_t seq = 0;
+      #define _ADC_SEQ_TAKE(P,T) T.sample(hal.adc_sequence_sum(seq++));
+      ADC_SEQUENCE(_ADC_SEQ_TAKE)
+      #undef _ADC_SEQ_TAKE
+      hal.adc_sequence_next();
+      readings_ready();
+    }
+
+  #else
 
-  switch (adc_sensor_state) {
+    /**
+     * One sensor is sampled on every other call of the ISR.
+     * Each sensor is read 16 (OVERSAMPLENR) times, taking the average.
+     * With TEMP_ADC_FILTER each sample is first passed through a median and
+     * a reading is taken every 16 / TEMP_ADC_DECIMATE samples.
+     *
+     * On each Prepare pass, ADC is started for a sensor pin.
+     * On the next pass, the ADC value is read and accumulated.
+     *
+     * This gives each ADC 0.9765ms to charge up.
+     */
+    #define ACCUMULATE_ADC(obj) do{ \
+      if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; \
+      else obj.sample(hal.adc_value() * TERN(TEMP_ADC_FILTER, TEMP_ADC_DECIMATE, 1)); \
+    }while(0)
 
-    #pragma GCC diagnostic push
-    #if __has_cpp_attribute(fallthrough)
-      #pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
+    #if ENABLED(TEMP_ADC_FILTER)
+      #if HAS_HOTEND
+        static ADCMedian<TEMP_ADC_MEDIAN_HOTEND> median_hotend[HOTENDS];
+      #endif
+      TERN_(HAS_TEMP_ADC_BED,       static ADCMedian<TEMP_ADC_MEDIAN_BED> median_bed);
+      TERN_(HAS_TEMP_ADC_CHAMBER,   static ADCMedian<TEMP_ADC_MEDIAN_OTHER> median_chamber);
+      TERN_(HAS_TEMP_ADC_COOLER,    static ADCMedian<TEMP_ADC_MEDIAN_OTHER> median_cooler);
+      TERN_(HAS_TEMP_ADC_PROBE,     static ADCMedian<TEMP_ADC_MEDIAN_OTHER> median_probe);
+      TERN_(HAS_TEMP_ADC_BOARD,     static ADCMedian<TEMP_ADC_MEDIAN_OTHER> median_board);
+      TERN_(HAS_TEMP_ADC_REDUNDANT, static ADCMedian<TEMP_ADC_MEDIAN_OTHER> median_redundant);
+      #define FILTER_ADC(obj, flt) do{ \
+        if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; \
+        else obj.sample(flt.next(hal.adc_value()) * (TEMP_ADC_DECIMATE)); \
+      }while(0)
+    #else
+      #define FILTER_ADC(obj, flt) ACCUMULATE_ADC(obj)
     #endif
 
-    case SensorsReady: {
-      // All sensors have been read. Stay in this state for a few
-      // ISRs to save on calls to temp update/checking code below.
-      constexpr int8_t extra_loops = MIN_ADC_ISR_LOOPS - (int8_t)SensorsReady;
-      static uint8_t delay_count = 0;
-      if (extra_loops > 0) {
-        if (delay_count == 0) delay_count = extra_loops;  // Init this delay
-        if (--delay_count)                                // While delaying...
-          next_sensor_state = SensorsReady;               // retain this state (else, next state will be 0)
-        break;
-      }
-      else {
-        adc_sensor_state = StartSampling;                 // Fall-through to start sampling
-        next_sensor_state = (ADCSensorState)(int(StartSampling) + 1);
-      }
-    }
+    ADCSensorState next_sensor_state = adc_sensor_state < SensorsReady ? (ADCSensorState)(int(adc_sensor_state) + 1) : StartSampling;
+
+    switch (adc_sensor_state) {
 
-    #pragma GCC diagnostic pop
+      #pragma GCC diagnostic push
+      #if __has_cpp_attribute(fallthrough)
+        #pragma GCC diagnostic ignored "-Wimplicit-fallthrough"
+      #endif
 
-    case StartSampling:                                   // Start of sampling loops. Do updates/checks.
-      if (++temp_count >= OVERSAMPLENR) {                 // 10 * 16 * 1/(16000000/64/256)  = 164ms.
-        temp_count = 0;
-        readings_ready();
+      case SensorsReady: {
+        // All sensors have been read. Stay in this state for a few
+        // ISRs to save on calls to temp update/checking code below.
+        constexpr int8_t extra_loops = MIN_ADC_ISR_LOOPS - (int8_t)SensorsReady;
+        static uint8_t delay_count = 0;
+        if (extra_loops > 0) {
+          if (delay_count == 0) delay_count = extra_loops;  // Init this delay
+          if (--delay_count)                                // While delaying...
+            next_sensor_state = SensorsReady;               // retain this state (else, next state will be 0)
+          break;
+        }
+        else {
+          adc_sensor_state = StartSampling;                 // Fall-through to start sampling
+          next_sensor_state = (ADCSensorState)(int(StartSampling) + 1);
+        }
       }
-      break;
 
-    #if HAS_TEMP_ADC_0
-      case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
-      case MeasureTemp_0: ACCUMULATE_ADC(temp_hotend[0]); break;
-    #endif
+      #pragma GCC diagnostic pop
 
-    #if HAS_TEMP_ADC_BED
-      case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
-      case MeasureTemp_BED: ACCUMULATE_ADC(temp_bed); break;
-    #endif
+      case StartSampling:                                   // Start of sampling loops. Do updates/checks.
+        if (++temp_count >= TEMP_ADC_SAMPLES) {             // 10 * 16 * 1/(16000000/64/256)  = 164ms.
+          temp_count = 0;
+          readings_ready();
+        }
+        break;
 
-    #if HAS_TEMP_ADC_CHAMBER
-      case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
-      case MeasureTemp_CHAMBER: ACCUMULATE_ADC(temp_chamber); break;
-    #endif
+      #if HAS_TEMP_ADC_0
+        case PrepareTemp_0: hal.adc_start(TEMP_0_PIN); break;
+        case MeasureTemp_0: FILTER_ADC(temp_hotend[0], median_hotend[0]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_COOLER
-      case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
-      case MeasureTemp_COOLER: ACCUMULATE_ADC(temp_cooler); break;
-    #endif
+      #if HAS_TEMP_ADC_BED
+        case PrepareTemp_BED: hal.adc_start(TEMP_BED_PIN); break;
+        case MeasureTemp_BED: FILTER_ADC(temp_bed, median_bed); break;
+      #endif
 
-    #if HAS_TEMP_ADC_PROBE
-      case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
-      case MeasureTemp_PROBE: ACCUMULATE_ADC(temp_probe); break;
-    #endif
+      #if HAS_TEMP_ADC_CHAMBER
+        case PrepareTemp_CHAMBER: hal.adc_start(TEMP_CHAMBER_PIN); break;
+        case MeasureTemp_CHAMBER: FILTER_ADC(temp_chamber, median_chamber); break;
+      #endif
 
-    #if HAS_TEMP_ADC_BOARD
-      case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
-      case MeasureTemp_BOARD: ACCUMULATE_ADC(temp_board); break;
-    #endif
+      #if HAS_TEMP_ADC_COOLER
+        case PrepareTemp_COOLER: hal.adc_start(TEMP_COOLER_PIN); break;
+        case MeasureTemp_COOLER: FILTER_ADC(temp_cooler, median_cooler); break;
+      #endif
 
-    #if HAS_TEMP_ADC_REDUNDANT
-      case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
-      case MeasureTemp_REDUNDANT: ACCUMULATE_ADC(temp_redundant); break;
-    #endif
+      #if HAS_TEMP_ADC_PROBE
+        case PrepareTemp_PROBE: hal.adc_start(TEMP_PROBE_PIN); break;
+        case MeasureTemp_PROBE: FILTER_ADC(temp_probe, median_probe); break;
+      #endif
 
-    #if HAS_TEMP_ADC_1
-      case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
-      case MeasureTemp_1: ACCUMULATE_ADC(temp_hotend[1]); break;
-    #endif
+      #if HAS_TEMP_ADC_BOARD
+        case PrepareTemp_BOARD: hal.adc_start(TEMP_BOARD_PIN); break;
+        case MeasureTemp_BOARD: FILTER_ADC(temp_board, median_board); break;
+      #endif
 
-    #if HAS_TEMP_ADC_2
-      case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
-      case MeasureTemp_2: ACCUMULATE_ADC(temp_hotend[2]); break;
-    #endif
+      #if HAS_TEMP_ADC_REDUNDANT
+        case PrepareTemp_REDUNDANT: hal.adc_start(TEMP_REDUNDANT_PIN); break;
+        case MeasureTemp_REDUNDANT: FILTER_ADC(temp_redundant, median_redundant); break;
+      #endif
 
-    #if HAS_TEMP_ADC_3
-      case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
-      case MeasureTemp_3: ACCUMULATE_ADC(temp_hotend[3]); break;
-    #endif
+      #if HAS_TEMP_ADC_1
+        case PrepareTemp_1: hal.adc_start(TEMP_1_PIN); break;
+        case MeasureTemp_1: FILTER_ADC(temp_hotend[1], median_hotend[1]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_4
-      case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
-      case MeasureTemp_4: ACCUMULATE_ADC(temp_hotend[4]); break;
-    #endif
+      #if HAS_TEMP_ADC_2
+        case PrepareTemp_2: hal.adc_start(TEMP_2_PIN); break;
+        case MeasureTemp_2: FILTER_ADC(temp_hotend[2], median_hotend[2]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_5
-      case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
-      case MeasureTemp_5: ACCUMULATE_ADC(temp_hotend[5]); break;
-    #endif
+      #if HAS_TEMP_ADC_3
+        case PrepareTemp_3: hal.adc_start(TEMP_3_PIN); break;
+        case MeasureTemp_3: FILTER_ADC(temp_hotend[3], median_hotend[3]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_6
-      case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
-      case MeasureTemp_6: ACCUMULATE_ADC(temp_hotend[6]); break;
-    #endif
+      #if HAS_TEMP_ADC_4
+        case PrepareTemp_4: hal.adc_start(TEMP_4_PIN); break;
+        case MeasureTemp_4: FILTER_ADC(temp_hotend[4], median_hotend[4]); break;
+      #endif
 
-    #if HAS_TEMP_ADC_7
-      case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
-      case MeasureTemp_7: ACCUMULATE_ADC(temp_hotend[7]); break;
-    #endif
+      #if HAS_TEMP_ADC_5
+        case PrepareTemp_5: hal.adc_start(TEMP_5_PIN); break;
+        case MeasureTemp_5: FILTER_ADC(temp_hotend[5], median_hotend[5]); break;
+      #endif
 
-    #if ENABLED(FILAMENT_WIDTH_SENSOR)
-      case Prepare_FILWIDTH: hal.adc_start(FILWIDTH_PIN); break;
-      case Measure_FILWIDTH:
-        if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
-        else filwidth.accumulate(hal.adc_value());
-      break;
-    #endif
+      #if HAS_TEMP_ADC_6
+        case PrepareTemp_6: hal.adc_start(TEMP_6_PIN); break;
+        case MeasureTemp_6: FILTER_ADC(temp_hotend[6], median_hotend[6]); break;
+      #endif
 
-    #if ENABLED(POWER_MONITOR_CURRENT)
-      case Prepare_POWER_MONITOR_CURRENT:
-        hal.adc_start(POWER_MONITOR_CURRENT_PIN);
-        break;
-      case Measure_POWER_MONITOR_CURRENT:
-        if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
-        else power_monitor.add_current_sample(hal.adc_value());
-        break;
-    #endif
+      #if HAS_TEMP_ADC_7
+        case PrepareTemp_7: hal.adc_start(TEMP_7_PIN); break;
+        case MeasureTemp_7: FILTER_ADC(temp_hotend[7], median_hotend[7]); break;
+      #endif
 
-    #if ENABLED(POWER_MONITOR_VOLTAGE)
-      case Prepare_POWER_MONITOR_VOLTAGE:
-        hal.adc_start(POWER_MONITOR_VOLTAGE_PIN);
-        break;
-      case Measure_POWER_MONITOR_VOLTAGE:
-        if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
-        else power_monitor.add_voltage_sample(hal.adc_value());
+      #if ENABLED(FILAMENT_WIDTH_SENSOR)
+        case Prepare_FILWIDTH: hal.adc_start(FILWIDTH_PIN); break;
+        case Measure_FILWIDTH:
+          if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
+          else filwidth.accumulate(hal.adc_value());
         break;
-    #endif
+      #endif
 
-    #if HAS_JOY_ADC_X
-      case PrepareJoy_X: hal.adc_start(JOY_X_PIN); break;
-      case MeasureJoy_X: ACCUMULATE_ADC(joystick.x); break;
-    #endif
+      #if ENABLED(POWER_MONITOR_CURRENT)
+        case Prepare_POWER_MONITOR_CURRENT:
+          hal.adc_start(POWER_MONITOR_CURRENT_PIN);
+          break;
+        case Measure_POWER_MONITOR_CURRENT:
+          if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
+          else power_monitor.add_current_sample(hal.adc_value());
+          break;
+      #endif
 
-    #if HAS_JOY_ADC_Y
-      case PrepareJoy_Y: hal.adc_start(JOY_Y_PIN); break;
-      case MeasureJoy_Y: ACCUMULATE_ADC(joystick.y); break;
-    #endif
+      #if ENABLED(POWER_MONITOR_VOLTAGE)
+        case Prepare_POWER_MONITOR_VOLTAGE:
+          hal.adc_start(POWER_MONITOR_VOLTAGE_PIN);
+          break;
+        case Measure_POWER_MONITOR_VOLTAGE:
+          if (!hal.adc_ready()) next_sensor_state = adc_sensor_state; // Redo this state
+          else power_monitor.add_voltage_sample(hal.adc_value());
+          break;
+      #endif
 
-    #if HAS_JOY_ADC_Z
-      case PrepareJoy_Z: hal.adc_start(JOY_Z_PIN); break;
-      case MeasureJoy_Z: ACCUMULATE_ADC(joystick.z); break;
-    #endif
+      #if HAS_JOY_ADC_X
+        case PrepareJoy_X: hal.adc_start(JOY_X_PIN); break;
+        case MeasureJoy_X: ACCUMULATE_ADC(joystick.x); break;
+      #endif
 
-    #if HAS_ADC_BUTTONS
-      #ifndef ADC_BUTTON_DEBOUNCE_DELAY
-        #define ADC_BUTTON_DEBOUNCE_DELAY 16
+      #if HAS_JOY_ADC_Y
+        case PrepareJoy_Y: hal.adc_start(JOY_Y_PIN); break;
+        case MeasureJoy_Y: ACCUMULATE_ADC(joystick.y); break;
       #endif
-      case Prepare_ADC_KEY: hal.adc_start(ADC_KEYPAD_PIN); break;
-      case Measure_ADC_KEY:
-        if (!hal.adc_ready())
-          next_sensor_state = adc_sensor_state; // redo this state
-        else if (ADCKey_count < ADC_BUTTON_DEBOUNCE_DELAY) {
-          raw_ADCKey_value = hal.adc_value();
-          if (raw_ADCKey_value <= 900UL * HAL_ADC_RANGE / 1024UL) {
-            NOMORE(current_ADCKey_raw, raw_ADCKey_value);
-            ADCKey_count++;
-          }
-          else { //ADC Key release
-            if (ADCKey_count > 0) ADCKey_count++; else ADCKey_pressed = false;
-            if (ADCKey_pressed) {
-              ADCKey_count = 0;
-              current_ADCKey_raw = HAL_ADC_RANGE;
+
+      #if HAS_JOY_ADC_Z
+        case PrepareJoy_Z: hal.adc_start(JOY_Z_PIN); break;
+        case MeasureJoy_Z: ACCUMULATE_ADC(joystick.z); break;
+      #endif
+
+      #if HAS_ADC_BUTTONS
+        #ifndef ADC_BUTTON_DEBOUNCE_DELAY
+          #define ADC_BUTTON_DEBOUNCE_DELAY 16
+        #endif
+        case Prepare_ADC_KEY: hal.adc_start(ADC_KEYPAD_PIN); break;
+        case Measure_ADC_KEY:
+          if (!hal.adc_ready())
+            next_sensor_state = adc_sensor_state; // redo this state
+          else if (ADCKey_count < ADC_BUTTON_DEBOUNCE_DELAY) {
+            raw_ADCKey_value = hal.adc_value();
+            if (raw_ADCKey_value <= 900UL * HAL_ADC_RANGE / 1024UL) {
+              NOMORE(current_ADCKey_raw, raw_ADCKey_value);
+              ADCKey_count++;
+            }
+            else { //ADC Key release
+              if (ADCKey_count > 0) ADCKey_count++; else ADCKey_pressed = false;
+              if (ADCKey_pressed) {
+                ADCKey_count = 0;
+                current_ADCKey_raw = HAL_ADC_RANGE;
+              }
             }
           }
-        }
-        if (ADCKey_count == ADC_BUTTON_DEBOUNCE_DELAY) ADCKey_pressed = true;
-        break;
-    #endif // HAS_ADC_BUTTONS
+          if (ADCKey_count == ADC_BUTTON_DEBOUNCE_DELAY) ADCKey_pressed = true;
+          break;
+      #endif // HAS_ADC_BUTTONS
+
+      case StartupDelay: break;
 
-    case StartupDelay: break;
+    } // switch(adc_sensor_state)
 
-  } // switch(adc_sensor_state)
+    // Go to the next state
+    adc_sensor_state = next_sensor_state;
 
-  // Go to the next state
-  adc_sensor_state = next_sensor_state;
+  #endif // !ADC_AUTO_SEQUENCE
 
   //
   // Additional ~1kHz Tasks
   //
 
   #if ENABLED(BABYSTEPPING) && DISABLED(INTEGRATED_BABYSTEPPING)
-    babystep.task();
+    {
+      TERN_(ISR_PROFILER, const ISRProfile profile(PROFILE_BABYSTEP));
+      babystep.task();
+    }
   #endif
 
   // Check fan tachometers
@@ -4159,9 +4500,56 @@ void Temperature::isr() {
   #if ENABLED(AUTO_REPORT_TEMPERATURES)
     AutoReporter<Temperature::AutoReportTemp> Temperature::auto_reporter;
     void Temperature::AutoReportTemp::report() {
+      if (TERN0(AUTO_REPORT_TEMP_CHANGES, !changed())) return;
       print_heater_states(active_extruder OPTARG(HAS_TEMP_REDUNDANT, ENABLED(AUTO_REPORT_REDUNDANT)));
       SERIAL_EOL();
     }
+
+    #if ENABLED(AUTO_REPORT_TEMP_CHANGES)
+
+      float Temperature::AutoReportTemp::delta = AUTO_REPORT_TEMP_DELTA;
+
+      /**
+       * Compare the reported values with the last report. If any moved by 'delta'
+       * or more, or the last report has expired, keep these values and return true.
+       */
+      bool Temperature::AutoReportTemp::changed() {
+        static celsius_float_t reported[(HOTENDS) * 2 + 2 * (ENABLED(HAS_HEATED_BED) + ENABLED(HAS_HEATED_CHAMBER) + ENABLED(HAS_COOLER))
+                                        + ENABLED(HAS_TEMP_PROBE) + ENABLED(HAS_TEMP_BOARD)];
+        static millis_t expire_ms = 0;
+
+        const millis_t ms = millis();
+        bool moved = !delta || ELAPSED(ms, expire_ms);
+
+        // First pass compares with the last report, second pass keeps the new values
+        for (uint8_t keep = 0; keep < 2; ++keep) {
+          uint8_t i = 0;
+          auto visit = [&](const celsius_float_t v) {
+            if (keep) reported[i] = v; else if (ABS(v - reported[i]) >= delta) moved = true;
+            ++i;
+          };
+          #if HAS_HOTEND
+            HOTEND_LOOP() { visit(temp_hotend[e].celsius); visit(temp_hotend[e].target); }
+          #endif
+          #if HAS_HEATED_BED
+            visit(temp_bed.celsius); visit(temp_bed.target);
+          #endif
+          #if HAS_HEATED_CHAMBER
+            visit(temp_chamber.celsius); visit(temp_chamber.target);
+          #endif
+          #if HAS_COOLER
+            visit(temp_cooler.celsius); visit(temp_cooler.target);
+          #endif
+          TERN_(HAS_TEMP_PROBE, visit(temp_probe.celsius));
+          TERN_(HAS_TEMP_BOARD, visit(temp_board.celsius));
+          if (!moved) return false;
+        }
+
+        expire_ms = ms + SEC_TO_MS(AUTO_REPORT_TEMP_MAX_INTERVAL);
+        return true;
+      }
+
+    #endif
   #endif
 
   #if HAS_HOTEND && HAS_STATUS_MESSAGE
@@ -135,7 +135,19 @@ enum ADCSensorState : char {
 // get all oversampled sensor readings
 #define MIN_ADC_ISR_LOOPS 10
 
-#define ACTUAL_ADC_SAMPLES _MAX(int(MIN_ADC_ISR_LOOPS), int(SensorsReady))
+// With ADC_AUTO_SEQUENCE each channel takes one sample slot per round
+#if ENABLED(ADC_AUTO_SEQUENCE)
+  #define ACTUAL_ADC_SAMPLES ADC_SEQUENCE_LENGTH
+#else
+  #define ACTUAL_ADC_SAMPLES _MAX(int(MIN_ADC_ISR_LOOPS), int(SensorsReady))
+#endif
+
+// Samples summed into each reading. Each sample is scaled to keep the OVERSAMPLENR range.
+#if ENABLED(TEMP_ADC_FILTER)
+  #define TEMP_ADC_SAMPLES ((OVERSAMPLENR) / (TEMP_ADC_DECIMATE))
+#else
+  #define TEMP_ADC_SAMPLES OVERSAMPLENR
+#endif
 
 //
 // PID
@@ -147,7 +159,7 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
 #if HAS_PID_HEATING
 
   #define PID_K2 (1.0f - float(PID_K1))
-  #define PID_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / (TEMP_TIMER_FREQUENCY))
+  #define PID_dT ((TEMP_ADC_SAMPLES * float(ACTUAL_ADC_SAMPLES)) / (TEMP_TIMER_FREQUENCY))
 
   // Apply the scale factors to the PID values
   #define scalePID_i(i)   ( float(i) * PID_dT )
@@ -165,8 +177,16 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
   struct PID_t {
     protected:
       bool pid_reset = true;
-      float temp_iState = 0.0f, temp_dState = 0.0f;
-      float work_p = 0, work_i = 0, work_d = 0;
+      #if ENABLED(PID_FIXED_POINT)
+        // Temperatures in 1/16 °C, terms in 1/256 of a power step
+        int32_t temp_iState = 0, temp_dState = 0, iState_max = 0;
+        int32_t work_p = 0, work_i = 0, work_d = 0;
+        int32_t Kp_q = 0, Ki_q = 0, Kd_q = 0;  // Q8, Q16 and Q4 copies of the gains
+        float Kp_f = 0, Ki_f = 0, Kd_f = 0;    // The gains the copies were made from
+      #else
+        float temp_iState = 0.0f, temp_dState = 0.0f;
+        float work_p = 0, work_i = 0, work_d = 0;
+      #endif
 
     public:
       float Kp = 0, Ki = 0, Kd = 0;
@@ -175,9 +195,15 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
       float d() const { return unscalePID_d(Kd); }
       float c() const { return 1; }
       float f() const { return 0; }
-      float pTerm() const { return work_p; }
-      float iTerm() const { return work_i; }
-      float dTerm() const { return work_d; }
+      #if ENABLED(PID_FIXED_POINT)
+        float pTerm() const { return work_p * (1.0f / 256); }
+        float iTerm() const { return work_i * (1.0f / 256); }
+        float dTerm() const { return work_d * (1.0f / 256); }
+      #else
+        float pTerm() const { return work_p; }
+        float iTerm() const { return work_i; }
+        float dTerm() const { return work_d; }
+      #endif
       float cTerm() const { return 0; }
       float fTerm() const { return 0; }
       void set_Kp(float p) { Kp = p; }
@@ -196,6 +222,57 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
 
       float get_extrusion_scale_output(const bool, const int32_t, const float, const int16_t) { return 0; }
 
+    #if ENABLED(PID_FIXED_POINT)
+
+      /**
+       * The same control law in integer math. The gains may be edited in place
+       * (e.g., by a UI), so their integer copies are refreshed whenever they differ.
+       * The change in temperature feeding the D term is limited to ±16°C per sample.
+       */
+      float get_pid_output(const float target, const float current) {
+        static constexpr int32_t range_q = int32_t((PID_FUNCTIONAL_RANGE) * 16),
+                                 k2_q = int32_t(PID_K2 * 4096 + 0.5f);
+
+        if (Kp != Kp_f || Ki != Ki_f || Kd != Kd_f) {
+          Kp_f = Kp; Ki_f = Ki; Kd_f = Kd;
+          Kp_q = LROUND(Kp * 256);
+          Ki_q = LROUND(Ki * 65536);
+          Kd_q = LROUND(Kd * 16);
+          iState_max = Ki_q > 0 ? int32_t(_MIN((float(MAX_POW) / Ki - float(MIN_POW)) * 16, 1e9f)) : 0;
+        }
+
+        const int32_t cur_q = LROUND(current * 16),
+                      pid_error = int32_t(target) * 16 - cur_q;
+        if (!target || pid_error < -range_q) {
+          pid_reset = true;
+          return 0;
+        }
+        else if (pid_error > range_q) {
+          pid_reset = true;
+          return MAX_POW;
+        }
+
+        if (pid_reset) {
+          pid_reset = false;
+          temp_iState = 0;
+          work_d = 0;
+        }
+
+        temp_iState = constrain(temp_iState + pid_error, 0, iState_max);
+
+        work_p = (Kp_q * pid_error) >> 4;
+        work_i = (Ki_q * temp_iState) >> 12;
+        // Smooth the D term, splitting the multiply so it can't overflow
+        const int32_t d_delta = Kd_q * constrain(temp_dState - cur_q, -256, 256) - work_d;
+        work_d += (d_delta >> 12) * k2_q + (((d_delta & 0xFFF) * k2_q) >> 12);
+
+        temp_dState = cur_q;
+
+        return constrain(work_p + work_i + work_d + int32_t(MIN_POW) * 256, 0, int32_t(MAX_POW) * 256) * (1.0f / 256);
+      }
+
+    #else
+
       float get_pid_output(const float target, const float current) {
         const float pid_error = target - current;
         if (!target || pid_error < -(PID_FUNCTIONAL_RANGE)) {
@@ -225,6 +302,8 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
         return constrain(work_p + work_i + work_d + float(MIN_POW), 0, MAX_POW);
       }
 
+    #endif // !PID_FIXED_POINT
+
   };
 
 #endif // HAS_PID_HEATING
@@ -384,7 +463,16 @@ typedef struct { float p, i, d, c, f; } raw_pidcf_t;
     float filament_heat_capacity_permm; // M306 H
   } MPC_t;
 
-  #define MPC_dT ((OVERSAMPLENR * float(ACTUAL_ADC_SAMPLES)) / (TEMP_TIMER_FREQUENCY))
+  #define MPC_dT ((TEMP_ADC_SAMPLES * float(ACTUAL_ADC_SAMPLES)) / (TEMP_TIMER_FREQUENCY))
+
+  // Per-step model constants, derived from MPC_t whenever it changes
+  typedef struct {
+    float heater_power, block_heat_capacity, sensor_responsiveness; // The settings they came from
+    float heat_step,    // (K) Block temperature change per step per PWM count
+          xfer_step,    // (K/W) Block temperature change per step per watt of loss
+          sensor_step,  // Fraction of the block-to-sensor difference closed per step
+          pwm_per_watt; // PWM output (0..254) per watt of heater power
+  } MPC_step_t;
 
 #endif
 
@@ -430,6 +518,7 @@ struct PIDHeaterInfo : public HeaterInfo {
 #if ENABLED(MPCTEMP)
   struct MPCHeaterInfo : public HeaterInfo {
     MPC_t mpc;
+    MPC_step_t mpc_step;
     float modeled_ambient_temp,
           modeled_block_temp,
           modeled_sensor_temp;
@@ -692,6 +781,10 @@ class Temperature {
       static int16_t lpq_len;
     #endif
 
+    #if ENABLED(PID_FLOW_FEEDFORWARD)
+      static float flow_ff[HOTENDS];  // (W per mm³/s) M301 V
+    #endif
+
     #if HAS_FAN_LOGIC
       static constexpr millis_t fan_update_interval_ms = TERN(HAS_PWMFANCHECK, 5000, TERN(HAS_FANCHECK, 1000, 2500));
     #endif
@@ -1027,6 +1120,10 @@ class Temperature {
 
       static void manage_heated_bed(const millis_t &ms);
 
+      #if ENABLED(HEATER_POWER_BUDGET)
+        static void apply_power_budget();
+      #endif
+
     #endif // HAS_HEATED_BED
 
     #if HAS_TEMP_PROBE
@@ -1164,7 +1261,7 @@ class Temperature {
 
     #endif // HAS_PID_HEATING
 
-    #if ENABLED(MPCTEMP)
+    #if ENABLED(MPC_AUTOTUNE)
       void MPC_autotune();
     #endif
 
@@ -1193,7 +1290,13 @@ class Temperature {
         OPTARG(HAS_TEMP_REDUNDANT, const bool include_r=false)
       );
       #if ENABLED(AUTO_REPORT_TEMPERATURES)
-        struct AutoReportTemp { static void report(); };
+        struct AutoReportTemp {
+          static void report();
+          #if ENABLED(AUTO_REPORT_TEMP_CHANGES)
+            static float delta;     // (°C) M155 D
+            static bool changed();
+          #endif
+        };
         static AutoReporter<AutoReportTemp> auto_reporter;
       #endif
     #endif
@@ -1299,6 +1402,18 @@ class Temperature {
       static tr_state_machine_t tr_state_machine[NR_HEATER_RUNAWAY];
 
     #endif // HAS_THERMAL_PROTECTION
+
+    #if ENABLED(THERMAL_PROTECTION_MODEL)
+      // Predicted temperature of one hotend over the current window
+      typedef struct {
+        celsius_float_t predicted;
+        millis_t last_ms = 0, window_ms = 0;
+        uint8_t strikes = 0;
+        void run(const uint8_t e, const millis_t &ms);
+      } tp_model_t;
+
+      static tp_model_t tp_model[HOTENDS];
+    #endif
 };
 
 extern Temperature thermalManager;
@@ -0,0 +1,81 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * direct_table.h - Thermistor tables resampled at compile time for direct indexing
+ *
+ * Each thermistor table in use is run through the same interpolation as
+ * SCAN_THERMISTOR_TABLE at every point of a uniform grid spanning the raw ADC
+ * range, and the results are stored in PROGMEM as 1/16 °C integers. A reading
+ * is then converted with one shift, two table reads and an integer lerp,
+ * with no bisect and no float divide.
+ */
+
+#include "thermistors.h"
+
+#define DIRECT_TABLE_SCALE 16   // Table entries are 1/16 °C
+
+constexpr uint8_t direct_table_log2(const uint32_t n, const uint8_t b=0) { return n > 1 ? direct_table_log2(n >> 1, b + 1) : b; }
+
+#define DIRECT_TABLE_RAW_RANGE (uint32_t(MAX_RAW_THERMISTOR_VALUE) + 1)
+#define DIRECT_TABLE_SHIFT     (direct_table_log2(DIRECT_TABLE_RAW_RANGE) - (THERMISTOR_DIRECT_TABLE_BITS))
+
+static_assert((DIRECT_TABLE_RAW_RANGE & (DIRECT_TABLE_RAW_RANGE - 1)) == 0, "THERMISTOR_DIRECT_TABLES requires a power-of-2 raw ADC range.");
+static_assert(direct_table_log2(DIRECT_TABLE_RAW_RANGE) >= (THERMISTOR_DIRECT_TABLE_BITS), "THERMISTOR_DIRECT_TABLE_BITS is larger than the raw ADC resolution.");
+
+typedef struct { int16_t t[_BV(THERMISTOR_DIRECT_TABLE_BITS) + 1]; } direct_temptable_t;
+
+// The interpolation done by SCAN_THERMISTOR_TABLE, as a constant expression
+constexpr float direct_table_celsius(const temp_entry_t * const tbl, const uint8_t len, const uint32_t raw) {
+  if (raw <= tbl[0].value) return tbl[0].celsius;
+  for (uint8_t i = 1; i < len; ++i) {
+    const uint32_t v00 = tbl[i - 1].value, v10 = tbl[i].value;
+    if (raw <= v10) {
+      const celsius_t v01 = tbl[i - 1].celsius, v11 = tbl[i].celsius;
+      return v10 == v00 ? v01 : v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);
+    }
+  }
+  return tbl[len - 1].celsius;
+}
+
+template<const auto &TBL>
+struct DirectTempTable {
+  static constexpr direct_temptable_t make() {
+    direct_temptable_t d{};
+    for (uint16_t k = 0; k < COUNT(d.t); ++k) {
+      const float c = direct_table_celsius(TBL, COUNT(TBL), uint32_t(k) << DIRECT_TABLE_SHIFT) * (DIRECT_TABLE_SCALE);
+      d.t[k] = int16_t(c < 0 ? c - 0.5f : c + 0.5f);
+    }
+    return d;
+  }
+  static constexpr direct_temptable_t table PROGMEM = make();
+};
+
+#define DIRECT_TEMPTABLE(TBL) DirectTempTable<TBL>::table
+
+FORCE_INLINE celsius_float_t direct_temptable_lookup(const direct_temptable_t &d, const raw_adc_t raw) {
+  const uint16_t r = _MIN(raw, MAX_RAW_THERMISTOR_VALUE),
+                 i = r >> DIRECT_TABLE_SHIFT, f = r & (_BV(DIRECT_TABLE_SHIFT) - 1);
+  const int16_t a = pgm_read_word(&d.t[i]), b = pgm_read_word(&d.t[i + 1]);
+  return int16_t(a + ((int32_t(b - a) * f) >> DIRECT_TABLE_SHIFT)) * (1.0f / (DIRECT_TABLE_SCALE));
+}
@@ -151,6 +151,33 @@ void _line_to_current(const AxisEnum fr_axis, const float fscale=1) {
 void slow_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.2f); }
 void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.5f); }
 
+#if ENABLED(TOOLCHANGE_PIPELINE)
+
+  // Leave the moves in the planner. tool_change() waits once at the end.
+  inline void tool_change_sync() {}
+  void tool_move_to_z(const_float_t rz, const_feedRate_t fr_mm_s) {
+    current_position.z = rz;
+    line_to_current_position(fr_mm_s);
+  }
+  void tool_move_to_xy(const xy_pos_t &raw, const_feedRate_t fr_mm_s) {
+    current_position.set(raw.x, raw.y);
+    line_to_current_position(fr_mm_s);
+  }
+  void tool_move_to_xy_z(const xy_pos_t &raw, const_float_t rz, const_feedRate_t fr_mm_s) {
+    if (current_position.z < rz) tool_move_to_z(rz, fr_mm_s);   // Raise before XY
+    tool_move_to_xy(raw, fr_mm_s);
+    if (current_position.z > rz) tool_move_to_z(rz, fr_mm_s);   // Lower after XY
+  }
+
+#else
+
+  inline void tool_change_sync() { planner.synchronize(); }
+  #define tool_move_to_z    do_blocking_move_to_z
+  #define tool_move_to_xy   do_blocking_move_to_xy
+  #define tool_move_to_xy_z do_blocking_move_to_xy_z
+
+#endif
+
 #define DEBUG_OUT ENABLED(DEBUG_TOOL_CHANGE)
 #include "../core/debug_out.h"
 
@@ -908,6 +935,7 @@ void fast_line_to_current(const AxisEnum fr_axis) { _line_to_current(fr_axis, 0.
   // Cool down with fan
   inline void filament_swap_cooling() {
     #if HAS_FAN && TOOLCHANGE_FS_FAN >= 0
+      TERN_(TOOLCHANGE_PIPELINE, planner.synchronize()); // Cool after the prime
       thermalManager.fan_speed[TOOLCHANGE_FS_FAN] = toolchange_settings.fan_speed;
       gcode.dwell(SEC_TO_MS(toolchange_settings.fan_time));
       thermalManager.fan_speed[TOOLCHANGE_FS_FAN] = FAN_OFF_PWM;
@@ -1140,7 +1168,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
 
   #elif HAS_MULTI_EXTRUDER
 
-    planner.synchronize();
+    tool_change_sync();
 
     #if ENABLED(DUAL_X_CARRIAGE)  // Only T0 allowed if the Printer is in DXC_DUPLICATION_MODE or DXC_MIRRORED_MODE
       if (new_tool != 0 && idex_is_duplicating())
@@ -1194,7 +1222,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
           current_position.z += toolchange_settings.z_raise;
           TERN_(HAS_SOFTWARE_ENDSTOPS, NOMORE(current_position.z, soft_endstop.max.z));
           fast_line_to_current(Z_AXIS);
-          planner.synchronize();
+          tool_change_sync();
         }
       #endif
 
@@ -1257,7 +1285,7 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             );
           #endif
           planner.buffer_line(current_position, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE), old_tool);
-          planner.synchronize();
+          tool_change_sync();
         }
       #endif
 
@@ -1348,17 +1376,17 @@ void tool_change(const uint8_t new_tool, bool no_move/*=false*/) {
             DEBUG_ECHOLNPGM("Move back Z only");
 
             if (TERN1(TOOLCHANGE_PARK, toolchange_settings.enable_park))
-              do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
+              tool_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
 
           #else
             // Move back to the original (or adjusted) position
             DEBUG_POS("Move back", destination);
 
             #if ENABLED(TOOLCHANGE_PARK)
-              if (toolchange_settings.enable_park) do_blocking_move_to_xy_z(destination, destination.z, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
+              if (toolchange_settings.enable_park) tool_move_to_xy_z(destination, destination.z, MMM_TO_MMS(TOOLCHANGE_PARK_XY_FEEDRATE));
             #else
-              do_blocking_move_to_xy(destination, planner.settings.max_feedrate_mm_s[X_AXIS]);
-              do_blocking_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
+              tool_move_to_xy(destination, planner.settings.max_feedrate_mm_s[X_AXIS]);
+              tool_move_to_z(destination.z, planner.settings.max_feedrate_mm_s[Z_AXIS]);
               SECONDARY_AXIS_CODE(
                 do_blocking_move_to_i(destination.i, planner.settings.max_feedrate_mm_s[I_AXIS]),
                 do_blocking_move_to_j(destination.j, planner.settings.max_feedrate_mm_s[J_AXIS]),
@@ -121,6 +121,11 @@
 // Send command and return error code. Return zero for OK
 uint8_t DiskIODriver_SPI_SD::cardCommand(const uint8_t cmd, const uint32_t arg) {
 
+  // Any other command ends an open multiple block read or write
+  #if ANY(SD_STREAMING_READ, SD_STREAMING_WRITE)
+    if (cmd != CMD12) stopStream();
+  #endif
+
   #if ENABLED(SDCARD_COMMANDS_SPLIT)
     if (cmd != CMD12) chipDeselect();
   #endif
@@ -286,6 +291,15 @@ bool DiskIODriver_SPI_SD::init(const uint8_t sckRateID, const pin_t chipSelectPi
 
   errorCode_ = type_ = 0;
   chipSelectPin_ = chipSelectPin;
+  #if ENABLED(SD_STREAMING_READ)
+    streaming_ = false;
+    streamBlock_ = 0xFFFFFFFF;
+  #endif
+  #if ENABLED(SD_STREAMING_WRITE)
+    writing_ = false;
+    writeNext_ = 0xFFFFFFFF;
+    eraseStart_ = eraseEnd_ = 0;
+  #endif
 
   // 16-bit init start time allows over a minute
   #if SD_INIT_TIMEOUT
@@ -380,7 +394,7 @@ bool DiskIODriver_SPI_SD::init(const uint8_t sckRateID, const pin_t chipSelectPi
   chipDeselect();
 
   ready = true;
-  return setSckRate(sckRateID);
+  return TERN(SD_SPI_AUTOTUNE, autoTune(sckRateID), setSckRate(sckRateID));
 
   FAIL:
   chipDeselect();
@@ -400,6 +414,25 @@ bool DiskIODriver_SPI_SD::readBlock(uint32_t blockNumber, uint8_t * const dst) {
     return 0 == SDHC_CardReadBlock(dst, blockNumber);
   #endif
 
+  #if ENABLED(SD_STREAMING_READ)
+    /**
+     * The second of two sequential reads starts a CMD18 read that later
+     * sequential reads continue with no command overhead. Another read,
+     * e.g., of the FAT, ends it but leaves the sequence to resume after.
+     */
+    if (blockNumber == streamBlock_) {
+      if (!streaming_) streaming_ = readStart(blockNumber);
+      if (streaming_) {
+        if (readData(dst)) { ++streamBlock_; return true; }
+        stopStream();                         // Try again with a single block read
+      }
+    }
+    else if (streaming_)
+      stopStream();
+    else
+      streamBlock_ = blockNumber + 1;
+  #endif
+
   if (type() != SD_CARD_TYPE_SDHC) blockNumber <<= 9;   // Use address if not SDHC card
 
   #if ENABLED(SD_CHECK_AND_RETRY)
@@ -585,6 +618,71 @@ bool DiskIODriver_SPI_SD::readStop() {
   return success;
 }
 
+#if ANY(SD_STREAMING_READ, SD_STREAMING_WRITE)
+
+  void DiskIODriver_SPI_SD::stopStream() {
+    #if ENABLED(SD_STREAMING_READ)
+      if (streaming_) { streaming_ = false; readStop(); }
+    #endif
+    #if ENABLED(SD_STREAMING_WRITE)
+      if (writing_) { writing_ = false; writeStop(); }
+    #endif
+  }
+
+#endif
+
+#if ENABLED(SD_SPI_AUTOTUNE)
+
+  /**
+   * Read a block at the current SPI rate and get the CRC-16 of its data,
+   * as computed here (so it works even if the card doesn't send a CRC).
+   */
+  bool DiskIODriver_SPI_SD::readBlockCrc(uint32_t blockNumber, uint16_t &crc) {
+    if (type() != SD_CARD_TYPE_SDHC) blockNumber <<= 9;
+    if (cardCommand(CMD17, blockNumber)) { chipDeselect(); return false; }
+
+    const millis_t read_timeout = millis() + (SD_READ_TIMEOUT ? SD_READ_TIMEOUT : 300u); // A bad rate may never send a token
+    while ((status_ = spiRec()) == 0xFF)
+      if (ELAPSED(millis(), read_timeout)) { chipDeselect(); return false; }
+
+    const bool ok = status_ == DATA_START_BLOCK;
+    if (ok) {
+      crc = 0;
+      for (uint16_t i = 0; i < 512; ++i) {
+        crc = (uint8_t)(crc >> 8) | (crc << 8);
+        crc ^= spiRec();
+        crc ^= (uint8_t)(crc & 0xFF) >> 4;
+        crc ^= crc << 12;
+        crc ^= (crc & 0xFF) << 5;
+      }
+      spiRec(); spiRec(); // Skip the card's CRC
+    }
+    chipDeselect();
+    return ok;
+  }
+
+  /**
+   * Settle on the fastest SPI rate, up to sckRateID, that reads block 0
+   * SD_SPI_AUTOTUNE_READS times in a row with the same CRC as a read at
+   * the (slow) init rate. If no faster rate is stable keep the init rate.
+   */
+  bool DiskIODriver_SPI_SD::autoTune(const uint8_t sckRateID) {
+    uint16_t ref, crc;
+    if (!readBlockCrc(0, ref)) return setSckRate(sckRateID); // No reference, so nothing to compare
+
+    for (uint8_t rate = sckRateID; rate < SPI_SD_INIT_RATE; ++rate) {
+      hal.watchdog_refresh();
+      spiRate_ = rate;
+      uint8_t good = 0;
+      while (good < SD_SPI_AUTOTUNE_READS && readBlockCrc(0, crc) && crc == ref) ++good;
+      if (good == SD_SPI_AUTOTUNE_READS) return setSckRate(rate);
+      errorCode_ = 0;
+    }
+    return setSckRate(SPI_SD_INIT_RATE);
+  }
+
+#endif // SD_SPI_AUTOTUNE
+
 /**
  * Set the SPI clock rate.
  *
@@ -630,6 +728,27 @@ bool DiskIODriver_SPI_SD::writeBlock(uint32_t blockNumber, const uint8_t * const
     return 0 == SDHC_CardWriteBlock(src, blockNumber);
   #endif
 
+  #if ENABLED(SD_STREAMING_WRITE)
+    /**
+     * The second of two sequential writes starts a CMD25 write that later
+     * sequential writes continue, so the card programs each block while the
+     * next one arrives. Another write, e.g., of the FAT, ends it but leaves
+     * the sequence to resume after. Blocks noted by eraseHint are pre-erased.
+     */
+    if (blockNumber == writeNext_) {
+      if (!writing_)
+        writing_ = writeStart(blockNumber, WITHIN(blockNumber, eraseStart_, eraseEnd_ - 1) ? eraseEnd_ - blockNumber : 1);
+      if (writing_) {
+        if (writeData(src)) { ++writeNext_; return true; }
+        stopStream();                         // Try again with a single block write
+      }
+    }
+    else if (writing_)
+      stopStream();
+    else
+      writeNext_ = blockNumber + 1;
+  #endif
+
   if (type() != SD_CARD_TYPE_SDHC) blockNumber <<= 9; // Use address if not SDHC card
   bool success = !cardCommand(CMD24, blockNumber);
   if (!success) {
@@ -167,6 +167,13 @@ public:
 
   void idle() override {}
 
+  #if ANY(SD_STREAMING_READ, SD_STREAMING_WRITE)
+    void stopStream() override;
+  #endif
+  #if ENABLED(SD_STREAMING_WRITE)
+    void eraseHint(const uint32_t block, const uint32_t count) override { eraseStart_ = block; eraseEnd_ = block + count; }
+  #endif
+
 private:
   bool ready = false;
   uint8_t chipSelectPin_,
@@ -175,6 +182,16 @@ private:
           status_,
           type_;
 
+  #if ENABLED(SD_STREAMING_READ)
+    bool streaming_ = false;              // A CMD18 read is open
+    uint32_t streamBlock_ = 0xFFFFFFFF;   // Block that continues the sequence
+  #endif
+  #if ENABLED(SD_STREAMING_WRITE)
+    bool writing_ = false;                // A CMD25 write is open
+    uint32_t writeNext_ = 0xFFFFFFFF,     // Block that continues the write sequence
+             eraseStart_ = 0, eraseEnd_ = 0; // Blocks free to pre-erase
+  #endif
+
   // private functions
   inline uint8_t cardAcmd(const uint8_t cmd, const uint32_t arg) {
     cardCommand(CMD55, 0);
@@ -188,5 +205,9 @@ private:
   void chipSelect();
   inline void type(const uint8_t value) { type_ = value; }
   bool waitNotBusy(const millis_t timeout_ms);
+  #if ENABLED(SD_SPI_AUTOTUNE)
+    bool autoTune(const uint8_t sckRateID);
+    bool readBlockCrc(uint32_t blockNumber, uint16_t &crc);
+  #endif
   bool writeData(const uint8_t token, const uint8_t * const src);
 };
@@ -1388,7 +1388,8 @@ int16_t SdBaseFile::read(void * const buf, uint16_t nbyte) {
         // start of new cluster
         if (curPosition_ == 0)
           curCluster_ = firstCluster_;                      // use first cluster in file
-        else if (!vol_->fatGet(curCluster_, &curCluster_))  // get next cluster from FAT
+        else if (!TERN0(SD_EXTENT_CACHE, isFile() && vol_->extentLookup(firstCluster_, curPosition_ >> (vol_->clusterSizeShift_ + 9), &curCluster_))
+          && !vol_->fatGet(curCluster_, &curCluster_))      // get next cluster from the extent list or FAT
           return -1;
       }
       block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
@@ -1905,6 +1906,23 @@ SdBaseFile::SdBaseFile(const char * const path, const uint8_t oflag) {
   open(path, oflag);
 }
 
+#if ENABLED(SD_EXTENT_PREFETCH)
+
+  /**
+   * Add the file's clusters up to cluster n to the volume's extent list,
+   * so reads up to there need no FAT access.
+   *
+   * \return false once the whole file is listed or the list can't grow.
+   */
+  bool SdBaseFile::extentPrefetch(const uint32_t n) {
+    if (!isFile() || !fileSize_) return false;
+    const uint32_t last = (fileSize_ - 1) >> (vol_->clusterSizeShift_ + 9);
+    uint32_t cluster;
+    return vol_->extentLookup(firstCluster_, _MIN(n, last), &cluster) && n < last;
+  }
+
+#endif
+
 /**
  * Sets a file's position.
  *
@@ -1930,6 +1948,13 @@ bool SdBaseFile::seekSet(const uint32_t pos) {
   nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
   nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
 
+  #if ENABLED(SD_EXTENT_CACHE)
+    if (isFile() && vol_->extentLookup(firstCluster_, nNew, &curCluster_)) {
+      curPosition_ = pos;
+      return true;
+    }
+  #endif
+
   if (nNew < nCur || curPosition_ == 0)
     curCluster_ = firstCluster_;      // must follow chain from first cluster
   else
@@ -2197,6 +2222,7 @@ int16_t SdBaseFile::write(const void *buf, const uint16_t nbyte) {
         if (firstCluster_ == 0) {
           // allocate first cluster of file
           if (!addCluster()) goto FAIL;
+          TERN_(SD_STREAMING_WRITE, vol_->sdCard()->eraseHint(vol_->clusterStartBlock(curCluster_), vol_->blocksPerCluster()));
         }
         else {
           curCluster_ = firstCluster_;
@@ -2208,6 +2234,7 @@ int16_t SdBaseFile::write(const void *buf, const uint16_t nbyte) {
         if (vol_->isEOC(next)) {
           // add cluster if at end of chain
           if (!addCluster()) goto FAIL;
+          TERN_(SD_STREAMING_WRITE, vol_->sdCard()->eraseHint(vol_->clusterStartBlock(curCluster_), vol_->blocksPerCluster()));
         }
         else {
           curCluster_ = next;
@@ -327,6 +327,9 @@ class SdBaseFile {
    */
   bool seekEnd(const int32_t offset=0) { return seekSet(fileSize_ + offset); }
   bool seekSet(const uint32_t pos);
+  #if ENABLED(SD_EXTENT_PREFETCH)
+    bool extentPrefetch(const uint32_t n);
+  #endif
   bool sync();
   bool timestamp(SdBaseFile * const file);
   bool timestamp(const uint8_t flag, const uint16_t year, const uint8_t month, const uint8_t day,
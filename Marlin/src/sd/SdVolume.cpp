@@ -194,10 +194,54 @@ bool SdVolume::fatGet(const uint32_t cluster, uint32_t * const value) {
   return true;
 }
 
+#if ENABLED(SD_EXTENT_CACHE)
+
+  /**
+   * Get cluster n of the chain starting at 'first' from the extent list,
+   * following the FAT only to extend the list as far as cluster n.
+   * A seek then costs one pass over a few extents instead of a FAT walk.
+   *
+   * \return false if the list can't answer (full, past the end of the chain,
+   *         or a FAT read error). The caller should then walk the FAT itself.
+   */
+  bool SdVolume::extentLookup(const uint32_t first, uint32_t n, uint32_t * const cluster) {
+    if (first != extentFirst_) {
+      extentFirst_ = first;
+      extentCovered_ = 0;
+      extentCount_ = 0;
+    }
+
+    while (n >= extentCovered_) {
+      uint32_t next = first;
+      if (extentCount_) {
+        extent_t &e = extent_[extentCount_ - 1];
+        if (!fatGet(e.start + e.length - 1, &next) || isEOC(next)) return false;
+        if (next == e.start + e.length && e.length < 0xFFFF) {
+          e.length++;
+          extentCovered_++;
+          continue;
+        }
+      }
+      if (extentCount_ >= COUNT(extent_)) return false;
+      extent_[extentCount_++] = { next, 1 };
+      extentCovered_++;
+    }
+
+    for (uint8_t i = 0; i < extentCount_; ++i) {
+      if (n < extent_[i].length) { *cluster = extent_[i].start + n; return true; }
+      n -= extent_[i].length;
+    }
+    return false;
+  }
+
+#endif // SD_EXTENT_CACHE
+
 // Store a FAT entry
 bool SdVolume::fatPut(const uint32_t cluster, const uint32_t value) {
   if (ENABLED(SDCARD_READONLY)) return false;
 
+  TERN_(SD_EXTENT_CACHE, extentClear()); // Any chain may change
+
   uint32_t lba;
   // error if reserved cluster
   if (cluster < 2) return false;
@@ -336,6 +380,7 @@ bool SdVolume::init(DiskIODriver * const dev, const uint8_t part) {
   cacheDirty_ = 0;  // cacheFlush() will write block if true
   cacheMirrorBlock_ = 0;
   cacheBlockNumber_ = 0xFFFFFFFF;
+  TERN_(SD_EXTENT_CACHE, extentClear());
 
   // if part == 0 assume super floppy with FAT boot sector in block zero
   // if part > 0 assume mbr volume with partition table
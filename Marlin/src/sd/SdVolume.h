@@ -164,6 +164,16 @@ class SdVolume {
   uint16_t rootDirEntryCount_;  // number of entries in FAT16 root dir
   uint32_t rootDirStart_;       // root start block for FAT16, cluster for FAT32
 
+  #if ENABLED(SD_EXTENT_CACHE)
+    // Runs of contiguous clusters in the chain starting at extentFirst_
+    struct extent_t { uint32_t start; uint16_t length; } extent_[SD_EXTENT_CACHE_SIZE];
+    uint32_t extentFirst_;        // first cluster of the cached chain, 0 if none
+    uint32_t extentCovered_;      // number of chain clusters covered by extent_
+    uint8_t extentCount_;         // number of extents in use
+    bool extentLookup(const uint32_t first, uint32_t n, uint32_t * const cluster);
+    void extentClear() { extentFirst_ = 0; }
+  #endif
+
   bool allocContiguous(const uint32_t count, uint32_t * const curCluster);
   uint8_t blockOfCluster(const uint32_t position) const { return (position >> 9) & (blocksPerCluster_ - 1); }
   uint32_t clusterStartBlock(const uint32_t cluster) const { return dataStartBlock_ + ((cluster - 2) << clusterSizeShift_); }
@@ -61,6 +61,18 @@ extern char seekdataflag;
   #include "../feature/pause.h"
 #endif
 
+#if ENABLED(CANCEL_OBJECTS_PRESCAN)
+  #include "../feature/cancel_prescan.h"
+#endif
+
+#if ENABLED(ESTIMATE_REMAINING_TIME)
+  #include "../feature/print_estimator.h"
+#endif
+
+#if ENABLED(SD_EXTENT_PREFETCH)
+  #include "../feature/bg_tasks.h"
+#endif
+
 #define DEBUG_OUT ANY(DEBUG_CARDREADER, MARLIN_DEV_MODE)
 #include "../core/debug_out.h"
 #include "../libs/hex_print.h"
@@ -87,6 +99,9 @@ IF_DISABLED(NO_SD_AUTOSTART, uint8_t CardReader::autofile_index); // = 0
 MediaFile CardReader::root, CardReader::workDir, CardReader::workDirParents[MAX_DIR_DEPTH];
 uint8_t CardReader::workDirDepth;
 int16_t CardReader::nrItems = -1;
+#if ENABLED(SD_DIR_INDEX)
+  uint16_t CardReader::dir_index[SD_DIR_INDEX_SIZE];
+#endif
 
 #if ENABLED(SDCARD_SORT_ALPHA)
 
@@ -103,6 +118,11 @@ int16_t CardReader::nrItems = -1;
     uint8_t CardReader::sort_order[SDSORT_LIMIT];
   #endif
 
+  #if ENABLED(SDSORT_ON_MEDIA)
+    MediaFile CardReader::media_sort_file;
+    int16_t CardReader::media_sort_count; // = 0
+  #endif
+
   #if ENABLED(SDSORT_USES_RAM)
 
     #if ENABLED(SDSORT_CACHE_NAMES)
@@ -149,6 +169,119 @@ MediaFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if ENABLED(SD_READ_AHEAD)
+
+  CardReader::ReadAhead CardReader::ra;
+  uint16_t CardReader::read_ahead_stalls;
+
+  // Put the file back at sdpos and drop the buffered bytes
+  void CardReader::read_ahead_sync() {
+    if (ra.len[0] || ra.len[1]) file.seekSet(sdpos);
+    read_ahead_clear();
+  }
+
+  // Read up to the end of the current block into a buffer. Aligned blocks go straight from the card.
+  bool CardReader::read_ahead_fill(const uint8_t b) {
+    if (!ra.len[0] && !ra.len[1]) sdpos = file.curPosition();   // Something else moved the file
+    const int16_t n = file.read(ra.buf[b], 512 - (file.curPosition() & 0x1FF));
+    if (n <= 0) return false;
+    ra.len[b] = n;
+    return true;
+  }
+
+  int16_t CardReader::get() {
+    if (ra.pos >= ra.len[ra.cur]) {
+      // The current buffer is used up, so move to the other one
+      const uint8_t b = ra.cur ^ 1;
+      if (!ra.len[b]) {
+        if (!read_ahead_fill(b)) return -1;
+        if (ra.len[ra.cur]) ++read_ahead_stalls;                 // idle() didn't get to it in time
+      }
+      ra.len[ra.cur] = 0;
+      ra.cur = b;
+      ra.pos = 0;
+    }
+    ++sdpos;
+    return ra.buf[ra.cur][ra.pos++];
+  }
+
+  /**
+   * Fill the empty buffer while printing, so get_sdcard_commands()
+   * seldom waits on the card. Called from idle().
+   */
+  void CardReader::read_ahead() {
+    if (!isPrinting() || flag.saving || !file.isOpen()) return;
+    const uint8_t b = ra.cur ^ 1;
+    if (!ra.len[b] && file.curPosition() < filesize) read_ahead_fill(b);
+  }
+
+#endif // SD_READ_AHEAD
+
+#if ENABLED(SD_QUIET_WRITES)
+
+  CardReader::deferred_write_t CardReader::deferred[DEFERRED_MAX];
+  uint8_t CardReader::deferred_count; // = 0
+  millis_t CardReader::deferred_since;
+  CardReader::DeferredStats CardReader::deferred_stats;
+
+  /**
+   * Queue a write to run from idle() at a quiet moment. A write that's
+   * already pending absorbs the new one, since it writes the latest data.
+   * Return false if the queue is full so the caller writes right away.
+   */
+  bool CardReader::defer_write(const deferred_write_t fn) {
+    if (!isMounted()) return false;
+    for (uint8_t i = 0; i < deferred_count; ++i)
+      if (deferred[i] == fn) { ++deferred_stats.merged; return true; }
+    if (deferred_count >= DEFERRED_MAX) return false;
+    if (!deferred_count) deferred_since = millis();
+    deferred[deferred_count++] = fn;
+    ++deferred_stats.queued;
+    NOLESS(deferred_stats.max_depth, deferred_count);
+    return true;
+  }
+
+  void CardReader::cancel_write(const deferred_write_t fn) {
+    for (uint8_t i = 0; i < deferred_count; ++i)
+      if (deferred[i] == fn) {
+        for (--deferred_count; i < deferred_count; ++i) deferred[i] = deferred[i + 1];
+        break;
+      }
+  }
+
+  /**
+   * Run pending writes when the card has time to spare: the planner is full
+   * (or idle) and the print file has been read ahead, so a slow write can't
+   * cause an underrun. Never wait longer than SD_QUIET_MAX_WAIT.
+   */
+  void CardReader::run_deferred(const bool force/*=false*/) {
+    if (!deferred_count) return;
+
+    const millis_t waited = millis() - deferred_since;
+    const bool quiet = (planner.is_full() || !planner.has_blocks_queued()) && TERN1(SD_READ_AHEAD, (!isPrinting() || read_ahead_ready()));
+    if (!force && !quiet) {
+      if (waited < SD_QUIET_MAX_WAIT) return;
+      ++deferred_stats.forced;
+    }
+    NOLESS(deferred_stats.max_wait, uint16_t(_MIN(waited, 0xFFFFUL)));
+
+    const uint8_t n = deferred_count;
+    deferred_count = 0;
+    for (uint8_t i = 0; i < n; ++i) deferred[i]();
+  }
+
+  void CardReader::report_deferred() {
+    SERIAL_ECHOLNPGM(
+      "SD deferred writes:", deferred_stats.queued,
+      " merged:", deferred_stats.merged,
+      " forced:", deferred_stats.forced,
+      " pending:", deferred_count, "/", deferred_stats.max_depth,
+      " max wait:", deferred_stats.max_wait, "ms"
+    );
+  }
+
+#endif // SD_QUIET_WRITES
+
 CardReader::CardReader() {
   changeMedia(&
     #if HAS_USB_FLASH_DRIVE && !SHARED_VOLUME_IS(SD_ONBOARD)
@@ -158,6 +291,8 @@ CardReader::CardReader() {
     #endif
   );
 
+  TERN_(SD_NAME_CACHE, name_cache_clear());
+
   #if ENABLED(SDCARD_SORT_ALPHA)
     sort_count = 0;
     #if ENABLED(SDSORT_GCODE)
@@ -232,29 +367,46 @@ bool CardReader::is_visible_entity(const dir_t &p OPTARG(CUSTOM_FIRMWARE_UPLOAD,
 
 //
 // Get the number of (compliant) items in the folder
+// With SD_DIR_INDEX also note where each item starts (only used for workDir)
 //
 int16_t CardReader::countVisibleItems(MediaFile dir) {
   dir_t p;
   int16_t c = 0;
   dir.rewind();
-  while (dir.readDir(&p, longFilename) > 0) c += is_visible_entity(p);
+  #if ENABLED(SD_DIR_INDEX)
+    uint16_t entry = 0;
+    while (dir.readDir(&p, longFilename) > 0) {
+      TERN_(COOPERATIVE_YIELD, idle_yield());
+      if (is_visible_entity(p)) {
+        if (c < SD_DIR_INDEX_SIZE) dir_index[c] = entry;
+        c++;
+      }
+      entry = dir.curPosition() >> 5;
+    }
+  #else
+    while (dir.readDir(&p, longFilename) > 0) {
+      TERN_(COOPERATIVE_YIELD, idle_yield());
+      c += is_visible_entity(p);
+    }
+  #endif
   return c;
 }
 
 //
 // Get file/folder info for an item by index
 //
-void CardReader::selectByIndex(MediaFile dir, const int16_t index) {
+bool CardReader::selectByIndex(MediaFile dir, const int16_t index) {
   dir_t p;
   for (int16_t cnt = 0; dir.readDir(&p, longFilename) > 0;) {
     if (is_visible_entity(p)) {
       if (cnt == index) {
         createFilename(filename, p);
-        return;  // 0 based index
+        return true;  // 0 based index
       }
       cnt++;
     }
   }
+  return false;
 }
 
 //
@@ -293,6 +445,7 @@ void CardReader::printListing(MediaFile parent, const char * const prepend, cons
   UNUSED(lsflags);
   dir_t p;
   while (parent.readDir(&p, longFilename) > 0) {
+    TERN_(COOPERATIVE_YIELD, idle_yield());
     if (DIR_IS_SUBDIR(&p)) {
 
       const size_t lenPrepend = prepend ? strlen(prepend) + 1 : 0;
@@ -447,6 +600,7 @@ void CardReader::printSelectedFilename() {
 void CardReader::mount() {
   flag.mounted = false;
   nrItems = -1;
+  TERN_(SD_NAME_CACHE, name_cache_clear());
   if (root.isOpen()) root.close();
 
   if (!driver->init(SD_SPI_SPEED, SDSS)
@@ -551,6 +705,9 @@ void CardReader::release() {
   flag.mounted = false;
   flag.workDirIsRoot = true;
   nrItems = -1;
+  TERN_(SD_NAME_CACHE, name_cache_clear());
+  TERN_(SDSORT_ON_MEDIA, media_sort_count = 0);
+  TERN_(SD_QUIET_WRITES, deferred_count = 0);
   SERIAL_ECHO_MSG(STR_SD_CARD_RELEASED);
 
   TERN_(NO_SD_DETECT, ui.refresh());
@@ -590,6 +747,7 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(DWIN_CREALITY_LCD, HMI_flag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
   if (isFileOpen()) file.close();
+  TERN_(SD_STREAMING_READ, driver->stopStream());
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -632,7 +790,7 @@ void openFailed(const char * const fname) {
 
 void announceOpen(const uint8_t doing, const char * const path) {
   if (doing) {
-    PORT_REDIRECT(SerialMask::All);
+    PORT_REDIRECT(SERIAL_NOTICE_PORTS);
     SERIAL_ECHO_START();
     SERIAL_ECHOPGM("Now ");
     SERIAL_ECHOF(doing == 1 ? F("doing") : F("fresh"));
@@ -696,9 +854,15 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    #if ENABLED(SD_READ_AHEAD)
+      read_ahead_clear();
+      read_ahead_stalls = 0;
+    #endif
+    TERN_(CANCEL_OBJECTS_PRESCAN, cancel_prescan.start(file));
+    TERN_(ESTIMATE_REMAINING_TIME, print_estimator.reset());
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
-      PORT_REDIRECT(SerialMask::All);
+      PORT_REDIRECT(SERIAL_NOTICE_PORTS);
       SERIAL_ECHOLNPGM(STR_SD_FILE_OPENED, fname, STR_SD_SIZE, filesize);
       SERIAL_ECHOLNPGM(STR_SD_FILE_SELECTED);
     }
@@ -732,6 +896,8 @@ void CardReader::openFileWrite(const char * const path) {
   #if DISABLED(SDCARD_READONLY)
     if (file.open(diveDir, fname, O_CREAT | O_APPEND | O_WRITE | O_TRUNC)) {
       flag.saving = true;
+      nrItems = -1;
+      TERN_(SD_NAME_CACHE, name_cache_clear());
       selectFileByName(fname);
       TERN_(EMERGENCY_PARSER, emergency_parser.disable());
       echo_write_to_file(fname);
@@ -787,6 +953,8 @@ void CardReader::removeFile(const char * const name) {
     if (file.remove(itsDirPtr, fname)) {
       SERIAL_ECHOLNPGM("File deleted:", fname);
       sdpos = 0;
+      nrItems = -1;
+      TERN_(SD_NAME_CACHE, name_cache_clear());
       TERN_(SDCARD_SORT_ALPHA, presort());
     }
     else
@@ -868,6 +1036,7 @@ void CardReader::write_command(char * const buf) {
 void CardReader::closefile(const bool store_location/*=false*/) {
   file.sync();
   file.close();
+  TERN_(SD_STREAMING_WRITE, driver->stopStream()); // Finish the last streamed block
   flag.saving = flag.logging = false;
   sdpos = 0;
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
@@ -891,10 +1060,120 @@ void CardReader::selectFileByIndex(const int16_t nr) {
       return;
     }
   #endif
+  if (TERN0(SD_NAME_CACHE, name_cache_get(nr))) return;
+  #if ENABLED(SD_DIR_INDEX)
+    // Jump straight to the item's first directory entry. The index is built along with nrItems.
+    if (WITHIN(nr, 0, SD_DIR_INDEX_SIZE - 1) && nr < get_num_items()) {
+      dir_t p;
+      if (workDir.seekSet(uint32_t(dir_index[nr]) << 5) && workDir.readDir(&p, longFilename) > 0 && is_visible_entity(p)) {
+        createFilename(filename, p);
+        TERN_(SD_NAME_CACHE, name_cache_put(nr));
+        return;
+      }
+    }
+  #endif
   workDir.rewind();
-  selectByIndex(workDir, nr);
+  #if ENABLED(SD_NAME_CACHE)
+    if (selectByIndex(workDir, nr)) name_cache_put(nr);
+  #else
+    selectByIndex(workDir, nr);
+  #endif
 }
 
+#if ENABLED(SD_NAME_CACHE)
+
+  CardReader::NameCacheEntry CardReader::name_cache[SD_NAME_CACHE_SIZE];
+  uint16_t CardReader::name_cache_tick; // = 0
+
+  void CardReader::name_cache_clear() {
+    for (auto &e : name_cache) e.index = -1;
+  }
+
+  // Fill in the item's names from the cache, if it's there
+  bool CardReader::name_cache_get(const int16_t nr) {
+    const uint32_t dir = workDir.firstCluster();
+    for (auto &e : name_cache) {
+      if (e.index == nr && e.dir == dir) {
+        e.stamp = ++name_cache_tick;
+        strcpy(filename, e.filename);
+        strcpy(longFilename, e.longFilename);
+        flag.filenameIsDir = e.isDir;
+        setBinFlag(e.isBin);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Keep the names of the item just selected, replacing the least recently used
+  void CardReader::name_cache_put(const int16_t nr) {
+    NameCacheEntry *out = &name_cache[0];
+    for (auto &e : name_cache) {
+      if (e.index < 0) { out = &e; break; }
+      if (uint16_t(name_cache_tick - e.stamp) > uint16_t(name_cache_tick - out->stamp)) out = &e;
+    }
+    out->dir = workDir.firstCluster();
+    out->index = nr;
+    out->stamp = ++name_cache_tick;
+    out->isDir = flag.filenameIsDir;
+    out->isBin = fileIsBinary();
+    strcpy(out->filename, filename);
+    strncpy(out->longFilename, longFilename, sizeof(out->longFilename) - 1);
+    out->longFilename[sizeof(out->longFilename) - 1] = '\0';
+  }
+
+  /**
+   * Put the names of listing positions first...first+n-1 (as used by
+   * selectFileByIndexSorted) into the name cache. Items not cached yet are
+   * read in one pass over the folder, starting at the first indexed entry
+   * when SD_DIR_INDEX has one. Leaves the last item read selected.
+   */
+  void CardReader::prefetchSorted(const int16_t first, uint8_t n) {
+    const int16_t cnt = get_num_items();
+    if (first < 0 || first >= cnt) return;
+    NOMORE(n, SD_NAME_CACHE_SIZE);
+    NOMORE(n, cnt - first);
+
+    // The folder items behind each listing position that aren't cached yet
+    const uint32_t dir = workDir.firstCluster();
+    int16_t want[SD_NAME_CACHE_SIZE], lo = cnt, hi = -1;
+    uint8_t w = 0;
+    for (int16_t nr = first; nr < first + n; nr++) {
+      #if ENABLED(SDCARD_SORT_ALPHA)
+        if (TERN0(SDSORT_ON_MEDIA, nr < media_sort_count)) continue;  // Selected through the saved order
+        const int16_t item = SortFlag(TERN1(SDSORT_GCODE, sort_alpha != AS_OFF)) && (nr < sort_count) ? sort_order[nr] : nr;
+      #else
+        const int16_t item = TERN(SDCARD_RATHERRECENTFIRST, cnt - 1 - nr, nr);
+      #endif
+      bool cached = false;
+      for (auto &e : name_cache) if (e.index == item && e.dir == dir) { cached = true; break; }
+      if (cached) continue;
+      want[w++] = item;
+      NOMORE(lo, item);
+      NOLESS(hi, item);
+    }
+    if (!w) return;
+
+    MediaFile d = workDir;
+    int16_t item = 0;
+    #if ENABLED(SD_DIR_INDEX)
+      item = _MIN(lo, int16_t(SD_DIR_INDEX_SIZE - 1));
+      if (!d.seekSet(uint32_t(dir_index[item]) << 5)) return;
+    #else
+      d.rewind();
+    #endif
+
+    dir_t p;
+    while (item <= hi && d.readDir(&p, longFilename) > 0) {
+      if (!is_visible_entity(p)) continue;
+      for (uint8_t i = 0; i < w; i++)
+        if (want[i] == item) { createFilename(filename, p); name_cache_put(item); break; }
+      item++;
+    }
+  }
+
+#endif // SD_NAME_CACHE
+
 //
 // Get info for a file in the working directory by DOS name
 //
@@ -1055,6 +1334,7 @@ void CardReader::cdroot() {
    * Get the name of a file in the working directory by sort-index
    */
   void CardReader::selectFileByIndexSorted(const int16_t nr) {
+    if (TERN0(SDSORT_ON_MEDIA, nr < media_sort_count && media_sort_select(nr))) return;
     selectFileByIndex(SortFlag(TERN1(SDSORT_GCODE, sort_alpha != AS_OFF)) && (nr < sort_count) ? sort_order[nr] : nr);
   }
 
@@ -1104,6 +1384,9 @@ void CardReader::cdroot() {
     // Sorting may be turned off
     if (TERN0(SDSORT_GCODE, sort_alpha == AS_OFF)) return;
 
+    // Folders too big to sort in RAM are sorted in batches, keeping the order on the media
+    if (TERN0(SDSORT_ON_MEDIA, fileCnt > int16_t(SDSORT_LIMIT) && media_presort(fileCnt))) return;
+
     // If there are files, sort up to the limit
     if (fileCnt > 0) {
 
@@ -1150,6 +1433,7 @@ void CardReader::cdroot() {
 
         // Init sort order.
         for (int16_t i = 0; i < fileCnt; i++) {
+          TERN_(COOPERATIVE_YIELD, idle_yield());
           sort_order[i] = i;
           // If using RAM then read all filenames now.
           #if ENABLED(SDSORT_USES_RAM)
@@ -1265,6 +1549,10 @@ void CardReader::cdroot() {
   }
 
   void CardReader::flush_presort() {
+    #if ENABLED(SDSORT_ON_MEDIA)
+      media_sort_count = 0;
+      if (media_sort_file.isOpen()) media_sort_file.close();
+    #endif
     if (sort_count > 0) {
       #if ENABLED(SDSORT_DYNAMIC_RAM)
         delete [] sort_order;
@@ -1281,6 +1569,150 @@ void CardReader::cdroot() {
     }
   }
 
+  #if ENABLED(SDSORT_ON_MEDIA)
+
+    #define SDSORT_MEDIA_FILE "SORTIDX.DAT"
+    #define SDSORT_MEDIA_MAGIC 0x5853                   // "SX"
+    #define SDSORT_MEDIA_KEYLEN ((SDSORT_CACHE_VFATS) * (FILENAME_LENGTH))
+
+    // Saved ahead of the sorted entry numbers. No padding on any platform.
+    struct media_sort_header_t {
+      uint32_t signature;   // Hash of the visible items and their positions
+      uint16_t magic;
+      uint16_t count;
+      uint8_t flags;        // Sort settings used
+      uint8_t reserved;
+    };
+
+    /**
+     * Sort the working directory in a fixed stack buffer of SDSORT_MEDIA_BATCH names.
+     * Each pass over the folder keeps the next smallest batch of items after the last
+     * one written, so RAM use doesn't depend on the folder size. The order is saved as
+     * 16-bit directory entry numbers in SDSORT_MEDIA_FILE, so selecting a sorted item
+     * is one seek, and the saved order is reused as long as the folder is unchanged.
+     *
+     * Return false to fall back to the RAM-limited sort.
+     */
+    bool CardReader::media_presort(const int16_t fileCnt) {
+      const int8_t folders = TERN(HAS_FOLDER_SORTING, TERN(SDSORT_GCODE, sort_folders, SDSORT_FOLDERS), 0);
+      const bool rev = TERN(SDSORT_GCODE, sort_alpha == AS_REV, ENABLED(SDSORT_REVERSE));
+
+      // Create the file first so its directory entry can't shift the items signed below
+      #if ENABLED(SDCARD_READONLY)
+        if (!media_sort_file.open(&workDir, SDSORT_MEDIA_FILE, O_READ)) return false;
+      #else
+        if (!media_sort_file.open(&workDir, SDSORT_MEDIA_FILE, O_CREAT | O_RDWR)) return false;
+        if (media_sort_file.fileSize() == 0) nrItems = -1; // New entry may sit in an indexed slot
+      #endif
+
+      media_sort_header_t head = { 0x811C9DC5UL, SDSORT_MEDIA_MAGIC, uint16_t(fileCnt), uint8_t((rev ? 0x10 : 0x00) | (folders & 0x0F)), 0 };
+      auto hash = [&head](const uint8_t b) { head.signature = (head.signature ^ b) * 0x01000193UL; };
+
+      // One quick pass to sign the folder contents
+      dir_t p;
+      workDir.rewind();
+      for (uint16_t entry = 0; workDir.readDir(&p, longFilename) > 0; entry = workDir.curPosition() >> 5) {
+        TERN_(COOPERATIVE_YIELD, idle_yield());
+        if (!is_visible_entity(p)) continue;
+        createFilename(filename, p);
+        hash(entry & 0xFF); hash(entry >> 8);
+        for (const char *c = longest_filename(); *c; ++c) hash(*c);
+      }
+
+      // Reuse the saved order if it was made for this exact folder and these settings
+      media_sort_header_t saved;
+      if (media_sort_file.read(&saved, sizeof(saved)) == int16_t(sizeof(saved))
+        && !memcmp(&saved, &head, sizeof(head))
+        && media_sort_file.fileSize() == sizeof(head) + 2UL * fileCnt
+      ) {
+        media_sort_count = fileCnt;
+        return true;
+      }
+
+      #if ENABLED(SDCARD_READONLY)
+
+        media_sort_file.close();
+        return false;
+
+      #else
+
+        struct MediaSortKey { uint16_t entry; bool isDir; char name[SDSORT_MEDIA_KEYLEN + 1]; };
+
+        // True if 'a' sorts before 'b'. The entry number breaks ties so no two keys are equal.
+        auto before = [folders, rev](const MediaSortKey &a, const MediaSortKey &b) -> bool {
+          if (folders && a.isDir != b.isDir) return folders < 0 ? a.isDir : b.isDir;
+          const int c = strcasecmp(a.name, b.name);
+          if (c) return rev ? c > 0 : c < 0;
+          return a.entry < b.entry;
+        };
+
+        // Start with a blank header so an interrupted sort is never trusted
+        const media_sort_header_t blank = { 0, 0, 0, 0, 0 };
+        bool ok = media_sort_file.truncate(0) && media_sort_file.write(&blank, sizeof(blank)) == int16_t(sizeof(blank));
+
+        MediaSortKey batch[SDSORT_MEDIA_BATCH], key, last;
+        int16_t done = 0;
+        while (ok && done < fileCnt) {
+          TERN(COOPERATIVE_YIELD, idle_yield(), hal.watchdog_refresh());
+
+          // Collect the smallest items that come after 'last'
+          uint8_t k = 0;
+          workDir.rewind();
+          for (uint16_t entry = 0; workDir.readDir(&p, longFilename) > 0; entry = workDir.curPosition() >> 5) {
+            TERN_(COOPERATIVE_YIELD, idle_yield());
+            if (!is_visible_entity(p)) continue;
+            createFilename(filename, p);
+            key.entry = entry;
+            key.isDir = flag.filenameIsDir;
+            strncpy(key.name, longest_filename(), SDSORT_MEDIA_KEYLEN);
+            key.name[SDSORT_MEDIA_KEYLEN] = '\0';
+
+            if (done && !before(last, key)) continue;                          // Already written
+            if (k == SDSORT_MEDIA_BATCH && !before(key, batch[k - 1])) continue; // Not in this batch
+
+            // Insert in order, dropping the largest if the batch is full
+            uint8_t i = k < SDSORT_MEDIA_BATCH ? k++ : k - 1;
+            for (; i && before(key, batch[i - 1]); --i) batch[i] = batch[i - 1];
+            batch[i] = key;
+          }
+
+          if (!k) break; // Folder changed under us
+          for (uint8_t i = 0; ok && i < k; ++i)
+            ok = media_sort_file.write(&batch[i].entry, 2) == 2;
+          last = batch[k - 1];
+          done += k;
+        }
+
+        ok = ok && done == fileCnt && media_sort_file.seekSet(0) && media_sort_file.write(&head, sizeof(head)) == int16_t(sizeof(head));
+        media_sort_file.close();
+        if (ok) ok = media_sort_file.open(&workDir, SDSORT_MEDIA_FILE, O_READ);
+        if (ok) media_sort_count = fileCnt;
+        return ok;
+
+      #endif
+    }
+
+    /**
+     * Select the sorted item 'nr' using its saved directory entry number.
+     * Return false if the entry no longer holds a visible item.
+     */
+    bool CardReader::media_sort_select(const int16_t nr) {
+      uint16_t entry;
+      dir_t p;
+      if (media_sort_file.seekSet(sizeof(media_sort_header_t) + 2UL * nr)
+        && media_sort_file.read(&entry, 2) == 2
+        && workDir.seekSet(uint32_t(entry) << 5)
+        && workDir.readDir(&p, longFilename) > 0
+        && is_visible_entity(p)
+      ) {
+        createFilename(filename, p);
+        return true;
+      }
+      return false;
+    }
+
+  #endif // SDSORT_ON_MEDIA
+
 #endif // SDCARD_SORT_ALPHA
 
 int16_t CardReader::get_num_items() {
@@ -1310,6 +1742,29 @@ void CardReader::fileHasFinished() {
   marlin_state = MF_SD_COMPLETE;  // Tell Marlin to enqueue M1001 soon
 }
 
+#if ENABLED(SD_EXTENT_PREFETCH)
+
+  uint32_t CardReader::extent_prefetch_n;
+
+  /**
+   * List the runs of the print file from idle time, so that reads during
+   * the print follow the list instead of the FAT. Called at job start,
+   * when the job is usually heating up.
+   */
+  void CardReader::prefetchExtents() {
+    extent_prefetch_n = 0;
+    bg_tasks.add(extent_prefetch_step);
+  }
+
+  // List the next few clusters. Done at the end of the file or of the list.
+  bool CardReader::extent_prefetch_step() {
+    if (!isFileOpen()) return true;
+    extent_prefetch_n += 16;
+    return !file.extentPrefetch(extent_prefetch_n);
+  }
+
+#endif
+
 #if ENABLED(AUTO_REPORT_SD_STATUS)
   AutoReporter<CardReader::AutoReportSD> CardReader::auto_reporter;
 #endif
@@ -1327,10 +1782,22 @@ void CardReader::fileHasFinished() {
     if (recovery.file.isOpen()) return;
     if (!recovery.file.open(&root, recovery.filename, read ? O_READ : O_CREAT | O_WRITE | O_TRUNC | O_SYNC))
       openFailed(recovery.filename);
-    else if (!read)
+    else if (!read) {
+      nrItems = -1;
       echo_write_to_file(recovery.filename);
+    }
   }
 
+  #if ENABLED(POWER_LOSS_JOURNAL)
+
+    // Open the power-loss journal and return its first block. Return 0 on failure.
+    uint32_t CardReader::openJournal(const uint8_t blocks) {
+      if (recovery.file.isOpen()) recovery.file.close();
+      return openContiguous(recovery.filename, blocks, 0x00);
+    }
+
+  #endif
+
   // Removing the job recovery file currently requires closing
   // the file being printed, so during SD printing the file should
   // be zeroed and written instead of deleted.
@@ -1347,4 +1814,58 @@ void CardReader::fileHasFinished() {
 
 #endif // POWER_LOSS_RECOVERY
 
+#if HAS_RAW_BLOCK_FILE
+
+  /**
+   * Open a contiguous file of 'blocks' blocks and return its first block.
+   * Any other file by that name is replaced by a new one with every byte
+   * set to 'fill'. Return 0 on failure.
+   */
+  uint32_t CardReader::openContiguous(const char * const name, const uint16_t blocks, const uint8_t fill) {
+    if (!isMounted()) return 0;
+    MediaFile f;
+
+    const uint32_t size = uint32_t(blocks) * 512;
+    uint32_t bgn = 0, end;
+    if (f.open(&root, name, O_READ)) {
+      if (f.fileSize() != size || !f.contiguousRange(&bgn, &end)) bgn = 0;
+      f.close();
+      if (bgn) return bgn;
+      MediaFile::remove(&root, name);
+    }
+
+    if (!f.createContiguous(&root, name, size) || !f.contiguousRange(&bgn, &end)) bgn = 0;
+    f.close();
+    if (!bgn) { openFailed(name); return 0; }
+    nrItems = -1;
+
+    // Clear anything left in these blocks by deleted files
+    uint8_t * const buf = rawBuffer();
+    if (!buf) return 0;
+    memset(buf, fill, 512);
+    for (uint16_t b = 0; b < blocks; ++b)
+      if (!rawWrite(bgn + b, buf)) return 0;
+
+    return bgn;
+  }
+
+  // Borrow the volume cache as the block buffer. It's flushed and released first.
+  uint8_t* CardReader::rawBuffer() {
+    cache_t * const c = volume.cacheClear();
+    return c ? c->data : nullptr;
+  }
+
+  // Read a raw block into the buffer
+  uint8_t* CardReader::rawRead(const uint32_t block) {
+    uint8_t * const buf = rawBuffer();
+    return buf && driver->readBlock(block, buf) ? buf : nullptr;
+  }
+
+  // Write the buffer to a raw block
+  bool CardReader::rawWrite(const uint32_t block, const uint8_t * const buf) {
+    return driver->writeBlock(block, buf);
+  }
+
+#endif // HAS_RAW_BLOCK_FILE
+
 #endif // HAS_MEDIA
@@ -153,6 +153,9 @@ public:
   // Select a file
   static void selectFileByIndex(const int16_t nr);
   static void selectFileByName(const char * const match);  // (working directory only)
+  #if ENABLED(SD_NAME_CACHE)
+    static void prefetchSorted(const int16_t first, uint8_t n); // Cache a page of the listing in one pass
+  #endif
 
   // Print job
   static void report_status();
@@ -163,8 +166,11 @@ public:
   static void endFilePrintNow(TERN_(SD_RESORT, const bool re_sort=false));
   static void abortFilePrintNow(TERN_(SD_RESORT, const bool re_sort=false));
   static void fileHasFinished();
+  #if ENABLED(SD_EXTENT_PREFETCH)
+    static void prefetchExtents();
+  #endif
   static void abortFilePrintSoon() { flag.abort_sd_printing = isFileOpen(); }
-  static void pauseSDPrint()       { flag.sdprinting = false; }
+  static void pauseSDPrint()       { flag.sdprinting = false; TERN_(SD_STREAMING_READ, driver->stopStream()); }
   static bool isPrinting()         { return flag.sdprinting; }
   static bool isPaused()           { return isFileOpen() && !isPrinting(); }
   #if HAS_PRINT_PROGRESS_PERMYRIAD
@@ -208,10 +214,30 @@ public:
 
   static void ls(const uint8_t lsflags=0);
 
+  #if ENABLED(SD_QUIET_WRITES)
+    // Low-priority writes held for a quiet moment so they don't starve the planner
+    typedef void (*deferred_write_t)();
+    static bool defer_write(const deferred_write_t fn);
+    static void cancel_write(const deferred_write_t fn);
+    static void run_deferred(const bool force=false);
+    static void report_deferred();
+  #endif
+
   #if ENABLED(POWER_LOSS_RECOVERY)
     static bool jobRecoverFileExists();
     static void openJobRecoveryFile(const bool read);
     static void removeJobRecoveryFile();
+    #if ENABLED(POWER_LOSS_JOURNAL)
+      static uint32_t openJournal(const uint8_t blocks);
+    #endif
+  #endif
+
+  #if HAS_RAW_BLOCK_FILE
+    // Contiguous files accessed by raw block I/O
+    static uint32_t openContiguous(const char * const name, const uint16_t blocks, const uint8_t fill);
+    static uint8_t* rawBuffer();
+    static uint8_t* rawRead(const uint32_t block);
+    static bool rawWrite(const uint32_t block, const uint8_t * const buf);
   #endif
 
   // Binary flag for the current file
@@ -229,10 +255,19 @@ public:
   static bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
-  static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  #if ENABLED(SD_READ_AHEAD)
+    static int16_t get();
+    static int16_t read(void *buf, uint16_t nbyte)  { if (!file.isOpen()) return -1; read_ahead_sync(); return file.read(buf, nbyte); }
+    static void setIndex(const uint32_t index)      { read_ahead_clear(); file.seekSet((sdpos = index)); }
+    static void read_ahead();
+    static uint16_t read_ahead_stalls;              // Times get() had to wait for a block
+    static bool read_ahead_ready()                  { return ra.len[ra.cur ^ 1] || file.curPosition() >= filesize; }
+  #else
+    static int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+    static int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #endif
   static int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -263,6 +298,39 @@ private:
   static uint8_t workDirDepth;
   static int16_t nrItems; // Cache the total count
 
+  #if ENABLED(SD_NAME_CACHE)
+    // Names of recently selected items, keyed by folder and item index
+    struct NameCacheEntry {
+      uint32_t dir;       // First cluster of the folder
+      int16_t index;      // Item index in the folder, -1 if unused
+      uint16_t stamp;     // Last use, for LRU replacement
+      bool isDir, isBin;
+      char filename[FILENAME_LENGTH], longFilename[LONG_FILENAME_LENGTH];
+    };
+    static NameCacheEntry name_cache[SD_NAME_CACHE_SIZE];
+    static uint16_t name_cache_tick;
+    static void name_cache_clear();
+    static bool name_cache_get(const int16_t nr);
+    static void name_cache_put(const int16_t nr);
+  #endif
+
+  #if ENABLED(SD_QUIET_WRITES)
+    static constexpr uint8_t DEFERRED_MAX = 4;
+    static deferred_write_t deferred[DEFERRED_MAX];
+    static uint8_t deferred_count;
+    static millis_t deferred_since;   // When the oldest pending write was queued
+    static struct DeferredStats {
+      uint16_t queued,    // Writes deferred
+               merged,    // Writes that joined one already pending
+               forced,    // Writes run at SD_QUIET_MAX_WAIT without a quiet moment
+               max_wait;  // Longest wait in ms
+      uint8_t max_depth;  // Most writes pending at once
+    } deferred_stats;
+  #endif
+  #if ENABLED(SD_DIR_INDEX)
+    static uint16_t dir_index[SD_DIR_INDEX_SIZE]; // First dir entry of each item, valid while nrItems >= 0
+  #endif
+
   //
   // Alphabetical file and folder sorting
   //
@@ -281,6 +349,13 @@ private:
       static uint8_t sort_order[SDSORT_LIMIT];
     #endif
 
+    #if ENABLED(SDSORT_ON_MEDIA)
+      static MediaFile media_sort_file; // Sorted entry numbers for workDir, open while in use
+      static int16_t media_sort_count;  // Items in media_sort_file, 0 when not in use
+      static bool media_presort(const int16_t fileCnt);
+      static bool media_sort_select(const int16_t nr);
+    #endif
+
     #if ALL(SDSORT_USES_RAM, SDSORT_CACHE_NAMES) && DISABLED(SDSORT_DYNAMIC_RAM)
       #define SORTED_LONGNAME_MAXLEN (SDSORT_CACHE_VFATS) * (FILENAME_LENGTH)
       #define SORTED_LONGNAME_STORAGE (SORTED_LONGNAME_MAXLEN + 1)
@@ -322,9 +397,31 @@ private:
   static MarlinVolume volume;
   static MediaFile file;
 
+  #if ENABLED(SD_EXTENT_PREFETCH)
+    static uint32_t extent_prefetch_n;
+    static bool extent_prefetch_step();
+  #endif
+
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  #if ENABLED(SD_READ_AHEAD)
+    /**
+     * Two block buffers for the print file. get() takes bytes from one while
+     * read_ahead() fills the other from idle(). The file position is sdpos
+     * plus the bytes not yet taken from the buffers.
+     */
+    static struct ReadAhead {
+      uint8_t buf[2][512];
+      uint16_t len[2],      // Bytes in each buffer. 0 for an empty buffer.
+               pos;         // Next byte in the current buffer
+      uint8_t cur;          // The buffer get() takes bytes from
+    } ra;
+    static void read_ahead_clear() { ra.len[0] = ra.len[1] = ra.pos = ra.cur = 0; }
+    static void read_ahead_sync();
+    static bool read_ahead_fill(const uint8_t b);
+  #endif
+
   //
   // Procedure calls to other files
   //
@@ -339,7 +436,7 @@ private:
   //
   static bool is_visible_entity(const dir_t &p OPTARG(CUSTOM_FIRMWARE_UPLOAD, const bool onlyBin=false));
   static int16_t countVisibleItems(MediaFile dir);
-  static void selectByIndex(MediaFile dir, const int16_t index);
+  static bool selectByIndex(MediaFile dir, const int16_t index);
   static void selectByName(MediaFile dir, const char * const match);
   static void printListing(
     MediaFile parent, const char * const prepend, const uint8_t lsflags
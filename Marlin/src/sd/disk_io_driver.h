@@ -65,4 +65,16 @@ public:
   virtual bool isReady() = 0;
 
   virtual void idle() = 0;
+
+  /**
+   * End a multiple block read or write left open by readBlock or writeBlock, if any.
+   * For drivers that stream reads or writes. Others have nothing to do.
+   */
+  virtual void stopStream() {}
+
+  /**
+   * Note blocks whose old contents are unwanted, e.g., a newly allocated cluster,
+   * so a streaming write starting among them can have the card pre-erase the rest.
+   */
+  virtual void eraseHint(const uint32_t, const uint32_t) {}
 };
@@ -272,6 +272,11 @@ bool DiskIODriver_USBFlash::isReady() {
 bool DiskIODriver_USBFlash::init(const uint8_t, const pin_t) {
   if (!isInserted()) return false;
 
+  #ifdef USB_READ_AHEAD_BLOCKS
+    ahead_count = 0;
+    next_block = 0xFFFFFFFF;
+  #endif
+
   #if USB_DEBUG >= 1
     const uint32_t sectorSize = bulk.GetSectorSize(0);
     if (sectorSize != 512) {
@@ -308,6 +313,31 @@ bool DiskIODriver_USBFlash::readBlock(uint32_t block, uint8_t *dst) {
       SERIAL_ECHOLNPGM("Read block ", block);
     #endif
   #endif
+
+  #ifdef USB_READ_AHEAD_BLOCKS
+    /**
+     * The second of two sequential reads fetches USB_READ_AHEAD_BLOCKS in one
+     * transfer, and the reads that follow are copied from RAM.
+     */
+    if (block - ahead_block < ahead_count) {
+      memcpy(dst, ahead_buf[block - ahead_block], 512);
+      next_block = block + 1;
+      return true;
+    }
+    if (block == next_block) {
+      next_block = block + 1;
+      if (bulk.Read(0, block, 512, USB_READ_AHEAD_BLOCKS, ahead_buf[0]) == 0) {
+        ahead_block = block;
+        ahead_count = USB_READ_AHEAD_BLOCKS;
+        memcpy(dst, ahead_buf[0], 512);
+        return true;
+      }
+      ahead_count = 0;                      // e.g., at the end of the drive. Read the one block.
+    }
+    else
+      next_block = block + 1;
+  #endif
+
   return bulk.Read(0, block, 512, 1, dst) == 0;
 }
 
@@ -322,6 +352,9 @@ bool DiskIODriver_USBFlash::writeBlock(uint32_t block, const uint8_t *src) {
       SERIAL_ECHOLNPGM("Write block ", block);
     #endif
   #endif
+  #ifdef USB_READ_AHEAD_BLOCKS
+    if (block - ahead_block < ahead_count) ahead_count = 0;
+  #endif
   return bulk.Write(0, block, 512, 1, src) == 0;
 }
 
@@ -51,6 +51,13 @@ class DiskIODriver_USBFlash : public DiskIODriver {
   private:
     uint32_t pos;
 
+    #ifdef USB_READ_AHEAD_BLOCKS
+      uint32_t ahead_block = 0,             // The first block in ahead_buf
+               next_block = 0xFFFFFFFF;     // The block that continues the sequence
+      uint8_t ahead_count = 0;              // Valid blocks in ahead_buf
+      uint8_t ahead_buf[USB_READ_AHEAD_BLOCKS][512];
+    #endif
+
     static void usbStateDebug();
 
   public:
@@ -30,13 +30,236 @@
 #include "../module/settings.h"
 #include "../module/stepper.h"
 #include "../module/temperature.h"
+#include "../libs/decimal.h"
+#include "../gcode/parser.h"
+#include "marlin_tests.h"
+
+#if HAS_MESH
+  #include "../feature/bedlevel/bedlevel.h"
+#endif
+
+#if ENABLED(PLANNER_BENCHMARK)
+  #include "planner_benchmark.h"
+#endif
 
 // Individual tests are localized in each module.
 // Each test produces its own report.
 
+// Timing budgets catch slowdowns from changes or upstream merges
+bool test_timing(FSTR_P const name, const uint32_t us, const uint32_t calls, const uint32_t budget_us) {
+  const uint32_t per_call = calls ? us / calls : 0;
+  const bool ok = per_call <= budget_us;
+  if (!ok) SERIAL_ECHOPGM("FAIL ");
+  SERIAL_ECHOF(name);
+  SERIAL_ECHOLNPGM(" time: ", per_call, "us per call, budget ", budget_us, "us");
+  return ok;
+}
+
+// Compare the G-code number scanner with strtod
+static void test_decimal_scanner() {
+  static const char edge_cases[] PROGMEM =
+    "0\0" "-0\0" "+1\0" "1.\0" ".5\0" "-.5\0" "12.345\0" "-0.001\0" "0.00001234\0" "200.000001\0"
+    "4294967295\0" "99999999999\0" "3.14159265358979\0" "-123456.789\0" "  42\0" ".\0" "-\0" "X\0";
+
+  uint16_t cases = 0, fails = 0;
+  char buf[24];
+
+  auto check = [&]{
+    char *end_a, *end_b;
+    const float a = decimal_to_float(buf, &end_a), b = strtod(buf, &end_b);
+    const int32_t fa = decimal_to_fixed(buf, 3), fb = LROUND(b * 1000.0f);  // Float reference, exact enough below 8000
+    ++cases;
+    if (end_a != end_b || ABS(a - b) > ABS(b) * 1.2e-7f || (ABS(b) < 8000.0f && ABS(fa - fb) > 1)) {
+      ++fails;
+      SERIAL_ECHOPGM("FAIL \"", buf, "\" scan:");
+      SERIAL_PRINT(a, 6);
+      SERIAL_ECHOPGM(" strtod:");
+      SERIAL_PRINT(b, 6);
+      SERIAL_ECHOLNPGM(" fixed:", fa, "/", fb);
+    }
+  };
+
+  for (PGM_P p = edge_cases; pgm_read_byte(p); p += strlen_P(p) + 1) {
+    strcpy_P(buf, p);
+    check();
+  }
+
+  // Random values with up to 9 digits and 0-6 decimals
+  uint32_t seed = 1;
+  for (uint16_t i = 0; i < 500; ++i) {
+    seed = seed * 1103515245UL + 12345UL;
+    const uint32_t m = (seed >> 3) % 1000000000UL;
+    seed = seed * 1103515245UL + 12345UL;
+    const uint8_t places = (seed >> 16) % 7;
+    char digits[11];
+    const int n = sprintf_P(digits, PSTR("%0*lu"), places + 1, (unsigned long)m);
+    char *b = buf;
+    if (seed & 0x8000) *b++ = '-';
+    for (int d = 0; d < n; ++d) {
+      if (places && d == n - places) *b++ = '.';
+      *b++ = digits[d];
+    }
+    *b = '\0';
+    check();
+  }
+
+  // Exponents are not numbers in G-code, where 'E' is a parameter
+  char *end;
+  const float e = decimal_to_float("1.5E3", &end);
+  ++cases;
+  if (e != 1.5f || *end != 'E') { ++fails; SERIAL_ECHOLNPGM("FAIL \"1.5E3\""); }
+
+  SERIAL_ECHOLNPGM("Decimal scanner: ", cases - fails, "/", cases, " match strtod");
+}
+
+// Parse G-code lines and check the command and parameter values
+static void test_parser() {
+  static const char lines[] PROGMEM =
+    "G1 X10.5 Y-3 Z.25 E-1.5 F3000\0" "M104 S215 T0\0" "G2 X0 Y20 I-5.125 J0.5\0" "M117 Hello World\0";
+  constexpr uint16_t repeat = 50;
+
+  uint16_t cases = 0, fails = 0, calls = 0;
+  uint32_t us = 0;
+  char buf[MAX_CMD_SIZE];
+
+  auto expect = [&](const bool ok, PGM_P const what) {
+    ++cases;
+    if (!ok) { ++fails; SERIAL_ECHOPGM("FAIL \"", parser.command_ptr, "\" "); SERIAL_ECHOLNPGM_P(what); }
+  };
+  auto param = [](const char c, const float v) { return parser.seenval(c) && ABS(parser.value_float() - v) < 0.0001f; };
+
+  uint8_t n = 0;
+  for (PGM_P p = lines; pgm_read_byte(p); p += strlen_P(p) + 1, ++n) {
+    for (uint16_t i = 0; i < repeat; ++i) {
+      strcpy_P(buf, p);
+      const uint32_t start_us = micros();
+      parser.parse(buf);
+      us += micros() - start_us;
+      ++calls;
+    }
+    switch (n) {
+      case 0:
+        expect(parser.command_letter == 'G' && parser.codenum == 1, PSTR("G1"));
+        expect(param('X', 10.5f) && param('Y', -3) && param('Z', 0.25f), PSTR("XYZ"));
+        expect(param('E', -1.5f) && param('F', 3000), PSTR("EF"));
+        break;
+      case 1:
+        expect(parser.command_letter == 'M' && parser.codenum == 104, PSTR("M104"));
+        expect(param('S', 215) && param('T', 0) && !parser.seen('X'), PSTR("ST"));
+        break;
+      case 2:
+        expect(parser.command_letter == 'G' && parser.codenum == 2, PSTR("G2"));
+        expect(param('X', 0) && param('Y', 20) && param('I', -5.125f) && param('J', 0.5f), PSTR("XYIJ"));
+        break;
+      case 3:
+        expect(parser.command_letter == 'M' && parser.codenum == 117, PSTR("M117"));
+        expect(parser.string_arg && !strcmp_P(parser.string_arg, PSTR("Hello World")), PSTR("string"));
+        break;
+    }
+  }
+
+  SERIAL_ECHOLNPGM("G-code parser: ", cases - fails, "/", cases, " checks passed");
+  test_timing(F("G-code parser"), us, calls, TERN(__AVR__, 400, 40));
+}
+
+#if HAS_HOTEND && TEMP_SENSOR_0_IS_THERMISTOR
+
+  // Convert the whole ADC range: the temperature must be monotonic
+  static void test_thermistor() {
+    const celsius_float_t first = thermalManager.analog_to_celsius_hotend(0, 0),
+                          last = thermalManager.analog_to_celsius_hotend(MAX_RAW_THERMISTOR_VALUE, 0);
+    const bool rising = last > first;
+
+    uint16_t calls = 0, fails = 0;
+    uint32_t us = 0;
+    celsius_float_t prev = first;
+    for (uint32_t raw = 0; raw <= MAX_RAW_THERMISTOR_VALUE; raw += 8) {
+      const uint32_t start_us = micros();
+      const celsius_float_t t = thermalManager.analog_to_celsius_hotend(raw, 0);
+      us += micros() - start_us;
+      ++calls;
+      if (rising ? t < prev : t > prev) {
+        ++fails;
+        SERIAL_ECHOPGM("FAIL raw:", raw, " temp:");
+        SERIAL_PRINT(t, 2);
+        SERIAL_ECHOPGM(" previous:");
+        SERIAL_PRINT(prev, 2);
+        SERIAL_EOL();
+      }
+      prev = t;
+    }
+
+    SERIAL_ECHOLNPGM("Thermistor 0: ", calls - fails, "/", calls, " monotonic");
+    test_timing(F("Thermistor conversion"), us, calls, TERN(__AVR__, 150, 15));
+  }
+
+#endif
+
+#if ANY(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING)
+
+  // Interpolate a tilted plane, which the mesh must reproduce exactly
+  static void test_mesh_interpolation() {
+    bed_mesh_t saved_z;
+    COPY(saved_z, bedlevel.z_values);
+    #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+      const bool had_mesh = bedlevel.has_mesh();
+      const xy_pos_t saved_spacing = bedlevel.grid_spacing, saved_start = bedlevel.grid_start;
+      if (!had_mesh) bedlevel.set_grid({ 20, 20 }, { 10, 10 });
+    #endif
+
+    auto plane = [](const float x, const float y) { return 0.002f * x - 0.003f * y + 0.1f; };
+    GRID_LOOP(x, y) bedlevel.z_values[x][y] = plane(bedlevel.get_mesh_x(x), bedlevel.get_mesh_y(y));
+    TERN_(AUTO_BED_LEVELING_BILINEAR, bedlevel.refresh_bed_level());
+
+    const xy_pos_t lo = { bedlevel.get_mesh_x(0), bedlevel.get_mesh_y(0) },
+                   hi = { bedlevel.get_mesh_x(GRID_MAX_POINTS_X - 1), bedlevel.get_mesh_y(GRID_MAX_POINTS_Y - 1) };
+
+    uint16_t calls = 0, fails = 0;
+    uint32_t us = 0, seed = 1;
+    for (uint16_t i = 0; i < 200; ++i) {
+      seed = seed * 1103515245UL + 12345UL;
+      const xy_pos_t pos = { lo.x + (hi.x - lo.x) * ((seed >> 8) & 0xFF) / 255.0f,
+                             lo.y + (hi.y - lo.y) * ((seed >> 16) & 0xFF) / 255.0f };
+      const uint32_t start_us = micros();
+      const float z = bedlevel.get_z_correction(pos);
+      us += micros() - start_us;
+      ++calls;
+      if (ABS(z - plane(pos.x, pos.y)) > 0.0005f) {
+        ++fails;
+        SERIAL_ECHOPGM("FAIL X", pos.x, " Y", pos.y, " Z");
+        SERIAL_PRINT(z, 4);
+        SERIAL_ECHOPGM(" expected:");
+        SERIAL_PRINT(plane(pos.x, pos.y), 4);
+        SERIAL_EOL();
+      }
+    }
+
+    COPY(bedlevel.z_values, saved_z);
+    #if ENABLED(AUTO_BED_LEVELING_BILINEAR)
+      if (!had_mesh) { bedlevel.grid_spacing = saved_spacing; bedlevel.grid_start = saved_start; }
+      bedlevel.refresh_bed_level();
+    #endif
+
+    SERIAL_ECHOLNPGM("Mesh interpolation: ", calls - fails, "/", calls, " on the plane");
+    test_timing(F("Mesh interpolation"), us, calls, TERN(__AVR__, 250, 25));
+  }
+
+#endif
+
 // Startup tests are run at the end of setup()
 void runStartupTests() {
   // Call post-setup tests here to validate behaviors.
+  test_decimal_scanner();
+  test_parser();
+  #if HAS_HOTEND && TEMP_SENSOR_0_IS_THERMISTOR
+    test_thermistor();
+  #endif
+  #if ANY(AUTO_BED_LEVELING_BILINEAR, MESH_BED_LEVELING)
+    test_mesh_interpolation();
+  #endif
+  planner.test_trapezoids();
+  TERN_(PLANNER_FIXED_POINT, planner.test_fixed_point_trapezoids());
+  TERN_(PLANNER_BENCHMARK, planner_benchmark.run());
 }
 
 // Periodic tests are run from within loop()
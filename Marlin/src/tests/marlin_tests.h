@@ -23,3 +23,6 @@
 
 void runStartupTests();
 void runPeriodicTests();
+
+// Report the time per call of a test and flag it if over budget
+bool test_timing(FSTR_P const name, const uint32_t us, const uint32_t calls, const uint32_t budget_us);
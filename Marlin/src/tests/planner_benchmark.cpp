@@ -0,0 +1,302 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * planner_benchmark.cpp - Planner throughput benchmark
+ *
+ * Each pattern is generated line by line, pushed into the G-code queue and
+ * executed by GcodeSuite, so parsing, prepare_line_to_destination() and the
+ * planner are all counted. Instead of the Stepper ISR, a simulated stepper
+ * takes each block once the time to execute the previous ones has passed.
+ *
+ * Reported for each pattern:
+ *  - Blocks per second of planning time (time spent in GCodeQueue::advance)
+ *  - Time per block, and recalculate() time from PLANNER_TELEMETRY
+ *  - How full the block buffer was whenever a block was taken
+ *  - Underruns, where the simulated stepper found the buffer empty
+ *  - Junctions where the exit speed of one block differs from the entry
+ *    speed of the next, and the largest step rate jump between blocks
+ */
+
+#include "../inc/MarlinConfigPre.h"
+
+#if ALL(MARLIN_TEST_BUILD, PLANNER_BENCHMARK)
+
+#include "planner_benchmark.h"
+
+#include "../MarlinCore.h"
+#include "../gcode/gcode.h"
+#include "../gcode/queue.h"
+#include "../module/motion.h"
+#include "../module/planner.h"
+#include "../module/temperature.h"
+
+PlannerBenchmark planner_benchmark;
+
+bool PlannerBenchmark::active; // = false
+
+enum BenchPattern : uint8_t { BENCH_PERIMETERS, BENCH_ENGRAVING, BENCH_INFILL, BENCH_COUNT };
+
+PGMSTR(bench_str_perimeters, "perimeters");
+PGMSTR(bench_str_engraving, "engraving");
+PGMSTR(bench_str_infill, "infill");
+static PGM_P const pattern_name[BENCH_COUNT] PROGMEM = { bench_str_perimeters, bench_str_engraving, bench_str_infill };
+
+static struct {
+  uint32_t start_us,          // micros() when the pattern started
+           stepper_us,        // Simulated time when the stepper finishes its current block
+           plan_us,           // Time spent in GCodeQueue::advance
+           blocks,            // Blocks taken by the simulated stepper
+           occupancy_total,   // Sum of movesplanned() for each block taken
+           recalc_total_us;
+  uint16_t occupancy[BLOCK_BUFFER_SIZE],
+           underruns,
+           discontinuities,
+           max_recalc_us;
+  uint32_t max_rate_jump;
+  float last_exit_speed;      // mm/s at the end of the last block taken (< 0 = none)
+  uint32_t last_final_rate;
+  bool feeding,               // The pattern still has lines to send
+       running;               // The simulated stepper has a block
+} bench;
+
+// Append " <axis><value>" with three decimals
+static char* append_coord(char *p, const char axis, const float v) {
+  int32_t um = LROUND(v * 1000.0f);
+  *p++ = ' ';
+  *p++ = axis;
+  if (um < 0) { *p++ = '-'; um = -um; }
+  return p + sprintf_P(p, PSTR("%lu.%03u"), (unsigned long)(um / 1000), unsigned(um % 1000));
+}
+
+/**
+ * Build line 'n' of a pattern. Return false when the pattern is done.
+ *
+ *  perimeters : Lobed loops of 4° segments, like the outer walls of a boat hull
+ *  engraving  : Random walk of 0.1-0.5mm strokes with sharp turns, like small text
+ *  infill     : 30mm zigzag lines 0.45mm apart
+ */
+static bool make_line(const BenchPattern pattern, const uint16_t n, char * const buf) {
+  static float x, y, heading;
+  static uint32_t seed;
+  constexpr float e_per_mm = 0.0333f;   // 0.4 x 0.2mm line from 1.75mm filament
+
+  char *p = buf;
+  switch (pattern) {
+    case BENCH_PERIMETERS: {
+      constexpr uint16_t segs = 90, loops = 4;
+      if (n > segs * loops) return false;
+      const uint8_t loop = n / segs;
+      const float a = RADIANS(4.0f) * (n % segs),
+                  r = (6.0f + 5.0f * (loop < loops ? loop : loops - 1)) * (1.0f + 0.15f * sin(3.0f * a)),
+                  nx = X_CENTER + r * cos(a), ny = Y_CENTER + r * sin(a);
+      if (n == 0)
+        p += sprintf_P(p, PSTR("G0 F9000"));
+      else {
+        p += sprintf_P(p, PSTR("G1 F3600"));
+        p = append_coord(p, 'E', e_per_mm * HYPOT(nx - x, ny - y));
+      }
+      p = append_coord(p, 'X', nx);
+      p = append_coord(p, 'Y', ny);
+      x = nx; y = ny;
+    } break;
+
+    case BENCH_ENGRAVING: {
+      if (n > 600) return false;
+      if (n == 0) {
+        x = X_CENTER; y = Y_CENTER; heading = 0; seed = 1;
+        p += sprintf_P(p, PSTR("G0 F9000"));
+      }
+      else {
+        seed = seed * 1103515245UL + 12345UL;
+        const uint8_t r = seed >> 16;
+        const float len = 0.1f + 0.1f * (r % 5);
+        heading += RADIANS(45.0f) * int8_t((r >> 3) % 7 - 3);
+        x += len * cos(heading);
+        y += len * sin(heading);
+        // Stay within a 30mm square, like a line of text
+        if (ABS(x - (X_CENTER)) > 15.0f || ABS(y - (Y_CENTER)) > 15.0f) heading += RADIANS(180.0f);
+        p += sprintf_P(p, PSTR("G1 F3000"));
+      }
+      p = append_coord(p, 'X', x);
+      p = append_coord(p, 'Y', y);
+    } break;
+
+    case BENCH_INFILL: {
+      constexpr uint16_t lines = 60;
+      constexpr float len = 30.0f, spacing = 0.45f;
+      if (n > lines * 2) return false;
+      const float x0 = X_CENTER - len / 2, y0 = Y_CENTER - lines * spacing / 2;
+      float nx, ny;
+      if (n == 0) { nx = x0; ny = y0; }
+      else {
+        const uint16_t i = (n - 1) / 2;
+        ny = y0 + spacing * (i + (n & 1 ? 0 : 1));
+        nx = (i & 1) ? x0 : x0 + len;
+      }
+      p += sprintf_P(p, n ? PSTR("G1 F9000") : PSTR("G0 F9000"));
+      if (n) p = append_coord(p, 'E', e_per_mm * HYPOT(nx - x, ny - y));
+      p = append_coord(p, 'X', nx);
+      p = append_coord(p, 'Y', ny);
+      x = nx; y = ny;
+    } break;
+
+    default: return false;
+  }
+  return true;
+}
+
+// Time to run a block at its planned rates, in µs
+static uint32_t block_time_us(const block_t * const b) {
+  const float vi = b->initial_rate, vn = b->nominal_rate, vf = b->final_rate,
+              accel_steps = b->accelerate_until,
+              cruise_steps = b->decelerate_after - b->accelerate_until,
+              decel_steps = b->step_event_count - b->decelerate_after;
+  return 1e6f * (2.0f * accel_steps / (vi + vn) + cruise_steps / vn + 2.0f * decel_steps / (vn + vf));
+}
+
+void PlannerBenchmark::consume() {
+  static bool busy; // idle() may be called while consuming
+  if (busy) return;
+  busy = true;
+
+  const uint32_t now = (micros() - bench.start_us) * (PLANNER_BENCHMARK_TIME_SCALE);
+
+  while (int32_t(now - bench.stepper_us) >= 0) {
+    const uint8_t queued = planner.movesplanned();
+    block_t * const b = planner.get_current_block();
+    if (!b) {
+      if (!queued) {
+        if (bench.running && bench.feeding) ++bench.underruns;
+        bench.running = false;
+        bench.last_exit_speed = -1;
+        bench.stepper_us = now;
+      }
+      break;
+    }
+
+    if (b->is_move()) {
+      const float inv_steps = b->millimeters / b->step_event_count,
+                  entry_speed = b->initial_rate * inv_steps;
+
+      // Compare the junction with the previous block
+      if (bench.last_exit_speed >= 0) {
+        if (ABS(entry_speed - bench.last_exit_speed) > _MAX(1.0f, 0.05f * _MAX(entry_speed, bench.last_exit_speed)))
+          ++bench.discontinuities;
+        const uint32_t jump = b->initial_rate > bench.last_final_rate ? b->initial_rate - bench.last_final_rate : bench.last_final_rate - b->initial_rate;
+        NOLESS(bench.max_rate_jump, jump);
+      }
+      bench.last_exit_speed = b->final_rate * inv_steps;
+      bench.last_final_rate = b->final_rate;
+
+      ++bench.occupancy[_MIN(queued, BLOCK_BUFFER_SIZE - 1)];
+      bench.occupancy_total += queued;
+      ++bench.blocks;
+
+      #if ENABLED(PLANNER_TELEMETRY)
+        const uint16_t recalc_us = planner.telemetry.ring[b->telemetry_index].recalc_us;
+        bench.recalc_total_us += recalc_us;
+        NOLESS(bench.max_recalc_us, recalc_us);
+      #endif
+
+      // Before the first block the stepper started at 'now'
+      if (!bench.running) bench.stepper_us = now;
+      bench.stepper_us += block_time_us(b);
+      bench.running = true;
+    }
+
+    planner.release_current_block();
+  }
+
+  busy = false;
+}
+
+void PlannerBenchmark::run() {
+  planner.synchronize();
+
+  const xyze_pos_t saved_position = current_position;
+  const feedRate_t saved_feedrate = feedrate_mm_s;
+  const relative_t saved_relative = gcode.axis_relative;
+  TERN_(PREVENT_COLD_EXTRUSION, const bool saved_cold = thermalManager.allow_cold_extrude);
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = true);
+
+  SERIAL_ECHOLNPGM("Planner benchmark (time scale x", PLANNER_BENCHMARK_TIME_SCALE, ")");
+
+  active = true;
+
+  for (uint8_t i = 0; i < BENCH_COUNT; ++i) {
+    const BenchPattern pattern = BenchPattern(i);
+
+    memset(&bench, 0, sizeof(bench));
+    bench.last_exit_speed = -1;
+    bench.feeding = true;
+    bench.start_us = micros();
+
+    char line[MAX_CMD_SIZE];
+    uint16_t lines = 0;
+
+    auto send = [&](const char * const cmd) {
+      // Give the planner room for a held move and the new one
+      while (planner.moves_free() < 2) idle();
+      idle();
+      queue.ring_buffer.enqueue(cmd);
+      const uint32_t t = micros();
+      queue.advance();
+      bench.plan_us += micros() - t;
+      ++lines;
+    };
+
+    send("G90");
+    send("M83");
+    for (uint16_t n = 0; make_line(pattern, n, line); ++n) send(line);
+    bench.feeding = false;
+    send("M400");
+
+    const uint32_t total_ms = (micros() - bench.start_us) / 1000UL;
+
+    SERIAL_ECHOPGM("Planner benchmark ");
+    SERIAL_ECHOPGM_P((PGM_P)pgm_read_ptr(&pattern_name[i]));
+    SERIAL_ECHOLNPGM(": ", lines, " lines, ", bench.blocks, " blocks in ", total_ms, "ms");
+    if (bench.blocks) {
+      SERIAL_ECHOLNPGM("  Planning: ", bench.plan_us / bench.blocks, "us/block, ",
+        bench.plan_us ? uint32_t(1e6f * bench.blocks / bench.plan_us) : 0UL, " blocks/s"
+        #if ENABLED(PLANNER_TELEMETRY)
+          , "  recalculate() avg ", bench.recalc_total_us / bench.blocks, "us, max ", bench.max_recalc_us, "us"
+        #endif
+      );
+      SERIAL_ECHOPGM("  Buffer occupancy avg ", float(bench.occupancy_total) / bench.blocks, " of ", BLOCK_BUFFER_SIZE - 1, ", histogram:");
+      for (uint8_t o = 0; o < BLOCK_BUFFER_SIZE; ++o) SERIAL_ECHOPGM(" ", bench.occupancy[o]);
+      SERIAL_EOL();
+    }
+    SERIAL_ECHOLNPGM("  Underruns: ", bench.underruns, "  Discontinuities: ", bench.discontinuities, "  Max rate jump: ", bench.max_rate_jump, " steps/s");
+  }
+
+  active = false;
+
+  current_position = saved_position;
+  sync_plan_position();
+  feedrate_mm_s = saved_feedrate;
+  gcode.axis_relative = saved_relative;
+  TERN_(PREVENT_COLD_EXTRUSION, thermalManager.allow_cold_extrude = saved_cold);
+}
+
+#endif // MARLIN_TEST_BUILD && PLANNER_BENCHMARK
@@ -0,0 +1,44 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2022 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * planner_benchmark.h - Feed generated G-code through the queue and planner
+ *
+ * A simulated stepper takes the planned blocks in (scaled) real time, so the
+ * buffer fills and drains the way it would with the motors running.
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class PlannerBenchmark {
+public:
+  static bool active;                     // Blocks go to the simulated stepper, not the Stepper ISR
+
+  static void run();                      // Run all patterns and report the results
+  static void idle() { if (active) consume(); }
+
+private:
+  static void consume();                  // Take the blocks the simulated stepper would have finished by now
+};
+
+extern PlannerBenchmark planner_benchmark;
@@ -0,0 +1,59 @@
+#
+# post:sram-report.py
+# List the static RAM used by each subsystem after the build,
+# and fail the build if the total exceeds SRAM_BUDGET.
+#
+import pioutil
+if pioutil.is_pio_build():
+
+    import re,subprocess
+    from pathlib import Path
+    Import("env")
+
+    # Demangled symbol patterns for each subsystem, matched in order
+    sram_groups = [
+        ("Planner / Stepper",  r"\b(Planner|planner|Stepper|stepper)\b"),
+        ("Command queue",      r"\b(GCodeQueue|queue|GCodeParser|parser)\b"),
+        ("MeatPack",           r"(?i)meatpack"),
+        ("Serial buffers",     r"(?i)serial"),
+        ("Touchscreen",        r"(Anycubic|TFT)"),
+        ("Bed leveling",       r"(bedlevel|Leveling|unified_bed_leveling|z_values)"),
+        ("SD card",            r"\b(CardReader|card|Sd2Card|SdFile|SdBaseFile|SdVolume|DiskIODriver\w*)\b"),
+        ("Temperature",        r"\b(Temperature|thermalManager)\b")
+    ]
+
+    def sram_report(source, target, env):
+        mf = env['MARLIN_FEATURES']
+        elf = Path(target[0].get_abspath()).with_suffix('.elf')
+        nm = re.sub(r"gcc$", "nm", env.subst("$CC"))
+        try:
+            out = subprocess.check_output([nm, "-C", "-S", "--size-sort", str(elf)]).decode()
+        except (OSError, subprocess.CalledProcessError) as e:
+            print("SRAM report skipped: %s" % e)
+            return 0
+
+        sizes = { name: 0 for name, _ in sram_groups }
+        sizes["Other"] = 0
+        for line in out.splitlines():
+            parts = line.split(None, 3)
+            # Keep .data and .bss symbols only
+            if len(parts) < 4 or parts[2] not in "bBdD": continue
+            size, symbol = int(parts[1], 16), parts[3]
+            group = next((name for name, patt in sram_groups if re.search(patt, symbol)), "Other")
+            sizes[group] += size
+
+        total = sum(sizes.values())
+        print("Static RAM by subsystem:")
+        for name, size in sorted(sizes.items(), key=lambda x: -x[1]):
+            if size: print("  %-20s %6d" % (name, size))
+        print("  %-20s %6d" % ("Total", total))
+
+        if 'SRAM_BUDGET' in mf:
+            budget = int(mf['SRAM_BUDGET'])
+            if total > budget:
+                print("Error: Static RAM (%d bytes) exceeds SRAM_BUDGET (%d bytes)." % (total, budget))
+                return 1
+        return 0
+
+    if 'SRAM_REPORT' in env.get('MARLIN_FEATURES', {}):
+        env.AddPostAction(str(Path("$BUILD_DIR", "${PROGNAME}.elf")), sram_report)